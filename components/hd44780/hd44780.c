@@ -37,6 +37,7 @@
  * BSD Licensed as described in the file LICENSE
  */
 #include <string.h>
+#include <sdkconfig.h>
 #include <esp_system.h>
 #include <esp_idf_lib_helpers.h>
 #include <ets_sys.h>
@@ -92,6 +93,7 @@ static const uint8_t line_addr[] = { 0x00, 0x40, 0x14, 0x54 };
 
 static esp_err_t write_nibble(const hd44780_t *lcd, uint8_t b, bool rs)
 {
+#if CONFIG_HD44780_WRITE_CB
     if (lcd->write_cb)
     {
         uint8_t data = (((b >> 3) & 1) << lcd->pins.d7)
@@ -99,12 +101,16 @@ static esp_err_t write_nibble(const hd44780_t *lcd, uint8_t b, bool rs)
                      | (((b >> 1) & 1) << lcd->pins.d5)
                      | ((b & 1) << lcd->pins.d4)
                      | (rs ? 1 << lcd->pins.rs : 0)
-                     | (lcd->backlight ? 1 << lcd->pins.bl : 0);
+#if CONFIG_HD44780_BACKLIGHT
+                     | (lcd->backlight ? 1 << lcd->pins.bl : 0)
+#endif
+                     ;
         CHECK(lcd->write_cb(lcd, data | (1 << lcd->pins.e)));
         toggle_delay();
         CHECK(lcd->write_cb(lcd, data));
     }
     else
+#endif
     {
         CHECK(gpio_set_level(lcd->pins.rs, rs));
         ets_delay_us(1); // Address Setup time >= 60ns.
@@ -131,6 +137,10 @@ static esp_err_t write_byte(const hd44780_t *lcd, uint8_t b, bool rs)
 esp_err_t hd44780_init(const hd44780_t *lcd)
 {
     CHECK_ARG(lcd && lcd->lines > 0 && lcd->lines < 5);
+#if !CONFIG_HD44780_WRITE_CB
+    if (lcd->write_cb)
+        return ESP_ERR_NOT_SUPPORTED;
+#endif
 
     if (!lcd->write_cb)
     {
@@ -144,8 +154,10 @@ esp_err_t hd44780_init(const hd44780_t *lcd)
                 GPIO_BIT(lcd->pins.d5) |
                 GPIO_BIT(lcd->pins.d6) |
                 GPIO_BIT(lcd->pins.d7);
+#if CONFIG_HD44780_BACKLIGHT
         if (lcd->pins.bl != HD44780_NOT_USED)
             io_conf.pin_bit_mask |= GPIO_BIT(lcd->pins.bl);
+#endif
         CHECK(gpio_config(&io_conf));
     }
 
@@ -236,25 +248,48 @@ esp_err_t hd44780_puts(const hd44780_t *lcd, const char *s)
     return ESP_OK;
 }
 
+esp_err_t hd44780_write_nibble(const hd44780_t *lcd, uint8_t nibble, bool rs)
+{
+    CHECK_ARG(lcd);
+
+    return write_nibble(lcd, nibble, rs);
+}
+
+esp_err_t hd44780_write_byte(const hd44780_t *lcd, uint8_t b, bool rs)
+{
+    CHECK_ARG(lcd);
+
+    return write_byte(lcd, b, rs);
+}
+
 esp_err_t hd44780_switch_backlight(hd44780_t *lcd, bool on)
 {
     CHECK_ARG(lcd);
+#if CONFIG_HD44780_BACKLIGHT
     if (lcd->pins.bl == HD44780_NOT_USED)
         return ESP_ERR_NOT_SUPPORTED;
 
-    if (!lcd->write_cb)
-        CHECK(gpio_set_level(lcd->pins.bl, on));
-    else
+#if CONFIG_HD44780_WRITE_CB
+    if (lcd->write_cb)
         CHECK(lcd->write_cb(lcd, on ? BV(lcd->pins.bl) : 0));
+    else
+#endif
+        CHECK(gpio_set_level(lcd->pins.bl, on));
 
     lcd->backlight = on;
 
     return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
 }
 
 esp_err_t hd44780_upload_character(const hd44780_t *lcd, uint8_t num, const uint8_t *data)
 {
     CHECK_ARG(lcd && data && num < 8);
+#if !CONFIG_HD44780_CGRAM
+    return ESP_ERR_NOT_SUPPORTED;
+#else
 
     uint8_t bytes = lcd->font == HD44780_FONT_5X8 ? 8 : 10;
     CHECK(write_byte(lcd, CMD_CGRAM_ADDR + num * bytes, false));
@@ -268,6 +303,7 @@ esp_err_t hd44780_upload_character(const hd44780_t *lcd, uint8_t num, const uint
     CHECK(hd44780_gotoxy(lcd, 0, 0));
 
     return ESP_OK;
+#endif
 }
 
 esp_err_t hd44780_scroll_left(const hd44780_t *lcd)
@@ -93,7 +93,8 @@ struct hd44780
  * Set cursor position to (0, 0)
  *
  * @param lcd LCD descriptor
- * @return `ESP_OK` on success
+ * @return `ESP_OK` on success,
+ *         `ESP_ERR_NOT_SUPPORTED` if `write_cb` is set without CONFIG_HD44780_WRITE_CB
  */
 esp_err_t hd44780_init(const hd44780_t *lcd);
 
@@ -148,12 +149,39 @@ esp_err_t hd44780_putc(const hd44780_t *lcd, char c);
  */
 esp_err_t hd44780_puts(const hd44780_t *lcd, const char *s);
 
+/**
+ * @brief Clock one 4-bit nibble onto the bus (no command delay)
+ *
+ * Low-level bus access for benchmarks. Sending an odd number of nibbles
+ * leaves the display out of 4-bit sync until hd44780_init() is called.
+ *
+ * @param lcd LCD descriptor
+ * @param nibble Value in the low 4 bits
+ * @param rs Data (true) or command (false) register
+ * @return `ESP_OK` on success
+ */
+esp_err_t hd44780_write_nibble(const hd44780_t *lcd, uint8_t nibble, bool rs);
+
+/**
+ * @brief Clock one byte onto the bus as two nibbles (no command delay)
+ *
+ * Low-level bus access for benchmarks. The caller waits out the command
+ * execution time before the next access.
+ *
+ * @param lcd LCD descriptor
+ * @param b Byte to write
+ * @param rs Data (true) or command (false) register
+ * @return `ESP_OK` on success
+ */
+esp_err_t hd44780_write_byte(const hd44780_t *lcd, uint8_t b, bool rs);
+
 /**
  * @brief Switch backlight
  *
  * @param lcd LCD descriptor
  * @param on Turn backlight on if true
- * @return `ESP_OK` on success
+ * @return `ESP_OK` on success,
+ *         `ESP_ERR_NOT_SUPPORTED` without a backlight pin or CONFIG_HD44780_BACKLIGHT
  */
 esp_err_t hd44780_switch_backlight(hd44780_t *lcd, bool on);
 
@@ -165,7 +193,8 @@ esp_err_t hd44780_switch_backlight(hd44780_t *lcd, bool on);
  * @param lcd LCD descriptor
  * @param num Character number (0..7)
  * @param data Character data: 8 or 10 bytes depending on the font
- * @return `ESP_OK` on success
+ * @return `ESP_OK` on success,
+ *         `ESP_ERR_NOT_SUPPORTED` without CONFIG_HD44780_CGRAM
  */
 esp_err_t hd44780_upload_character(const hd44780_t *lcd, uint8_t num, const uint8_t *data);
 
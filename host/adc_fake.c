@@ -0,0 +1,401 @@
+/**
+ * @file adc_fake.c
+ * @brief Continuous ADC fed by the thermal plant and fixed probes
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * A producer thread stands in for the DMA engine: every frame period it
+ * advances the plant to the current time, converts one frame with the scan
+ * pattern, stores it in the driver pool and calls on_conv_done. Like the
+ * driver, the handle holds an APB_FREQ_MAX lock ("adc_dma") while running.
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "esp_adc/adc_continuous.h"
+#include "esp_adc/adc_cali_scheme.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "adc_synth.h"
+#include "heater_pid.h"
+#include "temp_lut.h"
+#include "thermal_plant.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define ADC_FAKE_NOISE_LSB          1.5     // Same as grill_sim
+#define ADC_FAKE_SEED               1
+
+/* ==================== DATA TYPES ==================== */
+
+struct adc_continuous_ctx_t {
+    adc_continuous_handle_cfg_t handle_config;
+    adc_digi_pattern_config_t pattern[SOC_ADC_PATT_LEN_MAX];
+    uint32_t pattern_num;
+    uint32_t sample_freq_hz;
+    adc_continuous_evt_cbs_t callbacks;
+    void *user_data;
+
+    uint8_t *pool;              // Ring of whole frames
+    uint32_t pool_frames;
+    uint32_t pool_head;         // Oldest frame
+    uint32_t pool_count;
+    uint32_t pattern_index;     // Next pattern entry to convert
+
+    bool running;
+    pthread_t thread;
+    pthread_mutex_t lock;
+    esp_pm_lock_handle_t pm_lock;
+};
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_mutex_t plant_lock = PTHREAD_MUTEX_INITIALIZER;
+static thermal_plant_t plant;
+static adc_synth_t synth;
+static int64_t plant_time_us = -1;          // -1: not initialised
+static double probe_fixed_c[IDF_FAKE_PROBES] = {
+    NAN, IDF_FAKE_PROBE_DEFAULT_C, IDF_FAKE_PROBE_DEFAULT_C, IDF_FAKE_PROBE_DEFAULT_C,
+};
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/* ---------- Plant and probes (plant_lock held) ---------- */
+
+static void plant_catch_up(void)
+{
+    int64_t now_us = esp_timer_get_time();
+
+    if (plant_time_us < 0) {
+        thermal_plant_config_t config;
+        thermal_plant_default_config(&config);
+        thermal_plant_init(&plant, &config);
+        adc_synth_init(&synth, 1.0, ADC_FAKE_NOISE_LSB, 0.0, ADC_FAKE_SEED);
+        plant_time_us = now_us;
+    }
+    thermal_plant_advance(&plant, (double)(now_us - plant_time_us) / 1e6);
+    plant_time_us = now_us;
+}
+
+static uint16_t probe_code(int zone)
+{
+    if (zone < IDF_FAKE_PROBES && !isnan(probe_fixed_c[zone])) {
+        // Same sensor and ADC model as the plant's own probe
+        thermal_plant_t fixed = plant;
+        fixed.probe_c = probe_fixed_c[zone];
+        return (uint16_t)thermal_plant_adc_code(&fixed, &synth, 0);
+    }
+    if (zone == 0) {
+        return (uint16_t)thermal_plant_adc_code(&plant, &synth, 0);
+    }
+    return 0;       // Unconnected input
+}
+
+esp_err_t idf_fake_set_probe(int zone, double celsius)
+{
+    if (zone < 0 || zone >= IDF_FAKE_PROBES || (zone > 0 && isnan(celsius))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&plant_lock);
+    probe_fixed_c[zone] = celsius;
+    pthread_mutex_unlock(&plant_lock);
+    return ESP_OK;
+}
+
+void idf_fake_set_lid(bool open)
+{
+    pthread_mutex_lock(&plant_lock);
+    plant_catch_up();
+    thermal_plant_set_lid(&plant, open);
+    pthread_mutex_unlock(&plant_lock);
+}
+
+void idf_fake_set_heater(double duty)
+{
+    pthread_mutex_lock(&plant_lock);
+    plant_catch_up();
+    thermal_plant_set_duty(&plant, (int32_t)lround(duty * HEATER_PID_OUTPUT_MAX));
+    pthread_mutex_unlock(&plant_lock);
+}
+
+void idf_fake_plant(double *probe_c, double *patty_c, double *plate_c, double *duty)
+{
+    pthread_mutex_lock(&plant_lock);
+    plant_catch_up();
+    *probe_c = isnan(probe_fixed_c[0]) ? plant.probe_c : probe_fixed_c[0];
+    *patty_c = plant.patty_c;
+    *plate_c = plant.plate_c;
+    *duty = plant.duty;
+    pthread_mutex_unlock(&plant_lock);
+}
+
+/* ---------- Continuous driver ---------- */
+
+/**
+ * @brief Convert one frame in the ESP32-S3 result layout
+ */
+static void convert_frame(adc_continuous_handle_t handle, uint8_t *frame)
+{
+    uint32_t samples = handle->handle_config.conv_frame_size / SOC_ADC_DIGI_RESULT_BYTES;
+
+    pthread_mutex_lock(&plant_lock);
+    plant_catch_up();
+    for (uint32_t i = 0; i < samples; i++) {
+        const adc_digi_pattern_config_t *entry = &handle->pattern[handle->pattern_index];
+        adc_digi_output_data_t result = { .val = 0 };
+
+        // Pattern entry n scans zone n (grill_zones lists the channels in zone order)
+        result.type2.data = probe_code((int)handle->pattern_index);
+        result.type2.channel = entry->channel;
+        result.type2.unit = entry->unit;
+        memcpy(frame + (size_t)i * SOC_ADC_DIGI_RESULT_BYTES, &result, SOC_ADC_DIGI_RESULT_BYTES);
+        handle->pattern_index = (handle->pattern_index + 1) % handle->pattern_num;
+    }
+    pthread_mutex_unlock(&plant_lock);
+}
+
+static void *adc_dma_thread(void *arg)
+{
+    adc_continuous_handle_t handle = arg;
+    uint32_t frame_bytes = handle->handle_config.conv_frame_size;
+    uint64_t period_ns = (uint64_t)(frame_bytes / SOC_ADC_DIGI_RESULT_BYTES) * 1000000000ULL /
+                         handle->sample_freq_hz;
+    uint8_t *frame = malloc(frame_bytes);
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    while (frame != NULL && __atomic_load_n(&handle->running, __ATOMIC_ACQUIRE)) {
+        uint64_t nsec = (uint64_t)deadline.tv_nsec + period_ns;
+        deadline.tv_sec += (time_t)(nsec / 1000000000ULL);
+        deadline.tv_nsec = (long)(nsec % 1000000000ULL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+        }
+
+        convert_frame(handle, frame);
+
+        pthread_mutex_lock(&handle->lock);
+        bool stored = handle->pool_count < handle->pool_frames;
+        if (stored) {
+            uint32_t slot = (handle->pool_head + handle->pool_count) % handle->pool_frames;
+            memcpy(handle->pool + (size_t)slot * frame_bytes, frame, frame_bytes);
+            handle->pool_count++;
+        }
+        pthread_mutex_unlock(&handle->lock);
+
+        adc_continuous_evt_data_t edata = {
+            .conv_frame_buffer = frame,
+            .size = frame_bytes,
+        };
+        if (!stored && handle->callbacks.on_pool_ovf != NULL) {
+            handle->callbacks.on_pool_ovf(handle, &edata, handle->user_data);
+        } else if (stored && handle->callbacks.on_conv_done != NULL) {
+            handle->callbacks.on_conv_done(handle, &edata, handle->user_data);
+        }
+    }
+    free(frame);
+    return NULL;
+}
+
+esp_err_t adc_continuous_new_handle(const adc_continuous_handle_cfg_t *hdl_config,
+                                    adc_continuous_handle_t *ret_handle)
+{
+    if (hdl_config == NULL || ret_handle == NULL || hdl_config->conv_frame_size == 0 ||
+        hdl_config->conv_frame_size % SOC_ADC_DIGI_RESULT_BYTES != 0 ||
+        hdl_config->max_store_buf_size < hdl_config->conv_frame_size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    adc_continuous_handle_t handle = calloc(1, sizeof(*handle));
+    if (handle == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    handle->handle_config = *hdl_config;
+    handle->pool_frames = hdl_config->max_store_buf_size / hdl_config->conv_frame_size;
+    handle->pool = malloc((size_t)handle->pool_frames * hdl_config->conv_frame_size);
+    if (handle->pool == NULL) {
+        free(handle);
+        return ESP_ERR_NO_MEM;
+    }
+    pthread_mutex_init(&handle->lock, NULL);
+    if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "adc_dma", &handle->pm_lock) != ESP_OK) {
+        handle->pm_lock = NULL;
+    }
+    *ret_handle = handle;
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_config(adc_continuous_handle_t handle, const adc_continuous_config_t *config)
+{
+    if (handle == NULL || config == NULL || config->pattern_num == 0 ||
+        config->pattern_num > SOC_ADC_PATT_LEN_MAX || config->sample_freq_hz == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (handle->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    memcpy(handle->pattern, config->adc_pattern, config->pattern_num * sizeof(handle->pattern[0]));
+    handle->pattern_num = config->pattern_num;
+    handle->sample_freq_hz = config->sample_freq_hz;
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_register_event_callbacks(adc_continuous_handle_t handle,
+                                                  const adc_continuous_evt_cbs_t *cbs, void *user_data)
+{
+    if (handle == NULL || cbs == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (handle->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    handle->callbacks = *cbs;
+    handle->user_data = user_data;
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_start(adc_continuous_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (handle->running || handle->pattern_num == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (handle->pm_lock != NULL) {
+        esp_pm_lock_acquire(handle->pm_lock);
+    }
+    handle->running = true;
+    if (pthread_create(&handle->thread, NULL, adc_dma_thread, handle) != 0) {
+        handle->running = false;
+        if (handle->pm_lock != NULL) {
+            esp_pm_lock_release(handle->pm_lock);
+        }
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_stop(adc_continuous_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!handle->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    __atomic_store_n(&handle->running, false, __ATOMIC_RELEASE);
+    pthread_join(handle->thread, NULL);
+    if (handle->pm_lock != NULL) {
+        esp_pm_lock_release(handle->pm_lock);
+    }
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_flush_pool(adc_continuous_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (handle->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    pthread_mutex_lock(&handle->lock);
+    handle->pool_head = 0;
+    handle->pool_count = 0;
+    pthread_mutex_unlock(&handle->lock);
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_deinit(adc_continuous_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (handle->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (handle->pm_lock != NULL) {
+        esp_pm_lock_delete(handle->pm_lock);
+    }
+    pthread_mutex_destroy(&handle->lock);
+    free(handle->pool);
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t adc_continuous_read(adc_continuous_handle_t handle, uint8_t *buf, uint32_t length_max,
+                              uint32_t *out_length, uint32_t timeout_ms)
+{
+    uint32_t frame_bytes = handle->handle_config.conv_frame_size;
+    esp_err_t ret = ESP_ERR_TIMEOUT;    // The firmware polls (timeout 0): no blocking read
+
+    if (buf == NULL || out_length == NULL || length_max < frame_bytes) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&handle->lock);
+    if (handle->pool_count > 0) {
+        memcpy(buf, handle->pool + (size_t)handle->pool_head * frame_bytes, frame_bytes);
+        handle->pool_head = (handle->pool_head + 1) % handle->pool_frames;
+        handle->pool_count--;
+        *out_length = frame_bytes;
+        ret = ESP_OK;
+    }
+    pthread_mutex_unlock(&handle->lock);
+    return ret;
+}
+
+esp_err_t adc_continuous_parse_data(adc_continuous_handle_t handle, const uint8_t *raw_data,
+                                    uint32_t raw_data_size, adc_continuous_data_t *parsed_data,
+                                    uint32_t *num_parsed_samples)
+{
+    if (raw_data == NULL || parsed_data == NULL || num_parsed_samples == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t count = raw_data_size / SOC_ADC_DIGI_RESULT_BYTES;
+    for (uint32_t i = 0; i < count; i++) {
+        adc_digi_output_data_t result;
+        memcpy(&result, raw_data + (size_t)i * SOC_ADC_DIGI_RESULT_BYTES, SOC_ADC_DIGI_RESULT_BYTES);
+        parsed_data[i] = (adc_continuous_data_t) {
+            .unit = (adc_unit_t)result.type2.unit,
+            .channel = (adc_channel_t)result.type2.channel,
+            .raw_data = result.type2.data,
+            .valid = result.type2.channel < SOC_ADC_MAX_CHANNEL_NUM,
+        };
+    }
+    *num_parsed_samples = count;
+    return ESP_OK;
+}
+
+/* ---------- Calibration ---------- */
+
+esp_err_t adc_cali_create_scheme_curve_fitting(const adc_cali_curve_fitting_config_t *config,
+                                               adc_cali_handle_t *ret_handle)
+{
+    if (config == NULL || ret_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // Stateless: any non-NULL handle will do
+    *ret_handle = (adc_cali_handle_t)(uintptr_t)1;
+    return ESP_OK;
+}
+
+esp_err_t adc_cali_delete_scheme_curve_fitting(adc_cali_handle_t handle)
+{
+    return ESP_OK;
+}
+
+esp_err_t adc_cali_raw_to_voltage(adc_cali_handle_t handle, int raw, int *voltage)
+{
+    if (handle == NULL || voltage == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // The ideal linear response the default LUT assumes
+    *voltage = (raw * TEMP_LUT_DEFAULT_FULL_SCALE_MV + ADC_SYNTH_MAX_CODE / 2) / ADC_SYNTH_MAX_CODE;
+    return ESP_OK;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file adc_oversample_bench.c
+ * @brief Resolution and cost of the ADC oversampling decimator
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Feeds frames from the synthetic ADC source through the firmware's
+ * adc_decimator for every oversampling setting and reports the output rate,
+ * the RMS error against the ideal input, the effective resolution that error
+ * corresponds to, and the host CPU time per raw sample.
+ *
+ * Usage: adc_oversample_bench [--rate=HZ] [--noise=LSB] [--hum=LSB] [--readings=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "adc_decimator.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define DEFAULT_SAMPLE_RATE_HZ     20000   // Firmware ADC_SAMPLE_FREQ_HZ
+#define DEFAULT_NOISE_LSB          1.5     // Typical ESP32-S3 SAR noise at 12 dB
+#define DEFAULT_READINGS           2000
+#define FRAME_SAMPLES              256     // Firmware SAMPLER_FRAME_SAMPLES
+
+/* ==================== IMPLEMENTATION ==================== */
+
+int main(int argc, char **argv)
+{
+    double rate = DEFAULT_SAMPLE_RATE_HZ;
+    double noise = DEFAULT_NOISE_LSB;
+    double hum = 0.0;
+    long readings = DEFAULT_READINGS;
+
+    static const struct option options[] = {
+        { "rate",     required_argument, NULL, 'r' },
+        { "noise",    required_argument, NULL, 'n' },
+        { "hum",      required_argument, NULL, 'm' },
+        { "readings", required_argument, NULL, 'c' },
+        { "help",     no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'r': rate = strtod(optarg, NULL); break;
+            case 'n': noise = strtod(optarg, NULL); break;
+            case 'm': hum = strtod(optarg, NULL); break;
+            case 'c': readings = strtol(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "Usage: %s [--rate=HZ] [--noise=LSB] [--hum=LSB] [--readings=N]\n",
+                        argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    printf("Sample rate %.0f Hz, noise %.2f LSB rms, hum %.2f LSB\n", rate, noise, hum);
+    printf("%5s %6s %9s %12s %10s %12s\n",
+           "bits", "decim", "out_Hz", "rms_err_lsb", "eff_bits", "ns/sample");
+
+    for (uint8_t k = 0; k <= ADC_DECIMATOR_MAX_EXTRA_BITS; k++) {
+        adc_decimator_t dec;
+        adc_synth_t synth;
+        uint16_t frame[FRAME_SAMPLES];
+        double sq_err = 0.0;
+        long produced = 0;
+        uint64_t busy_ns = 0;
+        uint64_t samples = 0;
+
+        adc_decimator_init(&dec, k, 0);
+        adc_synth_init(&synth, rate, noise, hum, 12345 + k);
+
+        while (produced < readings) {
+            // A new ideal level per reading, away from the rails
+            double ideal = 200.0 + adc_synth_uniform(&synth) * 3600.0;
+            long remaining = dec.decimation;
+
+            while (remaining > 0) {
+                size_t n = remaining < FRAME_SAMPLES ? (size_t)remaining : FRAME_SAMPLES;
+                uint32_t out;
+
+                adc_synth_fill(&synth, ideal, frame, n);
+
+                uint64_t start = host_now_ns();
+                for (size_t i = 0; i < n; i++) {
+                    if (adc_decimator_push(&dec, frame[i], &out)) {
+                        double err = (double)out / (double)(1U << k) - ideal;
+                        sq_err += err * err;
+                        produced++;
+                    }
+                }
+                busy_ns += host_now_ns() - start;
+                samples += n;
+                remaining -= (long)n;
+            }
+        }
+
+        double rms = sqrt(sq_err / (double)produced);
+        // An ideal quantiser with step q has rms error q / sqrt(12)
+        double eff_bits = ADC_DECIMATOR_RAW_BITS - log2(rms * sqrt(12.0));
+
+        printf("%5u %6u %9.1f %12.4f %10.2f %12.2f\n",
+               (unsigned)adc_decimator_output_bits(&dec), dec.decimation,
+               rate / dec.decimation, rms, eff_bits, (double)busy_ns / (double)samples);
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file adc_synth.c
+ * @brief Synthetic 12-bit ADC sample source for host tools
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <math.h>
+#include "adc_synth.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+double adc_synth_uniform(adc_synth_t *synth)
+{
+    // xorshift64*
+    synth->rng ^= synth->rng >> 12;
+    synth->rng ^= synth->rng << 25;
+    synth->rng ^= synth->rng >> 27;
+    uint64_t r = synth->rng * 0x2545F4914F6CDD1DULL;
+    return (double)(r >> 11) * (1.0 / 9007199254740992.0);
+}
+
+double adc_synth_gaussian(adc_synth_t *synth)
+{
+    // Box-Muller; the second value is discarded to keep the state simple
+    double u1 = adc_synth_uniform(synth);
+    double u2 = adc_synth_uniform(synth);
+    if (u1 < 1e-300) {
+        u1 = 1e-300;
+    }
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+void adc_synth_init(adc_synth_t *synth, double sample_rate_hz, double noise_lsb,
+                    double hum_lsb, uint64_t seed)
+{
+    synth->sample_rate_hz = sample_rate_hz;
+    synth->noise_lsb = noise_lsb;
+    synth->hum_lsb = hum_lsb;
+    synth->hum_hz = 50.0;
+    synth->rng = seed ? seed : 0x9E3779B97F4A7C15ULL;
+    synth->index = 0;
+}
+
+uint16_t adc_synth_sample(adc_synth_t *synth, double ideal_code)
+{
+    double v = ideal_code;
+
+    if (synth->noise_lsb > 0.0) {
+        v += synth->noise_lsb * adc_synth_gaussian(synth);
+    }
+    if (synth->hum_lsb > 0.0) {
+        double t = (double)synth->index / synth->sample_rate_hz;
+        v += synth->hum_lsb * sin(2.0 * M_PI * synth->hum_hz * t);
+    }
+    synth->index++;
+
+    v = floor(v + 0.5);
+    if (v < 0.0) {
+        return 0;
+    }
+    if (v > ADC_SYNTH_MAX_CODE) {
+        return ADC_SYNTH_MAX_CODE;
+    }
+    return (uint16_t)v;
+}
+
+void adc_synth_fill(adc_synth_t *synth, double ideal_code, uint16_t *frame, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        frame[i] = adc_synth_sample(synth, ideal_code);
+    }
+}
@@ -0,0 +1,96 @@
+/**
+ * @file adc_synth.h
+ * @brief Synthetic 12-bit ADC sample source for host tools
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Turns an ideal (fractional) ADC code into the integer conversions a SAR ADC
+ * would return: white Gaussian noise, optional mains hum, rounding and
+ * clamping to the 12-bit range. Stands in for the DMA frames of the
+ * continuous ADC driver when exercising the sampling pipeline on the host.
+ */
+
+#ifndef ADC_SYNTH_H
+#define ADC_SYNTH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stddef.h>
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+/** @brief Largest 12-bit conversion result */
+#define ADC_SYNTH_MAX_CODE          4095
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Synthetic source state
+ */
+typedef struct {
+    double sample_rate_hz;  /**< Conversion rate, used for the hum phase */
+    double noise_lsb;       /**< Gaussian noise standard deviation in LSB */
+    double hum_lsb;         /**< Mains hum amplitude in LSB */
+    double hum_hz;          /**< Mains frequency */
+    uint64_t rng;           /**< Random generator state */
+    uint64_t index;         /**< Samples generated so far */
+} adc_synth_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Initialise a synthetic source
+ *
+ * @param synth Source to initialise
+ * @param sample_rate_hz Conversion rate
+ * @param noise_lsb Noise standard deviation in LSB
+ * @param hum_lsb 50 Hz hum amplitude in LSB (0 = none)
+ * @param seed Random seed
+ */
+void adc_synth_init(adc_synth_t *synth, double sample_rate_hz, double noise_lsb,
+                    double hum_lsb, uint64_t seed);
+
+/**
+ * @brief Produce one conversion of an ideal code
+ *
+ * @param synth Source
+ * @param ideal_code Fractional code the input voltage corresponds to
+ * @return Integer conversion result (0 to ADC_SYNTH_MAX_CODE)
+ */
+uint16_t adc_synth_sample(adc_synth_t *synth, double ideal_code);
+
+/**
+ * @brief Fill a frame with conversions of a constant ideal code
+ *
+ * @param synth Source
+ * @param ideal_code Fractional code for the whole frame
+ * @param frame Destination buffer
+ * @param count Number of conversions
+ */
+void adc_synth_fill(adc_synth_t *synth, double ideal_code, uint16_t *frame, size_t count);
+
+/**
+ * @brief Standard normal random number from the source's generator
+ *
+ * @param synth Source
+ * @return Sample of N(0, 1)
+ */
+double adc_synth_gaussian(adc_synth_t *synth);
+
+/**
+ * @brief Uniform random number in [0, 1) from the source's generator
+ *
+ * @param synth Source
+ * @return Uniform sample
+ */
+double adc_synth_uniform(adc_synth_t *synth);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_SYNTH_H */
@@ -0,0 +1,226 @@
+/**
+ * @file alarm_sim.c
+ * @brief Compare raw classification with the alarm engine on synthetic cooks
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Runs the built-in BEEF profile through three scenarios at the firmware's
+ * 2 Hz monitoring rate and at the 78 Hz filtered reading rate:
+ *
+ * - hover: 20 s at 24.5 C, then 10 min of noise around the 25/26 C band edge
+ * - ramp:  a steady 1 C/min climb from 18 C to 44 C
+ * - spike: a 12 C/min surge and recovery
+ *
+ * For each run it counts how often a plain per-sample classification would
+ * have changed label against the events the engine emits, and lists the
+ * events. Exits non-zero if hovering produces band changes after the first
+ * band, if the ramp does not walk through every band once, or if the event
+ * count depends on the sample rate.
+ *
+ * Usage: alarm_sim [--verbose] [--seed=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "doneness.h"
+#include "temp_alarm.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define HYSTERESIS_CENTI        50      // Matches main.c
+#define BAND_DWELL_MS           2000
+#define ALARM_DWELL_MS          3000
+#define RATE_LIMIT_CENTI_MIN    600     // 6 C/min
+#define RATE_HYSTERESIS         200
+
+/* ==================== DATA TYPES ==================== */
+
+typedef enum {
+    SCENARIO_HOVER = 0,
+    SCENARIO_RAMP,
+    SCENARIO_SPIKE,
+    SCENARIO_COUNT
+} scenario_t;
+
+typedef struct {
+    long samples;
+    long raw_changes;
+    long band_events;
+    long alarm_events;
+} run_result_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static const char *scenario_names[SCENARIO_COUNT] = { "hover", "ramp", "spike" };
+static const double scenario_seconds[SCENARIO_COUNT] = { 620.0, 1560.0, 600.0 };
+
+/**
+ * @brief Noiseless temperature of a scenario at time t
+ */
+static double scenario_celsius(scenario_t scenario, double t)
+{
+    switch (scenario) {
+        case SCENARIO_HOVER:
+            if (t < 20.0) return 24.5;      // Settle in the lower band first
+            return 25.95 + 0.1 * sin(t / 7.0);
+        case SCENARIO_RAMP:
+            return 18.0 + t / 60.0;
+        case SCENARIO_SPIKE:
+            if (t < 120.0) return 30.0;
+            if (t < 180.0) return 30.0 + (t - 120.0) * 12.0 / 60.0;     // +12 C in 1 min
+            if (t < 300.0) return 42.0 - (t - 180.0) * 12.0 / 120.0;    // back in 2 min
+            return 30.0;
+        default:
+            return 25.0;
+    }
+}
+
+static run_result_t run(const cook_profile_t *profile, scenario_t scenario, double rate_hz,
+                        uint64_t seed, bool verbose)
+{
+    static doneness_estimator_t trend;
+    temp_alarm_t alarm;
+    temp_alarm_event_t events[TEMP_ALARM_MAX_EVENTS];
+    adc_synth_t rng;
+    run_result_t result = { 0 };
+
+    const temp_alarm_config_t config = {
+        .hysteresis_centi = HYSTERESIS_CENTI,
+        .band_dwell_ms = BAND_DWELL_MS,
+        .alarm_dwell_ms = ALARM_DWELL_MS,
+        .rate_centi_per_min = RATE_LIMIT_CENTI_MIN,
+        .rate_hysteresis = RATE_HYSTERESIS,
+    };
+    temp_alarm_init(&alarm, &config, profile);
+    doneness_init(&trend);
+    adc_synth_init(&rng, rate_hz, 0.0, 0.0, seed);
+
+    // The trend window is sized in samples; feed it at the 2 Hz it was sized for
+    const long trend_every = rate_hz > 2.0 ? lround(rate_hz / 2.0) : 1;
+    uint8_t raw_previous = COOK_PROFILE_NO_BAND;
+    result.samples = (long)(scenario_seconds[scenario] * rate_hz);
+
+    for (long i = 0; i < result.samples; i++) {
+        const double t = (double)i / rate_hz;
+        const int64_t now_ms = (int64_t)llround(t * 1000.0);
+        const int32_t centi = (int32_t)lround((scenario_celsius(scenario, t) +
+                                               0.08 * adc_synth_gaussian(&rng)) * 100.0);
+
+        uint8_t raw = cook_profile_classify_centi(profile, centi);
+        if (i > 0 && raw != raw_previous) {
+            result.raw_changes++;
+        }
+        raw_previous = raw;
+
+        if (i % trend_every == 0) {
+            doneness_push(&trend, now_ms, centi);
+        }
+        float slope;
+        int32_t rate = TEMP_ALARM_RATE_UNKNOWN;
+        if (trend.count >= DONENESS_MIN_SAMPLES && doneness_slope(&trend, &slope) == ESP_OK) {
+            rate = (int32_t)lroundf(slope * 60000.0f);
+        }
+
+        size_t n = temp_alarm_update(&alarm, now_ms, centi, rate, events);
+        for (size_t e = 0; e < n; e++) {
+            const temp_alarm_event_t *ev = &events[e];
+            if (ev->type == TEMP_ALARM_EVENT_BAND) {
+                result.band_events++;
+            } else {
+                result.alarm_events++;
+            }
+            if (!verbose) {
+                continue;
+            }
+            if (ev->type == TEMP_ALARM_EVENT_BAND) {
+                printf("    %7.1fs %6.2f C  band %s -> %s\n", t, ev->centi / 100.0,
+                       ev->previous == COOK_PROFILE_NO_BAND ? "-" : cook_profile_band_name(profile, ev->previous),
+                       ev->id == COOK_PROFILE_NO_BAND ? "-" : cook_profile_band_name(profile, ev->id));
+            } else {
+                printf("    %7.1fs %6.2f C  %s %s (rate %+.1f C/min)\n", t, ev->centi / 100.0,
+                       temp_alarm_name((temp_alarm_id_t)ev->id),
+                       ev->type == TEMP_ALARM_EVENT_RAISED ? "raised" : "cleared",
+                       ev->rate_centi_per_min == TEMP_ALARM_RATE_UNKNOWN ? 0.0 : ev->rate_centi_per_min / 100.0);
+            }
+        }
+    }
+    return result;
+}
+
+int main(int argc, char **argv)
+{
+    static const double rates_hz[] = { 2.0, 78.0 };
+    bool verbose = false;
+    uint64_t seed = 1;
+
+    static const struct option options[] = {
+        { "verbose", no_argument,       NULL, 'v' },
+        { "seed",    required_argument, NULL, 's' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'v': verbose = true; break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "Usage: %s [--verbose] [--seed=N]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    static cook_profile_set_t profiles;
+    if (cook_profile_load(&profiles, cook_profile_default_blob, cook_profile_default_blob_size) != ESP_OK) {
+        fprintf(stderr, "Built-in profiles rejected\n");
+        return 1;
+    }
+    const cook_profile_t *profile = &profiles.profiles[0];
+    int failures = 0;
+
+    printf("Profile %s, hysteresis %.2f C, band dwell %u ms, alarm dwell %u ms, rate limit %.1f C/min\n\n",
+           profile->name, HYSTERESIS_CENTI / 100.0, BAND_DWELL_MS, ALARM_DWELL_MS,
+           RATE_LIMIT_CENTI_MIN / 100.0);
+    printf("%-6s %6s %9s %12s %12s %13s\n", "run", "rate", "samples", "raw changes",
+           "band events", "alarm events");
+
+    for (int s = 0; s < SCENARIO_COUNT; s++) {
+        run_result_t results[2];
+        for (int r = 0; r < 2; r++) {
+            if (verbose) {
+                printf("%s at %.0f Hz:\n", scenario_names[s], rates_hz[r]);
+            }
+            results[r] = run(profile, (scenario_t)s, rates_hz[r], seed, verbose);
+            printf("%-6s %4.0fHz %9ld %12ld %12ld %13ld\n", scenario_names[s], rates_hz[r],
+                   results[r].samples, results[r].raw_changes, results[r].band_events,
+                   results[r].alarm_events);
+        }
+
+        if (results[0].band_events != results[1].band_events ||
+            results[0].alarm_events != results[1].alarm_events) {
+            printf("  FAIL: event count depends on the sample rate\n");
+            failures++;
+        }
+        // One event for the first band, none afterwards
+        if (s == SCENARIO_HOVER && results[0].band_events > 1) {
+            printf("  FAIL: hovering on a band edge produced band changes\n");
+            failures++;
+        }
+        // Entering each of the four bands, then leaving the last one
+        if (s == SCENARIO_RAMP && results[0].band_events != profile->band_count + 1) {
+            printf("  FAIL: ramp should report %u band events\n", profile->band_count + 1);
+            failures++;
+        }
+    }
+
+    if (failures > 0) {
+        printf("\nFAIL: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("\nEvents follow real transitions, independent of the sample rate\n");
+    return 0;
+}
@@ -0,0 +1,363 @@
+/**
+ * @file debounce_bench.c
+ * @brief Debounce benchmark harness driven by the keypad bounce simulator
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Replays the same scripted key presses through every debounce configuration
+ * using the firmware's own key_debounce_update() and the scanner's row/column
+ * timing, then reports press-detection latency percentiles, false events and
+ * CPU time per scan pass.
+ *
+ * Usage: debounce_bench [--model=NAME|all] [--presses=N] [--seed=N]
+ *                       [--scan-ms=N] [--settle-us=N] [--chord=P] [--csv]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <getopt.h>
+#include "keypad_sim.h"
+#include "key_debounce.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define DEFAULT_PRESSES            2000
+#define DEFAULT_SEED               1
+#define DEFAULT_SCAN_INTERVAL_MS   10      // Firmware SCAN_INTERVAL_MS
+#define DEFAULT_ROW_SETTLE_US      1000    // Firmware per-row stabilisation delay
+
+static const uint32_t debounce_windows_ms[] = { 5, 10, 20, 30, 50 };
+
+static const key_debounce_mode_t debounce_modes[] = {
+    KEY_DEBOUNCE_LOCKOUT,
+    KEY_DEBOUNCE_STABLE,
+    KEY_DEBOUNCE_INTEGRATOR,
+};
+
+/* ==================== DATA STRUCTURES ==================== */
+
+/**
+ * @brief Debounced event captured during a run
+ */
+typedef struct {
+    uint8_t row;
+    uint8_t col;
+    bool pressed;
+    uint64_t t_us;
+} bench_event_t;
+
+/**
+ * @brief Results of one debounce configuration against one model
+ */
+typedef struct {
+    size_t true_presses;
+    size_t detected;
+    size_t missed;
+    size_t false_presses;
+    size_t false_releases;
+    double latency_p50_ms;
+    double latency_p90_ms;
+    double latency_p99_ms;
+    double latency_max_ms;
+    double ns_per_scan;
+} bench_result_t;
+
+typedef struct {
+    uint32_t scan_interval_us;
+    uint32_t row_settle_us;
+} bench_timing_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static int compare_u64(const void *a, const void *b)
+{
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+    return (va > vb) - (va < vb);
+}
+
+static double percentile_ms(const uint64_t *sorted, size_t n, double pct)
+{
+    if (n == 0) {
+        return 0.0;
+    }
+    size_t idx = (size_t)(pct / 100.0 * (double)(n - 1) + 0.5);
+    return (double)sorted[idx] / 1000.0;
+}
+
+/**
+ * @brief Run the scanner over the whole script and collect debounced events
+ */
+static size_t run_scanner(const keypad_sim_t *sim, const key_debounce_config_t *config,
+                          const bench_timing_t *timing, bench_event_t *events,
+                          size_t max_events, double *ns_per_scan)
+{
+    key_debounce_t keys[KEYPAD_SIM_ROWS][KEYPAD_SIM_COLS];
+    bool readings[KEYPAD_SIM_ROWS][KEYPAD_SIM_COLS];
+    uint64_t read_time[KEYPAD_SIM_ROWS];
+    uint64_t debounce_ns = 0;
+    uint64_t scans = 0;
+    size_t count = 0;
+
+    memset(keys, 0, sizeof(keys));
+
+    for (uint64_t t = 0; t < sim->duration_us; t += timing->scan_interval_us) {
+        // Sample the matrix the way matrix_keyboard_scan_once() does
+        for (uint8_t row = 0; row < KEYPAD_SIM_ROWS; row++) {
+            read_time[row] = t + (uint64_t)(row + 1) * timing->row_settle_us;
+            for (uint8_t col = 0; col < KEYPAD_SIM_COLS; col++) {
+                readings[row][col] = keypad_sim_read(sim, row, col, read_time[row]);
+            }
+        }
+
+        // Time only the debounce pass, not the simulator
+        uint64_t start = host_now_ns();
+        for (uint8_t row = 0; row < KEYPAD_SIM_ROWS; row++) {
+            for (uint8_t col = 0; col < KEYPAD_SIM_COLS; col++) {
+                if (key_debounce_update(&keys[row][col], config,
+                                        readings[row][col], read_time[row]) &&
+                    count < max_events) {
+                    events[count].row = row;
+                    events[count].col = col;
+                    events[count].pressed = keys[row][col].state;
+                    events[count].t_us = read_time[row];
+                    count++;
+                }
+            }
+        }
+        debounce_ns += host_now_ns() - start;
+        scans++;
+    }
+
+    *ns_per_scan = scans ? (double)debounce_ns / (double)scans : 0.0;
+    return count;
+}
+
+/**
+ * @brief Match debounced events against the ground-truth script
+ *
+ * A press event is a detection if it lands on a key whose true press has
+ * started and not yet finished bouncing on release, and that press has not
+ * been detected before. Everything else is a false press. A release event
+ * while the true contact is still held is a false release.
+ */
+static void score_run(const keypad_sim_t *sim, const bench_event_t *events, size_t n_events,
+                      bench_result_t *result)
+{
+    bool *matched = calloc(sim->press_count ? sim->press_count : 1, sizeof(bool));
+    uint64_t *latency = calloc(sim->press_count ? sim->press_count : 1, sizeof(uint64_t));
+    size_t n_latency = 0;
+
+    memset(result, 0, sizeof(*result));
+    result->true_presses = sim->press_count;
+    if (matched == NULL || latency == NULL) {
+        free(matched);
+        free(latency);
+        return;
+    }
+
+    for (size_t i = 0; i < n_events; i++) {
+        const bench_event_t *ev = &events[i];
+        const size_t *list = sim->key_presses[ev->row][ev->col];
+        size_t n = sim->key_press_count[ev->row][ev->col];
+        const keypad_sim_press_t *hit = NULL;
+        size_t hit_index = 0;
+
+        for (size_t k = 0; k < n; k++) {
+            const keypad_sim_press_t *p = &sim->presses[list[k]];
+            if (ev->t_us >= p->start_us && ev->t_us < p->end_us + p->release_burst_us) {
+                hit = p;
+                hit_index = list[k];
+                break;
+            }
+        }
+
+        if (ev->pressed) {
+            if (hit != NULL && !matched[hit_index]) {
+                matched[hit_index] = true;
+                latency[n_latency++] = ev->t_us - hit->start_us;
+            } else {
+                result->false_presses++;
+            }
+        } else if (hit != NULL && ev->t_us < hit->end_us) {
+            result->false_releases++;
+        }
+    }
+
+    qsort(latency, n_latency, sizeof(uint64_t), compare_u64);
+    result->detected = n_latency;
+    result->missed = sim->press_count - n_latency;
+    result->latency_p50_ms = percentile_ms(latency, n_latency, 50.0);
+    result->latency_p90_ms = percentile_ms(latency, n_latency, 90.0);
+    result->latency_p99_ms = percentile_ms(latency, n_latency, 99.0);
+    result->latency_max_ms = n_latency ? (double)latency[n_latency - 1] / 1000.0 : 0.0;
+
+    free(matched);
+    free(latency);
+}
+
+static void print_header(bool csv)
+{
+    if (csv) {
+        printf("model,mode,window_ms,presses,detected,missed,false_press,false_release,"
+               "p50_ms,p90_ms,p99_ms,max_ms,ns_per_scan\n");
+    } else {
+        printf("%-9s %-10s %6s %7s %6s %6s %6s %6s %7s %7s %7s %7s %8s\n",
+               "model", "mode", "win_ms", "presses", "detect", "missed", "f_prs", "f_rel",
+               "p50_ms", "p90_ms", "p99_ms", "max_ms", "ns/scan");
+    }
+}
+
+static void print_result(bool csv, const char *model, const key_debounce_config_t *config,
+                         uint32_t window_ms, const bench_result_t *r)
+{
+    const char *fmt = csv
+        ? "%s,%s,%" PRIu32 ",%zu,%zu,%zu,%zu,%zu,%.2f,%.2f,%.2f,%.2f,%.1f\n"
+        : "%-9s %-10s %6" PRIu32 " %7zu %6zu %6zu %6zu %6zu %7.2f %7.2f %7.2f %7.2f %8.1f\n";
+
+    printf(fmt, model, key_debounce_mode_name(config->mode), window_ms,
+           r->true_presses, r->detected, r->missed, r->false_presses, r->false_releases,
+           r->latency_p50_ms, r->latency_p90_ms, r->latency_p99_ms, r->latency_max_ms,
+           r->ns_per_scan);
+}
+
+static int bench_model(const keypad_bounce_model_t *model, const keypad_sim_script_config_t *script,
+                       uint64_t seed, const bench_timing_t *timing, bool csv)
+{
+    keypad_sim_t sim;
+
+    if (!keypad_sim_init(&sim, model, script, seed)) {
+        fprintf(stderr, "Out of memory building press script\n");
+        return 1;
+    }
+
+    size_t max_events = sim.press_count * 64 + 1024;
+    bench_event_t *events = malloc(max_events * sizeof(bench_event_t));
+    if (events == NULL) {
+        keypad_sim_free(&sim);
+        fprintf(stderr, "Out of memory for event buffer\n");
+        return 1;
+    }
+
+    for (size_t m = 0; m < sizeof(debounce_modes) / sizeof(debounce_modes[0]); m++) {
+        for (size_t w = 0; w < sizeof(debounce_windows_ms) / sizeof(debounce_windows_ms[0]); w++) {
+            uint32_t window_us = debounce_windows_ms[w] * 1000;
+            uint32_t samples = window_us / timing->scan_interval_us;
+            key_debounce_config_t config = {
+                .mode = debounce_modes[m],
+                .debounce_us = window_us,
+                .integrator_samples = (uint8_t)(samples < 1 ? 1 : (samples > 255 ? 255 : samples)),
+            };
+            bench_result_t result;
+            double ns_per_scan = 0.0;
+
+            size_t n = run_scanner(&sim, &config, timing, events, max_events, &ns_per_scan);
+            score_run(&sim, events, n, &result);
+            result.ns_per_scan = ns_per_scan;
+            print_result(csv, model->name, &config, debounce_windows_ms[w], &result);
+        }
+    }
+
+    free(events);
+    keypad_sim_free(&sim);
+    return 0;
+}
+
+static void usage(const char *prog)
+{
+    size_t n_models;
+    const keypad_bounce_model_t *list = keypad_sim_models(&n_models);
+
+    fprintf(stderr,
+            "Usage: %s [--model=NAME|all] [--presses=N] [--seed=N] [--scan-ms=N]\n"
+            "          [--settle-us=N] [--chord=P] [--csv]\n"
+            "Models:", prog);
+    for (size_t i = 0; i < n_models; i++) {
+        fprintf(stderr, " %s", list[i].name);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *model_name = "typical";
+    uint64_t seed = DEFAULT_SEED;
+    bool csv = false;
+    bench_timing_t timing = {
+        .scan_interval_us = DEFAULT_SCAN_INTERVAL_MS * 1000,
+        .row_settle_us = DEFAULT_ROW_SETTLE_US,
+    };
+    keypad_sim_script_config_t script = {
+        .press_count = DEFAULT_PRESSES,
+        .hold_min_us = 60000,
+        .hold_max_us = 400000,
+        .gap_min_us = 150000,
+        .gap_max_us = 600000,
+        .chord_prob = 0.0,
+    };
+    bool chord_set = false;
+
+    static const struct option options[] = {
+        { "model",     required_argument, NULL, 'm' },
+        { "presses",   required_argument, NULL, 'n' },
+        { "seed",      required_argument, NULL, 's' },
+        { "scan-ms",   required_argument, NULL, 'i' },
+        { "settle-us", required_argument, NULL, 'r' },
+        { "chord",     required_argument, NULL, 'c' },
+        { "csv",       no_argument,       NULL, 'v' },
+        { "help",      no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'm': model_name = optarg; break;
+            case 'n': script.press_count = strtoul(optarg, NULL, 0); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'i': timing.scan_interval_us = (uint32_t)strtoul(optarg, NULL, 0) * 1000; break;
+            case 'r': timing.row_settle_us = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'c': script.chord_prob = strtod(optarg, NULL); chord_set = true; break;
+            case 'v': csv = true; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    if (timing.scan_interval_us == 0 || script.press_count == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+
+    print_header(csv);
+
+    size_t n_models;
+    const keypad_bounce_model_t *list = keypad_sim_models(&n_models);
+    for (size_t i = 0; i < n_models; i++) {
+        if (strcmp(model_name, "all") != 0 && strcmp(model_name, list[i].name) != 0) {
+            continue;
+        }
+        keypad_sim_script_config_t model_script = script;
+        if (!chord_set && list[i].ghosting) {
+            model_script.chord_prob = 0.2;   // Ghosting needs chords to show up
+        }
+        if (bench_model(&list[i], &model_script, seed, &timing, csv) != 0) {
+            return 1;
+        }
+        if (strcmp(model_name, "all") != 0) {
+            return 0;
+        }
+    }
+
+    if (strcmp(model_name, "all") != 0) {
+        fprintf(stderr, "Unknown model '%s'\n", model_name);
+        usage(argv[0]);
+        return 2;
+    }
+
+    return 0;
+}
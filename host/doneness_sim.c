@@ -0,0 +1,186 @@
+/**
+ * @file doneness_sim.c
+ * @brief Check and time the time-to-doneness estimator on a simulated cook
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Feeds a patty core temperature that approaches the grill exponentially
+ * (with sensor noise and jittered sample times) into the estimator at the
+ * firmware's 500 ms rate. After every push the incremental slope is compared
+ * with a least-squares fit recomputed from the whole window; any difference
+ * beyond float rounding fails the run. Once a minute the predicted time to
+ * enter and leave the band is printed next to the true remaining time.
+ *
+ * Usage: doneness_sim [--band-min=C] [--band-max=C] [--tau=S] [--seed=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "doneness.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SAMPLE_PERIOD_MS        500     // Monitoring task rate
+#define START_C                 5.0     // Patty from the fridge
+#define ASYMPTOTE_C             80.0    // Core temperature the patty would settle at
+#define NOISE_C                 0.1
+#define JITTER_MS               20      // Sample time jitter (+/-)
+#define REPORT_EVERY_S          60
+#define MAX_SLOPE_ERROR         1e-4    // Relative, float result vs double reference
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Least-squares slope over the window, recomputed from scratch
+ */
+static double reference_slope(const doneness_estimator_t *est)
+{
+    double mean_t = 0.0;
+    double mean_y = 0.0;
+    double sxx = 0.0;
+    double sxy = 0.0;
+
+    for (int i = 0; i < est->count; i++) {
+        mean_t += (double)est->time_ms[i];
+        mean_y += est->centi[i];
+    }
+    mean_t /= est->count;
+    mean_y /= est->count;
+    for (int i = 0; i < est->count; i++) {
+        double dt = (double)est->time_ms[i] - mean_t;
+        sxx += dt * dt;
+        sxy += dt * (est->centi[i] - mean_y);
+    }
+    return sxy / sxx;
+}
+
+/**
+ * @brief Time at which the noiseless curve reaches `celsius`
+ */
+static double crossing_time_s(double celsius, double tau_s)
+{
+    return -tau_s * log((ASYMPTOTE_C - celsius) / (ASYMPTOTE_C - START_C));
+}
+
+static void format_seconds(char *out, size_t size, double seconds)
+{
+    if (seconds < 0.0) {
+        snprintf(out, size, "-");
+    } else {
+        snprintf(out, size, "%dm%02ds", (int)seconds / 60, (int)seconds % 60);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    double band_min = 55.0;
+    double band_max = 60.0;
+    double tau_s = 900.0;
+    uint64_t seed = 1;
+
+    static const struct option options[] = {
+        { "band-min", required_argument, NULL, 'l' },
+        { "band-max", required_argument, NULL, 'u' },
+        { "tau",      required_argument, NULL, 't' },
+        { "seed",     required_argument, NULL, 's' },
+        { "help",     no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'l': band_min = strtod(optarg, NULL); break;
+            case 'u': band_max = strtod(optarg, NULL); break;
+            case 't': tau_s = strtod(optarg, NULL); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "Usage: %s [--band-min=C] [--band-max=C] [--tau=S] [--seed=N]\n",
+                        argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    if (band_min >= band_max || band_max >= ASYMPTOTE_C || band_min <= START_C) {
+        fprintf(stderr, "Band must lie between %.0f and %.0f C\n", START_C, ASYMPTOTE_C);
+        return 2;
+    }
+
+    const double enter_s = crossing_time_s(band_min, tau_s);
+    const double leave_s = crossing_time_s(band_max, tau_s);
+    const long total = (long)((leave_s + 120.0) * 1000.0 / SAMPLE_PERIOD_MS);
+    const int32_t band_min_centi = (int32_t)lround(band_min * 100.0);
+    const int32_t band_max_centi = (int32_t)lround(band_max * 100.0);
+
+    static doneness_estimator_t est;
+    adc_synth_t rng;
+    double max_slope_error = 0.0;
+    uint64_t push_ns = 0;
+    uint64_t predict_ns = 0;
+
+    doneness_init(&est);
+    adc_synth_init(&rng, 1000.0 / SAMPLE_PERIOD_MS, 0.0, 0.0, seed);
+
+    printf("Band %.1f-%.1f C, tau %.0f s: enters at %.0f s, leaves at %.0f s\n",
+           band_min, band_max, tau_s, enter_s, leave_s);
+    printf("%8s %8s %10s %10s %10s %10s %10s  %s\n", "time", "temp", "C/min",
+           "enter", "(true)", "leave", "(true)", "state");
+
+    for (long i = 0; i < total; i++) {
+        int64_t time_ms = (int64_t)i * SAMPLE_PERIOD_MS +
+                          (int64_t)lround((adc_synth_uniform(&rng) * 2.0 - 1.0) * JITTER_MS);
+        if (time_ms < 0) {
+            time_ms = 0;
+        }
+        double t = (double)time_ms / 1000.0;
+        double celsius = ASYMPTOTE_C - (ASYMPTOTE_C - START_C) * exp(-t / tau_s) +
+                         NOISE_C * adc_synth_gaussian(&rng);
+
+        uint64_t start = host_now_ns();
+        doneness_push(&est, time_ms, (int32_t)lround(celsius * 100.0));
+        push_ns += host_now_ns() - start;
+
+        float slope;
+        if (doneness_slope(&est, &slope) == ESP_OK) {
+            double reference = reference_slope(&est);
+            double error = fabs((double)slope - reference) / fmax(fabs(reference), 1e-9);
+            if (error > max_slope_error) {
+                max_slope_error = error;
+            }
+        }
+
+        doneness_prediction_t prediction;
+        start = host_now_ns();
+        doneness_predict(&est, band_min_centi, band_max_centi, &prediction);
+        predict_ns += host_now_ns() - start;
+
+        if (i % (REPORT_EVERY_S * 1000 / SAMPLE_PERIOD_MS) == 0) {
+            char enter[16], enter_true[16], leave[16], leave_true[16];
+            format_seconds(enter, sizeof(enter), prediction.seconds_to_enter);
+            format_seconds(enter_true, sizeof(enter_true), t < enter_s ? enter_s - t : 0.0);
+            format_seconds(leave, sizeof(leave), prediction.seconds_to_leave);
+            format_seconds(leave_true, sizeof(leave_true), t < leave_s ? leave_s - t : -1.0);
+            printf("%7.0fs %8.2f %10.2f %10s %10s %10s %10s  %s\n", t,
+                   prediction.fitted_centi / 100.0, prediction.slope_centi_per_min / 100.0,
+                   enter, enter_true, leave, leave_true,
+                   doneness_state_name((doneness_state_t)prediction.state));
+        }
+    }
+
+    printf("Estimator: %zu bytes, window %d samples (%d s)\n", sizeof(doneness_estimator_t),
+           DONENESS_WINDOW_SAMPLES, DONENESS_WINDOW_SAMPLES * SAMPLE_PERIOD_MS / 1000);
+    printf("Cost: %.1f ns/push, %.1f ns/predict over %ld samples\n",
+           (double)push_ns / total, (double)predict_ns / total, total);
+    printf("Incremental vs recomputed slope: max relative error %.2e\n", max_slope_error);
+
+    if (max_slope_error > MAX_SLOPE_ERROR) {
+        printf("FAIL: incremental regression drifted from the recomputed fit\n");
+        return 1;
+    }
+    printf("Incremental regression matches the recomputed fit\n");
+    return 0;
+}
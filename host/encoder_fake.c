@@ -0,0 +1,146 @@
+/**
+ * @file encoder_fake.c
+ * @brief Host stand-in for the PCNT unit used by rotary_encoder.c
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "encoder_fake.h"
+
+#define PHASE_A 0
+#define PHASE_B 1
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Count one filtered edge using the firmware's channel configuration
+ *
+ * Channel A: edge on A, level on B, (rising, falling) = (INCREASE, DECREASE)
+ * Channel B: edge on B, level on A, (rising, falling) = (DECREASE, INCREASE)
+ * Both channels: control level high = HOLD, low = KEEP.
+ *
+ * An idle unit does not count: the edge that wakes it and any edge before
+ * the wake latency has passed are lost.
+ */
+static void count_edge(encoder_fake_t *fake, int phase, bool rising, uint64_t t_ns)
+{
+    bool control = fake->phase[phase == PHASE_A ? PHASE_B : PHASE_A].level;
+    int step;
+
+    if (fake->idle) {
+        fake->idle = false;
+        fake->counting_ns = t_ns + fake->wake_latency_ns;
+    }
+    if (t_ns < fake->counting_ns) {
+        fake->edges_lost++;
+        return;
+    }
+
+    if (phase == PHASE_A) {
+        step = rising ? 1 : -1;
+    } else {
+        step = rising ? -1 : 1;
+    }
+    if (control) {
+        return;
+    }
+
+    fake->count += step;
+    fake->edges_counted++;
+
+    // Watch point equals the limit: report and clear, like the hardware
+    if (fake->count >= fake->counts_per_detent || fake->count <= -fake->counts_per_detent) {
+        int8_t direction = fake->count > 0 ? 1 : -1;
+        int16_t delta = encoder_accel_step(&fake->accel, &fake->accel_config,
+                                           direction, t_ns / 1000);
+        fake->count = 0;
+        if (fake->event_cb != NULL) {
+            fake->event_cb(delta, t_ns, fake->event_ctx);
+        }
+    }
+}
+
+/**
+ * @brief Commit pending edges that stayed stable for the filter width
+ */
+void encoder_fake_advance(encoder_fake_t *fake, uint64_t t_ns)
+{
+    for (;;) {
+        int next = -1;
+        uint64_t next_t = 0;
+
+        // Commit in chronological order so the control level is correct
+        for (int p = 0; p < 2; p++) {
+            encoder_fake_phase_t *ph = &fake->phase[p];
+            if (!ph->has_pending) {
+                continue;
+            }
+            uint64_t commit_t = ph->pending_ns + fake->glitch_filter_ns;
+            if (commit_t <= t_ns && (next < 0 || commit_t < next_t)) {
+                next = p;
+                next_t = commit_t;
+            }
+        }
+
+        if (next < 0) {
+            return;
+        }
+
+        encoder_fake_phase_t *ph = &fake->phase[next];
+        ph->has_pending = false;
+        if (ph->pending != ph->level) {
+            ph->level = ph->pending;
+            count_edge(fake, next, ph->level, next_t);
+        }
+    }
+}
+
+void encoder_fake_init(encoder_fake_t *fake, uint32_t glitch_filter_ns, int counts_per_detent,
+                       const encoder_accel_config_t *accel, encoder_fake_event_cb_t cb, void *ctx)
+{
+    memset(fake, 0, sizeof(*fake));
+    fake->glitch_filter_ns = glitch_filter_ns;
+    fake->counts_per_detent = counts_per_detent;
+    fake->accel_config = *accel;
+    fake->event_cb = cb;
+    fake->event_ctx = ctx;
+    fake->phase[PHASE_A].level = true;
+    fake->phase[PHASE_B].level = true;
+    fake->phase[PHASE_A].pending = true;
+    fake->phase[PHASE_B].pending = true;
+}
+
+void encoder_fake_idle(encoder_fake_t *fake, uint32_t wake_latency_ns)
+{
+    fake->idle = true;
+    fake->wake_latency_ns = wake_latency_ns;
+    fake->count = 0;        // rotary_encoder_idle() clears the count
+}
+
+void encoder_fake_set_levels(encoder_fake_t *fake, uint64_t t_ns, bool a, bool b)
+{
+    const bool levels[2] = { a, b };
+
+    encoder_fake_advance(fake, t_ns);
+
+    for (int p = 0; p < 2; p++) {
+        encoder_fake_phase_t *ph = &fake->phase[p];
+        bool current = ph->has_pending ? ph->pending : ph->level;
+
+        if (levels[p] == current) {
+            continue;
+        }
+
+        if (ph->has_pending) {
+            // Reverted before the filter elapsed: the pulse is swallowed
+            ph->has_pending = false;
+            ph->pending = ph->level;
+            fake->glitches_filtered++;
+        } else {
+            ph->has_pending = true;
+            ph->pending = levels[p];
+            ph->pending_ns = t_ns;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+/**
+ * @file encoder_fake.h
+ * @brief Host stand-in for the PCNT unit used by rotary_encoder.c
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Mirrors the hardware configuration in rotary_encoder_init(): a glitch
+ * filter on each phase, counting of the two middle quadrature steps with the
+ * same edge and level actions, and watch points at plus and minus one detent
+ * that clear the count. encoder_fake_idle() models the unit disabled at rest:
+ * the wake edge and edges within the wake latency are not counted.
+ * Each watch point hit is passed through encoder_accel_step() exactly as the
+ * firmware ISR does, so synthetic quadrature can exercise the real
+ * acceleration logic on the host.
+ */
+
+#ifndef ENCODER_FAKE_H
+#define ENCODER_FAKE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "encoder_accel.h"
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Callback receiving one accelerated detent
+ *
+ * @param delta Signed steps returned by encoder_accel_step()
+ * @param t_ns Time the watch point was reached
+ * @param ctx User context
+ */
+typedef void (*encoder_fake_event_cb_t)(int16_t delta, uint64_t t_ns, void *ctx);
+
+/**
+ * @brief Glitch-filtered input of one phase
+ */
+typedef struct {
+    bool level;             /**< Level after the filter */
+    bool pending;           /**< Raw level waiting to pass the filter */
+    bool has_pending;       /**< A raw change is waiting */
+    uint64_t pending_ns;    /**< Time of the raw change */
+} encoder_fake_phase_t;
+
+/**
+ * @brief Fake PCNT unit
+ */
+typedef struct {
+    uint32_t glitch_filter_ns;          /**< Minimum stable time for an edge to count */
+    int counts_per_detent;              /**< Watch point / limit magnitude */
+    encoder_accel_config_t accel_config;/**< Acceleration curve */
+    encoder_accel_t accel;              /**< Acceleration state */
+    encoder_fake_phase_t phase[2];      /**< Phase A and B */
+    int count;                          /**< Current counter value */
+    uint32_t edges_counted;             /**< Edges that reached the counter */
+    bool idle;                          /**< Unit disabled, waiting for a wake edge */
+    uint32_t wake_latency_ns;           /**< Wake edge to counting again */
+    uint64_t counting_ns;               /**< Edges before this time are lost */
+    uint32_t edges_lost;                /**< Edges seen while idle or waking */
+    uint32_t glitches_filtered;         /**< Raw pulses swallowed by the filter */
+    encoder_fake_event_cb_t event_cb;   /**< Detent consumer */
+    void *event_ctx;                    /**< Detent consumer context */
+} encoder_fake_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Initialise the fake with both phases high (encoder at rest)
+ *
+ * @param fake Fake unit
+ * @param glitch_filter_ns Filter width (0 = off)
+ * @param counts_per_detent Watch point magnitude
+ * @param accel Acceleration curve
+ * @param cb Detent consumer
+ * @param ctx Detent consumer context
+ */
+void encoder_fake_init(encoder_fake_t *fake, uint32_t glitch_filter_ns, int counts_per_detent,
+                       const encoder_accel_config_t *accel, encoder_fake_event_cb_t cb, void *ctx);
+
+/**
+ * @brief Apply new raw phase levels at a point in time
+ *
+ * Calls must be made in non-decreasing time order.
+ *
+ * @param fake Fake unit
+ * @param t_ns Time of the change
+ * @param a Raw level of phase A
+ * @param b Raw level of phase B
+ */
+void encoder_fake_set_levels(encoder_fake_t *fake, uint64_t t_ns, bool a, bool b);
+
+/**
+ * @brief Disable the unit at rest, as rotary_encoder_idle() does
+ *
+ * @param fake Fake unit (both phases high)
+ * @param wake_latency_ns Time from the wake edge until the unit counts again
+ */
+void encoder_fake_idle(encoder_fake_t *fake, uint32_t wake_latency_ns);
+
+/**
+ * @brief Let time pass so pending edges can clear the glitch filter
+ *
+ * @param fake Fake unit
+ * @param t_ns Current time
+ */
+void encoder_fake_advance(encoder_fake_t *fake, uint64_t t_ns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENCODER_FAKE_H */
@@ -0,0 +1,213 @@
+/**
+ * @file encoder_sim.c
+ * @brief Feeds synthetic quadrature into the PCNT fake and reports detents
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Generates the phase waveforms of a rotary encoder turned through a scripted
+ * profile (slow deliberate turns, fast spins, direction changes), adds contact
+ * bounce around every edge, and runs them through the fake PCNT unit and the
+ * firmware acceleration curve. The resulting temperature entry value is
+ * tracked the same way handle_encoder_delta() does in main.c.
+ *
+ * After every rest of at least the idle time the unit idles as in the
+ * firmware, so the first edge of the next turn is lost and the next ones
+ * only count once the wake latency has passed. Exits non-zero unless every
+ * detent is reported.
+ *
+ * Usage: encoder_sim [--glitch-ns=N] [--bounce-ns=N] [--bounces=N]
+ *                    [--idle-ms=N] [--wake-us=N] [--quiet]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <getopt.h>
+#include "encoder_fake.h"
+#include "rotary_encoder.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+/* Same acceleration curve as app_main() */
+#define ENCODER_SLOW_INTERVAL_MS   120
+#define ENCODER_FAST_INTERVAL_MS   15
+#define ENCODER_MAX_MULTIPLIER     10
+#define ENCODER_IDLE_MS            1000
+#define ENCODER_WAKE_US            1000    // Light-sleep exit plus the esp_timer hand-over
+#define TEMP_INPUT_MAX             999
+
+/* ==================== DATA STRUCTURES ==================== */
+
+/**
+ * @brief One segment of the turning profile
+ */
+typedef struct {
+    const char *label;
+    int detents;                /**< Signed: positive = clockwise */
+    uint32_t detent_interval_us;/**< Time per detent */
+} turn_segment_t;
+
+static const turn_segment_t profile[] = {
+    { "slow clockwise",        5, 200000 },
+    { "rest",                  0, 1500000 },
+    { "fast spin clockwise",  30,   8000 },
+    { "pause",                 0, 500000 },
+    { "medium clockwise",     10,  60000 },
+    { "overshoot correction", -3, 150000 },
+    { "fast spin back",      -20,  10000 },
+};
+
+typedef struct {
+    int value;
+    int detents;
+    int steps;
+    bool quiet;
+} sim_state_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static void on_detent(int16_t delta, uint64_t t_ns, void *ctx)
+{
+    sim_state_t *st = ctx;
+
+    st->detents++;
+    st->steps += delta;
+    st->value += delta;
+    if (st->value < 0) {
+        st->value = 0;
+    } else if (st->value > TEMP_INPUT_MAX) {
+        st->value = TEMP_INPUT_MAX;
+    }
+
+    if (!st->quiet) {
+        printf("  t=%9.3f ms  delta=%+4d  value=%3d\n", (double)t_ns / 1e6, delta, st->value);
+    }
+}
+
+/**
+ * @brief Drive one phase transition, preceded by contact bounce
+ */
+static void drive_edge(encoder_fake_t *fake, uint64_t t_ns, int phase, bool *a, bool *b,
+                       uint32_t bounce_ns, int bounces)
+{
+    bool *pin = phase == 0 ? a : b;
+    bool target = !*pin;
+
+    // Bounce: short pulses to the new level that fall back before settling
+    for (int i = 0; i < bounces; i++) {
+        *pin = target;
+        encoder_fake_set_levels(fake, t_ns, *a, *b);
+        t_ns += bounce_ns;
+        *pin = !target;
+        encoder_fake_set_levels(fake, t_ns, *a, *b);
+        t_ns += bounce_ns;
+    }
+
+    *pin = target;
+    encoder_fake_set_levels(fake, t_ns, *a, *b);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t glitch_ns = ROTARY_ENCODER_GLITCH_NS;
+    uint32_t bounce_ns = 300;
+    int bounces = 3;
+    uint32_t idle_ms = ENCODER_IDLE_MS;
+    uint32_t wake_us = ENCODER_WAKE_US;
+    sim_state_t st = { 0 };
+
+    static const struct option options[] = {
+        { "glitch-ns", required_argument, NULL, 'g' },
+        { "bounce-ns", required_argument, NULL, 'b' },
+        { "bounces",   required_argument, NULL, 'n' },
+        { "idle-ms",   required_argument, NULL, 'i' },
+        { "wake-us",   required_argument, NULL, 'w' },
+        { "quiet",     no_argument,       NULL, 'q' },
+        { "help",      no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'g': glitch_ns = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'b': bounce_ns = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'n': bounces = atoi(optarg); break;
+            case 'i': idle_ms = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'w': wake_us = (uint32_t)strtoul(optarg, NULL, 0); break;
+            case 'q': st.quiet = true; break;
+            default:
+                fprintf(stderr, "Usage: %s [--glitch-ns=N] [--bounce-ns=N] [--bounces=N]\n"
+                        "       [--idle-ms=N] [--wake-us=N] [--quiet]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    encoder_accel_config_t accel = {
+        .slow_interval_us = ENCODER_SLOW_INTERVAL_MS * 1000,
+        .fast_interval_us = ENCODER_FAST_INTERVAL_MS * 1000,
+        .max_multiplier = ENCODER_MAX_MULTIPLIER,
+    };
+    encoder_fake_t fake;
+    encoder_fake_init(&fake, glitch_ns, ROTARY_ENCODER_COUNTS_PER_DETENT, &accel, on_detent, &st);
+
+    printf("Glitch filter %" PRIu32 " ns, bounce %d x %" PRIu32 " ns per edge, "
+           "idle after %" PRIu32 " ms, wake %" PRIu32 " us\n",
+           glitch_ns, bounces, bounce_ns, idle_ms, wake_us);
+
+    bool a = true;
+    bool b = true;
+    uint64_t t_ns = 0;
+    uint64_t last_edge_ns = 0;
+    int expected_detents = 0;
+    int idles = 0;
+
+    // The knob has rested since boot: the unit starts idle
+    encoder_fake_idle(&fake, wake_us * 1000);
+    idles++;
+
+    for (size_t s = 0; s < sizeof(profile) / sizeof(profile[0]); s++) {
+        const turn_segment_t *seg = &profile[s];
+        int n = abs(seg->detents);
+        uint64_t edge_ns = (uint64_t)seg->detent_interval_us * 1000 / 4;
+
+        if (!st.quiet) {
+            printf("%s (%d detents, %" PRIu32 " ms each)\n", seg->label, seg->detents,
+                   seg->detent_interval_us / 1000);
+        }
+
+        if (n == 0) {
+            t_ns += (uint64_t)seg->detent_interval_us * 1000;
+            encoder_fake_advance(&fake, t_ns);
+            if (t_ns - last_edge_ns >= (uint64_t)idle_ms * 1000000) {
+                encoder_fake_idle(&fake, wake_us * 1000);
+                idles++;
+            }
+            continue;
+        }
+
+        for (int d = 0; d < n; d++) {
+            // Clockwise: A leads B (11 -> 01 -> 00 -> 10 -> 11); reverse for CCW
+            for (int e = 0; e < 4; e++) {
+                int phase = (seg->detents > 0) ? (e & 1) : !(e & 1);
+                t_ns += edge_ns;
+                drive_edge(&fake, t_ns, phase, &a, &b, bounce_ns, bounces);
+                last_edge_ns = t_ns;
+            }
+        }
+        expected_detents += n;
+    }
+
+    encoder_fake_advance(&fake, t_ns + 1000000);
+
+    printf("\nDetents turned:    %d\n", expected_detents);
+    printf("Detents reported:  %d\n", st.detents);
+    printf("Edges counted:     %" PRIu32 "\n", fake.edges_counted);
+    printf("Glitches filtered: %" PRIu32 "\n", fake.glitches_filtered);
+    printf("Idle periods:      %d\n", idles);
+    printf("Edges lost waking: %" PRIu32 "\n", fake.edges_lost);
+    printf("Net steps:         %+d\n", st.steps);
+    printf("Final value:       %d\n", st.value);
+
+    return st.detents == expected_detents ? 0 : 1;
+}
@@ -0,0 +1,228 @@
+/**
+ * @file esp_timer_fake.c
+ * @brief esp_timer on a dispatcher task, time from CLOCK_MONOTONIC
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_timer.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TIMER_TASK_STACK            4096    // Recorded only; the host stack is larger
+#define TIMER_TASK_PRIORITY         22      // ESP_TASK_TIMER_PRIO on the target
+
+/* ==================== DATA TYPES ==================== */
+
+struct esp_timer {
+    esp_timer_create_args_t args;
+    int64_t alarm_us;           // Next expiry
+    uint64_t period_us;         // 0: one-shot
+    bool active;
+    struct esp_timer *next;
+};
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_once_t timer_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t timer_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t timer_changed;
+static struct esp_timer *timers = NULL;
+static int64_t start_ns = 0;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static int64_t monotonic_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+/**
+ * @brief Time zero is process start, like boot on the target
+ */
+__attribute__((constructor)) static void esp_timer_fake_epoch(void)
+{
+    start_ns = monotonic_ns();
+}
+
+int64_t esp_timer_get_time(void)
+{
+    return (monotonic_ns() - start_ns) / 1000;
+}
+
+/**
+ * @brief Dispatcher: callbacks run one at a time, in expiry order
+ *
+ * For power accounting the task is blocked from the end of one callback to
+ * the start of the next: re-checking a changed list does not wake the chip.
+ */
+static void esp_timer_task(void *arg)
+{
+    bool blocked = false;
+
+    pthread_mutex_lock(&timer_lock);
+    while (1) {
+        struct esp_timer *due = NULL;
+        for (struct esp_timer *timer = timers; timer != NULL; timer = timer->next) {
+            if (timer->active && (due == NULL || timer->alarm_us < due->alarm_us)) {
+                due = timer;
+            }
+        }
+
+        int64_t now_us = esp_timer_get_time();
+        if ((due == NULL || due->alarm_us > now_us) && !blocked) {
+            idf_fake_pm_task_block();
+            blocked = true;
+        }
+        if (due == NULL) {
+            pthread_cond_wait(&timer_changed, &timer_lock);
+            continue;
+        }
+        if (due->alarm_us > now_us) {
+            int64_t wake_ns = start_ns + due->alarm_us * 1000;
+            struct timespec deadline = {
+                .tv_sec = (time_t)(wake_ns / 1000000000LL),
+                .tv_nsec = (long)(wake_ns % 1000000000LL),
+            };
+            pthread_cond_timedwait(&timer_changed, &timer_lock, &deadline);
+            continue;       // The list may have changed
+        }
+
+        if (due->period_us > 0) {
+            due->alarm_us += (int64_t)due->period_us;
+            if (due->args.skip_unhandled_events && due->alarm_us <= now_us) {
+                due->alarm_us = now_us + (int64_t)due->period_us;
+            }
+        } else {
+            due->active = false;
+        }
+        esp_timer_cb_t callback = due->args.callback;
+        void *callback_arg = due->args.arg;
+        if (blocked) {
+            idf_fake_pm_task_unblock();
+            blocked = false;
+        }
+
+        pthread_mutex_unlock(&timer_lock);
+        callback(callback_arg);
+        pthread_mutex_lock(&timer_lock);
+    }
+}
+
+static void esp_timer_fake_init(void)
+{
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&timer_changed, &attr);
+    pthread_condattr_destroy(&attr);
+
+    xTaskCreatePinnedToCore(esp_timer_task, "esp_timer", TIMER_TASK_STACK, NULL,
+                            TIMER_TASK_PRIORITY, NULL, 0);
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle)
+{
+    if (create_args == NULL || create_args->callback == NULL || out_handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_once(&timer_once, esp_timer_fake_init);
+
+    struct esp_timer *timer = calloc(1, sizeof(*timer));
+    if (timer == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    timer->args = *create_args;
+
+    pthread_mutex_lock(&timer_lock);
+    timer->next = timers;
+    timers = timer;
+    pthread_mutex_unlock(&timer_lock);
+
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+static esp_err_t timer_start(esp_timer_handle_t timer, uint64_t timeout_us, uint64_t period_us)
+{
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer_lock);
+    if (!timer->active) {
+        timer->alarm_us = esp_timer_get_time() + (int64_t)timeout_us;
+        timer->period_us = period_us;
+        timer->active = true;
+        pthread_cond_broadcast(&timer_changed);
+        ret = ESP_OK;
+    }
+    pthread_mutex_unlock(&timer_lock);
+    return ret;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+    return timer_start(timer, timeout_us, 0);
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    return timer_start(timer, period, period);
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer_lock);
+    if (timer->active) {
+        timer->active = false;
+        pthread_cond_broadcast(&timer_changed);
+        ret = ESP_OK;
+    }
+    pthread_mutex_unlock(&timer_lock);
+    return ret;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&timer_lock);
+    if (timer->active) {
+        pthread_mutex_unlock(&timer_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    for (struct esp_timer **link = &timers; *link != NULL; link = &(*link)->next) {
+        if (*link == timer) {
+            *link = timer->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&timer_lock);
+    free(timer);
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer)
+{
+    pthread_mutex_lock(&timer_lock);
+    bool active = timer != NULL && timer->active;
+    pthread_mutex_unlock(&timer_lock);
+    return active;
+}
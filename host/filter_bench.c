@@ -0,0 +1,214 @@
+/**
+ * @file filter_bench.c
+ * @brief Compare temperature filter pipelines on a synthetic probe trace
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Generates a temperature trace at the firmware reading rate (steady, a step,
+ * then a ramp) with Gaussian noise and occasional spikes, and runs it through
+ * several sensor_filter pipelines. For each pipeline it reports steady-state
+ * noise, worst excursion, 10-90 % step rise time, ramp lag and the per-sample
+ * cost recorded by the pipeline itself.
+ *
+ * Usage: filter_bench [--rate=HZ] [--noise=C] [--spikes=P] [--seed=N] [--csv]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "cycle_counter.h"
+#include "sensor_filter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define DEFAULT_RATE_HZ         78.125  // 20 kHz / 4^4, the firmware reading rate
+#define DEFAULT_NOISE_C         0.20    // Probe and wiring noise, 1 sigma
+#define DEFAULT_SPIKE_PROB      0.01    // Chance a reading is a spike
+#define SPIKE_AMPLITUDE_C       8.0     // Spike size (relay or motor switching)
+
+#define TRACE_SECONDS           30.0
+#define STEP_TIME_S             10.0
+#define RAMP_TIME_S             20.0
+#define BASE_TEMP_C             25.0
+#define STEP_TEMP_C             30.0
+#define RAMP_C_PER_S            0.5
+
+/* ==================== DATA TYPES ==================== */
+
+typedef struct {
+    const char *name;
+    sensor_filter_stage_config_t stages[SENSOR_FILTER_MAX_STAGES];
+    uint8_t count;
+} pipeline_preset_t;
+
+typedef struct {
+    double noise_rms_c;         // Steady segment, error against the truth
+    double max_excursion_c;     // Steady segment, worst single error
+    double rise_ms;             // 10-90 % of the step
+    double ramp_lag_c;          // Mean error during the ramp
+    uint32_t avg_ticks;
+    uint32_t max_ticks;
+} pipeline_result_t;
+
+/* ==================== PRESETS ==================== */
+
+static const pipeline_preset_t presets[] = {
+    { "raw", { { 0 } }, 0 },
+    { "median5", {
+        { .type = SENSOR_FILTER_MEDIAN, .median = { .window = 5 } },
+    }, 1 },
+    { "iir3", {
+        { .type = SENSOR_FILTER_IIR, .iir = { .shift = 3 } },
+    }, 1 },
+    { "kalman", {
+        { .type = SENSOR_FILTER_KALMAN, .kalman = { .process_noise = 4.0f, .measurement_noise = 400.0f } },
+    }, 1 },
+    { "median5+iir3", {   // Firmware default
+        { .type = SENSOR_FILTER_MEDIAN, .median = { .window = 5 } },
+        { .type = SENSOR_FILTER_IIR, .iir = { .shift = 3 } },
+    }, 2 },
+    { "median5+kalman", {
+        { .type = SENSOR_FILTER_MEDIAN, .median = { .window = 5 } },
+        { .type = SENSOR_FILTER_KALMAN, .kalman = { .process_noise = 4.0f, .measurement_noise = 400.0f } },
+    }, 2 },
+    { "median9+iir2+kalman", {
+        { .type = SENSOR_FILTER_MEDIAN, .median = { .window = 9 } },
+        { .type = SENSOR_FILTER_IIR, .iir = { .shift = 2 } },
+        { .type = SENSOR_FILTER_KALMAN, .kalman = { .process_noise = 4.0f, .measurement_noise = 400.0f } },
+    }, 3 },
+};
+
+#define PRESET_COUNT (sizeof(presets) / sizeof(presets[0]))
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static double truth_at(double t)
+{
+    if (t < STEP_TIME_S) {
+        return BASE_TEMP_C;
+    }
+    if (t < RAMP_TIME_S) {
+        return STEP_TEMP_C;
+    }
+    return STEP_TEMP_C + RAMP_C_PER_S * (t - RAMP_TIME_S);
+}
+
+static void run_preset(const pipeline_preset_t *preset, double rate, double noise_c,
+                       double spike_prob, uint64_t seed, pipeline_result_t *result)
+{
+    sensor_filter_t filter;
+    adc_synth_t rng;
+    const long samples = (long)(TRACE_SECONDS * rate);
+    const double low = BASE_TEMP_C + 0.1 * (STEP_TEMP_C - BASE_TEMP_C);
+    const double high = BASE_TEMP_C + 0.9 * (STEP_TEMP_C - BASE_TEMP_C);
+    double t10 = -1.0;
+    double t90 = -1.0;
+    double steady_sq = 0.0;
+    long steady_n = 0;
+    double ramp_sum = 0.0;
+    long ramp_n = 0;
+
+    sensor_filter_init(&filter, preset->stages, preset->count);
+    // Same seed for every preset so they all see the identical trace
+    adc_synth_init(&rng, rate, 0.0, 0.0, seed);
+    result->max_excursion_c = 0.0;
+
+    for (long i = 0; i < samples; i++) {
+        double t = i / rate;
+        double truth = truth_at(t);
+        double measured = truth + noise_c * adc_synth_gaussian(&rng);
+        if (adc_synth_uniform(&rng) < spike_prob) {
+            measured += adc_synth_uniform(&rng) < 0.5 ? SPIKE_AMPLITUDE_C : -SPIKE_AMPLITUDE_C;
+        }
+
+        int32_t out = sensor_filter_process(&filter, (int32_t)lround(measured * 100.0));
+        double out_c = out / 100.0;
+        double err = out_c - truth;
+
+        // Skip the first second while the stages settle
+        if (t >= 1.0 && t < STEP_TIME_S) {
+            steady_sq += err * err;
+            steady_n++;
+            if (fabs(err) > result->max_excursion_c) {
+                result->max_excursion_c = fabs(err);
+            }
+        } else if (t >= STEP_TIME_S && t < RAMP_TIME_S) {
+            if (t10 < 0.0 && out_c >= low) {
+                t10 = t;
+            }
+            if (t90 < 0.0 && out_c >= high) {
+                t90 = t;
+            }
+        } else if (t >= RAMP_TIME_S + 2.0) {
+            ramp_sum += -err;
+            ramp_n++;
+        }
+    }
+
+    result->noise_rms_c = sqrt(steady_sq / steady_n);
+    result->rise_ms = (t10 >= 0.0 && t90 >= 0.0) ? (t90 - t10) * 1000.0 : -1.0;
+    result->ramp_lag_c = ramp_sum / ramp_n;
+    result->avg_ticks = sensor_filter_avg_ticks(&filter);
+    result->max_ticks = filter.stats.max_ticks;
+}
+
+int main(int argc, char **argv)
+{
+    double rate = DEFAULT_RATE_HZ;
+    double noise = DEFAULT_NOISE_C;
+    double spikes = DEFAULT_SPIKE_PROB;
+    uint64_t seed = 1;
+    int csv = 0;
+
+    static const struct option options[] = {
+        { "rate",   required_argument, NULL, 'r' },
+        { "noise",  required_argument, NULL, 'n' },
+        { "spikes", required_argument, NULL, 'p' },
+        { "seed",   required_argument, NULL, 's' },
+        { "csv",    no_argument,       NULL, 'c' },
+        { "help",   no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'r': rate = strtod(optarg, NULL); break;
+            case 'n': noise = strtod(optarg, NULL); break;
+            case 'p': spikes = strtod(optarg, NULL); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            case 'c': csv = 1; break;
+            default:
+                fprintf(stderr, "Usage: %s [--rate=HZ] [--noise=C] [--spikes=P] [--seed=N] [--csv]\n",
+                        argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    if (csv) {
+        printf("pipeline,noise_rms_c,max_excursion_c,rise_ms,ramp_lag_c,avg_%s,max_%s\n",
+               CYCLE_COUNTER_UNIT, CYCLE_COUNTER_UNIT);
+    } else {
+        printf("Rate %.3f Hz, noise %.2f C, spike probability %.3f (+/-%.1f C)\n",
+               rate, noise, spikes, SPIKE_AMPLITUDE_C);
+        printf("%-22s %10s %10s %9s %10s %9s %9s\n", "pipeline", "noise_C", "worst_C",
+               "rise_ms", "ramp_lag_C", "avg_" CYCLE_COUNTER_UNIT, "max_" CYCLE_COUNTER_UNIT);
+    }
+
+    for (size_t i = 0; i < PRESET_COUNT; i++) {
+        pipeline_result_t r;
+        run_preset(&presets[i], rate, noise, spikes, seed, &r);
+
+        if (csv) {
+            printf("%s,%.4f,%.4f,%.1f,%.4f,%u,%u\n", presets[i].name, r.noise_rms_c,
+                   r.max_excursion_c, r.rise_ms, r.ramp_lag_c, r.avg_ticks, r.max_ticks);
+        } else {
+            printf("%-22s %10.3f %10.3f %9.1f %10.3f %9u %9u\n", presets[i].name, r.noise_rms_c,
+                   r.max_excursion_c, r.rise_ms, r.ramp_lag_c, r.avg_ticks, r.max_ticks);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * @file flash_file.c
+ * @brief File-backed stand-in for a raw flash partition
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "flash_file.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static esp_err_t flash_file_read(void *ctx, uint32_t offset, void *dst, size_t len)
+{
+    flash_file_t *flash = ctx;
+
+    if ((uint64_t)offset + len > flash->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (fseek(flash->file, (long)offset, SEEK_SET) != 0 || fread(dst, 1, len, flash->file) != len) {
+        return ESP_FAIL;
+    }
+    flash->reads++;
+    return ESP_OK;
+}
+
+static esp_err_t flash_file_write(void *ctx, uint32_t offset, const void *src, size_t len)
+{
+    flash_file_t *flash = ctx;
+    uint8_t old[4096];
+    const uint8_t *data = src;
+
+    if ((uint64_t)offset + len > flash->size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // A simulated power cut programs only part of the write and fails
+    bool torn = false;
+    if (flash->fail_after_bytes > 0 && flash->bytes_written + len > flash->fail_after_bytes) {
+        len = (size_t)(flash->fail_after_bytes - flash->bytes_written);
+        torn = true;
+    }
+
+    for (size_t done = 0; done < len;) {
+        size_t chunk = len - done < sizeof(old) ? len - done : sizeof(old);
+        if (fseek(flash->file, (long)(offset + done), SEEK_SET) != 0 ||
+            fread(old, 1, chunk, flash->file) != chunk) {
+            return ESP_FAIL;
+        }
+        for (size_t i = 0; i < chunk; i++) {
+            if ((data[done + i] & ~old[i]) != 0) {
+                flash->violations++;
+            }
+            old[i] &= data[done + i];   // NOR: programming only clears bits
+        }
+        if (fseek(flash->file, (long)(offset + done), SEEK_SET) != 0 ||
+            fwrite(old, 1, chunk, flash->file) != chunk) {
+            return ESP_FAIL;
+        }
+        done += chunk;
+    }
+    fflush(flash->file);
+
+    flash->writes++;
+    flash->bytes_written += len;
+    return torn ? ESP_FAIL : ESP_OK;
+}
+
+static esp_err_t flash_file_erase(void *ctx, uint32_t offset, size_t len)
+{
+    flash_file_t *flash = ctx;
+    uint8_t blank[4096];
+
+    if (offset % flash->sector_size != 0 || len % flash->sector_size != 0 ||
+        (uint64_t)offset + len > flash->size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(blank, 0xFF, sizeof(blank));
+    for (size_t done = 0; done < len;) {
+        size_t chunk = len - done < sizeof(blank) ? len - done : sizeof(blank);
+        if (fseek(flash->file, (long)(offset + done), SEEK_SET) != 0 ||
+            fwrite(blank, 1, chunk, flash->file) != chunk) {
+            return ESP_FAIL;
+        }
+        done += chunk;
+    }
+    fflush(flash->file);
+
+    flash->erases += (uint32_t)(len / flash->sector_size);
+    return ESP_OK;
+}
+
+esp_err_t flash_file_open(flash_file_t *flash, const char *path, uint32_t size,
+                          uint32_t sector_size)
+{
+    memset(flash, 0, sizeof(*flash));
+    flash->size = size;
+    flash->sector_size = sector_size;
+
+    flash->file = fopen(path, "r+b");
+    if (flash->file == NULL) {
+        flash->file = fopen(path, "w+b");
+        if (flash->file == NULL) {
+            return ESP_FAIL;
+        }
+    }
+
+    // Extend a new or short image with erased bytes
+    fseek(flash->file, 0, SEEK_END);
+    long length = ftell(flash->file);
+    while (length < (long)size) {
+        fputc(0xFF, flash->file);
+        length++;
+    }
+    fflush(flash->file);
+    return ESP_OK;
+}
+
+void flash_file_close(flash_file_t *flash)
+{
+    if (flash->file != NULL) {
+        fclose(flash->file);
+        flash->file = NULL;
+    }
+}
+
+void flash_file_region(flash_file_t *flash, session_log_flash_t *region)
+{
+    region->read = flash_file_read;
+    region->write = flash_file_write;
+    region->erase = flash_file_erase;
+    region->ctx = flash;
+    region->size = flash->size;
+    region->sector_size = flash->sector_size;
+}
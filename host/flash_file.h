@@ -0,0 +1,73 @@
+/**
+ * @file flash_file.h
+ * @brief File-backed stand-in for a raw flash partition
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Behaves like SPI NOR flash behind esp_partition: erase sets whole sectors
+ * to 0xFF, and programming can only clear bits (new = old & data). Programming
+ * a bit from 0 back to 1 is counted as a violation, so host runs catch code
+ * that rewrites flash without erasing. The image persists in a file so a
+ * second run "reboots" onto the same contents. Exposes the session_log
+ * region interface directly.
+ */
+
+#ifndef FLASH_FILE_H
+#define FLASH_FILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "session_log.h"
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief File-backed partition
+ */
+typedef struct {
+    FILE *file;
+    uint32_t size;
+    uint32_t sector_size;
+    uint32_t reads;
+    uint32_t writes;
+    uint64_t bytes_written;
+    uint32_t erases;
+    uint32_t violations;        /**< Writes that tried to set a programmed bit */
+    uint32_t fail_after_bytes;  /**< Power-cut simulation: tear writes after this many bytes (0 = off) */
+} flash_file_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Open or create an image; new images start fully erased
+ *
+ * @param flash Partition state
+ * @param path Image file
+ * @param size Partition size
+ * @param sector_size Erase sector size
+ * @return ESP_OK on success, ESP_FAIL if the file cannot be opened
+ */
+esp_err_t flash_file_open(flash_file_t *flash, const char *path, uint32_t size,
+                          uint32_t sector_size);
+
+/**
+ * @brief Close the image
+ */
+void flash_file_close(flash_file_t *flash);
+
+/**
+ * @brief Fill a session_log region descriptor backed by this file
+ */
+void flash_file_region(flash_file_t *flash, session_log_flash_t *region);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLASH_FILE_H */
@@ -0,0 +1,597 @@
+/**
+ * @file freertos_fake.c
+ * @brief FreeRTOS tasks, queues, semaphores and notifications on POSIX threads
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * One kernel lock guards every queue and notification count, and one
+ * condition variable is broadcast on every change: blocked calls re-check
+ * their own condition. That is slower than per-object wait lists but keeps
+ * the semantics obvious, which is what the host build is for.
+ *
+ * Every wait that can block tells the power-management fake, which counts
+ * the time in which no task is ready as light sleep (pm_fake.c).
+ *
+ * Run-time stats count each task's thread CPU time in microseconds. Each
+ * core's idle task is a placeholder whose run time is the wall time minus
+ * the CPU time of the tasks on that core; unpinned tasks count half on each.
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/idf_additions.h"
+#include "esp_timer.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define HOST_TASK_MIN_STACK         (256 * 1024)    // glibc printf alone needs more than the target
+#define HOST_TASK_NAME_LEN          16
+
+/* ==================== DATA TYPES ==================== */
+
+struct host_task {
+    char name[HOST_TASK_NAME_LEN];
+    TaskFunction_t function;
+    void *arg;
+    uint32_t stack_depth;
+    UBaseType_t priority;
+    BaseType_t core_id;
+    uint32_t notify_count;
+    pthread_t thread;
+    bool running;               // thread is valid
+    struct host_task *next;     // All live tasks, for uxTaskGetSystemState
+};
+
+struct host_queue {
+    uint8_t *items;
+    UBaseType_t length;
+    UBaseType_t item_size;      // 0: semaphore (only the count matters)
+    UBaseType_t count;
+    UBaseType_t head;           // Oldest item
+    struct host_queue *set;     // Queue set this queue belongs to
+};
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_once_t kernel_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t kernel_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t kernel_changed;
+static pthread_mutex_t critical_lock;
+static UBaseType_t task_count = 0;
+static struct host_task *task_list = NULL;
+static struct host_task idle_tasks[portNUM_PROCESSORS] = {
+    { .name = "IDLE0", .core_id = 0 },
+    { .name = "IDLE1", .core_id = 1 },
+};
+static uint32_t idle_run_time[portNUM_PROCESSORS];   // Last reported, kept monotonic
+
+static __thread struct host_task *current_task = NULL;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static void kernel_init(void)
+{
+    pthread_condattr_t cond_attr;
+    pthread_condattr_init(&cond_attr);
+    pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&kernel_changed, &cond_attr);
+    pthread_condattr_destroy(&cond_attr);
+
+    pthread_mutexattr_t mutex_attr;
+    pthread_mutexattr_init(&mutex_attr);
+    pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&critical_lock, &mutex_attr);
+    pthread_mutexattr_destroy(&mutex_attr);
+}
+
+static void kernel_enter(void)
+{
+    pthread_once(&kernel_once, kernel_init);
+    pthread_mutex_lock(&kernel_lock);
+}
+
+static void kernel_exit_changed(void)
+{
+    pthread_cond_broadcast(&kernel_changed);
+    pthread_mutex_unlock(&kernel_lock);
+}
+
+static struct timespec deadline_after(TickType_t ticks)
+{
+    struct timespec deadline;
+    uint64_t ms = (uint64_t)ticks * 1000 / configTICK_RATE_HZ;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += (time_t)(ms / 1000);
+    deadline.tv_nsec += (long)(ms % 1000) * 1000000L;
+    if (deadline.tv_nsec >= 1000000000L) {
+        deadline.tv_sec++;
+        deadline.tv_nsec -= 1000000000L;
+    }
+    return deadline;
+}
+
+/**
+ * @brief Block on the kernel condition (kernel lock held)
+ *
+ * @return false once the deadline has passed
+ */
+static bool kernel_wait(TickType_t ticks, const struct timespec *deadline)
+{
+    bool woken;
+
+    if (ticks == 0) {
+        return false;
+    }
+    if (current_task != NULL) {
+        idf_fake_pm_task_block();
+    }
+    if (ticks == portMAX_DELAY) {
+        pthread_cond_wait(&kernel_changed, &kernel_lock);
+        woken = true;
+    } else {
+        woken = pthread_cond_timedwait(&kernel_changed, &kernel_lock, deadline) != ETIMEDOUT;
+    }
+    if (current_task != NULL) {
+        idf_fake_pm_task_unblock();
+    }
+    return woken;
+}
+
+void vPortEnterCritical(portMUX_TYPE *mux)
+{
+    pthread_once(&kernel_once, kernel_init);
+    pthread_mutex_lock(&critical_lock);
+}
+
+void vPortExitCritical(portMUX_TYPE *mux)
+{
+    pthread_mutex_unlock(&critical_lock);
+}
+
+BaseType_t xPortGetCoreID(void)
+{
+    struct host_task *task = current_task;
+    return task != NULL && task->core_id != tskNO_AFFINITY ? task->core_id : 0;
+}
+
+/* ---------- Tasks ---------- */
+
+/**
+ * @brief Remove a task from the task list (kernel lock held)
+ */
+static void task_unlink(struct host_task *task)
+{
+    for (struct host_task **link = &task_list; *link != NULL; link = &(*link)->next) {
+        if (*link == task) {
+            *link = task->next;
+            return;
+        }
+    }
+}
+
+static void *task_entry(void *arg)
+{
+    current_task = arg;
+    kernel_enter();
+    current_task->thread = pthread_self();
+    current_task->running = true;
+    pthread_mutex_unlock(&kernel_lock);
+    current_task->function(current_task->arg);
+    vTaskDelete(NULL);      // A task function must not return; the target would abort
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *created_task,
+                                   BaseType_t core_id)
+{
+    struct host_task *task = calloc(1, sizeof(*task));
+    if (task == NULL) {
+        return pdFAIL;
+    }
+    snprintf(task->name, sizeof(task->name), "%s", name != NULL ? name : "");
+    task->function = function;
+    task->arg = arg;
+    task->stack_depth = stack_depth;
+    task->priority = priority;
+    task->core_id = core_id;
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    size_t stack = stack_depth > HOST_TASK_MIN_STACK ? stack_depth : HOST_TASK_MIN_STACK;
+    pthread_attr_setstacksize(&attr, stack < PTHREAD_STACK_MIN ? PTHREAD_STACK_MIN : stack);
+
+    // The handle must be valid before the task can run and use it
+    if (created_task != NULL) {
+        *created_task = task;
+    }
+    kernel_enter();
+    task_count++;
+    task->next = task_list;
+    task_list = task;
+    pthread_mutex_unlock(&kernel_lock);
+    idf_fake_pm_task_unblock();     // Created ready
+
+    pthread_t thread;
+    int err = pthread_create(&thread, &attr, task_entry, task);
+    pthread_attr_destroy(&attr);
+    if (err != 0) {
+        kernel_enter();
+        task_count--;
+        task_unlink(task);
+        pthread_mutex_unlock(&kernel_lock);
+        idf_fake_pm_task_block();
+        free(task);
+        if (created_task != NULL) {
+            *created_task = NULL;
+        }
+        return pdFAIL;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    // Only self-deletion is emulated: other tasks are deleted on error paths
+    // the fakes never take, and a thread cannot be stopped safely from outside
+    if (task != NULL && task != current_task) {
+        return;
+    }
+    kernel_enter();
+    task_count--;
+    task_unlink(current_task);
+    pthread_mutex_unlock(&kernel_lock);
+    idf_fake_pm_task_block();
+    free(current_task);
+    current_task = NULL;
+    pthread_exit(NULL);
+}
+
+static void sleep_until_us(int64_t wake_us)
+{
+    int64_t now_us = esp_timer_get_time();
+    if (wake_us <= now_us) {
+        return;
+    }
+    struct timespec delay = {
+        .tv_sec = (time_t)((wake_us - now_us) / 1000000),
+        .tv_nsec = (long)((wake_us - now_us) % 1000000) * 1000L,
+    };
+    bool task = current_task != NULL;
+    if (task) {
+        idf_fake_pm_task_block();
+    }
+    while (nanosleep(&delay, &delay) != 0 && errno == EINTR) {
+    }
+    if (task) {
+        idf_fake_pm_task_unblock();
+    }
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    sleep_until_us(esp_timer_get_time() + (int64_t)ticks * 1000000 / configTICK_RATE_HZ);
+}
+
+BaseType_t xTaskDelayUntil(TickType_t *previous_wake_time, TickType_t increment)
+{
+    TickType_t wake = *previous_wake_time + increment;
+    TickType_t now = xTaskGetTickCount();
+
+    *previous_wake_time = wake;
+    if ((int32_t)(wake - now) <= 0) {
+        return pdFALSE;     // Already late: no delay, like the kernel
+    }
+    sleep_until_us((int64_t)wake * 1000000 / configTICK_RATE_HZ);
+    return pdTRUE;
+}
+
+TickType_t xTaskGetTickCount(void)
+{
+    return (TickType_t)(esp_timer_get_time() * configTICK_RATE_HZ / 1000000);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void)
+{
+    return current_task;
+}
+
+const char *pcTaskGetName(TaskHandle_t task)
+{
+    task = task != NULL ? task : current_task;
+    return task != NULL ? task->name : "";
+}
+
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority)
+{
+    task = task != NULL ? task : current_task;
+    if (task != NULL) {
+        task->priority = priority;
+    }
+}
+
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task)
+{
+    task = task != NULL ? task : current_task;
+    return task != NULL ? task->priority : 0;
+}
+
+UBaseType_t uxTaskGetNumberOfTasks(void)
+{
+    kernel_enter();
+    UBaseType_t count = task_count;
+    pthread_mutex_unlock(&kernel_lock);
+    return count;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task)
+{
+    task = task != NULL ? task : current_task;
+    return task != NULL ? task->stack_depth : 0;
+}
+
+TaskHandle_t xTaskGetIdleTaskHandleForCore(BaseType_t core_id)
+{
+    return core_id >= 0 && core_id < portNUM_PROCESSORS ? &idle_tasks[core_id] : NULL;
+}
+
+/**
+ * @brief CPU time of a task's thread in microseconds (kernel lock held)
+ */
+static uint64_t task_run_time_us(const struct host_task *task)
+{
+    clockid_t clock;
+    struct timespec now;
+
+    if (!task->running || pthread_getcpuclockid(task->thread, &clock) != 0 ||
+        clock_gettime(clock, &now) != 0) {
+        return 0;
+    }
+    return (uint64_t)now.tv_sec * 1000000u + (uint64_t)now.tv_nsec / 1000u;
+}
+
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *array, UBaseType_t size,
+                                 configRUN_TIME_COUNTER_TYPE *total)
+{
+    uint64_t busy_us[portNUM_PROCESSORS] = { 0 };
+    UBaseType_t count = 0;
+
+    kernel_enter();
+    if (task_count + portNUM_PROCESSORS > size) {
+        pthread_mutex_unlock(&kernel_lock);
+        return 0;
+    }
+    uint64_t wall_us = (uint64_t)esp_timer_get_time();
+    for (struct host_task *task = task_list; task != NULL; task = task->next) {
+        uint64_t run_us = task_run_time_us(task);
+        if (task->core_id >= 0 && task->core_id < portNUM_PROCESSORS) {
+            busy_us[task->core_id] += run_us;
+        } else {
+            for (int core = 0; core < portNUM_PROCESSORS; core++) {
+                busy_us[core] += run_us / portNUM_PROCESSORS;
+            }
+        }
+        array[count++] = (TaskStatus_t) {
+            .xHandle = task,
+            .pcTaskName = task->name,
+            .uxCurrentPriority = task->priority,
+            .ulRunTimeCounter = (configRUN_TIME_COUNTER_TYPE)run_us,
+            .xCoreID = task->core_id,
+        };
+    }
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        // A deleted task's time leaves the sum: never let the idle time go back
+        uint32_t idle_us = (uint32_t)(wall_us > busy_us[core] ? wall_us - busy_us[core] : 0);
+        if ((int32_t)(idle_us - idle_run_time[core]) > 0) {
+            idle_run_time[core] = idle_us;
+        }
+        array[count++] = (TaskStatus_t) {
+            .xHandle = &idle_tasks[core],
+            .pcTaskName = idle_tasks[core].name,
+            .uxCurrentPriority = 0,
+            .ulRunTimeCounter = idle_run_time[core],
+            .xCoreID = core,
+        };
+    }
+    pthread_mutex_unlock(&kernel_lock);
+
+    if (total != NULL) {
+        *total = (configRUN_TIME_COUNTER_TYPE)wall_us;
+    }
+    return count;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    kernel_enter();
+    task->notify_count++;
+    kernel_exit_changed();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_task_woken)
+{
+    xTaskNotifyGive(task);
+    if (higher_priority_task_woken != NULL) {
+        *higher_priority_task_woken = pdTRUE;
+    }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    struct host_task *task = current_task;
+    struct timespec deadline = deadline_after(ticks_to_wait);
+    uint32_t value;
+
+    kernel_enter();
+    while (task->notify_count == 0 && kernel_wait(ticks_to_wait, &deadline)) {
+    }
+    value = task->notify_count;
+    if (value > 0) {
+        task->notify_count = clear_on_exit ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return value;
+}
+
+/* ---------- Queues, semaphores and queue sets ---------- */
+
+static QueueHandle_t queue_create(UBaseType_t length, UBaseType_t item_size, UBaseType_t count)
+{
+    struct host_queue *queue = calloc(1, sizeof(*queue));
+    if (queue == NULL) {
+        return NULL;
+    }
+    if (item_size > 0) {
+        queue->items = calloc(length, item_size);
+        if (queue->items == NULL) {
+            free(queue);
+            return NULL;
+        }
+    }
+    queue->length = length;
+    queue->item_size = item_size;
+    queue->count = count;
+    return queue;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size)
+{
+    return length > 0 ? queue_create(length, item_size, 0) : NULL;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return queue_create(1, 0, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void)
+{
+    return queue_create(1, 0, 1);       // No priority inheritance on the host
+}
+
+QueueSetHandle_t xQueueCreateSet(UBaseType_t length)
+{
+    return queue_create(length, sizeof(QueueSetMemberHandle_t), 0);
+}
+
+void vQueueDelete(QueueHandle_t queue)
+{
+    if (queue != NULL) {
+        free(queue->items);
+        free(queue);
+    }
+}
+
+/**
+ * @brief Append an item (kernel lock held, space checked by the caller)
+ */
+static void queue_push(QueueHandle_t queue, const void *item)
+{
+    if (queue->item_size > 0) {
+        UBaseType_t tail = (queue->head + queue->count) % queue->length;
+        memcpy(queue->items + (size_t)tail * queue->item_size, item, queue->item_size);
+    }
+    queue->count++;
+
+    // The set receives the member's handle once per item, like the kernel
+    if (queue->set != NULL && queue->set->count < queue->set->length) {
+        queue_push(queue->set, &queue);
+    }
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait)
+{
+    struct timespec deadline = deadline_after(ticks_to_wait);
+    BaseType_t ret = pdFAIL;
+
+    kernel_enter();
+    while (queue->count >= queue->length && kernel_wait(ticks_to_wait, &deadline)) {
+    }
+    if (queue->count < queue->length) {
+        queue_push(queue, item);
+        ret = pdPASS;
+    }
+    kernel_exit_changed();
+    return ret;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item,
+                             BaseType_t *higher_priority_task_woken)
+{
+    BaseType_t ret = xQueueSend(queue, item, 0);
+    if (ret == pdPASS && higher_priority_task_woken != NULL) {
+        *higher_priority_task_woken = pdTRUE;
+    }
+    return ret;
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t queue, const void *item)
+{
+    kernel_enter();
+    if (queue->count >= queue->length) {
+        queue->count = 0;       // Length-one queue: drop the old item
+    }
+    queue_push(queue, item);
+    kernel_exit_changed();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticks_to_wait)
+{
+    struct timespec deadline = deadline_after(ticks_to_wait);
+    BaseType_t ret = pdFAIL;
+
+    kernel_enter();
+    while (queue->count == 0 && kernel_wait(ticks_to_wait, &deadline)) {
+    }
+    if (queue->count > 0) {
+        if (queue->item_size > 0) {
+            memcpy(buffer, queue->items + (size_t)queue->head * queue->item_size, queue->item_size);
+            queue->head = (queue->head + 1) % queue->length;
+        }
+        queue->count--;
+        ret = pdPASS;
+    }
+    kernel_exit_changed();
+    return ret;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    kernel_enter();
+    UBaseType_t count = queue->count;
+    pthread_mutex_unlock(&kernel_lock);
+    return count;
+}
+
+BaseType_t xQueueAddToSet(QueueSetMemberHandle_t member, QueueSetHandle_t set)
+{
+    BaseType_t ret = pdFAIL;
+
+    kernel_enter();
+    if (member->set == NULL && member->count == 0) {
+        member->set = set;
+        ret = pdPASS;
+    }
+    pthread_mutex_unlock(&kernel_lock);
+    return ret;
+}
+
+QueueSetMemberHandle_t xQueueSelectFromSet(QueueSetHandle_t set, TickType_t ticks_to_wait)
+{
+    QueueSetMemberHandle_t member = NULL;
+    return xQueueReceive(set, &member, ticks_to_wait) == pdPASS ? member : NULL;
+}
@@ -0,0 +1,418 @@
+/**
+ * @file gpio_fake.c
+ * @brief GPIO levels with the keypad matrix and HD44780 bus models attached
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Pin interrupts are evaluated whenever a level can have changed (a write,
+ * a key, an interrupt enabled); handlers run on the calling thread, outside
+ * the GPIO lock, as the "ISR".
+ */
+
+#include <pthread.h>
+#include <string.h>
+#include "driver/gpio.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define LCD_DDRAM_LINE_LEN          0x28    // 40 characters per line in 2-line mode
+#define LCD_DDRAM_LINE1             0x40
+
+#define LCD_CMD_CLEAR               0x01
+#define LCD_CMD_HOME                0x02
+#define LCD_CMD_FUNC_SET            0x20
+#define LCD_ARG_FS_8_BIT            0x10
+#define LCD_CMD_CGRAM_ADDR          0x40
+#define LCD_CMD_DDRAM_ADDR          0x80
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief What the controller latched from the bus
+ */
+typedef struct {
+    bool four_bit;              // After "function set, 4-bit"
+    bool have_high;             // First nibble of a byte latched
+    uint8_t high;
+    bool cgram;                 // Data goes to the glyph RAM
+    uint8_t address;            // DDRAM address counter
+    char ddram[2][LCD_DDRAM_LINE_LEN];
+    uint32_t bytes;
+} lcd_model_t;
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_mutex_t gpio_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t levels[GPIO_NUM_MAX];
+static gpio_mode_t modes[GPIO_NUM_MAX];
+static bool pull_ups[GPIO_NUM_MAX];
+
+static bool isr_service = false;
+static gpio_int_type_t intr_types[GPIO_NUM_MAX];
+static bool intr_enabled[GPIO_NUM_MAX];
+static uint8_t intr_levels[GPIO_NUM_MAX];       // Level at the last evaluation (edges)
+static gpio_isr_t isr_handlers[GPIO_NUM_MAX];
+static void *isr_args[GPIO_NUM_MAX];
+
+static const int row_pins[IDF_FAKE_KEYPAD_ROWS] = IDF_FAKE_ROW_PINS;
+static const int col_pins[IDF_FAKE_KEYPAD_COLS] = IDF_FAKE_COL_PINS;
+static const char key_map[] = IDF_FAKE_KEY_MAP;
+static bool keys_down[IDF_FAKE_KEYPAD_ROWS][IDF_FAKE_KEYPAD_COLS];
+
+static const int lcd_data_pins[4] = IDF_FAKE_LCD_DATA_PINS;
+static lcd_model_t lcd = {
+    .ddram = {
+        [0 ... 1] = { [0 ... LCD_DDRAM_LINE_LEN - 1] = ' ' },
+    },
+};
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+static void gpio_raise_interrupts(void);
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static bool valid_pin(gpio_num_t gpio_num)
+{
+    return gpio_num >= 0 && gpio_num < GPIO_NUM_MAX;
+}
+
+/* ---------- HD44780 model ---------- */
+
+static void lcd_advance(void)
+{
+    lcd.address++;
+    // The counter runs from the end of line 0 into line 1 and back
+    if (lcd.address == LCD_DDRAM_LINE_LEN) {
+        lcd.address = LCD_DDRAM_LINE1;
+    } else if (lcd.address == LCD_DDRAM_LINE1 + LCD_DDRAM_LINE_LEN) {
+        lcd.address = 0;
+    }
+}
+
+static void lcd_latch_byte(bool rs, uint8_t value)
+{
+    lcd.bytes++;
+    if (rs) {
+        if (!lcd.cgram) {
+            int line = lcd.address >= LCD_DDRAM_LINE1;
+            lcd.ddram[line][lcd.address - (line ? LCD_DDRAM_LINE1 : 0)] = (char)value;
+            lcd_advance();
+        }
+        return;
+    }
+
+    if (value & LCD_CMD_DDRAM_ADDR) {
+        uint8_t address = value & 0x7F;
+        bool line1 = address >= LCD_DDRAM_LINE1;
+        if ((address & 0x3F) < LCD_DDRAM_LINE_LEN) {
+            lcd.address = line1 ? (uint8_t)(LCD_DDRAM_LINE1 + (address & 0x3F)) : address;
+        }
+        lcd.cgram = false;
+    } else if (value & LCD_CMD_CGRAM_ADDR) {
+        lcd.cgram = true;
+    } else if ((value & 0xE0) == LCD_CMD_FUNC_SET && (value & LCD_ARG_FS_8_BIT)) {
+        lcd.four_bit = false;   // hd44780_init() resynchronizes this way
+    } else if (value == LCD_CMD_CLEAR) {
+        memset(lcd.ddram, ' ', sizeof(lcd.ddram));
+        lcd.address = 0;
+        lcd.cgram = false;
+    } else if ((value & ~1) == LCD_CMD_HOME) {
+        lcd.address = 0;
+        lcd.cgram = false;
+    }
+    // Entry mode, display control and shifts: the driver uses the defaults
+}
+
+/**
+ * @brief Falling edge of E: the controller latches D7..D4
+ */
+static void lcd_latch_nibble(void)
+{
+    uint8_t nibble = 0;
+    for (int bit = 0; bit < 4; bit++) {
+        nibble |= (uint8_t)((levels[lcd_data_pins[bit]] & 1) << bit);
+    }
+    bool rs = levels[IDF_FAKE_LCD_RS] != 0;
+
+    if (!lcd.four_bit) {
+        // 8-bit interface with D3..D0 unconnected: every nibble is a whole command
+        uint8_t command = (uint8_t)(nibble << 4);
+        if ((command & 0xE0) == LCD_CMD_FUNC_SET && !(command & LCD_ARG_FS_8_BIT)) {
+            lcd.four_bit = true;
+        }
+        lcd.bytes++;
+        return;
+    }
+    if (!lcd.have_high) {
+        lcd.high = nibble;
+        lcd.have_high = true;
+        return;
+    }
+    lcd.have_high = false;
+    lcd_latch_byte(rs, (uint8_t)(lcd.high << 4 | nibble));
+}
+
+void idf_fake_lcd_text(char lines[IDF_FAKE_LCD_LINES][IDF_FAKE_LCD_COLS + 1])
+{
+    pthread_mutex_lock(&gpio_lock);
+    for (int line = 0; line < IDF_FAKE_LCD_LINES; line++) {
+        for (int col = 0; col < IDF_FAKE_LCD_COLS; col++) {
+            char c = lcd.ddram[line][col];
+            lines[line][col] = c >= ' ' && c <= '~' ? c : '?';
+        }
+        lines[line][IDF_FAKE_LCD_COLS] = '\0';
+    }
+    pthread_mutex_unlock(&gpio_lock);
+}
+
+uint32_t idf_fake_lcd_bytes(void)
+{
+    pthread_mutex_lock(&gpio_lock);
+    uint32_t bytes = lcd.bytes;
+    pthread_mutex_unlock(&gpio_lock);
+    return bytes;
+}
+
+/* ---------- Keypad model ---------- */
+
+esp_err_t idf_fake_key(char key, bool pressed)
+{
+    const char *at = strchr(key_map, key);
+    if (key == '\0' || at == NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    int index = (int)(at - key_map);
+
+    pthread_mutex_lock(&gpio_lock);
+    keys_down[index / IDF_FAKE_KEYPAD_COLS][index % IDF_FAKE_KEYPAD_COLS] = pressed;
+    pthread_mutex_unlock(&gpio_lock);
+    gpio_raise_interrupts();
+    return ESP_OK;
+}
+
+/**
+ * @brief Column level: low while a pressed key connects it to a low row
+ */
+static int keypad_column_level(int col)
+{
+    for (int row = 0; row < IDF_FAKE_KEYPAD_ROWS; row++) {
+        if (keys_down[row][col] && modes[row_pins[row]] == GPIO_MODE_OUTPUT &&
+            levels[row_pins[row]] == 0) {
+            return 0;
+        }
+    }
+    return pull_ups[col_pins[col]] ? 1 : 0;
+}
+
+/**
+ * @brief Pin level as read back (gpio lock held)
+ */
+static int pin_level(gpio_num_t gpio_num)
+{
+    for (int col = 0; col < IDF_FAKE_KEYPAD_COLS; col++) {
+        if (col_pins[col] == gpio_num) {
+            return keypad_column_level(col);
+        }
+    }
+    return levels[gpio_num];
+}
+
+/* ---------- Interrupts ---------- */
+
+static bool intr_pending(int pin, int level)
+{
+    switch (intr_types[pin]) {
+    case GPIO_INTR_LOW_LEVEL:
+        return level == 0;
+    case GPIO_INTR_HIGH_LEVEL:
+        return level == 1;
+    case GPIO_INTR_POSEDGE:
+        return level > intr_levels[pin];
+    case GPIO_INTR_NEGEDGE:
+        return level < intr_levels[pin];
+    case GPIO_INTR_ANYEDGE:
+        return level != intr_levels[pin];
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Call the handler of every pin whose interrupt condition holds
+ */
+static void gpio_raise_interrupts(void)
+{
+    gpio_isr_t handlers[GPIO_NUM_MAX];
+    void *args[GPIO_NUM_MAX];
+    int count = 0;
+
+    pthread_mutex_lock(&gpio_lock);
+    for (int pin = 0; pin < GPIO_NUM_MAX; pin++) {
+        if (isr_handlers[pin] == NULL) {
+            continue;
+        }
+        int level = pin_level(pin);
+        if (isr_service && intr_enabled[pin] && intr_pending(pin, level)) {
+            handlers[count] = isr_handlers[pin];
+            args[count] = isr_args[pin];
+            count++;
+        }
+        intr_levels[pin] = (uint8_t)level;
+    }
+    pthread_mutex_unlock(&gpio_lock);
+
+    for (int i = 0; i < count; i++) {
+        handlers[i](args[i]);
+    }
+}
+
+/* ---------- Driver API ---------- */
+
+esp_err_t gpio_config(const gpio_config_t *config)
+{
+    if (config == NULL || config->pin_bit_mask == 0 ||
+        (config->pin_bit_mask >> GPIO_NUM_MAX) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    for (int pin = 0; pin < GPIO_NUM_MAX; pin++) {
+        if (config->pin_bit_mask & (1ULL << pin)) {
+            modes[pin] = config->mode;
+            pull_ups[pin] = config->pull_up_en == GPIO_PULLUP_ENABLE;
+            intr_types[pin] = config->intr_type;
+        }
+    }
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+    if (!valid_pin(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    uint8_t previous = levels[gpio_num];
+    levels[gpio_num] = level ? 1 : 0;
+    if (gpio_num == IDF_FAKE_LCD_E && previous && !level) {
+        lcd_latch_nibble();
+    }
+    pthread_mutex_unlock(&gpio_lock);
+    gpio_raise_interrupts();
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+    if (!valid_pin(gpio_num)) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    int level = pin_level(gpio_num);
+    pthread_mutex_unlock(&gpio_lock);
+    return level;
+}
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+    pthread_mutex_lock(&gpio_lock);
+    bool installed = isr_service;
+    isr_service = true;
+    pthread_mutex_unlock(&gpio_lock);
+    return installed ? ESP_ERR_INVALID_STATE : ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void *args)
+{
+    if (!valid_pin(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    if (!isr_service) {
+        pthread_mutex_unlock(&gpio_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    isr_handlers[gpio_num] = isr_handler;
+    isr_args[gpio_num] = args;
+    intr_levels[gpio_num] = (uint8_t)pin_level(gpio_num);
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_isr_handler_remove(gpio_num_t gpio_num)
+{
+    if (!valid_pin(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    isr_handlers[gpio_num] = NULL;
+    isr_args[gpio_num] = NULL;
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type)
+{
+    if (!valid_pin(gpio_num) || intr_type > GPIO_INTR_HIGH_LEVEL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    intr_types[gpio_num] = intr_type;
+    pthread_mutex_unlock(&gpio_lock);
+    gpio_raise_interrupts();
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+    if (!valid_pin(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    intr_enabled[gpio_num] = true;
+    pthread_mutex_unlock(&gpio_lock);
+    gpio_raise_interrupts();
+    return ESP_OK;
+}
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+    if (!valid_pin(gpio_num)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    pthread_mutex_lock(&gpio_lock);
+    intr_enabled[gpio_num] = false;
+    pthread_mutex_unlock(&gpio_lock);
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t gpio_num, gpio_int_type_t intr_type)
+{
+    // Light sleep is the blocked-tasks state of the FreeRTOS fake, which any
+    // interrupt ends: only the argument checks of the driver are left
+    if (!valid_pin(gpio_num) ||
+        (intr_type != GPIO_INTR_LOW_LEVEL && intr_type != GPIO_INTR_HIGH_LEVEL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t gpio_num)
+{
+    return valid_pin(gpio_num) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t gpio_sleep_sel_dis(gpio_num_t gpio_num)
+{
+    return valid_pin(gpio_num) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
@@ -0,0 +1,234 @@
+/**
+ * @file grill_app.c
+ * @brief The whole firmware on Linux: app_main over the in-process fakes
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Links main/ and the hd44780 component unchanged against the host ESP-IDF
+ * headers (host/include) and the *_fake.c files behind them, then
+ * starts app_main on a "main" task as the target's startup code does. The
+ * serial console reads stdin; besides the firmware's own commands it has
+ * the hardware controls:
+ *
+ * - key <chars>                press and release keypad keys in turn
+ * - lcd                        print the LCD text
+ * - probe <zone> <C|plant>     fix a probe temperature or return zone 0
+ *                              to the thermal plant
+ * - lid open|closed            open or close the grill lid of the plant
+ * - turn <detents>             turn the encoder (negative: counter-clockwise)
+ * - plant                      print the plant state and the heater duty
+ *
+ * so a session can be typed or piped in:
+ *
+ *   printf 'key 1\nlcd\nstats ui\n' | grill_app --seconds=5
+ *
+ * The telemetry UART is a pty; --pty links it to a fixed path for
+ * host/telemetry_decode:
+ *
+ *   grill_app --pty=/tmp/grill-telemetry &
+ *   telemetry_decode /tmp/grill-telemetry
+ *
+ * Usage: grill_app [--seconds=N] [--flash=PATH] [--pty=PATH]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "grill_console.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define MAIN_TASK_STACK         8192    // CONFIG_ESP_MAIN_TASK_STACK_SIZE
+#define MAIN_TASK_PRIORITY      1       // ESP_TASK_MAIN_PRIO
+
+#define KEY_HOLD_MS             100     // Well past the 50 ms debounce
+#define KEY_GAP_MS              100
+#define DETENT_GAP_MS           150     // Slow enough to stay out of acceleration
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+void app_main(void);
+
+static int cmd_key(int argc, char **argv);
+static int cmd_lcd(int argc, char **argv);
+static int cmd_probe(int argc, char **argv);
+static int cmd_lid(int argc, char **argv);
+static int cmd_turn(int argc, char **argv);
+static int cmd_plant(int argc, char **argv);
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const grill_console_cmd_t host_cmds[] = {
+    { "key",   "<chars>",       "Press keypad keys one after another", cmd_key },
+    { "lcd",   "",              "Print the LCD text", cmd_lcd },
+    { "probe", "<zone> <C|plant>", "Fix a probe or return zone 0 to the plant", cmd_probe },
+    { "lid",   "open|closed",   "Open or close the grill lid", cmd_lid },
+    { "turn",  "<detents>",     "Turn the encoder (negative: CCW)", cmd_turn },
+    { "plant", "",              "Print the thermal plant and heater duty", cmd_plant },
+};
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static int cmd_key(int argc, char **argv)
+{
+    if (argc != 2) {
+        printf("usage: key <chars>\n");
+        return 1;
+    }
+    for (const char *key = argv[1]; *key != '\0'; key++) {
+        if (idf_fake_key(*key, true) != ESP_OK) {
+            printf("no key '%c' on the keypad\n", *key);
+            return 1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(KEY_HOLD_MS));
+        idf_fake_key(*key, false);
+        vTaskDelay(pdMS_TO_TICKS(KEY_GAP_MS));
+    }
+    return 0;
+}
+
+static int cmd_lcd(int argc, char **argv)
+{
+    char lines[IDF_FAKE_LCD_LINES][IDF_FAKE_LCD_COLS + 1];
+
+    idf_fake_lcd_text(lines);
+    for (int line = 0; line < IDF_FAKE_LCD_LINES; line++) {
+        printf("|%s|\n", lines[line]);
+    }
+    return 0;
+}
+
+static int cmd_probe(int argc, char **argv)
+{
+    if (argc != 3) {
+        printf("usage: probe <zone> <C|plant>\n");
+        return 1;
+    }
+
+    int zone = atoi(argv[1]);
+    char *end;
+    double celsius = strtod(argv[2], &end);
+    if (strcmp(argv[2], "plant") == 0 && zone == 0) {
+        celsius = NAN;
+    } else if (end == argv[2] || *end != '\0') {
+        printf("bad temperature '%s'\n", argv[2]);
+        return 1;
+    }
+
+    if (idf_fake_set_probe(zone, celsius) != ESP_OK) {
+        printf("no probe %d\n", zone);
+        return 1;
+    }
+    return 0;
+}
+
+static int cmd_lid(int argc, char **argv)
+{
+    if (argc != 2 || (strcmp(argv[1], "open") != 0 && strcmp(argv[1], "closed") != 0)) {
+        printf("usage: lid open|closed\n");
+        return 1;
+    }
+    idf_fake_set_lid(strcmp(argv[1], "open") == 0);
+    return 0;
+}
+
+static int cmd_turn(int argc, char **argv)
+{
+    if (argc != 2) {
+        printf("usage: turn <detents>\n");
+        return 1;
+    }
+
+    int detents = atoi(argv[1]);
+    int direction = detents < 0 ? -1 : 1;
+    for (int i = 0; i < abs(detents); i++) {
+        if (idf_fake_encoder_detent(direction) != ESP_OK) {
+            printf("encoder not running\n");
+            return 1;
+        }
+        vTaskDelay(pdMS_TO_TICKS(DETENT_GAP_MS));
+    }
+    return 0;
+}
+
+static int cmd_plant(int argc, char **argv)
+{
+    double probe_c, patty_c, plate_c, duty;
+
+    idf_fake_plant(&probe_c, &patty_c, &plate_c, &duty);
+    printf("probe %.1f C  patty %.1f C  plate %.1f C  heater %.0f %%\n",
+           probe_c, patty_c, plate_c, duty * 100.0);
+    return 0;
+}
+
+static void main_task(void *arg)
+{
+    app_main();
+    vTaskDelete(NULL);
+}
+
+int main(int argc, char **argv)
+{
+    int seconds = 0;            // 0: run until killed
+    const char *flash_path = NULL;
+    const char *pty_path = NULL;
+
+    static const struct option options[] = {
+        { "seconds", required_argument, NULL, 's' },
+        { "flash",   required_argument, NULL, 'f' },
+        { "pty",     required_argument, NULL, 'p' },
+        { NULL, 0, NULL, 0 },
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+        case 's':
+            seconds = atoi(optarg);
+            break;
+        case 'f':
+            flash_path = optarg;
+            break;
+        case 'p':
+            pty_path = optarg;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [--seconds=N] [--flash=PATH] [--pty=PATH]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (flash_path != NULL) {
+        esp_err_t ret = idf_fake_flash_open(flash_path);
+        if (ret != ESP_OK) {
+            fprintf(stderr, "cannot open %s: %s\n", flash_path, esp_err_to_name(ret));
+            return 1;
+        }
+    }
+    if (pty_path != NULL) {
+        idf_fake_uart_link(pty_path);
+    }
+    // Before app_main reaches grill_console_start()
+    grill_console_add_commands(host_cmds, sizeof(host_cmds) / sizeof(host_cmds[0]));
+
+    if (xTaskCreatePinnedToCore(main_task, "main", MAIN_TASK_STACK, NULL, MAIN_TASK_PRIORITY,
+                                NULL, 0) != pdPASS) {
+        fprintf(stderr, "cannot start the main task\n");
+        return 1;
+    }
+
+    if (seconds <= 0) {
+        while (1) {
+            pause();
+        }
+    }
+    sleep((unsigned int)seconds);
+    cmd_lcd(0, NULL);
+    fflush(stdout);
+    exit(0);
+}
@@ -0,0 +1,417 @@
+/**
+ * @file grill_sim.c
+ * @brief Closed-loop cook on the thermal plant model, faster than real time
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Wires the firmware's zone-0 signal chain and controllers to thermal_plant
+ * in place of the ADC and the heater:
+ *
+ *   plant probe -> oversampled ADC code (78 Hz) -> temp_lut -> sensor_filter
+ *     -> heater_pid (50 Hz) -> duty -> plant
+ *     -> doneness + temp_alarm (2 Hz)
+ *
+ * with the rates, filter stages, tuning and alarm settings of main.c. The
+ * scripted cook runs the BEEF profile: warm up to the WELL DONE midpoint,
+ * open the lid for a minute, then switch to MEDIUM RARE. The report gives
+ * rise time, overshoot, steady-state error and duty chatter, the lid-open
+ * drop and recovery,
+ * the settle after the setpoint change, the alarm events and how much
+ * faster than real time the run was. Exits non-zero if any of these is
+ * outside its limit, so tuning and alarm changes can be checked in seconds.
+ *
+ * Usage: grill_sim [--minutes=N] [--kp=X] [--ki=X] [--kd=X] [--kd-filter=S]
+ *                  [--kff=X] [--noise=LSB] [--trace=S] [--verbose] [--seed=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "thermal_plant.h"
+#include "temp_lut.h"
+#include "sensor_filter.h"
+#include "heater_pid.h"
+#include "doneness.h"
+#include "temp_alarm.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+// Matches main.c
+#define ADC_SAMPLE_FREQ_HZ      20000
+#define ADC_OVERSAMPLE_BITS     4
+#define READING_PERIOD_US       ((1000000LL << (2 * ADC_OVERSAMPLE_BITS)) / ADC_SAMPLE_FREQ_HZ)
+#define CONTROL_PERIOD_MS       20
+#define MONITOR_PERIOD_MS       500
+#define KP                      20.0f
+#define KI                      0.02f
+#define KD                      20.0f
+#define KD_FILTER_S             1.0f
+#define KFF                     0.5f
+#define AMBIENT_CENTI           2000
+#define HYSTERESIS_CENTI        50
+#define BAND_DWELL_MS           2000
+#define ALARM_DWELL_MS          3000
+#define RATE_LIMIT_CENTI_MIN    600
+#define RATE_HYSTERESIS         200
+
+// Script
+#define DEFAULT_MINUTES         30
+#define FIRST_LEVEL             2       // WELL DONE
+#define SECOND_LEVEL            1       // MEDIUM RARE
+#define LID_OPEN_S              (12 * 60)
+#define LID_OPEN_FOR_S          60
+#define LEVEL_CHANGE_S          (20 * 60)
+#define STEADY_WINDOW_S         120     // Error measured over this window before the lid opens
+#define SETTLED_CENTI           50      // "At the setpoint" is within 0.5 C
+#define DEFAULT_NOISE_LSB       1.5
+
+// Limits
+#define MAX_RISE_S              600
+#define MAX_OVERSHOOT_CENTI     100
+#define MAX_STEADY_ERROR_CENTI  20
+#define MAX_LID_RECOVERY_S      240
+#define MAX_LEVEL_SETTLE_S      420
+#define MIN_SPEEDUP             1000.0
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief What the run measured
+ */
+typedef struct {
+    double rise_s;                  /**< First time within SETTLED_CENTI of the first setpoint */
+    int32_t overshoot_centi;        /**< Largest excursion above the first setpoint before the lid opens */
+    double steady_abs_sum;          /**< Sum of |error| over the steady window */
+    long steady_samples;
+    double steady_chatter_sq_sum;   /**< Sum of squared step-to-step duty changes, same window */
+    int32_t lid_drop_centi;         /**< Largest excursion below the setpoint from the lid opening */
+    double lid_recovery_s;          /**< Time from closing the lid back to within SETTLED_CENTI */
+    double level_settle_s;          /**< Time from the level change to within SETTLED_CENTI */
+    int32_t level_undershoot_centi;
+    long band_events;
+    long alarm_raised[TEMP_ALARM_COUNT];
+    long control_steps;
+    long saturated_steps;
+} sim_result_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Band midpoint, as publish_grill_target() in main.c computes it
+ */
+static int32_t band_setpoint(const cook_profile_t *profile, uint8_t level)
+{
+    const cook_band_t *band = &profile->bands[level];
+    return ((int32_t)band->min_c * 100 + (int32_t)band->max_c * 100 + 99) / 2;
+}
+
+static void print_event(const cook_profile_t *profile, const temp_alarm_event_t *ev, double t)
+{
+    if (ev->type == TEMP_ALARM_EVENT_BAND) {
+        printf("  %7.1fs %6.2f C  band %s -> %s\n", t, ev->centi / 100.0,
+               ev->previous == COOK_PROFILE_NO_BAND ? "-" : cook_profile_band_name(profile, ev->previous),
+               ev->id == COOK_PROFILE_NO_BAND ? "-" : cook_profile_band_name(profile, ev->id));
+    } else {
+        printf("  %7.1fs %6.2f C  %s %s\n", t, ev->centi / 100.0,
+               temp_alarm_name((temp_alarm_id_t)ev->id),
+               ev->type == TEMP_ALARM_EVENT_RAISED ? "raised" : "cleared");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    long minutes = DEFAULT_MINUTES;
+    heater_pid_config_t tuning = {
+        .kp = KP, .ki = KI, .kd = KD, .kd_filter_s = KD_FILTER_S, .kff = KFF,
+        .ambient_centi = AMBIENT_CENTI, .period_ms = CONTROL_PERIOD_MS,
+    };
+    double noise = DEFAULT_NOISE_LSB;
+    long trace_s = 0;
+    bool verbose = false;
+    uint64_t seed = 1;
+
+    static const struct option options[] = {
+        { "minutes", required_argument, NULL, 'm' },
+        { "kp",      required_argument, NULL, 'p' },
+        { "ki",      required_argument, NULL, 'i' },
+        { "kd",      required_argument, NULL, 'd' },
+        { "kd-filter", required_argument, NULL, 'D' },
+        { "kff",     required_argument, NULL, 'f' },
+        { "noise",   required_argument, NULL, 'n' },
+        { "trace",   required_argument, NULL, 't' },
+        { "verbose", no_argument,       NULL, 'v' },
+        { "seed",    required_argument, NULL, 's' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'm': minutes = atol(optarg); break;
+            case 'p': tuning.kp = strtof(optarg, NULL); break;
+            case 'i': tuning.ki = strtof(optarg, NULL); break;
+            case 'd': tuning.kd = strtof(optarg, NULL); break;
+            case 'D': tuning.kd_filter_s = strtof(optarg, NULL); break;
+            case 'f': tuning.kff = strtof(optarg, NULL); break;
+            case 'n': noise = strtod(optarg, NULL); break;
+            case 't': trace_s = atol(optarg); break;
+            case 'v': verbose = true; break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "Usage: %s [--minutes=N] [--kp=X] [--ki=X] [--kd=X] [--kd-filter=S]\n"
+                        "       [--kff=X] [--noise=LSB] [--trace=S] [--verbose] [--seed=N]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+    if (minutes * 60 <= LEVEL_CHANGE_S) {
+        fprintf(stderr, "The script needs more than %d minutes\n", LEVEL_CHANGE_S / 60);
+        return 2;
+    }
+
+    // Firmware modules, configured as main.c configures them
+    static cook_profile_set_t profiles;
+    static temp_lut_t lut;
+    static doneness_estimator_t trend;
+    if (cook_profile_load(&profiles, cook_profile_default_blob, cook_profile_default_blob_size) != ESP_OK ||
+        temp_lut_build(&lut, temp_lut_linear_voltage, NULL) != ESP_OK) {
+        fprintf(stderr, "Built-in profiles or LUT rejected\n");
+        return 1;
+    }
+    const cook_profile_t *profile = &profiles.profiles[0];
+
+    static const sensor_filter_stage_config_t stages[] = {
+        { .type = SENSOR_FILTER_MEDIAN, .median = { .window = 5 } },
+        { .type = SENSOR_FILTER_IIR,    .iir = { .shift = 3 } },
+    };
+    sensor_filter_t filter;
+    sensor_filter_init(&filter, stages, sizeof(stages) / sizeof(stages[0]));
+
+    heater_pid_t pid;
+    if (heater_pid_init(&pid, &tuning) != ESP_OK) {
+        fprintf(stderr, "Tuning rejected\n");
+        return 2;
+    }
+
+    const temp_alarm_config_t alarm_config = {
+        .hysteresis_centi = HYSTERESIS_CENTI,
+        .band_dwell_ms = BAND_DWELL_MS,
+        .alarm_dwell_ms = ALARM_DWELL_MS,
+        .rate_centi_per_min = RATE_LIMIT_CENTI_MIN,
+        .rate_hysteresis = RATE_HYSTERESIS,
+    };
+    temp_alarm_t alarm;
+    temp_alarm_init(&alarm, &alarm_config, profile);
+    doneness_init(&trend);
+
+    thermal_plant_config_t plant_config;
+    thermal_plant_default_config(&plant_config);
+    thermal_plant_t plant;
+    thermal_plant_init(&plant, &plant_config);
+    adc_synth_t synth;
+    adc_synth_init(&synth, ADC_SAMPLE_FREQ_HZ, noise, 0.0, seed);
+
+    printf("Profile %s, %s then %s, lid open at %d s for %d s, %ld min\n", profile->name,
+           cook_profile_band_name(profile, FIRST_LEVEL), cook_profile_band_name(profile, SECOND_LEVEL),
+           LID_OPEN_S, LID_OPEN_FOR_S, minutes);
+    printf("Kp %.3f Ki %.4f Kd %.3f (tau %.2f s) Kff %.3f; plant %.0f W, plate %.0f J/K, patty %.0f J/K in at %.1f C\n\n",
+           tuning.kp, tuning.ki, tuning.kd, tuning.kd_filter_s, tuning.kff, plant_config.heater_w,
+           plant_config.plate_j_per_k, plant_config.patty_j_per_k, plant_config.initial_patty_c);
+    if (trace_s > 0) {
+        printf("%8s %8s %8s %8s %8s %8s %7s\n", "time s", "plate C", "probe C", "filt C", "patty C",
+               "setpt C", "duty %");
+    }
+
+    // Event loop in simulated microseconds; the plant is advanced between events
+    const int64_t end_us = (int64_t)minutes * 60 * 1000000;
+    const int64_t control_us = CONTROL_PERIOD_MS * 1000LL;
+    const int64_t monitor_us = MONITOR_PERIOD_MS * 1000LL;
+    int64_t next_reading_us = READING_PERIOD_US;
+    int64_t next_control_us = control_us;
+    int64_t next_monitor_us = monitor_us;
+    int64_t now_us = 0;
+
+    int32_t setpoint = band_setpoint(profile, FIRST_LEVEL);
+    int32_t filtered = INT32_MIN;
+    int32_t previous_duty = 0;
+    sim_result_t result = {
+        .rise_s = -1.0, .lid_recovery_s = -1.0, .level_settle_s = -1.0,
+        .overshoot_centi = INT32_MIN,
+    };
+    int64_t settled_since_us = -1;  // Start of the current stretch within SETTLED_CENTI
+    uint64_t wall_start = host_now_ns();
+
+    while (now_us < end_us) {
+        int64_t next_us = next_reading_us;
+        if (next_control_us < next_us) next_us = next_control_us;
+        if (next_monitor_us < next_us) next_us = next_monitor_us;
+        thermal_plant_advance(&plant, (next_us - now_us) / 1e6);
+        now_us = next_us;
+        const double t = now_us / 1e6;
+
+        // Script
+        thermal_plant_set_lid(&plant, t >= LID_OPEN_S && t < LID_OPEN_S + LID_OPEN_FOR_S);
+        if (t >= LEVEL_CHANGE_S) {
+            setpoint = band_setpoint(profile, SECOND_LEVEL);
+        }
+
+        if (now_us == next_reading_us) {
+            uint32_t code = thermal_plant_adc_code(&plant, &synth, ADC_OVERSAMPLE_BITS);
+            filtered = sensor_filter_process(&filter,
+                                             temp_lut_oversampled_to_centi(&lut, code, ADC_OVERSAMPLE_BITS));
+            next_reading_us += READING_PERIOD_US;
+        }
+
+        if (now_us == next_control_us) {
+            if (filtered != INT32_MIN) {
+                previous_duty = pid.output;
+                thermal_plant_set_duty(&plant, heater_pid_step(&pid, setpoint, filtered));
+                result.control_steps++;
+                result.saturated_steps += pid.saturated ? 1 : 0;
+            }
+            next_control_us += control_us;
+
+            // Performance measured on the plate itself, not on the filtered reading
+            const int32_t error = (int32_t)lround(plant.plate_c * 100.0) - setpoint;
+            settled_since_us = abs(error) <= SETTLED_CENTI ? (settled_since_us < 0 ? now_us : settled_since_us) : -1;
+
+            if (t < LID_OPEN_S) {
+                if (result.rise_s < 0 && settled_since_us >= 0) {
+                    result.rise_s = t;
+                }
+                if (result.rise_s >= 0 && error > result.overshoot_centi) {
+                    result.overshoot_centi = error;
+                }
+                if (t >= LID_OPEN_S - STEADY_WINDOW_S) {
+                    result.steady_abs_sum += abs(error);
+                    result.steady_samples++;
+                    const double chatter = pid.output - previous_duty;
+                    result.steady_chatter_sq_sum += chatter * chatter;
+                }
+            } else if (t < LEVEL_CHANGE_S) {
+                if (-error > result.lid_drop_centi) {
+                    result.lid_drop_centi = -error;
+                }
+                // Recovered once back within the band and held for a minute
+                if (t >= LID_OPEN_S + LID_OPEN_FOR_S && result.lid_recovery_s < 0 &&
+                    settled_since_us >= 0 && now_us - settled_since_us >= 60000000LL) {
+                    result.lid_recovery_s = settled_since_us / 1e6 - (LID_OPEN_S + LID_OPEN_FOR_S);
+                    if (result.lid_recovery_s < 0) {
+                        result.lid_recovery_s = 0;
+                    }
+                }
+            } else {
+                if (-error > result.level_undershoot_centi) {
+                    result.level_undershoot_centi = -error;
+                }
+                if (result.level_settle_s < 0 && settled_since_us >= 0 &&
+                    now_us - settled_since_us >= 60000000LL) {
+                    result.level_settle_s = settled_since_us / 1e6 - LEVEL_CHANGE_S;
+                }
+            }
+        }
+
+        if (now_us == next_monitor_us) {
+            const int64_t now_ms = now_us / 1000;
+            doneness_push(&trend, now_ms, filtered);
+            float slope;
+            int32_t rate = TEMP_ALARM_RATE_UNKNOWN;
+            if (trend.count >= DONENESS_MIN_SAMPLES && doneness_slope(&trend, &slope) == ESP_OK) {
+                rate = (int32_t)lroundf(slope * 60000.0f);
+            }
+            temp_alarm_event_t events[TEMP_ALARM_MAX_EVENTS];
+            size_t n = temp_alarm_update(&alarm, now_ms, filtered, rate, events);
+            for (size_t e = 0; e < n; e++) {
+                if (events[e].type == TEMP_ALARM_EVENT_BAND) {
+                    result.band_events++;
+                } else if (events[e].type == TEMP_ALARM_EVENT_RAISED) {
+                    result.alarm_raised[events[e].id]++;
+                }
+                if (verbose) {
+                    print_event(profile, &events[e], t);
+                }
+            }
+            next_monitor_us += monitor_us;
+
+            if (trace_s > 0 && now_ms % (trace_s * 1000) == 0) {
+                printf("%8.0f %8.2f %8.2f %8.2f %8.2f %8.2f %7.1f\n", t, plant.plate_c, plant.probe_c,
+                       filtered / 100.0, plant.patty_c, setpoint / 100.0, pid.output / 100.0);
+            }
+        }
+    }
+    const double wall_s = (host_now_ns() - wall_start) / 1e9;
+    const double speedup = (end_us / 1e6) / wall_s;
+
+    const double steady = result.steady_samples > 0 ? result.steady_abs_sum / result.steady_samples : 0.0;
+    const double chatter = result.steady_samples > 0 ?
+                           sqrt(result.steady_chatter_sq_sum / result.steady_samples) : 0.0;
+    const uint8_t final_band = alarm.band;
+    int failures = 0;
+
+    printf("%s%-34s %10s %10s\n", trace_s > 0 || verbose ? "\n" : "", "", "measured", "limit");
+    printf("%-34s %9.1fs %9ds\n", "rise to setpoint", result.rise_s, MAX_RISE_S);
+    printf("%-34s %8.2f C %8.2f C\n", "overshoot", result.overshoot_centi / 100.0, MAX_OVERSHOOT_CENTI / 100.0);
+    printf("%-34s %8.3f C %8.2f C\n", "steady-state mean |error|", steady / 100.0, MAX_STEADY_ERROR_CENTI / 100.0);
+    printf("%-34s %9.2f%% %10s\n", "steady-state duty chatter (rms)", chatter / 100.0, "-");
+    printf("%-34s %8.2f C %10s\n", "lid-open drop", result.lid_drop_centi / 100.0, "-");
+    printf("%-34s %9.1fs %9ds\n", "lid-closed recovery", result.lid_recovery_s, MAX_LID_RECOVERY_S);
+    printf("%-34s %9.1fs %9ds\n", "settle after level change", result.level_settle_s, MAX_LEVEL_SETTLE_S);
+    printf("%-34s %8.2f C %10s\n", "undershoot after level change", result.level_undershoot_centi / 100.0, "-");
+    printf("%-34s %9.1f%% %10s\n", "control steps saturated",
+           result.control_steps > 0 ? 100.0 * result.saturated_steps / result.control_steps : 0.0, "-");
+    printf("%-34s %9.1fWh %10s\n", "heater energy", plant.energy_j / 3600.0, "-");
+    printf("%-34s %10ld %10s\n", "band events", result.band_events, "-");
+    for (int id = 0; id < TEMP_ALARM_COUNT; id++) {
+        char label[40];
+        snprintf(label, sizeof(label), "%s raised", temp_alarm_name((temp_alarm_id_t)id));
+        printf("%-34s %10ld %10s\n", label, result.alarm_raised[id], id == TEMP_ALARM_HIGH ? "0" : "-");
+    }
+    printf("%-34s %10s %10s\n", "final band",
+           final_band == COOK_PROFILE_NO_BAND ? "-" : cook_profile_band_name(profile, final_band),
+           cook_profile_band_name(profile, SECOND_LEVEL));
+    printf("%-34s %9.0fx %9.0fx  (%.0f s in %.3f s)\n", "faster than real time", speedup, MIN_SPEEDUP,
+           end_us / 1e6, wall_s);
+
+    if (result.rise_s < 0 || result.rise_s > MAX_RISE_S) {
+        printf("  FAIL: warm-up too slow\n");
+        failures++;
+    }
+    if (result.overshoot_centi > MAX_OVERSHOOT_CENTI) {
+        printf("  FAIL: overshoot\n");
+        failures++;
+    }
+    if (steady > MAX_STEADY_ERROR_CENTI) {
+        printf("  FAIL: steady-state error\n");
+        failures++;
+    }
+    if (result.lid_recovery_s < 0 || result.lid_recovery_s > MAX_LID_RECOVERY_S) {
+        printf("  FAIL: slow recovery after the lid closed\n");
+        failures++;
+    }
+    if (result.level_settle_s < 0 || result.level_settle_s > MAX_LEVEL_SETTLE_S) {
+        printf("  FAIL: slow settle after the level change\n");
+        failures++;
+    }
+    if (result.alarm_raised[TEMP_ALARM_HIGH] > 0) {
+        printf("  FAIL: controller drove the zone over the safe range\n");
+        failures++;
+    }
+    if (final_band != SECOND_LEVEL) {
+        printf("  FAIL: alarm engine did not end in the selected band\n");
+        failures++;
+    }
+    if (speedup < MIN_SPEEDUP) {
+        printf("  FAIL: simulation too slow for regression runs\n");
+        failures++;
+    }
+
+    if (failures > 0) {
+        printf("\nFAIL: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("\nClosed loop meets its limits on the plant model\n");
+    return 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file history_bench.c
+ * @brief Verify and time the tiered temperature history
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Pushes a synthetic cook (warm-up, plateau, sensor dropouts, noise) into a
+ * temp_history for longer than the day the minute tier covers, while keeping
+ * every sample. At the end each tier is read back and compared with the same
+ * downsampling recomputed from scratch, and the push and read costs are
+ * reported together with the per-zone memory footprint.
+ *
+ * Usage: history_bench [--hours=H] [--seed=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "temp_history.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define DEFAULT_HOURS           26.0
+#define DROPOUT_PROBABILITY     0.0005  // Chance per sample of starting a dropout
+#define DROPOUT_SAMPLES         25      // Dropout length (2.5 s)
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static int16_t reference_mean(long sum, long count)
+{
+    return (int16_t)(sum >= 0 ? (sum + count / 2) / count : (sum - count / 2) / count);
+}
+
+/**
+ * @brief Recompute one bucket of `width` samples ending before `end`
+ */
+static temp_history_point_t reference_bucket(const int16_t *samples, long end, long width)
+{
+    temp_history_point_t p = { INT16_MAX, 0, INT16_MIN };
+    long sum = 0;
+    long valid = 0;
+
+    for (long i = end - width; i < end; i++) {
+        if (samples[i] == TEMP_HISTORY_GAP) {
+            continue;
+        }
+        sum += samples[i];
+        valid++;
+        if (samples[i] < p.min) p.min = samples[i];
+        if (samples[i] > p.max) p.max = samples[i];
+    }
+
+    if (valid == 0) {
+        p.min = p.avg = p.max = TEMP_HISTORY_GAP;
+    } else {
+        p.avg = reference_mean(sum, valid);
+    }
+    return p;
+}
+
+/**
+ * @brief Compare a whole tier with the reference; returns mismatches
+ */
+static long verify_tier(const temp_history_t *history, temp_history_tier_t tier,
+                        const int16_t *samples, long total, long width,
+                        temp_history_point_t *buffer)
+{
+    size_t n = temp_history_read(history, tier, 0, temp_history_count(history, tier), buffer);
+    long closed = total / width;    // Buckets completed so far
+    long mismatches = 0;
+
+    for (size_t i = 0; i < n; i++) {
+        long bucket = closed - (long)n + (long)i;
+        temp_history_point_t ref = reference_bucket(samples, (bucket + 1) * width, width);
+        if (tier != TEMP_HISTORY_TIER_MINUTES) {
+            ref.min = ref.max = ref.avg;
+        }
+        if (ref.min != buffer[i].min || ref.avg != buffer[i].avg || ref.max != buffer[i].max) {
+            if (mismatches++ < 5) {
+                printf("  mismatch tier %d point %zu: got %d/%d/%d want %d/%d/%d\n", tier, i,
+                       buffer[i].min, buffer[i].avg, buffer[i].max, ref.min, ref.avg, ref.max);
+            }
+        }
+    }
+    return mismatches;
+}
+
+int main(int argc, char **argv)
+{
+    double hours = DEFAULT_HOURS;
+    uint64_t seed = 1;
+
+    static const struct option options[] = {
+        { "hours", required_argument, NULL, 'H' },
+        { "seed",  required_argument, NULL, 's' },
+        { "help",  no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'H': hours = strtod(optarg, NULL); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "Usage: %s [--hours=H] [--seed=N]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    const long total = (long)(hours * 3600.0 * TEMP_HISTORY_SAMPLE_HZ);
+    int16_t *samples = malloc((size_t)total * sizeof(*samples));
+    temp_history_point_t *buffer = malloc(TEMP_HISTORY_SECOND_POINTS * sizeof(*buffer));
+    static temp_history_t history;
+    adc_synth_t rng;
+    long dropout = 0;
+
+    if (samples == NULL || buffer == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    temp_history_init(&history);
+    adc_synth_init(&rng, TEMP_HISTORY_SAMPLE_HZ, 0.0, 0.0, seed);
+
+    // Generate first so the timed loop measures only the pushes
+    for (long i = 0; i < total; i++) {
+        double t = (double)i / TEMP_HISTORY_SAMPLE_HZ;
+        double c = 25.0 + 200.0 * (1.0 - exp(-t / 900.0)) + 3.0 * sin(t / 60.0) +
+                   0.3 * adc_synth_gaussian(&rng);
+        if (dropout == 0 && adc_synth_uniform(&rng) < DROPOUT_PROBABILITY) {
+            dropout = DROPOUT_SAMPLES;
+        }
+        if (dropout > 0) {
+            dropout--;
+            samples[i] = TEMP_HISTORY_GAP;
+        } else {
+            samples[i] = (int16_t)lround(c * 100.0);
+        }
+    }
+
+    uint64_t start = host_now_ns();
+    for (long i = 0; i < total; i++) {
+        temp_history_push(&history, samples[i]);
+    }
+    uint64_t push_ns = host_now_ns() - start;
+
+    start = host_now_ns();
+    size_t read = temp_history_read(&history, TEMP_HISTORY_TIER_SECONDS, 0,
+                                    TEMP_HISTORY_SECOND_POINTS, buffer);
+    uint64_t read_ns = host_now_ns() - start;
+
+    printf("History per zone: %zu bytes (%d full, %d x 1 s, %d x 1 min points)\n",
+           sizeof(temp_history_t), TEMP_HISTORY_FULL_POINTS, TEMP_HISTORY_SECOND_POINTS,
+           TEMP_HISTORY_MINUTE_POINTS);
+    printf("Pushed %ld samples (%.1f h at %d Hz): %.1f ns/push\n",
+           total, hours, TEMP_HISTORY_SAMPLE_HZ, (double)push_ns / total);
+    printf("Read %zu points from the 1 s tier: %.2f ns/point\n",
+           read, read > 0 ? (double)read_ns / read : 0.0);
+
+    long mismatches = 0;
+    mismatches += verify_tier(&history, TEMP_HISTORY_TIER_FULL, samples, total, 1, buffer);
+    mismatches += verify_tier(&history, TEMP_HISTORY_TIER_SECONDS, samples, total,
+                              TEMP_HISTORY_SAMPLES_PER_SECOND, buffer);
+
+    // The minute tier holds up to 1440 points; reuse the larger buffer
+    mismatches += verify_tier(&history, TEMP_HISTORY_TIER_MINUTES, samples, total,
+                              TEMP_HISTORY_SAMPLES_PER_MINUTE, buffer);
+
+    for (int tier = 0; tier < TEMP_HISTORY_TIER_COUNT; tier++) {
+        printf("Tier %d: %zu points x %u ms\n", tier,
+               temp_history_count(&history, (temp_history_tier_t)tier),
+               temp_history_period_ms((temp_history_tier_t)tier));
+    }
+
+    free(samples);
+    free(buffer);
+
+    if (mismatches > 0) {
+        printf("FAIL: %ld point(s) differ from the reference downsampling\n", mismatches);
+        return 1;
+    }
+    printf("All tiers match the reference downsampling\n");
+    return 0;
+}
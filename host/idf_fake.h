@@ -0,0 +1,154 @@
+/**
+ * @file idf_fake.h
+ * @brief Controls of the in-process hardware behind the host ESP-IDF drivers
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The firmware sees only the ESP-IDF driver API (host/include); these calls
+ * are the other side of it, for the host application and scripts:
+ *
+ * - keypad: a 4x4 matrix on the scanned GPIOs; a pressed key pulls its
+ *   column low while the scanner drives its row low
+ * - LCD: the HD44780 bus pins are decoded on every falling E edge into a
+ *   DDRAM model (4-bit mode, clear, home, address commands)
+ * - probes: zone 0 is the thermal plant model (host/thermal_plant.c) heated
+ *   by the LEDC heater channel; the other zones hold a fixed temperature
+ * - encoder: a detent walks both phases through a quadrature cycle on the
+ *   GPIO fake; a started PCNT unit counts the edges with its channel actions
+ * - flash: the "sessionlog" partition is a file (host/flash_file.c)
+ * - power: light sleep is the time in which every task is blocked and no
+ *   esp_pm lock is held (host/pm_fake.c)
+ * - UART: each installed port is a pty, paced at its baud rate
+ *   (host/uart_fake.c); the telemetry stream comes out of one
+ *
+ * Keypad and LCD pins come from the same Kconfig options as main.c
+ * (host/include/sdkconfig.h); the other pins are repeated from main.c.
+ */
+
+#ifndef IDF_FAKE_H
+#define IDF_FAKE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+// row_pins, col_pins and key_map in main.c (a 4x4 keypad)
+#define IDF_FAKE_KEYPAD_ROWS        4
+#define IDF_FAKE_KEYPAD_COLS        4
+#define IDF_FAKE_ROW_PINS           { CONFIG_GRILL_KEYPAD_ROW0_GPIO, CONFIG_GRILL_KEYPAD_ROW1_GPIO, \
+                                      CONFIG_GRILL_KEYPAD_ROW2_GPIO, CONFIG_GRILL_KEYPAD_ROW3_GPIO }
+#define IDF_FAKE_COL_PINS           { CONFIG_GRILL_KEYPAD_COL0_GPIO, CONFIG_GRILL_KEYPAD_COL1_GPIO, \
+                                      CONFIG_GRILL_KEYPAD_COL2_GPIO, CONFIG_GRILL_KEYPAD_COL3_GPIO }
+#define IDF_FAKE_KEY_MAP            "123A456B789C*0#D"
+
+// The hd44780_t pins in main.c
+#define IDF_FAKE_LCD_RS             CONFIG_GRILL_LCD_RS_GPIO
+#define IDF_FAKE_LCD_E              CONFIG_GRILL_LCD_E_GPIO
+#define IDF_FAKE_LCD_DATA_PINS      { CONFIG_GRILL_LCD_D4_GPIO, CONFIG_GRILL_LCD_D5_GPIO, \
+                                      CONFIG_GRILL_LCD_D6_GPIO, CONFIG_GRILL_LCD_D7_GPIO }
+#define IDF_FAKE_LCD_COLS           16
+#define IDF_FAKE_LCD_LINES          2
+
+#define IDF_FAKE_HEATER_GPIO        14      // HEATER_PWM_GPIO in main.c
+#define IDF_FAKE_PROBES             4       // GRILL_ZONE_COUNT in main.c
+#define IDF_FAKE_PROBE_DEFAULT_C    20.0    // Zones 1..3 until set
+
+#define IDF_FAKE_FLASH_SIZE         0x40000 // sessionlog in partitions.csv
+#define IDF_FAKE_FLASH_SECTOR       4096
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Press or release a key of the keypad
+ *
+ * @return ESP_ERR_NOT_FOUND if the character is not on the keypad
+ */
+esp_err_t idf_fake_key(char key, bool pressed);
+
+/**
+ * @brief Visible LCD text, one NUL-terminated string per line
+ *
+ * Characters outside printable ASCII (custom glyphs) show as '?'.
+ */
+void idf_fake_lcd_text(char lines[IDF_FAKE_LCD_LINES][IDF_FAKE_LCD_COLS + 1]);
+
+/**
+ * @brief Bytes the LCD has latched since start (commands and data)
+ */
+uint32_t idf_fake_lcd_bytes(void);
+
+/**
+ * @brief Fix a probe temperature (zone 0: back to the plant with NAN)
+ *
+ * @return ESP_ERR_INVALID_ARG for an unknown zone
+ */
+esp_err_t idf_fake_set_probe(int zone, double celsius);
+
+/**
+ * @brief Open or close the grill lid of the plant model
+ */
+void idf_fake_set_lid(bool open);
+
+/**
+ * @brief Plant state: probe, patty and plate temperature, heater duty (0..1)
+ */
+void idf_fake_plant(double *probe_c, double *patty_c, double *plate_c, double *duty);
+
+/**
+ * @brief Heater duty from the LEDC fake (fraction of full scale)
+ */
+void idf_fake_set_heater(double duty);
+
+/**
+ * @brief Turn the encoder by one detent (+1 clockwise, -1 counter-clockwise)
+ *
+ * After the first edge, waits up to 100 ms for an idle unit to be started
+ * again by its wake interrupt.
+ *
+ * @return ESP_ERR_INVALID_STATE if no PCNT unit is counting the phases
+ */
+esp_err_t idf_fake_encoder_detent(int direction);
+
+/**
+ * @brief Back the "sessionlog" partition with a file (before app_main)
+ *
+ * Without it esp_partition_find_first() finds nothing, like a board flashed
+ * without the partition.
+ */
+esp_err_t idf_fake_flash_open(const char *path);
+
+/**
+ * @brief Link the pty of the next UART installed to a path (before app_main)
+ *
+ * Any file at the path is replaced. Without it the pty device is only
+ * printed on stderr.
+ */
+void idf_fake_uart_link(const char *path);
+
+/**
+ * @brief The calling task is about to block (FreeRTOS fake, stdin reads)
+ *
+ * With no task left ready and no lock held, "light sleep" begins.
+ */
+void idf_fake_pm_task_block(void);
+
+/**
+ * @brief A task is ready again (created, woken or timed out)
+ *
+ * Ends a "light sleep" and reports it to the exit callbacks.
+ */
+void idf_fake_pm_task_unblock(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IDF_FAKE_H */
@@ -0,0 +1,16 @@
+/**
+ * @file adc_cali.h
+ * @brief Host stand-in for the ESP-IDF ADC calibration API
+ */
+
+#ifndef HOST_ESP_ADC_CALI_H
+#define HOST_ESP_ADC_CALI_H
+
+#include "esp_err.h"
+#include "hal/adc_types.h"
+
+typedef struct adc_cali_scheme_t *adc_cali_handle_t;
+
+esp_err_t adc_cali_raw_to_voltage(adc_cali_handle_t handle, int raw, int *voltage);
+
+#endif /* HOST_ESP_ADC_CALI_H */
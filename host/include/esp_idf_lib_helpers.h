@@ -0,0 +1,15 @@
+/**
+ * @file esp_idf_lib_helpers.h
+ * @brief Host stand-in for the esp-idf-lib target helpers
+ *
+ * The component's own header stops the build on an unknown target; the
+ * hd44780 driver only needs it for FreeRTOS and the version macros.
+ */
+
+#ifndef HOST_ESP_IDF_LIB_HELPERS_H
+#define HOST_ESP_IDF_LIB_HELPERS_H
+
+#include "freertos/FreeRTOS.h"
+#include "esp_idf_version.h"
+
+#endif /* HOST_ESP_IDF_LIB_HELPERS_H */
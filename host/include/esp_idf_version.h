@@ -0,0 +1,20 @@
+/**
+ * @file esp_idf_version.h
+ * @brief Host stand-in for the ESP-IDF version header
+ *
+ * Reports the ESP-IDF release the firmware is built with, so version checks
+ * take the same branch as on the target.
+ */
+
+#ifndef HOST_ESP_IDF_VERSION_H
+#define HOST_ESP_IDF_VERSION_H
+
+#define ESP_IDF_VERSION_MAJOR       6
+#define ESP_IDF_VERSION_MINOR       0
+#define ESP_IDF_VERSION_PATCH       0
+
+#define ESP_IDF_VERSION_VAL(major, minor, patch) (((major) << 16) | ((minor) << 8) | (patch))
+#define ESP_IDF_VERSION \
+    ESP_IDF_VERSION_VAL(ESP_IDF_VERSION_MAJOR, ESP_IDF_VERSION_MINOR, ESP_IDF_VERSION_PATCH)
+
+#endif /* HOST_ESP_IDF_VERSION_H */
@@ -0,0 +1,56 @@
+/**
+ * @file esp_pm.h
+ * @brief Host stand-in for ESP-IDF power management
+ *
+ * Locks are counted and dumped like the real ones. "Light sleep" is the
+ * state in which every FreeRTOS task is blocked and no lock is held
+ * (pm_fake.c); the exit callbacks receive the time spent in it.
+ */
+
+#ifndef HOST_ESP_PM_H
+#define HOST_ESP_PM_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+typedef enum {
+    ESP_PM_CPU_FREQ_MAX,
+    ESP_PM_APB_FREQ_MAX,
+    ESP_PM_NO_LIGHT_SLEEP,
+} esp_pm_lock_type_t;
+
+typedef struct {
+    int max_freq_mhz;
+    int min_freq_mhz;
+    bool light_sleep_enable;
+} esp_pm_config_t;
+
+typedef struct esp_pm_lock *esp_pm_lock_handle_t;
+
+typedef esp_err_t (*esp_pm_light_sleep_cb_t)(int64_t sleep_time_us, void *arg);
+
+typedef struct {
+    esp_pm_light_sleep_cb_t enter_cb;
+    esp_pm_light_sleep_cb_t exit_cb;
+    void *enter_cb_user_arg;
+    void *exit_cb_user_arg;
+    uint32_t enter_cb_prior;
+    uint32_t exit_cb_prior;
+} esp_pm_sleep_cbs_register_config_t;
+
+esp_err_t esp_pm_configure(const void *config);
+esp_err_t esp_pm_get_configuration(void *config);
+
+esp_err_t esp_pm_lock_create(esp_pm_lock_type_t lock_type, int arg, const char *name,
+                             esp_pm_lock_handle_t *out_handle);
+esp_err_t esp_pm_lock_acquire(esp_pm_lock_handle_t handle);
+esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle);
+esp_err_t esp_pm_lock_delete(esp_pm_lock_handle_t handle);
+esp_err_t esp_pm_dump_locks(FILE *stream);
+
+esp_err_t esp_pm_light_sleep_register_cbs(esp_pm_sleep_cbs_register_config_t *cbs_conf);
+esp_err_t esp_pm_light_sleep_unregister_cbs(esp_pm_sleep_cbs_register_config_t *cbs_conf);
+
+#endif /* HOST_ESP_PM_H */
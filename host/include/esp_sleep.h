@@ -0,0 +1,16 @@
+/**
+ * @file esp_sleep.h
+ * @brief Host stand-in for the ESP-IDF sleep wakeup sources
+ *
+ * Any interrupt ends the emulated light sleep, so enabling a wakeup source
+ * succeeds and changes nothing.
+ */
+
+#ifndef HOST_ESP_SLEEP_H
+#define HOST_ESP_SLEEP_H
+
+#include "esp_err.h"
+
+esp_err_t esp_sleep_enable_gpio_wakeup(void);
+
+#endif /* HOST_ESP_SLEEP_H */
@@ -0,0 +1,13 @@
+/**
+ * @file esp_system.h
+ * @brief Host stand-in for the ESP-IDF system header
+ *
+ * Included by the hd44780 component; nothing from it is used on the host.
+ */
+
+#ifndef HOST_ESP_SYSTEM_H
+#define HOST_ESP_SYSTEM_H
+
+#include "esp_err.h"
+
+#endif /* HOST_ESP_SYSTEM_H */
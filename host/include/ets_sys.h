@@ -0,0 +1,16 @@
+/**
+ * @file ets_sys.h
+ * @brief Host stand-in for the ROM busy-wait delay
+ */
+
+#ifndef HOST_ETS_SYS_H
+#define HOST_ETS_SYS_H
+
+#include <stdint.h>
+
+/**
+ * @brief Busy-wait like the ROM routine (the caller keeps the CPU)
+ */
+void ets_delay_us(uint32_t us);
+
+#endif /* HOST_ETS_SYS_H */
@@ -0,0 +1,64 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Host stand-in for the ESP-IDF FreeRTOS base header
+ *
+ * Tasks, queues and semaphores are POSIX threads and condition variables
+ * (freertos_fake.c). Semantics follow FreeRTOS closely enough for the
+ * firmware to run unchanged; what the host cannot reproduce:
+ *
+ * - priorities and core affinity are recorded but not enforced (the Linux
+ *   scheduler decides), so preemption order differs from the target
+ * - critical sections are one process-wide recursive lock
+ * - "ISR" callbacks run on ordinary fake-driver threads
+ * - stack high-water marks are not measured
+ */
+
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+typedef int32_t BaseType_t;
+typedef uint32_t UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint8_t StackType_t;
+
+#define pdTRUE                      ((BaseType_t)1)
+#define pdFALSE                     ((BaseType_t)0)
+#define pdPASS                      pdTRUE
+#define pdFAIL                      pdFALSE
+
+#define portMAX_DELAY               ((TickType_t)0xffffffffUL)
+#define configTICK_RATE_HZ          CONFIG_FREERTOS_HZ
+#define portTICK_PERIOD_MS          ((TickType_t)1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)           ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000U))
+#define configMAX_PRIORITIES        25
+#define configRUN_TIME_COUNTER_TYPE uint32_t
+#define portNUM_PROCESSORS          2
+#define tskNO_AFFINITY              ((BaseType_t)0x7FFFFFFF)
+
+#define IRAM_ATTR
+
+/**
+ * @brief Spinlock (all of them share the process-wide critical section)
+ */
+typedef struct {
+    uint32_t owner;
+} portMUX_TYPE;
+
+#define portMUX_INITIALIZER_UNLOCKED    { 0 }
+
+void vPortEnterCritical(portMUX_TYPE *mux);
+void vPortExitCritical(portMUX_TYPE *mux);
+BaseType_t xPortGetCoreID(void);
+
+#define portENTER_CRITICAL(mux)         vPortEnterCritical(mux)
+#define portEXIT_CRITICAL(mux)          vPortExitCritical(mux)
+#define portENTER_CRITICAL_ISR(mux)     vPortEnterCritical(mux)
+#define portEXIT_CRITICAL_ISR(mux)      vPortExitCritical(mux)
+#define portYIELD_FROM_ISR(woken)       ((void)(woken))
+
+#endif /* HOST_FREERTOS_H */
@@ -0,0 +1,16 @@
+/**
+ * @file idf_additions.h
+ * @brief Host stand-in for the ESP-IDF FreeRTOS additions
+ */
+
+#ifndef HOST_FREERTOS_IDF_ADDITIONS_H
+#define HOST_FREERTOS_IDF_ADDITIONS_H
+
+#include "freertos/task.h"
+
+/**
+ * @brief Idle task of a core: a placeholder that only appears in the run-time stats
+ */
+TaskHandle_t xTaskGetIdleTaskHandleForCore(BaseType_t core_id);
+
+#endif /* HOST_FREERTOS_IDF_ADDITIONS_H */
@@ -0,0 +1,21 @@
+/**
+ * @file semphr.h
+ * @brief Host stand-in for FreeRTOS semaphores (queues of zero-size items)
+ */
+
+#ifndef HOST_FREERTOS_SEMPHR_H
+#define HOST_FREERTOS_SEMPHR_H
+
+#include "freertos/queue.h"
+
+typedef QueueHandle_t SemaphoreHandle_t;
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void);
+SemaphoreHandle_t xSemaphoreCreateMutex(void);
+
+#define xSemaphoreTake(sem, ticks)          xQueueReceive((sem), NULL, (ticks))
+#define xSemaphoreGive(sem)                 xQueueSend((sem), NULL, 0)
+#define xSemaphoreGiveFromISR(sem, woken)   xQueueSendFromISR((sem), NULL, (woken))
+#define vSemaphoreDelete(sem)               vQueueDelete(sem)
+
+#endif /* HOST_FREERTOS_SEMPHR_H */
@@ -0,0 +1,66 @@
+/**
+ * @file task.h
+ * @brief Host stand-in for the FreeRTOS task API
+ */
+
+#ifndef HOST_FREERTOS_TASK_H
+#define HOST_FREERTOS_TASK_H
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct host_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *arg);
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stack_depth,
+                                   void *arg, UBaseType_t priority, TaskHandle_t *created_task,
+                                   BaseType_t core_id);
+
+static inline BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stack_depth,
+                                     void *arg, UBaseType_t priority, TaskHandle_t *created_task)
+{
+    return xTaskCreatePinnedToCore(function, name, stack_depth, arg, priority, created_task,
+                                   tskNO_AFFINITY);
+}
+
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskDelayUntil(TickType_t *previous_wake_time, TickType_t increment);
+#define vTaskDelayUntil(previous_wake_time, increment) \
+    ((void)xTaskDelayUntil((previous_wake_time), (increment)))
+TickType_t xTaskGetTickCount(void);
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+const char *pcTaskGetName(TaskHandle_t task);
+void vTaskPrioritySet(TaskHandle_t task, UBaseType_t priority);
+UBaseType_t uxTaskPriorityGet(TaskHandle_t task);
+UBaseType_t uxTaskGetNumberOfTasks(void);
+
+/**
+ * @brief Stack the task was created with (the host does not measure use)
+ */
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+/**
+ * @brief Run-time stats of one task (the fields the firmware reads)
+ */
+typedef struct {
+    TaskHandle_t xHandle;
+    const char *pcTaskName;
+    UBaseType_t uxCurrentPriority;
+    configRUN_TIME_COUNTER_TYPE ulRunTimeCounter;   // Thread CPU time in µs
+    BaseType_t xCoreID;
+} TaskStatus_t;
+
+/**
+ * @brief Every task and the idle tasks, with the wall time in µs as total
+ *
+ * @return Entries written, 0 if @p size is too small
+ */
+UBaseType_t uxTaskGetSystemState(TaskStatus_t *array, UBaseType_t size,
+                                 configRUN_TIME_COUNTER_TYPE *total);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_task_woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait);
+
+#endif /* HOST_FREERTOS_TASK_H */
@@ -0,0 +1,56 @@
+/**
+ * @file sdkconfig.h
+ * @brief Host stand-in for the generated ESP-IDF configuration
+ *
+ * The Linux host build of the whole firmware (grill_app) is configured like
+ * an ESP-IDF "linux" target: firmware code that checks CONFIG_IDF_TARGET_LINUX
+ * takes its host path (the console reads stdin).
+ */
+
+#ifndef HOST_SDKCONFIG_H
+#define HOST_SDKCONFIG_H
+
+#define CONFIG_IDF_TARGET_LINUX     1
+#define CONFIG_IDF_TARGET           "linux"
+#define CONFIG_FREERTOS_HZ          1000
+#define CONFIG_LOG_DEFAULT_LEVEL    3       // ESP_LOG_INFO
+
+// Run-time stats as in sdkconfig.defaults (host/freertos_fake.c)
+#define CONFIG_FREERTOS_USE_TRACE_FACILITY      1
+#define CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS 1
+
+// Power management as in sdkconfig.defaults
+#define CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ         240
+#define CONFIG_PM_ENABLE                        1
+#define CONFIG_PM_LIGHT_SLEEP_CALLBACKS         1
+#define CONFIG_FREERTOS_USE_TICKLESS_IDLE       1
+#define CONFIG_FREERTOS_IDLE_TIME_BEFORE_SLEEP  3
+
+// main/Kconfig.projbuild defaults
+#define CONFIG_GRILL_KEYPAD_COLS        4
+#define CONFIG_GRILL_KEYPAD_ROW0_GPIO   1
+#define CONFIG_GRILL_KEYPAD_ROW1_GPIO   2
+#define CONFIG_GRILL_KEYPAD_ROW2_GPIO   42
+#define CONFIG_GRILL_KEYPAD_ROW3_GPIO   41
+#define CONFIG_GRILL_KEYPAD_COL0_GPIO   40
+#define CONFIG_GRILL_KEYPAD_COL1_GPIO   39
+#define CONFIG_GRILL_KEYPAD_COL2_GPIO   38
+#define CONFIG_GRILL_KEYPAD_COL3_GPIO   37
+#define CONFIG_GRILL_KEYPAD_DEBOUNCE_MS 50
+#define CONFIG_GRILL_KEYPAD_SCAN_MS     10
+#define CONFIG_GRILL_LCD_RS_GPIO        10
+#define CONFIG_GRILL_LCD_E_GPIO         11
+#define CONFIG_GRILL_LCD_D4_GPIO        16
+#define CONFIG_GRILL_LCD_D5_GPIO        17
+#define CONFIG_GRILL_LCD_D6_GPIO        18
+#define CONFIG_GRILL_LCD_D7_GPIO        7
+#define CONFIG_GRILL_TEMP_UPDATE_MS     500
+#define CONFIG_GRILL_TELEMETRY          1
+#define CONFIG_GRILL_TELEMETRY_UART     1       // A pty on the host (host/uart_fake.c)
+#define CONFIG_GRILL_TELEMETRY_UART_NUM 1
+#define CONFIG_GRILL_TELEMETRY_UART_TX_GPIO 15
+#define CONFIG_GRILL_TELEMETRY_UART_BAUD 921600
+
+// components/hd44780/Kconfig as set in sdkconfig.defaults: all three off
+
+#endif /* HOST_SDKCONFIG_H */
@@ -0,0 +1,14 @@
+/**
+ * @file soc_caps.h
+ * @brief Host stand-in for the ESP32-S3 SoC capabilities the firmware uses
+ */
+
+#ifndef HOST_SOC_CAPS_H
+#define HOST_SOC_CAPS_H
+
+#define SOC_ADC_DIGI_RESULT_BYTES   4
+#define SOC_ADC_DIGI_MAX_BITWIDTH   12
+#define SOC_ADC_PATT_LEN_MAX        24
+#define SOC_ADC_MAX_CHANNEL_NUM     10
+
+#endif /* HOST_SOC_CAPS_H */
@@ -0,0 +1,323 @@
+/**
+ * @file keypad_sim.c
+ * @brief Host-side 4x4 keypad simulator with contact-bounce models
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "keypad_sim.h"
+
+/** @brief Shortest time a finger needs to release and press the same key again */
+#define MIN_REPRESS_US              80000
+
+/* ==================== BUILT-IN BOUNCE MODELS ==================== */
+
+static const keypad_bounce_model_t models[] = {
+    {
+        .name = "clean",
+        .burst_us = 0, .bounce_period_us = 100,
+        .chatter_prob = 0.0, .dropout_rate_hz = 0.0, .dropout_us = 0,
+        .noise_prob = 0.0, .ghosting = false,
+    },
+    {
+        .name = "typical",              // New membrane keypad
+        .burst_us = 5000, .bounce_period_us = 250,
+        .chatter_prob = 0.001, .dropout_rate_hz = 0.0, .dropout_us = 0,
+        .noise_prob = 0.0, .ghosting = false,
+    },
+    {
+        .name = "worn",                 // Aged contacts with long bursts and dropouts
+        .burst_us = 20000, .bounce_period_us = 500,
+        .chatter_prob = 0.02, .dropout_rate_hz = 2.0, .dropout_us = 15000,
+        .noise_prob = 0.0, .ghosting = false,
+    },
+    {
+        .name = "noisy",                // Long unshielded cable next to the heater
+        .burst_us = 8000, .bounce_period_us = 250,
+        .chatter_prob = 0.005, .dropout_rate_hz = 0.0, .dropout_us = 0,
+        .noise_prob = 0.002, .ghosting = false,
+    },
+    {
+        .name = "ghosting",             // Diode-less matrix pressed with chords
+        .burst_us = 5000, .bounce_period_us = 250,
+        .chatter_prob = 0.001, .dropout_rate_hz = 0.0, .dropout_us = 0,
+        .noise_prob = 0.0, .ghosting = true,
+    },
+};
+
+/* ==================== PSEUDO-RANDOM HELPERS ==================== */
+
+/**
+ * @brief SplitMix64 finaliser, used as a stateless hash
+ */
+static uint64_t mix64(uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @brief Deterministic uniform number in [0, 1) for a tuple of inputs
+ */
+static double hash01(uint64_t seed, uint64_t a, uint64_t b, uint64_t c)
+{
+    uint64_t h = mix64(seed ^ mix64(a ^ mix64(b ^ mix64(c))));
+    return (double)(h >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief Sequential generator used while building the press script
+ */
+static double next01(uint64_t *state)
+{
+    *state = mix64(*state);
+    return (double)(*state >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static uint32_t next_range(uint64_t *state, uint32_t lo, uint32_t hi)
+{
+    if (hi <= lo) {
+        return lo;
+    }
+    return lo + (uint32_t)(next01(state) * (double)(hi - lo + 1));
+}
+
+/* ==================== SCRIPT GENERATION ==================== */
+
+static int compare_press_start(const void *a, const void *b)
+{
+    const keypad_sim_press_t *pa = a;
+    const keypad_sim_press_t *pb = b;
+
+    if (pa->start_us < pb->start_us) return -1;
+    if (pa->start_us > pb->start_us) return 1;
+    return 0;
+}
+
+static void add_press(keypad_sim_t *sim, uint64_t *rng, uint64_t busy_until[][KEYPAD_SIM_COLS],
+                      uint8_t row, uint8_t col, uint64_t start_us, uint32_t hold_us)
+{
+    keypad_sim_press_t *p = &sim->presses[sim->press_count++];
+    uint32_t burst = sim->model.burst_us;
+
+    p->row = row;
+    p->col = col;
+    p->start_us = start_us;
+    p->end_us = start_us + hold_us;
+    p->press_burst_us = burst ? next_range(rng, burst / 2, burst) : 0;
+    p->release_burst_us = burst ? next_range(rng, burst / 2, burst) : 0;
+
+    busy_until[row][col] = p->end_us + p->release_burst_us + MIN_REPRESS_US;
+    if (busy_until[row][col] > sim->duration_us) {
+        sim->duration_us = busy_until[row][col];
+    }
+}
+
+bool keypad_sim_init(keypad_sim_t *sim, const keypad_bounce_model_t *model,
+                     const keypad_sim_script_config_t *script, uint64_t seed)
+{
+    uint64_t busy_until[KEYPAD_SIM_ROWS][KEYPAD_SIM_COLS] = {{0}};
+    uint64_t rng = seed;
+    uint64_t t = 100000;   // Leave the scanner 100 ms to settle
+
+    memset(sim, 0, sizeof(*sim));
+    sim->model = *model;
+    sim->seed = seed;
+
+    // A chord adds up to three presses per script step
+    sim->presses = calloc(script->press_count * 3, sizeof(keypad_sim_press_t));
+    if (sim->presses == NULL) {
+        return false;
+    }
+
+    for (size_t i = 0; i < script->press_count; i++) {
+        uint32_t hold = next_range(&rng, script->hold_min_us, script->hold_max_us);
+        uint8_t r1 = (uint8_t)next_range(&rng, 0, KEYPAD_SIM_ROWS - 1);
+        uint8_t c1 = (uint8_t)next_range(&rng, 0, KEYPAD_SIM_COLS - 1);
+
+        if (next01(&rng) < script->chord_prob) {
+            // Three corners of a rectangle, staggered by a few milliseconds
+            uint8_t r2 = (uint8_t)((r1 + next_range(&rng, 1, KEYPAD_SIM_ROWS - 1)) % KEYPAD_SIM_ROWS);
+            uint8_t c2 = (uint8_t)((c1 + next_range(&rng, 1, KEYPAD_SIM_COLS - 1)) % KEYPAD_SIM_COLS);
+            const uint8_t corner_row[3] = { r1, r1, r2 };
+            const uint8_t corner_col[3] = { c1, c2, c2 };
+            uint64_t start = t;
+
+            for (int k = 0; k < 4; k++) {
+                uint8_t r = (k & 1) ? r2 : r1;
+                uint8_t c = (k & 2) ? c2 : c1;
+                if (busy_until[r][c] > start) {
+                    start = busy_until[r][c];
+                }
+            }
+            for (int k = 0; k < 3; k++) {
+                add_press(sim, &rng, busy_until, corner_row[k], corner_col[k],
+                          start + (uint64_t)k * next_range(&rng, 2000, 15000), hold);
+            }
+            t = start;
+        } else {
+            uint64_t start = t > busy_until[r1][c1] ? t : busy_until[r1][c1];
+            add_press(sim, &rng, busy_until, r1, c1, start, hold);
+            t = start;
+        }
+
+        t += next_range(&rng, script->gap_min_us, script->gap_max_us);
+    }
+
+    qsort(sim->presses, sim->press_count, sizeof(keypad_sim_press_t), compare_press_start);
+
+    // Per-key index for O(log n) contact lookups
+    for (size_t i = 0; i < sim->press_count; i++) {
+        sim->key_press_count[sim->presses[i].row][sim->presses[i].col]++;
+    }
+    for (int r = 0; r < KEYPAD_SIM_ROWS; r++) {
+        for (int c = 0; c < KEYPAD_SIM_COLS; c++) {
+            size_t n = sim->key_press_count[r][c];
+            sim->key_presses[r][c] = calloc(n ? n : 1, sizeof(size_t));
+            if (sim->key_presses[r][c] == NULL) {
+                keypad_sim_free(sim);
+                return false;
+            }
+            sim->key_press_count[r][c] = 0;
+        }
+    }
+    for (size_t i = 0; i < sim->press_count; i++) {
+        const keypad_sim_press_t *p = &sim->presses[i];
+        sim->key_presses[p->row][p->col][sim->key_press_count[p->row][p->col]++] = i;
+    }
+
+    return true;
+}
+
+void keypad_sim_free(keypad_sim_t *sim)
+{
+    for (int r = 0; r < KEYPAD_SIM_ROWS; r++) {
+        for (int c = 0; c < KEYPAD_SIM_COLS; c++) {
+            free(sim->key_presses[r][c]);
+            sim->key_presses[r][c] = NULL;
+        }
+    }
+    free(sim->presses);
+    sim->presses = NULL;
+    sim->press_count = 0;
+}
+
+/* ==================== CONTACT MODEL ==================== */
+
+/**
+ * @brief Find the last press of a key starting at or before t_us
+ */
+static const keypad_sim_press_t *find_press(const keypad_sim_t *sim, uint8_t row, uint8_t col,
+                                            uint64_t t_us, size_t *index)
+{
+    const size_t *list = sim->key_presses[row][col];
+    size_t lo = 0;
+    size_t hi = sim->key_press_count[row][col];
+
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (sim->presses[list[mid]].start_us <= t_us) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo == 0) {
+        return NULL;
+    }
+
+    *index = list[lo - 1];
+    return &sim->presses[*index];
+}
+
+bool keypad_sim_contact(const keypad_sim_t *sim, uint8_t row, uint8_t col, uint64_t t_us)
+{
+    const keypad_bounce_model_t *m = &sim->model;
+    uint32_t period = m->bounce_period_us ? m->bounce_period_us : 1;
+    size_t index = 0;
+    const keypad_sim_press_t *p = find_press(sim, row, col, t_us, &index);
+
+    if (p == NULL || t_us >= p->end_us + p->release_burst_us) {
+        return false;
+    }
+
+    // Bounce burst after the press edge
+    if (t_us < p->start_us + p->press_burst_us) {
+        uint64_t slot = (t_us - p->start_us) / period;
+        return hash01(sim->seed, index, 1, slot) < 0.5;
+    }
+
+    // Bounce burst after the release edge
+    if (t_us >= p->end_us) {
+        uint64_t slot = (t_us - p->end_us) / period;
+        return hash01(sim->seed, index, 2, slot) < 0.5;
+    }
+
+    // Worn contact: the hold time is split into dropout-sized slots
+    if (m->dropout_rate_hz > 0.0 && m->dropout_us > 0) {
+        uint64_t slot = (t_us - p->start_us) / m->dropout_us;
+        double slot_prob = m->dropout_rate_hz * (double)m->dropout_us / 1e6;
+        if (hash01(sim->seed, index, 3, slot) < slot_prob) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool keypad_sim_read(const keypad_sim_t *sim, uint8_t row, uint8_t col, uint64_t t_us)
+{
+    const keypad_bounce_model_t *m = &sim->model;
+    uint64_t key_id = (uint64_t)row * KEYPAD_SIM_COLS + col;
+    bool level = keypad_sim_contact(sim, row, col, t_us);
+
+    if (level) {
+        if (m->chatter_prob > 0.0 && hash01(sim->seed, key_id, 4, t_us) < m->chatter_prob) {
+            level = false;
+        }
+    } else if (m->noise_prob > 0.0 && hash01(sim->seed, key_id, 5, t_us) < m->noise_prob) {
+        level = true;
+    }
+
+    if (!level && m->ghosting) {
+        // Current path row -> (row,c2) -> c2 -> (r2,c2) -> r2 -> (r2,col) -> col
+        for (uint8_t c2 = 0; c2 < KEYPAD_SIM_COLS && !level; c2++) {
+            if (c2 == col || !keypad_sim_contact(sim, row, c2, t_us)) {
+                continue;
+            }
+            for (uint8_t r2 = 0; r2 < KEYPAD_SIM_ROWS; r2++) {
+                if (r2 != row &&
+                    keypad_sim_contact(sim, r2, c2, t_us) &&
+                    keypad_sim_contact(sim, r2, col, t_us)) {
+                    level = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    return level;
+}
+
+/* ==================== MODEL TABLE ==================== */
+
+const keypad_bounce_model_t *keypad_sim_find_model(const char *name)
+{
+    for (size_t i = 0; i < sizeof(models) / sizeof(models[0]); i++) {
+        if (strcmp(models[i].name, name) == 0) {
+            return &models[i];
+        }
+    }
+    return NULL;
+}
+
+const keypad_bounce_model_t *keypad_sim_models(size_t *count)
+{
+    *count = sizeof(models) / sizeof(models[0]);
+    return models;
+}
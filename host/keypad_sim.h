@@ -0,0 +1,153 @@
+/**
+ * @file keypad_sim.h
+ * @brief Host-side 4x4 keypad simulator with contact-bounce models
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Produces the column levels the scanner would read for a scripted sequence
+ * of key presses. Each physical press is distorted by a configurable bounce
+ * model so debounce settings can be compared from data instead of by feel.
+ * All randomness is derived from a seed: the same seed and model always yield
+ * the same column readings, independent of the order in which they are read.
+ */
+
+#ifndef KEYPAD_SIM_H
+#define KEYPAD_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+/** @brief Simulated matrix rows (matches the firmware keypad) */
+#define KEYPAD_SIM_ROWS             4
+
+/** @brief Simulated matrix columns (matches the firmware keypad) */
+#define KEYPAD_SIM_COLS             4
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Contact-bounce model applied to every press and release
+ */
+typedef struct {
+    const char *name;           /**< Model name used in reports */
+    uint32_t burst_us;          /**< Maximum bounce burst after each true edge */
+    uint32_t bounce_period_us;  /**< Granularity of level changes inside a burst */
+    double chatter_prob;        /**< Probability a held contact reads open on one read */
+    double dropout_rate_hz;     /**< Worn contact: dropouts per second of hold time */
+    uint32_t dropout_us;        /**< Length of each worn-contact dropout */
+    double noise_prob;          /**< Probability an idle contact reads closed on one read */
+    bool ghosting;              /**< Diode-less matrix: three held corners ghost the fourth */
+} keypad_bounce_model_t;
+
+/**
+ * @brief Ground-truth press of one key
+ */
+typedef struct {
+    uint8_t row;                /**< Row index */
+    uint8_t col;                /**< Column index */
+    uint64_t start_us;          /**< Time the finger closes the contact */
+    uint64_t end_us;            /**< Time the finger releases the contact */
+    uint32_t press_burst_us;    /**< Bounce burst length after the press edge */
+    uint32_t release_burst_us;  /**< Bounce burst length after the release edge */
+} keypad_sim_press_t;
+
+/**
+ * @brief Press script generation parameters
+ */
+typedef struct {
+    size_t press_count;         /**< Number of presses to generate */
+    uint32_t hold_min_us;       /**< Shortest hold time */
+    uint32_t hold_max_us;       /**< Longest hold time */
+    uint32_t gap_min_us;        /**< Shortest pause between consecutive press starts */
+    uint32_t gap_max_us;        /**< Longest pause between consecutive press starts */
+    double chord_prob;          /**< Probability a press is a three-key rectangle chord */
+} keypad_sim_script_config_t;
+
+/**
+ * @brief Simulator instance
+ */
+typedef struct {
+    keypad_bounce_model_t model;        /**< Active bounce model */
+    uint64_t seed;                      /**< Seed for all pseudo-random decisions */
+    keypad_sim_press_t *presses;        /**< Ground-truth script sorted by start time */
+    size_t press_count;                 /**< Number of entries in presses */
+    uint64_t duration_us;               /**< End of the script including trailing bursts */
+    size_t *key_presses[KEYPAD_SIM_ROWS][KEYPAD_SIM_COLS];   /**< Per-key indices into presses */
+    size_t key_press_count[KEYPAD_SIM_ROWS][KEYPAD_SIM_COLS]; /**< Entries per key index */
+} keypad_sim_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Create a simulator with a generated press script
+ *
+ * @param sim Simulator to initialise
+ * @param model Bounce model to apply
+ * @param script Press script parameters
+ * @param seed Seed for the script and the bounce model
+ * @return true on success, false if memory allocation fails
+ */
+bool keypad_sim_init(keypad_sim_t *sim, const keypad_bounce_model_t *model,
+                     const keypad_sim_script_config_t *script, uint64_t seed);
+
+/**
+ * @brief Release memory owned by the simulator
+ *
+ * @param sim Simulator to free
+ */
+void keypad_sim_free(keypad_sim_t *sim);
+
+/**
+ * @brief Physical contact level of one key, without matrix effects
+ *
+ * @param sim Simulator
+ * @param row Row index
+ * @param col Column index
+ * @param t_us Time of the read in microseconds
+ * @return true if the contact is closed
+ */
+bool keypad_sim_contact(const keypad_sim_t *sim, uint8_t row, uint8_t col, uint64_t t_us);
+
+/**
+ * @brief Level the scanner reads on a column while a row is driven
+ *
+ * Includes chatter, noise and ghosting. The result uses the scanner's
+ * convention after inversion: true means the key reads as pressed.
+ *
+ * @param sim Simulator
+ * @param row Driven row
+ * @param col Column being read
+ * @param t_us Time of the read in microseconds
+ * @return true if the column reads as pressed
+ */
+bool keypad_sim_read(const keypad_sim_t *sim, uint8_t row, uint8_t col, uint64_t t_us);
+
+/**
+ * @brief Look up a built-in bounce model by name
+ *
+ * @param name Model name ("clean", "typical", "worn", "noisy", "ghosting")
+ * @return Pointer to the model, or NULL if unknown
+ */
+const keypad_bounce_model_t *keypad_sim_find_model(const char *name);
+
+/**
+ * @brief Get the table of built-in bounce models
+ *
+ * @param count Receives the number of models
+ * @return Pointer to the first model
+ */
+const keypad_bounce_model_t *keypad_sim_models(size_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEYPAD_SIM_H */
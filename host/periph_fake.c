@@ -0,0 +1,595 @@
+/**
+ * @file periph_fake.c
+ * @brief GPTimer alarms on threads, LEDC duties, a PCNT unit on quadrature pins
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * An enabled GPTimer holds an APB_FREQ_MAX lock ("gptimer"), as the driver
+ * does for its APB clock source. So does an enabled PCNT unit with a glitch
+ * filter ("pcnt"): the filter counts APB cycles.
+ *
+ * idf_fake_encoder_detent() drives the encoder phases through the GPIO fake,
+ * so their pin interrupts fire, and a started unit counts each edge with the
+ * edge and level actions of its channels, as the hardware does.
+ */
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "driver/gpio.h"
+#include "driver/gptimer.h"
+#include "driver/ledc.h"
+#include "driver/pulse_cnt.h"
+#include "esp_pm.h"
+#include "idf_fake.h"
+
+/* ==================== DATA TYPES ==================== */
+
+struct gptimer_t {
+    gptimer_config_t config;
+    gptimer_alarm_config_t alarm;
+    gptimer_event_callbacks_t callbacks;
+    void *user_data;
+    bool enabled;
+    bool running;
+    pthread_t thread;
+    esp_pm_lock_handle_t pm_lock;
+};
+
+typedef struct {
+    int gpio_num;
+    ledc_timer_t timer;
+    uint32_t duty;              // Set, not yet updated
+    bool configured;
+} ledc_fake_channel_t;
+
+struct pcnt_chan_t {
+    pcnt_unit_handle_t unit;
+    pcnt_chan_config_t config;
+    pcnt_channel_edge_action_t pos_act;
+    pcnt_channel_edge_action_t neg_act;
+    pcnt_channel_level_action_t high_act;
+    pcnt_channel_level_action_t low_act;
+};
+
+struct pcnt_unit_t {
+    pcnt_unit_config_t config;
+    pcnt_event_callbacks_t callbacks;
+    void *user_data;
+    bool enabled;
+    bool running;
+    int count;
+    pcnt_channel_handle_t channels[2];  // Phase A first, as rotary_encoder_init() creates them
+    esp_pm_lock_handle_t pm_lock;       // Created by the first glitch filter
+};
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_mutex_t periph_lock = PTHREAD_MUTEX_INITIALIZER;
+static ledc_timer_bit_t ledc_resolution[LEDC_TIMER_MAX];
+static ledc_fake_channel_t ledc_channels[LEDC_CHANNEL_MAX];
+static pcnt_unit_handle_t encoder_unit = NULL;     // The unit idf_fake_encoder_detent() turns
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/* ---------- GPTimer ---------- */
+
+/**
+ * @brief Alarm "interrupt": absolute deadlines, so callback time does not drift
+ */
+static void *gptimer_thread(void *arg)
+{
+    gptimer_handle_t timer = arg;
+    uint64_t period_ns = timer->alarm.alarm_count * 1000000000ULL / timer->config.resolution_hz;
+    struct timespec deadline;
+
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    while (__atomic_load_n(&timer->running, __ATOMIC_ACQUIRE)) {
+        uint64_t nsec = (uint64_t)deadline.tv_nsec + period_ns;
+        deadline.tv_sec += (time_t)(nsec / 1000000000ULL);
+        deadline.tv_nsec = (long)(nsec % 1000000000ULL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR) {
+        }
+        if (!__atomic_load_n(&timer->running, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+
+        gptimer_alarm_event_data_t edata = {
+            .count_value = timer->alarm.alarm_count,
+            .alarm_value = timer->alarm.alarm_count,
+        };
+        if (timer->callbacks.on_alarm != NULL) {
+            timer->callbacks.on_alarm(timer, &edata, timer->user_data);
+        }
+        if (!timer->alarm.flags.auto_reload_on_alarm) {
+            break;      // The counter runs on past a one-shot alarm: no more alarms
+        }
+    }
+    return NULL;
+}
+
+esp_err_t gptimer_new_timer(const gptimer_config_t *config, gptimer_handle_t *ret_timer)
+{
+    if (config == NULL || ret_timer == NULL || config->resolution_hz == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    gptimer_handle_t timer = calloc(1, sizeof(*timer));
+    if (timer == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    timer->config = *config;
+    if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "gptimer", &timer->pm_lock) != ESP_OK) {
+        timer->pm_lock = NULL;
+    }
+    *ret_timer = timer;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_del_timer(gptimer_handle_t timer)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (timer->pm_lock != NULL) {
+        esp_pm_lock_delete(timer->pm_lock);
+    }
+    free(timer);
+    return ESP_OK;
+}
+
+esp_err_t gptimer_register_event_callbacks(gptimer_handle_t timer, const gptimer_event_callbacks_t *cbs,
+                                           void *user_data)
+{
+    if (timer == NULL || cbs == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->callbacks = *cbs;
+    timer->user_data = user_data;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_set_alarm_action(gptimer_handle_t timer, const gptimer_alarm_config_t *config)
+{
+    if (timer == NULL || config == NULL || config->alarm_count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    timer->alarm = *config;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_enable(gptimer_handle_t timer)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (timer->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (timer->pm_lock != NULL) {
+        esp_pm_lock_acquire(timer->pm_lock);
+    }
+    timer->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_disable(gptimer_handle_t timer)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!timer->enabled || timer->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (timer->pm_lock != NULL) {
+        esp_pm_lock_release(timer->pm_lock);
+    }
+    timer->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t gptimer_set_raw_count(gptimer_handle_t timer, uint64_t value)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // The alarm thread counts from zero at every start: that is the only value
+    return value == 0 && !timer->running ? ESP_OK : ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t gptimer_start(gptimer_handle_t timer)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!timer->enabled || timer->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    timer->running = true;
+    if (pthread_create(&timer->thread, NULL, gptimer_thread, timer) != 0) {
+        timer->running = false;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t gptimer_stop(gptimer_handle_t timer)
+{
+    if (timer == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!timer->running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    __atomic_store_n(&timer->running, false, __ATOMIC_RELEASE);
+    pthread_join(timer->thread, NULL);
+    return ESP_OK;
+}
+
+/* ---------- LEDC ---------- */
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t *timer_conf)
+{
+    if (timer_conf == NULL || timer_conf->timer_num >= LEDC_TIMER_MAX || timer_conf->freq_hz == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    ledc_resolution[timer_conf->timer_num] = timer_conf->duty_resolution;
+    return ESP_OK;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t *ledc_conf)
+{
+    if (ledc_conf == NULL || ledc_conf->channel >= LEDC_CHANNEL_MAX || ledc_conf->timer_sel >= LEDC_TIMER_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&periph_lock);
+    ledc_channels[ledc_conf->channel] = (ledc_fake_channel_t) {
+        .gpio_num = ledc_conf->gpio_num,
+        .timer = ledc_conf->timer_sel,
+        .duty = ledc_conf->duty,
+        .configured = true,
+    };
+    pthread_mutex_unlock(&periph_lock);
+    return ledc_update_duty(ledc_conf->speed_mode, ledc_conf->channel);
+}
+
+esp_err_t ledc_set_duty(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty)
+{
+    if (channel >= LEDC_CHANNEL_MAX || !ledc_channels[channel].configured) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&periph_lock);
+    ledc_channels[channel].duty = duty;
+    pthread_mutex_unlock(&periph_lock);
+    return ESP_OK;
+}
+
+esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+    if (channel >= LEDC_CHANNEL_MAX || !ledc_channels[channel].configured) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&periph_lock);
+    ledc_fake_channel_t state = ledc_channels[channel];
+    pthread_mutex_unlock(&periph_lock);
+
+    if (state.gpio_num == IDF_FAKE_HEATER_GPIO) {
+        idf_fake_set_heater((double)state.duty / (double)(1U << ledc_resolution[state.timer]));
+    }
+    return ESP_OK;
+}
+
+esp_err_t ledc_stop(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t idle_level)
+{
+    if (channel >= LEDC_CHANNEL_MAX || !ledc_channels[channel].configured) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (ledc_channels[channel].gpio_num == IDF_FAKE_HEATER_GPIO) {
+        idf_fake_set_heater(idle_level ? 1.0 : 0.0);
+    }
+    return ESP_OK;
+}
+
+/* ---------- PCNT ---------- */
+
+esp_err_t pcnt_new_unit(const pcnt_unit_config_t *config, pcnt_unit_handle_t *ret_unit)
+{
+    if (config == NULL || ret_unit == NULL || config->low_limit >= 0 || config->high_limit <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pcnt_unit_handle_t unit = calloc(1, sizeof(*unit));
+    if (unit == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    unit->config = *config;
+    *ret_unit = unit;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_del_unit(pcnt_unit_handle_t unit)
+{
+    if (unit == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (unit->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (unit->pm_lock != NULL) {
+        esp_pm_lock_delete(unit->pm_lock);
+    }
+    pthread_mutex_lock(&periph_lock);
+    if (encoder_unit == unit) {
+        encoder_unit = NULL;
+    }
+    pthread_mutex_unlock(&periph_lock);
+    free(unit);
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_set_glitch_filter(pcnt_unit_handle_t unit, const pcnt_glitch_filter_config_t *config)
+{
+    if (unit == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (unit->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // As in the driver, the lock outlives a later NULL (filter off) config
+    if (config != NULL && unit->pm_lock == NULL &&
+        esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "pcnt", &unit->pm_lock) != ESP_OK) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t pcnt_new_channel(pcnt_unit_handle_t unit, const pcnt_chan_config_t *config,
+                           pcnt_channel_handle_t *ret_chan)
+{
+    if (unit == NULL || config == NULL || ret_chan == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    int slot = unit->channels[0] == NULL ? 0 : 1;
+    if (unit->channels[slot] != NULL) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    pcnt_channel_handle_t chan = calloc(1, sizeof(*chan));
+    if (chan == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    chan->unit = unit;
+    chan->config = *config;
+    chan->pos_act = PCNT_CHANNEL_EDGE_ACTION_HOLD;
+    chan->neg_act = PCNT_CHANNEL_EDGE_ACTION_HOLD;
+    unit->channels[slot] = chan;
+
+    // The driver enables the pull-up: an idle encoder reads high
+    gpio_set_level(config->edge_gpio_num, 1);
+    *ret_chan = chan;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_del_channel(pcnt_channel_handle_t chan)
+{
+    if (chan != NULL) {
+        for (int i = 0; i < 2; i++) {
+            if (chan->unit->channels[i] == chan) {
+                chan->unit->channels[i] = NULL;
+            }
+        }
+    }
+    free(chan);
+    return ESP_OK;
+}
+
+esp_err_t pcnt_channel_set_edge_action(pcnt_channel_handle_t chan, pcnt_channel_edge_action_t pos_act,
+                                       pcnt_channel_edge_action_t neg_act)
+{
+    if (chan == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    chan->pos_act = pos_act;
+    chan->neg_act = neg_act;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_channel_set_level_action(pcnt_channel_handle_t chan, pcnt_channel_level_action_t high_act,
+                                        pcnt_channel_level_action_t low_act)
+{
+    if (chan == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    chan->high_act = high_act;
+    chan->low_act = low_act;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_add_watch_point(pcnt_unit_handle_t unit, int watch_point)
+{
+    return unit != NULL ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t pcnt_unit_register_event_callbacks(pcnt_unit_handle_t unit, const pcnt_event_callbacks_t *cbs,
+                                             void *user_data)
+{
+    if (unit == NULL || cbs == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    unit->callbacks = *cbs;
+    unit->user_data = user_data;
+    pthread_mutex_lock(&periph_lock);
+    encoder_unit = unit;
+    pthread_mutex_unlock(&periph_lock);
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_enable(pcnt_unit_handle_t unit)
+{
+    if (unit == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (unit->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (unit->pm_lock != NULL) {
+        esp_pm_lock_acquire(unit->pm_lock);
+    }
+    unit->enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_disable(pcnt_unit_handle_t unit)
+{
+    if (unit == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!unit->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (unit->pm_lock != NULL) {
+        esp_pm_lock_release(unit->pm_lock);
+    }
+    unit->enabled = false;
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_start(pcnt_unit_handle_t unit)
+{
+    if (unit == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!unit->enabled) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    pthread_mutex_lock(&periph_lock);
+    unit->running = true;
+    pthread_mutex_unlock(&periph_lock);
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_stop(pcnt_unit_handle_t unit)
+{
+    if (unit == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&periph_lock);
+    unit->running = false;
+    pthread_mutex_unlock(&periph_lock);
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_clear_count(pcnt_unit_handle_t unit)
+{
+    if (unit == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&periph_lock);
+    unit->count = 0;
+    pthread_mutex_unlock(&periph_lock);
+    return ESP_OK;
+}
+
+esp_err_t pcnt_unit_get_count(pcnt_unit_handle_t unit, int *value)
+{
+    if (unit == NULL || value == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&periph_lock);
+    *value = unit->count;
+    pthread_mutex_unlock(&periph_lock);
+    return ESP_OK;
+}
+
+/**
+ * @brief Count one edge on a pin with the channel actions; true at a limit
+ *        (periph lock held)
+ */
+static bool pcnt_count_edge(pcnt_unit_handle_t unit, int pin, bool rising, int *limit)
+{
+    if (!unit->running) {
+        return false;
+    }
+    for (int i = 0; i < 2; i++) {
+        pcnt_channel_handle_t chan = unit->channels[i];
+        if (chan == NULL || chan->config.edge_gpio_num != pin) {
+            continue;
+        }
+        pcnt_channel_edge_action_t edge = rising ? chan->pos_act : chan->neg_act;
+        int step = edge == PCNT_CHANNEL_EDGE_ACTION_INCREASE ? 1 :
+                   edge == PCNT_CHANNEL_EDGE_ACTION_DECREASE ? -1 : 0;
+        pcnt_channel_level_action_t level = gpio_get_level(chan->config.level_gpio_num) ?
+                                            chan->high_act : chan->low_act;
+        if (level == PCNT_CHANNEL_LEVEL_ACTION_INVERSE) {
+            step = -step;
+        } else if (level == PCNT_CHANNEL_LEVEL_ACTION_HOLD) {
+            step = 0;
+        }
+        unit->count += step;
+    }
+    // Limits are the watch points here: report and clear, like the hardware
+    if (unit->count >= unit->config.high_limit || unit->count <= unit->config.low_limit) {
+        *limit = unit->count >= unit->config.high_limit ? unit->config.high_limit
+                                                        : unit->config.low_limit;
+        unit->count = 0;
+        return true;
+    }
+    return false;
+}
+
+esp_err_t idf_fake_encoder_detent(int direction)
+{
+    pthread_mutex_lock(&periph_lock);
+    pcnt_unit_handle_t unit = encoder_unit;
+    pthread_mutex_unlock(&periph_lock);
+
+    if (unit == NULL || unit->callbacks.on_reach == NULL ||
+        unit->channels[0] == NULL || unit->channels[1] == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    const int pins[2] = { unit->channels[0]->config.edge_gpio_num,
+                          unit->channels[1]->config.edge_gpio_num };
+
+    // Clockwise A leads: 11 -> 01 -> 00 -> 10 -> 11; counter-clockwise B leads
+    for (int step = 0; step < 4; step++) {
+        int pin = pins[direction > 0 ? step & 1 : !(step & 1)];
+        bool rising = step >= 2;
+
+        pthread_mutex_lock(&periph_lock);
+        bool running = unit->running;
+        pthread_mutex_unlock(&periph_lock);
+        if (step == 1 && !running) {
+            // The first edge woke an idle encoder: give its timer time to start the unit
+            for (int waited_ms = 0; waited_ms < 100 && !running; waited_ms++) {
+                usleep(1000);
+                pthread_mutex_lock(&periph_lock);
+                running = unit->running;
+                pthread_mutex_unlock(&periph_lock);
+            }
+            if (!running) {
+                gpio_set_level(pins[0], 1);
+                gpio_set_level(pins[1], 1);
+                return ESP_ERR_INVALID_STATE;
+            }
+        }
+
+        gpio_set_level(pin, rising);
+        int limit = 0;
+        pthread_mutex_lock(&periph_lock);
+        bool reached = pcnt_count_edge(unit, pin, rising, &limit);
+        pthread_mutex_unlock(&periph_lock);
+        if (reached) {
+            pcnt_watch_event_data_t edata = {
+                .watch_point_value = limit,
+                .zero_cross_mode = PCNT_UNIT_ZERO_CROSS_POS_ZERO,
+            };
+            unit->callbacks.on_reach(unit, &edata, unit->user_data);
+        }
+    }
+    return ESP_OK;
+}
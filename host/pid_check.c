@@ -0,0 +1,274 @@
+/**
+ * @file pid_check.c
+ * @brief Check the fixed-point heater PID against a double-precision reference
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Runs the firmware heater_pid with the firmware's tuning and checks four
+ * things:
+ *
+ * - arithmetic: random setpoint/measurement sequences through heater_pid_step()
+ *   and a double-precision copy of the same law (using the quantised gains)
+ *   must agree to within rounding; gain quantisation is reported separately
+ * - anti-windup: after a long saturated warm-up the measurement ramps past
+ *   the setpoint; the output must be off full duty within a few steps of the
+ *   crossing, where a plain integrator stays saturated for minutes
+ * - derivative noise: a single 0.01 C step of the measurement, and a reading
+ *   dithering by one LSB, must move the output by a fraction of what the
+ *   unfiltered derivative (Kd/dt per centi) would
+ * - cost: time per step, fixed point vs. double
+ *
+ * Usage: pid_check [--steps=N] [--seed=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "heater_pid.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+// Matches main.c
+#define PERIOD_MS               20
+#define KP                      20.0f
+#define KI                      0.02f
+#define KD                      20.0f
+#define KD_FILTER_S             1.0f
+#define KFF                     0.5f
+#define AMBIENT_CENTI           2000
+
+#define MAX_ROUNDING_ERROR      2       // Duty units (0.01 %) allowed between fixed and double
+#define WINDUP_SECONDS          900     // Saturated warm-up before the ramp
+#define RAMP_CENTI_PER_STEP     0.4     // 12 C/min at 50 Hz
+#define MAX_RECOVERY_STEPS      5       // Steps allowed at full duty after the crossing
+#define MAX_STEP_KICK           50      // Duty units (0.5 %) one 0.01 C step may move the D term
+#define DITHER_STEPS            50000   // Steps of +-1 centi dither for the D-term spread
+#define BENCH_STEPS             10000000L
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Double-precision copy of the control law
+ */
+typedef struct {
+    double kp, ki, kd, kff;     // Per step, output units per centi
+    double kd_alpha;            // Derivative low-pass weight
+    double ambient;
+    double integral;
+    double derivative;
+    double previous;
+    bool primed;
+    bool anti_windup;
+} ref_pid_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static void ref_init(ref_pid_t *ref, const heater_pid_t *pid, bool anti_windup)
+{
+    const double one = (double)(1 << HEATER_PID_Q);
+    *ref = (ref_pid_t){
+        .kp = pid->kp_q / one, .ki = pid->ki_q / one, .kd = pid->kd_q / one, .kff = pid->kff_q / one,
+        .kd_alpha = pid->kd_alpha_q / one,
+        .ambient = pid->ambient_centi, .anti_windup = anti_windup,
+    };
+}
+
+static double ref_step(ref_pid_t *ref, double setpoint, double measured)
+{
+    const double max = HEATER_PID_OUTPUT_MAX;
+    double error = setpoint - measured;
+    double p = ref->kp * error;
+    if (ref->primed) {
+        ref->derivative += (-ref->kd * (measured - ref->previous) - ref->derivative) * ref->kd_alpha;
+    }
+    double d = ref->derivative;
+    double ff = ref->kff * (setpoint - ref->ambient);
+    ref->previous = measured;
+    ref->primed = true;
+
+    double integral = ref->integral + ref->ki * error;
+    if (ref->anti_windup) {
+        double candidate = p + d + ff + integral;
+        if ((candidate > max && error > 0) || (candidate < 0 && error < 0)) {
+            integral = ref->integral;
+        }
+        integral = fmin(fmax(integral, -max), max);
+    }
+    ref->integral = integral;
+
+    return fmin(fmax(p + d + ff + integral, 0.0), max);
+}
+
+int main(int argc, char **argv)
+{
+    long steps = 1000000;
+    uint64_t seed = 1;
+
+    static const struct option options[] = {
+        { "steps", required_argument, NULL, 'n' },
+        { "seed",  required_argument, NULL, 's' },
+        { "help",  no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'n': steps = atol(optarg); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "Usage: %s [--steps=N] [--seed=N]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    const heater_pid_config_t config = {
+        .kp = KP, .ki = KI, .kd = KD, .kd_filter_s = KD_FILTER_S, .kff = KFF,
+        .ambient_centi = AMBIENT_CENTI, .period_ms = PERIOD_MS,
+    };
+    heater_pid_config_t unfiltered_config = config;
+    unfiltered_config.kd_filter_s = 0.0f;
+    heater_pid_t pid;
+    heater_pid_t unfiltered;
+    if (heater_pid_init(&pid, &config) != ESP_OK ||
+        heater_pid_init(&unfiltered, &unfiltered_config) != ESP_OK) {
+        fprintf(stderr, "Tuning rejected\n");
+        return 1;
+    }
+    int failures = 0;
+
+    // Gain quantisation
+    const double one = (double)(1 << HEATER_PID_Q);
+    const double dt = PERIOD_MS / 1000.0;
+    const double wanted[5] = { KP, KI * dt, KD / dt, dt / (KD_FILTER_S + dt), KFF };
+    const int32_t got[5] = { pid.kp_q, pid.ki_q, pid.kd_q, pid.kd_alpha_q, pid.kff_q };
+    const char *names[5] = { "Kp", "Ki*dt", "Kd/dt", "D alpha", "Kff" };
+    printf("Q%d gains at %d ms:\n", HEATER_PID_Q, PERIOD_MS);
+    for (int i = 0; i < 5; i++) {
+        printf("  %-6s %12.6f -> %10d (%+.4f %%)\n", names[i], wanted[i], (int)got[i],
+               wanted[i] > 0 ? (got[i] / one - wanted[i]) / wanted[i] * 100.0 : 0.0);
+    }
+
+    // Arithmetic against the reference on a random walk around the setpoint
+    adc_synth_t rng;
+    adc_synth_init(&rng, 1.0, 0.0, 0.0, seed);
+    ref_pid_t ref;
+    ref_init(&ref, &pid, true);
+    int32_t setpoint = 3000;
+    double measured = 2500.0;
+    int max_error = 0;
+    for (long i = 0; i < steps; i++) {
+        if (adc_synth_uniform(&rng) < 0.001) {
+            setpoint = 2000 + (int32_t)(adc_synth_uniform(&rng) * 2000.0);
+        }
+        measured += 3.0 * adc_synth_gaussian(&rng) + (setpoint - measured) * 0.001;
+        int32_t centi = (int32_t)lround(measured);
+
+        int32_t fixed = heater_pid_step(&pid, setpoint, centi);
+        double reference = ref_step(&ref, setpoint, centi);
+        int error = abs(fixed - (int32_t)lround(reference));
+        if (error > max_error) {
+            max_error = error;
+        }
+    }
+    printf("\nArithmetic: %ld steps, max |fixed - double| = %d duty units (limit %d)\n",
+           steps, max_error, MAX_ROUNDING_ERROR);
+    if (max_error > MAX_ROUNDING_ERROR) {
+        printf("  FAIL: fixed point drifts from the reference\n");
+        failures++;
+    }
+
+    // Anti-windup: 10 C below the setpoint for minutes, then a ramp 2 C past it
+    ref_pid_t plain;
+    heater_pid_reset(&pid);
+    ref_init(&plain, &pid, false);
+    const long windup_steps = WINDUP_SECONDS * 1000L / PERIOD_MS;
+    for (long i = 0; i < windup_steps; i++) {
+        heater_pid_step(&pid, 3000, 2000);
+        ref_step(&plain, 3000, 2000);
+    }
+    long crossing = -1;
+    long fixed_saturated = -1;      // Steps at full duty after the crossing
+    long plain_saturated = -1;
+    double ramp = 2000.0;
+    for (long i = 0; i < 100000 && (fixed_saturated < 0 || plain_saturated < 0); i++) {
+        ramp = fmin(ramp + RAMP_CENTI_PER_STEP, 3200.0);
+        int32_t centi = (int32_t)lround(ramp);
+        bool fixed_full = heater_pid_step(&pid, 3000, centi) >= HEATER_PID_OUTPUT_MAX;
+        bool plain_full = ref_step(&plain, 3000, centi) >= HEATER_PID_OUTPUT_MAX;
+        if (centi <= 3000) {
+            continue;
+        }
+        if (crossing < 0) {
+            crossing = i;
+        }
+        if (fixed_saturated < 0 && !fixed_full) {
+            fixed_saturated = i - crossing;
+        }
+        if (plain_saturated < 0 && !plain_full) {
+            plain_saturated = i - crossing;
+        }
+    }
+    printf("\nAnti-windup: after %d s at full duty, steps at 100 %% once past the setpoint: "
+           "%ld; plain integrator %ld (%.1f s)\n", WINDUP_SECONDS, fixed_saturated,
+           plain_saturated, plain_saturated * PERIOD_MS / 1000.0);
+    if (fixed_saturated < 0 || fixed_saturated > MAX_RECOVERY_STEPS) {
+        printf("  FAIL: integral wound up\n");
+        failures++;
+    }
+
+    // Derivative noise: one LSB step, then one LSB of dither, at the setpoint
+    heater_pid_t *pids[2] = { &pid, &unfiltered };
+    int32_t kick[2];
+    double spread[2];
+    for (int i = 0; i < 2; i++) {
+        heater_pid_reset(pids[i]);
+        heater_pid_step(pids[i], 3000, 3000);
+        heater_pid_step(pids[i], 3000, 3001);
+        kick[i] = abs(pids[i]->d_term);
+
+        heater_pid_reset(pids[i]);
+        double sum = 0.0;
+        double sum_sq = 0.0;
+        for (long n = 0; n < DITHER_STEPS; n++) {
+            heater_pid_step(pids[i], 3000, 3000 + (adc_synth_uniform(&rng) < 0.5 ? 0 : 1));
+            sum += pids[i]->d_term;
+            sum_sq += (double)pids[i]->d_term * pids[i]->d_term;
+        }
+        spread[i] = sqrt(fmax(sum_sq / DITHER_STEPS - (sum / DITHER_STEPS) * (sum / DITHER_STEPS), 0.0));
+    }
+    printf("\nDerivative noise (tau %.1f s): one 0.01 C step moves D by %.2f %% (unfiltered %.2f %%), "
+           "1 LSB dither spreads it by %.2f %% rms (unfiltered %.2f %%)\n", KD_FILTER_S,
+           kick[0] / 100.0, kick[1] / 100.0, spread[0] / 100.0, spread[1] / 100.0);
+    if (kick[0] > MAX_STEP_KICK) {
+        printf("  FAIL: quantisation steps kick the derivative\n");
+        failures++;
+    }
+
+    // Cost per step
+    heater_pid_reset(&pid);
+    ref_init(&ref, &pid, true);
+    int64_t sink = 0;
+    uint64_t start = host_now_ns();
+    for (long i = 0; i < BENCH_STEPS; i++) {
+        sink += heater_pid_step(&pid, 3000, 2900 + (int32_t)(i & 255));
+    }
+    uint64_t fixed_ns = host_now_ns() - start;
+    start = host_now_ns();
+    for (long i = 0; i < BENCH_STEPS; i++) {
+        sink += (int64_t)ref_step(&ref, 3000, 2900 + (double)(i & 255));
+    }
+    uint64_t ref_ns = host_now_ns() - start;
+    printf("\nStep cost: fixed %.2f ns, double %.2f ns (checksum %lld)\n",
+           (double)fixed_ns / BENCH_STEPS, (double)ref_ns / BENCH_STEPS, (long long)sink);
+
+    if (failures > 0) {
+        printf("\nFAIL: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("\nFixed-point PID matches the reference, does not wind up and filters its derivative\n");
+    return 0;
+}
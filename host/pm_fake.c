@@ -0,0 +1,312 @@
+/**
+ * @file pm_fake.c
+ * @brief esp_pm locks, and light sleep as "every task blocked"
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The FreeRTOS fake reports each task that blocks (delay, notification,
+ * queue, semaphore, the esp_timer task between callbacks, the console
+ * waiting for stdin) and each that becomes ready again. When none is ready,
+ * light sleep is enabled and no lock is held, the target's idle task would
+ * put the chip to sleep: the fake marks that moment, and the next task to
+ * wake ends the "sleep" and hands its length to the exit callbacks.
+ *
+ * Sleeps shorter than CONFIG_FREERTOS_IDLE_TIME_BEFORE_SLEEP ticks are not
+ * reported: the idle task would not have entered them. The fake knows the
+ * length only afterwards, so enter callbacks are accepted and never called.
+ * DFS has no host equivalent; the frequency range is only recorded.
+ */
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define PM_FAKE_LOCK_NAME_LEN       16
+#define PM_FAKE_MAX_CALLBACKS       4       // CONFIG_PM_LIGHT_SLEEP_CALLBACKS keeps a short list too
+#define PM_FAKE_MIN_SLEEP_US        ((int64_t)CONFIG_FREERTOS_IDLE_TIME_BEFORE_SLEEP * 1000000 / \
+                                     CONFIG_FREERTOS_HZ)
+
+/* ==================== DATA TYPES ==================== */
+
+struct esp_pm_lock {
+    esp_pm_lock_type_t type;
+    int arg;
+    char name[PM_FAKE_LOCK_NAME_LEN];
+    uint32_t count;             // Acquisitions not yet released
+    uint32_t times_taken;
+    struct esp_pm_lock *next;
+};
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_mutex_t pm_lock = PTHREAD_MUTEX_INITIALIZER;
+static esp_pm_config_t pm_config;
+static bool configured = false;
+static struct esp_pm_lock *locks = NULL;
+static uint32_t locks_held = 0;             // Locks with a non-zero count
+static uint32_t tasks_ready = 0;
+static bool asleep = false;
+static int64_t sleep_start_us = 0;
+static esp_pm_light_sleep_cb_t exit_cbs[PM_FAKE_MAX_CALLBACKS];
+static void *exit_cb_args[PM_FAKE_MAX_CALLBACKS];
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Enter or leave "light sleep" after a change (pm_lock held)
+ */
+static void pm_update(void)
+{
+    bool can_sleep = configured && pm_config.light_sleep_enable && tasks_ready == 0 &&
+                     locks_held == 0;
+
+    if (can_sleep && !asleep) {
+        asleep = true;
+        sleep_start_us = esp_timer_get_time();
+    } else if (!can_sleep && asleep) {
+        asleep = false;
+        int64_t slept_us = esp_timer_get_time() - sleep_start_us;
+        if (slept_us >= PM_FAKE_MIN_SLEEP_US) {
+            for (int i = 0; i < PM_FAKE_MAX_CALLBACKS && exit_cbs[i] != NULL; i++) {
+                exit_cbs[i](slept_us, exit_cb_args[i]);
+            }
+        }
+    }
+}
+
+void idf_fake_pm_task_block(void)
+{
+    pthread_mutex_lock(&pm_lock);
+    if (tasks_ready > 0) {
+        tasks_ready--;
+    }
+    pm_update();
+    pthread_mutex_unlock(&pm_lock);
+}
+
+void idf_fake_pm_task_unblock(void)
+{
+    pthread_mutex_lock(&pm_lock);
+    tasks_ready++;
+    pm_update();
+    pthread_mutex_unlock(&pm_lock);
+}
+
+esp_err_t esp_pm_configure(const void *config)
+{
+    const esp_pm_config_t *pm = config;
+
+    if (pm == NULL || pm->min_freq_mhz <= 0 || pm->max_freq_mhz < pm->min_freq_mhz) {
+        return ESP_ERR_INVALID_ARG;
+    }
+#if !CONFIG_FREERTOS_USE_TICKLESS_IDLE
+    if (pm->light_sleep_enable) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+#endif
+    pthread_mutex_lock(&pm_lock);
+    pm_config = *pm;
+    configured = true;
+    pm_update();
+    pthread_mutex_unlock(&pm_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_get_configuration(void *config)
+{
+    if (config == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&pm_lock);
+    *(esp_pm_config_t *)config = pm_config;
+    pthread_mutex_unlock(&pm_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_create(esp_pm_lock_type_t lock_type, int arg, const char *name,
+                             esp_pm_lock_handle_t *out_handle)
+{
+    if (out_handle == NULL || lock_type > ESP_PM_NO_LIGHT_SLEEP) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct esp_pm_lock *lock = calloc(1, sizeof(*lock));
+    if (lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    lock->type = lock_type;
+    lock->arg = arg;
+    snprintf(lock->name, sizeof(lock->name), "%s", name != NULL ? name : "");
+
+    pthread_mutex_lock(&pm_lock);
+    lock->next = locks;
+    locks = lock;
+    pthread_mutex_unlock(&pm_lock);
+    *out_handle = lock;
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_acquire(esp_pm_lock_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&pm_lock);
+    if (handle->count++ == 0) {
+        locks_held++;
+        pm_update();
+    }
+    handle->times_taken++;
+    pthread_mutex_unlock(&pm_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_lock_release(esp_pm_lock_handle_t handle)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&pm_lock);
+    if (handle->count == 0) {
+        ret = ESP_ERR_INVALID_STATE;
+    } else if (--handle->count == 0) {
+        locks_held--;
+        pm_update();
+    }
+    pthread_mutex_unlock(&pm_lock);
+    return ret;
+}
+
+esp_err_t esp_pm_lock_delete(esp_pm_lock_handle_t handle)
+{
+    if (handle == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&pm_lock);
+    if (handle->count > 0) {
+        pthread_mutex_unlock(&pm_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    for (struct esp_pm_lock **link = &locks; *link != NULL; link = &(*link)->next) {
+        if (*link == handle) {
+            *link = handle->next;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&pm_lock);
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_dump_locks(FILE *stream)
+{
+    static const char *const type_names[] = { "CPU_FREQ_MAX", "APB_FREQ_MAX", "NO_SLEEP" };
+
+    pthread_mutex_lock(&pm_lock);
+    fprintf(stream, "Lock stats:\n");
+    fprintf(stream, "  %-15s %-14s %-4s %-6s %-11s\n", "Name", "Type", "Arg", "Active", "Total_count");
+    for (struct esp_pm_lock *lock = locks; lock != NULL; lock = lock->next) {
+        fprintf(stream, "  %-15s %-14s %-4d %-6" PRIu32 " %-11" PRIu32 "\n", lock->name,
+                type_names[lock->type], lock->arg, lock->count, lock->times_taken);
+    }
+    pthread_mutex_unlock(&pm_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_pm_light_sleep_register_cbs(esp_pm_sleep_cbs_register_config_t *cbs_conf)
+{
+    esp_err_t ret = ESP_ERR_NO_MEM;
+
+    if (cbs_conf == NULL || (cbs_conf->enter_cb == NULL && cbs_conf->exit_cb == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (cbs_conf->exit_cb == NULL) {
+        return ESP_OK;
+    }
+    pthread_mutex_lock(&pm_lock);
+    for (int i = 0; i < PM_FAKE_MAX_CALLBACKS; i++) {
+        if (exit_cbs[i] == NULL) {
+            exit_cbs[i] = cbs_conf->exit_cb;
+            exit_cb_args[i] = cbs_conf->exit_cb_user_arg;
+            ret = ESP_OK;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&pm_lock);
+    return ret;
+}
+
+esp_err_t esp_pm_light_sleep_unregister_cbs(esp_pm_sleep_cbs_register_config_t *cbs_conf)
+{
+    if (cbs_conf == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&pm_lock);
+    for (int i = 0; i < PM_FAKE_MAX_CALLBACKS; i++) {
+        if (exit_cbs[i] == cbs_conf->exit_cb) {
+            // Keep the list packed: pm_update() stops at the first empty slot
+            memmove(&exit_cbs[i], &exit_cbs[i + 1], (PM_FAKE_MAX_CALLBACKS - i - 1) * sizeof(exit_cbs[0]));
+            memmove(&exit_cb_args[i], &exit_cb_args[i + 1],
+                    (PM_FAKE_MAX_CALLBACKS - i - 1) * sizeof(exit_cb_args[0]));
+            exit_cbs[PM_FAKE_MAX_CALLBACKS - 1] = NULL;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&pm_lock);
+    return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_gpio_wakeup(void)
+{
+    return ESP_OK;
+}
+
+/* ---------- Console input ---------- */
+
+char *__real_fgets(char *s, int size, FILE *stream);
+char *__real___fgets_chk(char *s, size_t buf_size, int size, FILE *stream);
+
+/**
+ * @brief A task reading stdin blocks, like the console on the UART driver
+ *
+ * Linked with --wrap for fgets and for its _FORTIFY_SOURCE variant.
+ */
+char *__wrap_fgets(char *s, int size, FILE *stream)
+{
+    bool blocks = stream == stdin && xTaskGetCurrentTaskHandle() != NULL;
+
+    if (blocks) {
+        idf_fake_pm_task_block();
+    }
+    char *line = __real_fgets(s, size, stream);
+    if (blocks) {
+        idf_fake_pm_task_unblock();
+    }
+    return line;
+}
+
+char *__wrap___fgets_chk(char *s, size_t buf_size, int size, FILE *stream)
+{
+    bool blocks = stream == stdin && xTaskGetCurrentTaskHandle() != NULL;
+
+    if (blocks) {
+        idf_fake_pm_task_block();
+    }
+    char *line = __real___fgets_chk(s, buf_size, size, stream);
+    if (blocks) {
+        idf_fake_pm_task_unblock();
+    }
+    return line;
+}
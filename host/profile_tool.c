@@ -0,0 +1,277 @@
+/**
+ * @file profile_tool.c
+ * @brief Encode, inspect and time cooking-profile blobs
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Encodes a text profile description into the blob format read by
+ * cook_profile_load(), either as a binary file or as the C source of the
+ * firmware's built-in profiles. Without --encode it inspects a blob (the
+ * built-in one by default): every profile is loaded through the firmware
+ * code, its compiled table is checked against the band list, and the
+ * direct-index classification is timed against an if-chain over the bands.
+ *
+ * Usage: profile_tool --encode=SPEC (--out=FILE | --emit-c)
+ *        profile_tool [--blob=FILE]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "cook_profile.h"
+#include "crc32.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define MAX_BLOB_BYTES          4096
+#define BENCH_LOOKUPS           20000000L
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static void put_i16(uint8_t *p, int v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)((unsigned)v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++) {
+        p[i] = (uint8_t)(v >> (8 * i));
+    }
+}
+
+/**
+ * @brief Parse a profile description into a blob
+ *
+ * @return Blob length, or 0 on a syntax error (reported on stderr)
+ */
+static size_t encode_spec(const char *path, uint8_t *blob)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return 0;
+    }
+
+    char line[128];
+    int line_no = 0;
+    size_t len = 8;
+    uint8_t *band_count = NULL;
+    int profiles = 0;
+
+    put_u32(blob, COOK_PROFILE_MAGIC);
+    blob[4] = COOK_PROFILE_VERSION;
+    blob[6] = blob[7] = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char name[64];
+        int lo, hi, used = 0;
+        line_no++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (line[0] == '#' || line[strspn(line, " \t")] == '\0') {
+            continue;
+        }
+        if (sscanf(line, "profile %63s %d %d", name, &lo, &hi) == 3) {
+            if (strlen(name) > COOK_PROFILE_NAME_LEN || profiles == COOK_PROFILE_MAX_PROFILES ||
+                len + COOK_PROFILE_NAME_LEN + 5 > MAX_BLOB_BYTES - 4) {
+                fprintf(stderr, "%s:%d: profile name too long or too many profiles\n", path, line_no);
+                fclose(file);
+                return 0;
+            }
+            memset(blob + len, 0, COOK_PROFILE_NAME_LEN);
+            memcpy(blob + len, name, strlen(name));
+            put_i16(blob + len + COOK_PROFILE_NAME_LEN, lo);
+            put_i16(blob + len + COOK_PROFILE_NAME_LEN + 2, hi);
+            band_count = blob + len + COOK_PROFILE_NAME_LEN + 4;
+            *band_count = 0;
+            len += COOK_PROFILE_NAME_LEN + 5;
+            profiles++;
+        } else if (sscanf(line, "band %d %d %n", &lo, &hi, &used) == 2 && used > 0) {
+            const char *label = line + used;
+            if (band_count == NULL || strlen(label) == 0 ||
+                strlen(label) > COOK_PROFILE_BAND_NAME_LEN ||
+                len + 4 + COOK_PROFILE_BAND_NAME_LEN > MAX_BLOB_BYTES - 4) {
+                fprintf(stderr, "%s:%d: band outside a profile or bad label\n", path, line_no);
+                fclose(file);
+                return 0;
+            }
+            put_i16(blob + len, lo);
+            put_i16(blob + len + 2, hi);
+            memset(blob + len + 4, 0, COOK_PROFILE_BAND_NAME_LEN);
+            memcpy(blob + len + 4, label, strlen(label));
+            len += 4 + COOK_PROFILE_BAND_NAME_LEN;
+            (*band_count)++;
+        } else {
+            fprintf(stderr, "%s:%d: cannot parse '%s'\n", path, line_no, line);
+            fclose(file);
+            return 0;
+        }
+    }
+    fclose(file);
+
+    blob[5] = (uint8_t)profiles;
+    put_u32(blob + len, crc32_update(0, blob, len));
+    return len + 4;
+}
+
+static void emit_c(const uint8_t *blob, size_t len, const char *spec)
+{
+    printf("/**\n"
+           " * @file cook_profile_data.c\n"
+           " * @brief Built-in cooking profiles (generated)\n"
+           " * @author Mechatronics Engineer\n"
+           " * @date October 2026\n"
+           " *\n"
+           " * Generated by host/profile_tool from %s.\n"
+           " * Edit the description and regenerate instead of changing the bytes.\n"
+           " */\n\n"
+           "#include \"cook_profile.h\"\n\n"
+           "const uint8_t cook_profile_default_blob[] = {", spec);
+    for (size_t i = 0; i < len; i++) {
+        printf("%s0x%02x,", i % 12 == 0 ? "\n    " : " ", blob[i]);
+    }
+    printf("\n};\n\nconst size_t cook_profile_default_blob_size = sizeof(cook_profile_default_blob);\n");
+}
+
+/**
+ * @brief Classification the way the original firmware did it: walk the bands
+ */
+static uint8_t classify_by_chain(const cook_profile_t *profile, int celsius)
+{
+    for (uint8_t band = 0; band < profile->band_count; band++) {
+        if (celsius >= profile->bands[band].min_c && celsius <= profile->bands[band].max_c) {
+            return band;
+        }
+    }
+    return COOK_PROFILE_NO_BAND;
+}
+
+static int inspect(const uint8_t *blob, size_t len)
+{
+    static cook_profile_set_t set;
+    esp_err_t ret = cook_profile_load(&set, blob, len);
+
+    if (ret != ESP_OK) {
+        printf("Blob rejected: error 0x%x\n", ret);
+        return 1;
+    }
+    printf("Blob: %zu bytes, %u profile(s); compiled set %zu bytes (%d entries per profile)\n",
+           len, set.count, sizeof(set), COOK_PROFILE_TEMP_SPAN);
+
+    int mismatches = 0;
+    for (uint8_t i = 0; i < set.count; i++) {
+        const cook_profile_t *profile = &set.profiles[i];
+        printf("\n%s (safe %d-%d C)\n", profile->name, profile->safe_min_c, profile->safe_max_c);
+        for (uint8_t band = 0; band < profile->band_count; band++) {
+            printf("  %3d-%-3d C  %s\n", profile->bands[band].min_c, profile->bands[band].max_c,
+                   profile->bands[band].name);
+        }
+        for (int c = COOK_PROFILE_TEMP_MIN - 10; c <= COOK_PROFILE_TEMP_MAX + 10; c++) {
+            if (cook_profile_classify(profile, c) != classify_by_chain(profile, c)) {
+                mismatches++;
+            }
+        }
+    }
+
+    // Time both classifiers over the same pseudo-random temperatures
+    const cook_profile_t *profile = &set.profiles[0];
+    uint32_t rng = 1;
+    unsigned sink = 0;
+    uint64_t start = host_now_ns();
+    for (long i = 0; i < BENCH_LOOKUPS; i++) {
+        rng = rng * 1664525u + 1013904223u;
+        sink += cook_profile_classify(profile, (int)(rng >> 26));
+    }
+    uint64_t table_ns = host_now_ns() - start;
+
+    rng = 1;
+    start = host_now_ns();
+    for (long i = 0; i < BENCH_LOOKUPS; i++) {
+        rng = rng * 1664525u + 1013904223u;
+        sink += classify_by_chain(profile, (int)(rng >> 26));
+    }
+    uint64_t chain_ns = host_now_ns() - start;
+
+    printf("\nClassify (%s, 0-63 C): table %.2f ns, band walk %.2f ns per lookup (checksum %u)\n",
+           profile->name, (double)table_ns / BENCH_LOOKUPS, (double)chain_ns / BENCH_LOOKUPS, sink);
+
+    if (mismatches > 0) {
+        printf("FAIL: %d temperature(s) classified differently by the table\n", mismatches);
+        return 1;
+    }
+    printf("Compiled tables match the band lists\n");
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *spec = NULL;
+    const char *out = NULL;
+    const char *blob_path = NULL;
+    int emit = 0;
+
+    static const struct option options[] = {
+        { "encode", required_argument, NULL, 'e' },
+        { "out",    required_argument, NULL, 'o' },
+        { "emit-c", no_argument,       NULL, 'c' },
+        { "blob",   required_argument, NULL, 'b' },
+        { "help",   no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'e': spec = optarg; break;
+            case 'o': out = optarg; break;
+            case 'c': emit = 1; break;
+            case 'b': blob_path = optarg; break;
+            default:
+                fprintf(stderr, "Usage: %s --encode=SPEC (--out=FILE | --emit-c)\n"
+                                "       %s [--blob=FILE]\n", argv[0], argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    static uint8_t blob[MAX_BLOB_BYTES];
+    size_t len;
+
+    if (spec != NULL) {
+        len = encode_spec(spec, blob);
+        if (len == 0) {
+            return 1;
+        }
+        if (emit) {
+            emit_c(blob, len, spec);
+            return 0;
+        }
+        if (out == NULL) {
+            return inspect(blob, len);
+        }
+        FILE *file = fopen(out, "wb");
+        if (file == NULL || fwrite(blob, 1, len, file) != len) {
+            fprintf(stderr, "Cannot write %s\n", out);
+            return 1;
+        }
+        fclose(file);
+        printf("Wrote %zu bytes to %s\n", len, out);
+        return 0;
+    }
+
+    if (blob_path != NULL) {
+        FILE *file = fopen(blob_path, "rb");
+        if (file == NULL) {
+            fprintf(stderr, "Cannot open %s\n", blob_path);
+            return 1;
+        }
+        len = fread(blob, 1, sizeof(blob), file);
+        fclose(file);
+        return inspect(blob, len);
+    }
+
+    return inspect(cook_profile_default_blob, cook_profile_default_blob_size);
+}
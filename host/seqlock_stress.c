@@ -0,0 +1,215 @@
+/**
+ * @file seqlock_stress.c
+ * @brief Hammer the firmware seqlock from several threads and look for torn reads
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * One writer thread publishes a snapshot as fast as it can; every word of
+ * snapshot n is derived from n, so a copy mixing two snapshots is detected.
+ * Reader threads take copies through seqlock_read() and check each one.
+ * The same run is then repeated with plain word copies (no sequence check)
+ * to show that the contention is real and tearing would be caught.
+ *
+ * Exits non-zero if a seqlock read returns a torn snapshot or the writer
+ * made no progress.
+ *
+ * Usage: seqlock_stress [--seconds=N] [--readers=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <getopt.h>
+#include "seqlock.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SNAPSHOT_WORDS          24      // About the size of a grill readings snapshot with more zones
+#define MAX_READERS             16
+
+/* ==================== DATA TYPES ==================== */
+
+typedef struct {
+    uint32_t words[SNAPSHOT_WORDS];
+} snapshot_t;
+
+typedef struct {
+    bool use_seqlock;
+    long reads;
+    long torn;
+    long gave_up;
+    long retries;
+    long max_attempts;
+} reader_stats_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static seqlock_t lock = SEQLOCK_INIT;
+static snapshot_t shared;
+static volatile int running;
+
+static uint32_t word_value(uint32_t n, int i)
+{
+    return n ^ ((uint32_t)i * 0x9E3779B9u);
+}
+
+static bool snapshot_consistent(const snapshot_t *snapshot)
+{
+    uint32_t n = snapshot->words[0];
+    for (int i = 0; i < SNAPSHOT_WORDS; i++) {
+        if (snapshot->words[i] != word_value(n, i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void *writer_thread(void *arg)
+{
+    uint32_t *published = arg;
+    snapshot_t next;
+    uint32_t n = 0;
+
+    while (__atomic_load_n(&running, __ATOMIC_RELAXED)) {
+        n++;
+        for (int i = 0; i < SNAPSHOT_WORDS; i++) {
+            next.words[i] = word_value(n, i);
+        }
+        seqlock_write(&lock, &shared, &next, sizeof(next));
+    }
+    *published = n;
+    return NULL;
+}
+
+static void *reader_thread(void *arg)
+{
+    reader_stats_t *stats = arg;
+    snapshot_t copy;
+
+    while (__atomic_load_n(&running, __ATOMIC_RELAXED)) {
+        if (stats->use_seqlock) {
+            uint32_t attempts = seqlock_read(&lock, &shared, &copy, sizeof(copy), SEQLOCK_READ_TRIES);
+            if (attempts == 0) {
+                stats->gave_up++;   // Caller would keep its previous copy
+                continue;
+            }
+            stats->retries += attempts - 1;
+            if ((long)attempts > stats->max_attempts) {
+                stats->max_attempts = attempts;
+            }
+        } else {
+            for (int i = 0; i < SNAPSHOT_WORDS; i++) {
+                copy.words[i] = __atomic_load_n(&shared.words[i], __ATOMIC_RELAXED);
+            }
+        }
+        stats->reads++;
+        if (!snapshot_consistent(&copy)) {
+            stats->torn++;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief One timed run; returns the summed reader statistics
+ */
+static reader_stats_t run(bool use_seqlock, int readers, double seconds, uint32_t *writes)
+{
+    pthread_t writer;
+    pthread_t reader_ids[MAX_READERS];
+    reader_stats_t stats[MAX_READERS] = { 0 };
+    reader_stats_t total = { .use_seqlock = use_seqlock };
+    snapshot_t first;
+
+    for (int i = 0; i < SNAPSHOT_WORDS; i++) {
+        first.words[i] = word_value(0, i);
+    }
+    seqlock_write(&lock, &shared, &first, sizeof(first));
+
+    __atomic_store_n(&running, 1, __ATOMIC_RELAXED);
+    pthread_create(&writer, NULL, writer_thread, writes);
+    for (int r = 0; r < readers; r++) {
+        stats[r].use_seqlock = use_seqlock;
+        pthread_create(&reader_ids[r], NULL, reader_thread, &stats[r]);
+    }
+
+    struct timespec pause = { (time_t)seconds, (long)((seconds - (time_t)seconds) * 1e9) };
+    nanosleep(&pause, NULL);
+    __atomic_store_n(&running, 0, __ATOMIC_RELAXED);
+
+    pthread_join(writer, NULL);
+    for (int r = 0; r < readers; r++) {
+        pthread_join(reader_ids[r], NULL);
+        total.reads += stats[r].reads;
+        total.torn += stats[r].torn;
+        total.gave_up += stats[r].gave_up;
+        total.retries += stats[r].retries;
+        if (stats[r].max_attempts > total.max_attempts) {
+            total.max_attempts = stats[r].max_attempts;
+        }
+    }
+    return total;
+}
+
+int main(int argc, char **argv)
+{
+    double seconds = 2.0;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int readers = cpus > 2 ? (int)(cpus - 1) : 2;
+
+    static const struct option options[] = {
+        { "seconds", required_argument, NULL, 's' },
+        { "readers", required_argument, NULL, 'r' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 's': seconds = atof(optarg); break;
+            case 'r': readers = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [--seconds=N] [--readers=N]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+    if (readers < 1 || readers > MAX_READERS || seconds <= 0.0) {
+        fprintf(stderr, "readers must be 1-%d and seconds positive\n", MAX_READERS);
+        return 2;
+    }
+
+    printf("%d reader(s) + 1 writer, %zu-byte snapshot, %.1f s per run\n\n",
+           readers, sizeof(snapshot_t), seconds);
+    printf("%-12s %12s %12s %10s %10s %9s %8s\n", "copy", "writes", "reads", "torn",
+           "retries", "gave up", "max try");
+
+    int failures = 0;
+    for (int mode = 0; mode < 2; mode++) {
+        bool use_seqlock = (mode == 0);
+        uint32_t writes = 0;
+        reader_stats_t total = run(use_seqlock, readers, seconds, &writes);
+
+        printf("%-12s %12u %12ld %10ld %10ld %9ld %8ld\n", use_seqlock ? "seqlock" : "plain",
+               writes, total.reads, total.torn, total.retries, total.gave_up, total.max_attempts);
+
+        if (use_seqlock && total.torn > 0) {
+            printf("  FAIL: seqlock returned torn snapshots\n");
+            failures++;
+        }
+        if (writes == 0 || total.reads == 0) {
+            printf("  FAIL: no progress\n");
+            failures++;
+        }
+    }
+
+    if (failures > 0) {
+        printf("\nFAIL: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("\nNo torn seqlock reads (plain copies show what the contention would tear)\n");
+    return 0;
+}
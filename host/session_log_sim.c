@@ -0,0 +1,269 @@
+/**
+ * @file session_log_sim.c
+ * @brief Exercise the flash session log against a file-backed partition
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Appends numbered records the way the firmware does (RAM append, batched
+ * flushes by a writer, a forced flush when idle), "reboots" by remounting the
+ * image, and checks that the iterator returns an unbroken run of the newest
+ * records. Then cuts power in the middle of a batch write, remounts, appends
+ * again and checks that only the torn record is lost. Reports flash writes,
+ * bytes per write, erases and the wear spread across sectors.
+ *
+ * Usage: session_log_sim [--image=PATH] [--records=N] [--size-kb=K] [--keep]
+ *        session_log_sim --dump [--image=PATH] [--size-kb=K]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "flash_file.h"
+#include "session_log.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define DEFAULT_IMAGE           "session_log.img"
+#define DEFAULT_RECORDS         20000
+#define DEFAULT_SIZE_KB         256     // Matches the sessionlog partition
+#define SECTOR_SIZE             4096
+#define IDLE_FLUSH_EVERY        50      // Records between forced flushes (writer idle timeout)
+#define POWER_CUT_RECORDS       200
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static uint32_t rng_state = 12345;
+
+static uint32_t next_random(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+/**
+ * @brief Append one numbered record with a variable-size payload
+ */
+static esp_err_t append_numbered(session_log_t *log, uint32_t number)
+{
+    uint8_t payload[SESSION_LOG_MAX_PAYLOAD];
+    uint16_t length = (uint16_t)(4 + next_random() % 37);
+
+    memcpy(payload, &number, sizeof(number));
+    for (uint16_t i = 4; i < length; i++) {
+        payload[i] = (uint8_t)(number + i);
+    }
+    return session_log_append(log, (uint8_t)(number % 4), number / 10, payload, length);
+}
+
+/**
+ * @brief Walk the log; check numbers are consecutive and end at last_number
+ *
+ * @return Number of records read, or -1 on a verification failure
+ */
+static long verify_log(const session_log_t *log, uint32_t last_number, uint32_t *corrupt)
+{
+    session_log_iter_t it;
+    session_log_record_t record;
+    uint8_t payload[SESSION_LOG_MAX_PAYLOAD];
+    uint32_t expected = 0;
+    long count = 0;
+
+    session_log_iter_begin(log, &it);
+    while (session_log_iter_next(log, &it, &record, payload) == ESP_OK) {
+        uint32_t number;
+        memcpy(&number, payload, sizeof(number));
+        if (count > 0 && number != expected) {
+            printf("  gap: expected record %u, got %u\n", expected, number);
+            return -1;
+        }
+        expected = number + 1;
+        count++;
+    }
+    *corrupt = it.corrupt;
+
+    if (count == 0 || expected != last_number + 1) {
+        printf("  log ends at record %u, expected %u\n", expected - 1, last_number);
+        return -1;
+    }
+    return count;
+}
+
+static void print_stats(const char *label, const session_log_t *log, const flash_file_t *flash)
+{
+    session_log_stats_t stats;
+    session_log_get_stats(log, &stats);
+
+    printf("%s: %u appended, %u dropped, %u flushed in %u writes (%.0f B/write), "
+           "%u erases, wear %u..%u, %u NOR violations\n",
+           label, stats.appended, stats.dropped, stats.flushed, stats.flash_writes,
+           flash->writes ? (double)flash->bytes_written / flash->writes : 0.0,
+           stats.sector_erases, stats.min_erase_count, stats.max_erase_count, flash->violations);
+}
+
+static int dump_log(const char *image, uint32_t size)
+{
+    flash_file_t flash;
+    session_log_flash_t region;
+    static session_log_t log;
+
+    if (flash_file_open(&flash, image, size, SECTOR_SIZE) != ESP_OK) {
+        fprintf(stderr, "Cannot open %s\n", image);
+        return 1;
+    }
+    flash_file_region(&flash, &region);
+    if (session_log_mount(&log, &region) != ESP_OK) {
+        fprintf(stderr, "Mount failed\n");
+        return 1;
+    }
+
+    session_log_iter_t it;
+    session_log_record_t record;
+    uint8_t payload[SESSION_LOG_MAX_PAYLOAD];
+    long count = 0;
+
+    session_log_iter_begin(&log, &it);
+    while (session_log_iter_next(&log, &it, &record, payload) == ESP_OK) {
+        printf("%8ld t=%-8u type=%-3u len=%-3u", count++, record.timestamp, record.type, record.length);
+        for (uint16_t i = 0; i < record.length && i < 16; i++) {
+            printf(" %02x", payload[i]);
+        }
+        printf("\n");
+    }
+    printf("%ld records, %u corrupt\n", count, it.corrupt);
+
+    flash_file_close(&flash);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *image = DEFAULT_IMAGE;
+    long records = DEFAULT_RECORDS;
+    uint32_t size = DEFAULT_SIZE_KB * 1024;
+    int keep = 0;
+    int dump = 0;
+
+    static const struct option options[] = {
+        { "image",   required_argument, NULL, 'i' },
+        { "records", required_argument, NULL, 'n' },
+        { "size-kb", required_argument, NULL, 's' },
+        { "keep",    no_argument,       NULL, 'k' },
+        { "dump",    no_argument,       NULL, 'd' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'i': image = optarg; break;
+            case 'n': records = strtol(optarg, NULL, 0); break;
+            case 's': size = (uint32_t)strtoul(optarg, NULL, 0) * 1024; break;
+            case 'k': keep = 1; break;
+            case 'd': dump = 1; break;
+            default:
+                fprintf(stderr, "Usage: %s [--image=PATH] [--records=N] [--size-kb=K] [--keep] [--dump]\n",
+                        argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    if (dump) {
+        return dump_log(image, size);
+    }
+    if (!keep) {
+        remove(image);
+    }
+
+    flash_file_t flash;
+    session_log_flash_t region;
+    static session_log_t log;
+    uint32_t corrupt;
+    int failures = 0;
+
+    if (flash_file_open(&flash, image, size, SECTOR_SIZE) != ESP_OK) {
+        fprintf(stderr, "Cannot open %s\n", image);
+        return 1;
+    }
+    flash_file_region(&flash, &region);
+    if (session_log_mount(&log, &region) != ESP_OK) {
+        fprintf(stderr, "Mount failed\n");
+        return 1;
+    }
+
+    // Phase 1: steady logging
+    uint32_t number = 0;
+    for (long i = 0; i < records; i++, number++) {
+        if (append_numbered(&log, number) != ESP_OK) {
+            printf("append %u failed\n", number);
+            failures++;
+        }
+        session_log_flush(&log, (i + 1) % IDLE_FLUSH_EVERY == 0);
+    }
+    session_log_flush(&log, true);
+    print_stats("Logging", &log, &flash);
+
+    // Phase 2: reboot and read back
+    session_log_mount(&log, &region);
+    long count = verify_log(&log, number - 1, &corrupt);
+    printf("After reboot: %ld records readable (newest %u), %u corrupt\n", count, number - 1, corrupt);
+    if (count < 0 || corrupt != 0) {
+        failures++;
+    }
+
+    // Phase 3: power cut in the middle of a batch write
+    flash.fail_after_bytes = (uint32_t)flash.bytes_written + SESSION_LOG_BATCH_BYTES / 2;
+    for (long i = 0; i < POWER_CUT_RECORDS; i++, number++) {
+        append_numbered(&log, number);
+        if (session_log_flush(&log, false) != ESP_OK) {
+            break;
+        }
+    }
+    flash.fail_after_bytes = 0;
+
+    session_log_mount(&log, &region);
+    session_log_iter_t it;
+    session_log_record_t record;
+    uint8_t payload[SESSION_LOG_MAX_PAYLOAD];
+    uint32_t last_valid = 0;
+    session_log_iter_begin(&log, &it);
+    while (session_log_iter_next(&log, &it, &record, payload) == ESP_OK) {
+        memcpy(&last_valid, payload, sizeof(last_valid));
+    }
+    printf("After power cut: last intact record %u, %u torn record(s) skipped\n",
+           last_valid, it.corrupt);
+
+    // Phase 4: resume logging after the torn write
+    number = last_valid + 1;
+    for (long i = 0; i < POWER_CUT_RECORDS; i++, number++) {
+        append_numbered(&log, number);
+        session_log_flush(&log, false);
+    }
+    session_log_flush(&log, true);
+    session_log_mount(&log, &region);
+    count = verify_log(&log, number - 1, &corrupt);
+    printf("After resume: %ld records readable (newest %u), %u corrupt\n", count, number - 1, corrupt);
+    if (count < 0 || corrupt > 1) {
+        failures++;
+    }
+
+    session_log_stats_t stats;
+    session_log_get_stats(&log, &stats);
+    printf("Flash totals: %u writes (%.0f B/write), %u erases, wear %u..%u, %u NOR violations\n",
+           flash.writes, flash.writes ? (double)flash.bytes_written / flash.writes : 0.0,
+           flash.erases, stats.min_erase_count, stats.max_erase_count, flash.violations);
+    if (flash.violations != 0) {
+        failures++;
+    }
+
+    flash_file_close(&flash);
+    if (failures > 0) {
+        printf("FAIL: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("All checks passed\n");
+    return 0;
+}
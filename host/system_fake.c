@@ -0,0 +1,186 @@
+/**
+ * @file system_fake.c
+ * @brief Logging, busy-wait, heap queries and the session-log partition
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "esp_partition.h"
+#include "ets_sys.h"
+#include "flash_file.h"
+#include "session_store.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define LOG_TAG_LEVELS              16      // Tags with their own level
+
+/* ==================== DATA TYPES ==================== */
+
+typedef struct {
+    const char *tag;            // Caller's string (TAG constants live forever)
+    esp_log_level_t level;
+} log_tag_level_t;
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_mutex_t log_lock = PTHREAD_MUTEX_INITIALIZER;
+static esp_log_level_t log_default_level = (esp_log_level_t)CONFIG_LOG_DEFAULT_LEVEL;
+static log_tag_level_t log_tag_levels[LOG_TAG_LEVELS];
+static size_t log_tag_count = 0;
+
+static flash_file_t flash;
+static session_log_flash_t flash_region;
+static esp_partition_t session_partition = {
+    .type = ESP_PARTITION_TYPE_DATA,
+    .subtype = SESSION_STORE_PARTITION_SUBTYPE,
+    .address = 0x110000,
+    .size = IDF_FAKE_FLASH_SIZE,
+    .erase_size = IDF_FAKE_FLASH_SECTOR,
+    .label = SESSION_STORE_PARTITION_LABEL,
+};
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/* ---------- Logging ---------- */
+
+static log_tag_level_t *find_tag(const char *tag)
+{
+    for (size_t i = 0; i < log_tag_count; i++) {
+        if (strcmp(log_tag_levels[i].tag, tag) == 0) {
+            return &log_tag_levels[i];
+        }
+    }
+    return NULL;
+}
+
+void esp_log_level_set(const char *tag, esp_log_level_t level)
+{
+    pthread_mutex_lock(&log_lock);
+    if (strcmp(tag, "*") == 0) {
+        log_default_level = level;
+        log_tag_count = 0;
+    } else {
+        log_tag_level_t *entry = find_tag(tag);
+        if (entry == NULL && log_tag_count < LOG_TAG_LEVELS) {
+            entry = &log_tag_levels[log_tag_count++];
+            entry->tag = tag;
+        }
+        if (entry != NULL) {
+            entry->level = level;
+        }
+    }
+    pthread_mutex_unlock(&log_lock);
+}
+
+esp_log_level_t esp_log_level_get(const char *tag)
+{
+    pthread_mutex_lock(&log_lock);
+    log_tag_level_t *entry = find_tag(tag);
+    esp_log_level_t level = entry != NULL ? entry->level : log_default_level;
+    pthread_mutex_unlock(&log_lock);
+    return level;
+}
+
+uint32_t esp_log_timestamp(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+void esp_log_write(esp_log_level_t level, const char *tag, const char *format, ...)
+{
+    if (level > esp_log_level_get(tag)) {
+        return;
+    }
+
+    va_list args;
+    va_start(args, format);
+    pthread_mutex_lock(&log_lock);      // Whole lines, as the target's log lock does
+    vprintf(format, args);
+    fflush(stdout);
+    pthread_mutex_unlock(&log_lock);
+    va_end(args);
+}
+
+/* ---------- ROM delay ---------- */
+
+void ets_delay_us(uint32_t us)
+{
+    int64_t until = esp_timer_get_time() + us;
+    while (esp_timer_get_time() < until) {
+    }
+}
+
+/* ---------- Heap ---------- */
+
+size_t heap_caps_get_free_size(uint32_t caps)
+{
+    return 0;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps)
+{
+    return 0;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps)
+{
+    return 0;
+}
+
+size_t heap_caps_get_total_size(uint32_t caps)
+{
+    return 0;
+}
+
+/* ---------- Partition ---------- */
+
+esp_err_t idf_fake_flash_open(const char *path)
+{
+    esp_err_t ret = flash_file_open(&flash, path, IDF_FAKE_FLASH_SIZE, IDF_FAKE_FLASH_SECTOR);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    flash_file_region(&flash, &flash_region);
+    session_partition.flash_chip = &flash_region;
+    return ESP_OK;
+}
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type,
+                                                esp_partition_subtype_t subtype, const char *label)
+{
+    if (session_partition.flash_chip == NULL || type != session_partition.type ||
+        (subtype != ESP_PARTITION_SUBTYPE_ANY && subtype != session_partition.subtype) ||
+        (label != NULL && strcmp(label, session_partition.label) != 0)) {
+        return NULL;
+    }
+    return &session_partition;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst,
+                             size_t size)
+{
+    const session_log_flash_t *region = partition->flash_chip;
+    return region->read(region->ctx, (uint32_t)src_offset, dst, size);
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *partition, size_t dst_offset, const void *src,
+                              size_t size)
+{
+    const session_log_flash_t *region = partition->flash_chip;
+    return region->write(region->ctx, (uint32_t)dst_offset, src, size);
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *partition, size_t offset, size_t size)
+{
+    const session_log_flash_t *region = partition->flash_chip;
+    return region->erase(region->ctx, (uint32_t)offset, size);
+}
@@ -0,0 +1,360 @@
+/**
+ * @file telemetry_check.c
+ * @brief Check the telemetry codec: round trips, COBS blocks and stream recovery
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Runs the firmware's telemetry_codec.c on synthetic streams and checks four
+ * things:
+ *
+ * - round trip: random records (payloads full of zeros, every type, random
+ *   deltas) through telemetry_encode_frame() and telemetry_decode_frame()
+ *   come back unchanged, with the only zero byte of a frame at its end;
+ *   varints round-trip at their extremes
+ * - COBS blocks: every length around the 254-byte block boundary (all zero,
+ *   no zero, a zero at each edge of a block) decodes to the input and stays
+ *   within the len + len / 254 + 1 bound
+ * - corruption: one flipped byte costs exactly that record (one bad frame,
+ *   one seq gap); records up to the next SYNC are undated, and the times
+ *   after it match the sender's again
+ * - a dropped frame: one seq gap, no bad frame, undated until the next SYNC
+ *
+ * Exits non-zero if any check fails.
+ *
+ * Usage: telemetry_check [--records=N] [--seed=N]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <getopt.h>
+#include "adc_synth.h"
+#include "telemetry_codec.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define STREAM_RECORDS          200     // Records per recovery stream
+#define STREAM_SYNC_EVERY       20      // Records between SYNCs, as TELEMETRY_SYNC_MS would give
+#define STREAM_DAMAGED          50      // Record damaged or dropped (not a SYNC)
+#define COBS_MAX_LEN            (3 * 254 + 2)
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief A sender's stream: frames back to back, with what the reader should see
+ */
+typedef struct {
+    uint8_t bytes[STREAM_RECORDS * TELEMETRY_MAX_FRAME];
+    size_t length;
+    size_t frame_start[STREAM_RECORDS];
+    size_t frame_len[STREAM_RECORDS];
+    uint64_t time_us[STREAM_RECORDS];
+    bool sync[STREAM_RECORDS];
+} test_stream_t;
+
+/**
+ * @brief What a reader made of a stream
+ */
+typedef struct {
+    telemetry_stream_t state;
+    uint32_t wrong_times;       // Dated records whose time differs from the sender's
+    uint32_t dated_after_damage;    // Records dated between the damage and the next SYNC
+} read_result_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static uint32_t random_u32(adc_synth_t *rng)
+{
+    return (uint32_t)(adc_synth_uniform(rng) * 4294967296.0);
+}
+
+/**
+ * @brief Random payload, about a third of its bytes zero
+ */
+static size_t random_payload(adc_synth_t *rng, uint8_t *payload)
+{
+    size_t len = random_u32(rng) % (TELEMETRY_MAX_PAYLOAD + 1);
+
+    for (size_t i = 0; i < len; i++) {
+        payload[i] = adc_synth_uniform(rng) < 0.33 ? 0 : (uint8_t)random_u32(rng);
+    }
+    return len;
+}
+
+static int check_varints(adc_synth_t *rng)
+{
+    static const uint64_t fixed_u[] = { 0, 1, 127, 128, 16383, 16384, UINT32_MAX, UINT64_MAX };
+    static const int64_t fixed_s[] = { 0, -1, 1, -64, 64, INT32_MIN, INT32_MAX, INT64_MIN, INT64_MAX };
+    uint8_t buffer[TELEMETRY_MAX_VARINT];
+    int failures = 0;
+
+    for (size_t i = 0; i < sizeof(fixed_u) / sizeof(fixed_u[0]) + 10000; i++) {
+        uint64_t value = i < sizeof(fixed_u) / sizeof(fixed_u[0]) ? fixed_u[i] :
+                         (uint64_t)random_u32(rng) << (random_u32(rng) % 33) | random_u32(rng);
+        uint64_t back = 0;
+        size_t put = telemetry_put_uvarint(buffer, value);
+        if (telemetry_get_uvarint(buffer, put, &back) != put || back != value) {
+            failures++;
+        }
+    }
+    for (size_t i = 0; i < sizeof(fixed_s) / sizeof(fixed_s[0]) + 10000; i++) {
+        int64_t value = i < sizeof(fixed_s) / sizeof(fixed_s[0]) ? fixed_s[i] :
+                        (int64_t)((uint64_t)random_u32(rng) << 32 | random_u32(rng)) >> (random_u32(rng) % 64);
+        int64_t back = 0;
+        size_t put = telemetry_put_svarint(buffer, value);
+        if (telemetry_get_svarint(buffer, put, &back) != put || back != value) {
+            failures++;
+        }
+    }
+    return failures;
+}
+
+static int check_round_trip(adc_synth_t *rng, long records)
+{
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    uint8_t frame[TELEMETRY_MAX_FRAME];
+    int failures = 0;
+
+    for (long i = 0; i < records; i++) {
+        uint8_t type = (uint8_t)(random_u32(rng) % TELEMETRY_TYPE_COUNT);
+        uint8_t seq = (uint8_t)i;
+        uint32_t delta_us = random_u32(rng) >> (random_u32(rng) % 32);
+        size_t length = random_payload(rng, payload);
+
+        size_t len = telemetry_encode_frame(type, seq, delta_us, payload, length, frame);
+        if (len == 0 || len > TELEMETRY_MAX_FRAME || frame[len - 1] != 0 ||
+            memchr(frame, 0, len - 1) != NULL) {
+            failures++;
+            continue;
+        }
+        telemetry_record_t record;
+        if (telemetry_decode_frame(frame, len - 1, &record) != ESP_OK ||
+            record.version != TELEMETRY_VERSION || record.type != type || record.seq != seq ||
+            record.delta_us != delta_us || record.length != length ||
+            memcmp(record.payload, payload, length) != 0) {
+            failures++;
+        }
+    }
+    return failures;
+}
+
+static int check_cobs_blocks(void)
+{
+    static uint8_t src[COBS_MAX_LEN];
+    static uint8_t encoded[COBS_MAX_LEN + COBS_MAX_LEN / 254 + 1];
+    static uint8_t decoded[COBS_MAX_LEN + 1];
+    int failures = 0;
+
+    for (size_t len = 1; len <= COBS_MAX_LEN; len++) {
+        for (int pattern = 0; pattern < 4; pattern++) {
+            for (size_t i = 0; i < len; i++) {
+                switch (pattern) {
+                    case 0: src[i] = 0; break;
+                    case 1: src[i] = (uint8_t)(i % 255 + 1); break;
+                    case 2: src[i] = i % 254 == 253 ? 0 : 0x5A; break;  // Zero ending each full block
+                    default: src[i] = i % 254 == 0 ? 0 : 0xA5; break;   // Zero starting each block
+                }
+            }
+            size_t enc_len = telemetry_cobs_encode(src, len, encoded);
+            size_t dec_len = telemetry_cobs_decode(encoded, enc_len, decoded);
+            if (enc_len > len + len / 254 + 1 || memchr(encoded, 0, enc_len) != NULL ||
+                dec_len != len || memcmp(decoded, src, len) != 0) {
+                printf("  COBS length %zu pattern %d: encoded %zu, decoded %zu\n",
+                       len, pattern, enc_len, dec_len);
+                failures++;
+            }
+        }
+    }
+    return failures;
+}
+
+/**
+ * @brief Build a stream as the sender would: a SYNC first and every STREAM_SYNC_EVERY
+ */
+static void build_stream(adc_synth_t *rng, test_stream_t *stream)
+{
+    uint8_t payload[TELEMETRY_MAX_PAYLOAD];
+    uint64_t now_us = 5000000;
+
+    stream->length = 0;
+    for (int i = 0; i < STREAM_RECORDS; i++) {
+        uint32_t delta_us = i == 0 ? 0 : 100 + random_u32(rng) % 200000;
+        now_us += delta_us;
+        bool sync = i % STREAM_SYNC_EVERY == 0;
+        size_t length;
+        uint8_t type;
+        if (sync) {
+            type = TELEMETRY_SYNC;
+            length = telemetry_put_uvarint(payload, now_us);
+            for (int prio = 0; prio < TELEMETRY_SYNC_PRIORITIES; prio++) {
+                length += telemetry_put_uvarint(&payload[length], 0);
+            }
+        } else {
+            type = (uint8_t)(1 + random_u32(rng) % (TELEMETRY_TYPE_COUNT - 1));
+            length = random_payload(rng, payload);
+        }
+        stream->frame_start[i] = stream->length;
+        stream->frame_len[i] = telemetry_encode_frame(type, (uint8_t)i, delta_us, payload, length,
+                                                      &stream->bytes[stream->length]);
+        stream->length += stream->frame_len[i];
+        stream->time_us[i] = now_us;
+        stream->sync[i] = sync;
+    }
+}
+
+/**
+ * @brief Split on zero bytes and feed every frame, as telemetry_decode does
+ *
+ * @param damaged Record whose frame was damaged or dropped
+ */
+static void read_stream(const uint8_t *bytes, size_t length, const test_stream_t *sent,
+                        int damaged, read_result_t *result)
+{
+    uint8_t frame[TELEMETRY_MAX_FRAME + 1];
+    size_t frame_len = 0;
+
+    memset(result, 0, sizeof(*result));
+    telemetry_stream_init(&result->state);
+    for (size_t i = 0; i < length; i++) {
+        if (bytes[i] != 0) {
+            if (frame_len < sizeof(frame)) {
+                frame[frame_len++] = bytes[i];
+            }
+            continue;
+        }
+        telemetry_record_t record;
+        int64_t time_us;
+        if (frame_len > 0 &&
+            telemetry_stream_feed(&result->state, frame, frame_len, &record, &time_us) == ESP_OK &&
+            time_us >= 0) {
+            // Records keep their sender index in seq: fewer than 256 per stream
+            if ((uint64_t)time_us != sent->time_us[record.seq]) {
+                result->wrong_times++;
+            }
+            int next_sync = (damaged / STREAM_SYNC_EVERY + 1) * STREAM_SYNC_EVERY;
+            if (record.seq > damaged && record.seq < next_sync) {
+                result->dated_after_damage++;
+            }
+        }
+        frame_len = 0;
+    }
+}
+
+static int check_recovery(adc_synth_t *rng, test_stream_t *stream)
+{
+    static uint8_t damaged[sizeof(stream->bytes)];
+    const int undated = STREAM_SYNC_EVERY - STREAM_DAMAGED % STREAM_SYNC_EVERY - 1;
+    read_result_t result;
+    int failures = 0;
+
+    build_stream(rng, stream);
+
+    read_stream(stream->bytes, stream->length, stream, STREAM_RECORDS, &result);
+    printf("  clean:     %" PRIu32 " records, %" PRIu32 " bad, %" PRIu32 " gaps, %" PRIu32
+           " undated, %" PRIu32 " wrong times\n", result.state.records, result.state.bad_frames,
+           result.state.seq_gaps, result.state.unsynced, result.wrong_times);
+    if (result.state.records != STREAM_RECORDS || result.state.bad_frames != 0 ||
+        result.state.seq_gaps != 0 || result.state.unsynced != 0 || result.wrong_times != 0) {
+        printf("  FAIL: clean stream not read back exactly\n");
+        failures++;
+    }
+
+    // One byte of record STREAM_DAMAGED flipped (never to zero, which would split the frame)
+    memcpy(damaged, stream->bytes, stream->length);
+    size_t at = stream->frame_start[STREAM_DAMAGED] +
+                random_u32(rng) % (stream->frame_len[STREAM_DAMAGED] - 1);
+    uint8_t flip = (uint8_t)(1 + random_u32(rng) % 255);
+    if ((damaged[at] ^ flip) == 0) {
+        flip ^= 0x01;
+    }
+    damaged[at] ^= flip;
+    read_stream(damaged, stream->length, stream, STREAM_DAMAGED, &result);
+    printf("  corrupted: %" PRIu32 " records, %" PRIu32 " bad, %" PRIu32 " gaps, %" PRIu32
+           " undated, %" PRIu32 " wrong times\n", result.state.records, result.state.bad_frames,
+           result.state.seq_gaps, result.state.unsynced, result.wrong_times);
+    if (result.state.records != STREAM_RECORDS - 1 || result.state.bad_frames != 1 ||
+        result.state.seq_gaps != 1 || result.state.unsynced != (uint32_t)undated ||
+        result.dated_after_damage != 0 || result.wrong_times != 0) {
+        printf("  FAIL: a corrupted byte was not contained to its record\n");
+        failures++;
+    }
+
+    // Record STREAM_DAMAGED lost whole, delimiter included
+    size_t cut = stream->frame_start[STREAM_DAMAGED];
+    size_t cut_len = stream->frame_len[STREAM_DAMAGED];
+    memcpy(damaged, stream->bytes, cut);
+    memcpy(&damaged[cut], &stream->bytes[cut + cut_len], stream->length - cut - cut_len);
+    read_stream(damaged, stream->length - cut_len, stream, STREAM_DAMAGED, &result);
+    printf("  dropped:   %" PRIu32 " records, %" PRIu32 " bad, %" PRIu32 " gaps, %" PRIu32
+           " undated, %" PRIu32 " wrong times\n", result.state.records, result.state.bad_frames,
+           result.state.seq_gaps, result.state.unsynced, result.wrong_times);
+    if (result.state.records != STREAM_RECORDS - 1 || result.state.bad_frames != 0 ||
+        result.state.seq_gaps != 1 || result.state.unsynced != (uint32_t)undated ||
+        result.dated_after_damage != 0 || result.wrong_times != 0) {
+        printf("  FAIL: a dropped frame was not reported as one gap\n");
+        failures++;
+    }
+    return failures;
+}
+
+int main(int argc, char **argv)
+{
+    long records = 100000;
+    uint64_t seed = 1;
+
+    static const struct option options[] = {
+        { "records", required_argument, NULL, 'n' },
+        { "seed",    required_argument, NULL, 's' },
+        { "help",    no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'n': records = atol(optarg); break;
+            case 's': seed = strtoull(optarg, NULL, 0); break;
+            default:
+                fprintf(stderr, "Usage: %s [--records=N] [--seed=N]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    adc_synth_t rng;
+    adc_synth_init(&rng, 1.0, 0.0, 0.0, seed);
+    int failures = 0;
+
+    int errors = check_varints(&rng);
+    printf("Varints: %d mismatches\n", errors);
+    if (errors > 0) {
+        printf("  FAIL: varints do not round-trip\n");
+        failures++;
+    }
+
+    errors = check_round_trip(&rng, records);
+    printf("\nRound trip: %ld random records, %d mismatches\n", records, errors);
+    if (errors > 0) {
+        printf("  FAIL: records do not round-trip\n");
+        failures++;
+    }
+
+    errors = check_cobs_blocks();
+    printf("\nCOBS: lengths 1-%d in 4 patterns, %d mismatches\n", COBS_MAX_LEN, errors);
+    if (errors > 0) {
+        printf("  FAIL: COBS blocks do not round-trip\n");
+        failures++;
+    }
+
+    static test_stream_t stream;
+    printf("\nRecovery: %d records, SYNC every %d, record %d damaged\n", STREAM_RECORDS,
+           STREAM_SYNC_EVERY, STREAM_DAMAGED);
+    failures += check_recovery(&rng, &stream);
+
+    if (failures > 0) {
+        printf("\nFAIL: %d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("\nTelemetry codec round-trips and recovers from damaged frames\n");
+    return 0;
+}
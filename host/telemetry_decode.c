@@ -0,0 +1,345 @@
+/**
+ * @file telemetry_decode.c
+ * @brief Print the firmware's binary telemetry stream, one line per record
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Reads COBS frames from a serial device, a pty (grill_app --pty) or a
+ * capture file, decodes them with the firmware's own codec
+ * (main/telemetry_codec.c) and prints each record with its time since boot.
+ * A tty is switched to raw mode first; the baud rate is left as set (a pty
+ * has none). Bad frames, lost records and the sender's drop counters from
+ * its SYNC records are summed up at the end:
+ *
+ *   grill_app --pty=/tmp/grill-telemetry &
+ *   telemetry_decode --seconds=10 /tmp/grill-telemetry
+ *
+ * Exits 1 if a frame was bad or records were lost on the wire, so a link
+ * can be checked from a script. A reader that joins mid-frame skips the
+ * bytes up to the first delimiter that do not decode; that is not an error.
+ * Records dropped by the sender are reported but are not an error either.
+ *
+ * Usage: telemetry_decode [--seconds=N] [--quiet] PATH|-
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <getopt.h>
+#include "telemetry_codec.h"
+#include "temp_alarm.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define READ_CHUNK              512
+
+/* ==================== DATA TYPES ==================== */
+
+typedef struct {
+    telemetry_stream_t stream;
+    uint8_t frame[TELEMETRY_MAX_FRAME + 1];    // One byte over: an overlong frame stays invalid
+    size_t frame_len;
+    uint64_t bytes;
+    uint32_t by_type[TELEMETRY_TYPE_COUNT];
+    uint64_t sender_dropped[TELEMETRY_SYNC_PRIORITIES];  // From the last SYNC
+    bool started;               // A delimiter was seen: frames are whole from here
+    bool quiet;
+} decoder_t;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static void print_centi(int64_t centi)
+{
+    if (centi == TELEMETRY_NO_VALUE) {
+        printf(" -");
+    } else {
+        printf(" %.2f", centi / 100.0);
+    }
+}
+
+/**
+ * @brief Band index within the active profile, "-" for none
+ */
+static void print_band(uint8_t band)
+{
+    if (band == COOK_PROFILE_NO_BAND) {
+        printf(" -");
+    } else {
+        printf(" %u", band);
+    }
+}
+
+/**
+ * @brief Payload fields of one record
+ */
+static void print_payload(decoder_t *dec, const telemetry_record_t *record)
+{
+    const uint8_t *p = record->payload;
+    size_t left = record->length;
+    uint64_t u;
+    int64_t v;
+    size_t used;
+
+#define NEXT_U(dst) do { if ((used = telemetry_get_uvarint(p, left, &(dst))) == 0) goto truncated; \
+                         p += used; left -= used; } while (0)
+#define NEXT_S(dst) do { if ((used = telemetry_get_svarint(p, left, &(dst))) == 0) goto truncated; \
+                         p += used; left -= used; } while (0)
+    switch (record->type) {
+        case TELEMETRY_SYNC:
+            NEXT_U(u);
+            for (int prio = 0; prio < TELEMETRY_SYNC_PRIORITIES; prio++) {
+                NEXT_U(dec->sender_dropped[prio]);
+            }
+            if (!dec->quiet) {
+                printf(" dropped low %" PRIu64 " normal %" PRIu64 " critical %" PRIu64,
+                       dec->sender_dropped[0], dec->sender_dropped[1], dec->sender_dropped[2]);
+            }
+            break;
+
+        case TELEMETRY_KEY:
+            if (left < 3) {
+                goto truncated;
+            }
+            printf(" '%c' %s [%d,%d]", p[0], p[1] ? "pressed" : "released", p[2] >> 4, p[2] & 0x0F);
+            break;
+
+        case TELEMETRY_ZONES: {
+            if (left < 1) {
+                goto truncated;
+            }
+            int zones = *p++;
+            left--;
+            for (int zone = 0; zone < zones; zone++) {
+                NEXT_S(v);
+                print_centi(v);
+            }
+            NEXT_S(v);
+            printf(" setpoint");
+            print_centi(v);
+            NEXT_S(v);
+            printf(" duty %.1f%%", v / 100.0);
+            break;
+        }
+
+        case TELEMETRY_ALARM: {
+            if (left < 3) {
+                goto truncated;
+            }
+            uint8_t type = p[0];
+            uint8_t id = p[1];
+            uint8_t previous = p[2];
+            p += 3;
+            left -= 3;
+            if (type == TEMP_ALARM_EVENT_BAND) {
+                printf(" band");
+                print_band(previous);
+                printf(" ->");
+                print_band(id);
+                printf(" at");
+            } else {
+                printf(" %s %s at", temp_alarm_name((temp_alarm_id_t)id),
+                       type == TEMP_ALARM_EVENT_RAISED ? "raised" : "cleared");
+            }
+            NEXT_S(v);
+            print_centi(v);
+            NEXT_S(v);
+            if (v != TELEMETRY_NO_VALUE) {
+                printf(" rate %+.2f/min", v / 100.0);
+            }
+            break;
+        }
+
+        case TELEMETRY_COUNTERS: {
+            if (left < 1) {
+                goto truncated;
+            }
+            int count = *p++;
+            left--;
+            for (int i = 0; i < count; i++) {
+                if (left < 1) {
+                    goto truncated;
+                }
+                uint8_t id = *p++;
+                left--;
+                NEXT_U(u);
+                printf(" %s=%" PRIu64, telemetry_counter_name(id), u);
+            }
+            break;
+        }
+
+        default:
+            printf(" (%zu bytes)", record->length);
+            break;
+    }
+#undef NEXT_U
+#undef NEXT_S
+    return;
+
+truncated:
+    printf(" (truncated payload)");
+}
+
+/**
+ * @brief One frame between delimiters
+ */
+static void decode_frame(decoder_t *dec)
+{
+    telemetry_record_t record;
+    int64_t time_us;
+
+    // Bytes before the first delimiter may be the tail of a frame sent before we joined
+    if (!dec->started) {
+        uint8_t copy[sizeof(dec->frame)];
+        memcpy(copy, dec->frame, dec->frame_len);
+        if (telemetry_decode_frame(copy, dec->frame_len, &record) != ESP_OK) {
+            if (!dec->quiet) {
+                printf("%12s  joined mid-frame: %zu bytes skipped\n", "-", dec->frame_len);
+            }
+            return;
+        }
+    }
+
+    esp_err_t ret = telemetry_stream_feed(&dec->stream, dec->frame, dec->frame_len, &record, &time_us);
+    if (ret != ESP_OK) {
+        if (!dec->quiet) {
+            printf("%12s  bad frame (%zu bytes): %s\n", "-", dec->frame_len, esp_err_to_name(ret));
+        }
+        return;
+    }
+    if (record.type < TELEMETRY_TYPE_COUNT) {
+        dec->by_type[record.type]++;
+    }
+
+    if (dec->quiet) {
+        // SYNC payloads still carry the sender's drop counters
+        if (record.type == TELEMETRY_SYNC) {
+            print_payload(dec, &record);
+        }
+        return;
+    }
+    if (time_us < 0) {
+        printf("%12s", "-");
+    } else {
+        printf("%12.6f", time_us / 1e6);
+    }
+    printf("  %3u %-8s", record.seq, telemetry_type_name(record.type));
+    print_payload(dec, &record);
+    printf("\n");
+}
+
+static void feed_bytes(decoder_t *dec, const uint8_t *data, size_t len)
+{
+    dec->bytes += len;
+    for (size_t i = 0; i < len; i++) {
+        if (data[i] != 0) {
+            if (dec->frame_len < sizeof(dec->frame)) {
+                dec->frame[dec->frame_len++] = data[i];
+            }
+            continue;
+        }
+        if (dec->frame_len > 0) {
+            decode_frame(dec);
+        }
+        dec->frame_len = 0;
+        dec->started = true;
+    }
+    fflush(stdout);
+}
+
+static int64_t now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+int main(int argc, char **argv)
+{
+    int seconds = 0;            // 0: until end of file
+    decoder_t dec = { 0 };
+
+    static const struct option options[] = {
+        { "seconds", required_argument, NULL, 's' },
+        { "quiet",   no_argument,       NULL, 'q' },
+        { NULL, 0, NULL, 0 },
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+        case 's':
+            seconds = atoi(optarg);
+            break;
+        case 'q':
+            dec.quiet = true;
+            break;
+        default:
+            fprintf(stderr, "usage: %s [--seconds=N] [--quiet] PATH|-\n", argv[0]);
+            return 2;
+        }
+    }
+    if (optind != argc - 1) {
+        fprintf(stderr, "usage: %s [--seconds=N] [--quiet] PATH|-\n", argv[0]);
+        return 2;
+    }
+
+    const char *path = argv[optind];
+    int fd = strcmp(path, "-") == 0 ? STDIN_FILENO : open(path, O_RDONLY | O_NOCTTY);
+    if (fd < 0) {
+        fprintf(stderr, "cannot open %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    struct termios tio;
+    if (isatty(fd) && tcgetattr(fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    telemetry_stream_init(&dec.stream);
+
+    int64_t deadline_ms = seconds > 0 ? now_ms() + (int64_t)seconds * 1000 : 0;
+    uint8_t chunk[READ_CHUNK];
+    while (1) {
+        int timeout_ms = -1;
+        if (deadline_ms != 0) {
+            int64_t left_ms = deadline_ms - now_ms();
+            if (left_ms <= 0) {
+                break;
+            }
+            timeout_ms = (int)left_ms;
+        }
+        struct pollfd pfd = { .fd = fd, .events = POLLIN };
+        int ready = poll(&pfd, 1, timeout_ms);
+        if (ready < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ready <= 0) {
+            break;
+        }
+        ssize_t got = read(fd, chunk, sizeof(chunk));
+        if (got < 0 && (errno == EINTR || errno == EAGAIN)) {
+            continue;
+        }
+        if (got <= 0) {
+            break;              // End of file, or the pty closed (EIO)
+        }
+        feed_bytes(&dec, chunk, (size_t)got);
+    }
+
+    const telemetry_stream_t *s = &dec.stream;
+    printf("%" PRIu64 " bytes, %" PRIu32 " records (%.1f bytes each):", dec.bytes, s->records,
+           s->records > 0 ? (double)dec.bytes / s->records : 0.0);
+    for (int type = 0; type < TELEMETRY_TYPE_COUNT; type++) {
+        printf(" %s %" PRIu32, telemetry_type_name((uint8_t)type), dec.by_type[type]);
+    }
+    printf("\nbad frames %" PRIu32 ", unknown version %" PRIu32 ", lost on the wire %" PRIu32
+           ", undated %" PRIu32 "\n", s->bad_frames, s->unknown_version, s->seq_gaps, s->unsynced);
+    printf("dropped by the sender (last SYNC): low %" PRIu64 " normal %" PRIu64 " critical %" PRIu64 "\n",
+           dec.sender_dropped[0], dec.sender_dropped[1], dec.sender_dropped[2]);
+    return s->bad_frames > 0 || s->seq_gaps > 0 ? 1 : 0;
+}
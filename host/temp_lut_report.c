@@ -0,0 +1,143 @@
+/**
+ * @file temp_lut_report.c
+ * @brief Accuracy and cost of the fixed-point temperature lookup table
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Builds the firmware temp_lut from a model of the ESP32-S3 curve-fitting
+ * calibration (or the uncalibrated linear fallback), then for every
+ * oversampling setting compares the fixed-point path with the float path the
+ * firmware used before (calibrate two codes, interpolate, apply the sensor
+ * equation in float) and times both.
+ *
+ * Usage: temp_lut_report [--linear] [--bits=K]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <getopt.h>
+#include "temp_lut.h"
+#include "adc_decimator.h"
+#include "cycle_counter.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TEMP_LUT_MAX_ERROR_C       0.0101f  // Two half-centi-degree roundings
+
+/* ==================== CALIBRATION MODEL ==================== */
+
+// Second-order fit of a typical ESP32-S3 ADC1 curve at 12 dB attenuation
+#define CALI_MODEL_OFFSET_MV       0.0
+#define CALI_MODEL_GAIN_MV         0.760
+#define CALI_MODEL_CURVE_MV        1.0e-5
+
+static esp_err_t cali_model_voltage(void *ctx, int raw, int *voltage_mv)
+{
+    (void)ctx;
+    double mv = CALI_MODEL_OFFSET_MV + CALI_MODEL_GAIN_MV * raw +
+                CALI_MODEL_CURVE_MV * (double)raw * raw;
+    *voltage_mv = (int)lround(mv);
+    return ESP_OK;
+}
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief The pre-LUT conversion: two calibration calls and float math
+ */
+static float float_path_celsius(temp_lut_voltage_fn_t to_mv, uint32_t code, uint8_t extra_bits)
+{
+    int raw = (int)(code >> extra_bits);
+    float fraction = (float)(code & ((1U << extra_bits) - 1)) / (float)(1U << extra_bits);
+    int mv_low;
+    int mv_high;
+
+    to_mv(NULL, raw, &mv_low);
+    to_mv(NULL, raw < (int)TEMP_LUT_SIZE - 1 ? raw + 1 : raw, &mv_high);
+    return temp_lut_reference_celsius(mv_low + (mv_high - mv_low) * fraction);
+}
+
+int main(int argc, char **argv)
+{
+    temp_lut_voltage_fn_t to_mv = cali_model_voltage;
+    int only_bits = -1;
+
+    static const struct option options[] = {
+        { "linear", no_argument,       NULL, 'l' },
+        { "bits",   required_argument, NULL, 'b' },
+        { "help",   no_argument,       NULL, 'h' },
+        { NULL, 0, NULL, 0 }
+    };
+
+    int opt;
+    while ((opt = getopt_long(argc, argv, "", options, NULL)) != -1) {
+        switch (opt) {
+            case 'l': to_mv = temp_lut_linear_voltage; break;
+            case 'b': only_bits = atoi(optarg); break;
+            default:
+                fprintf(stderr, "Usage: %s [--linear] [--bits=K]\n", argv[0]);
+                return opt == 'h' ? 0 : 2;
+        }
+    }
+
+    static temp_lut_t lut;
+    uint64_t start = host_now_ns();
+    if (temp_lut_build(&lut, to_mv, NULL) != ESP_OK) {
+        fprintf(stderr, "LUT build failed\n");
+        return 1;
+    }
+    uint64_t build_ns = host_now_ns() - start;
+
+    printf("Calibration: %s, table %u entries (%zu bytes), built in %.1f us\n",
+           to_mv == temp_lut_linear_voltage ? "linear (uncalibrated)" : "curve-fitting model",
+           TEMP_LUT_SIZE, sizeof(lut), build_ns / 1000.0);
+    printf("Range: %.2f C (code 0) to %.2f C (code %u)\n",
+           lut.centi[0] / 100.0, lut.centi[TEMP_LUT_SIZE - 1] / 100.0, TEMP_LUT_SIZE - 1);
+    printf("%5s %8s %11s %11s %11s %11s %11s\n",
+           "bits", "codes", "max_err_C", "rms_err_C", "worst_code", "float_ns", "lut_ns");
+
+    int failures = 0;
+    for (int k = 0; k <= ADC_DECIMATOR_MAX_EXTRA_BITS; k++) {
+        if (only_bits >= 0 && k != only_bits) {
+            continue;
+        }
+
+        temp_lut_accuracy_t report;
+        temp_lut_check_accuracy(&lut, to_mv, NULL, (uint8_t)k, &report);
+
+        // Time both paths over every code; the sinks keep the loops alive
+        uint32_t codes = TEMP_LUT_SIZE << k;
+        volatile float float_sink = 0.0f;
+        volatile int32_t lut_sink = 0;
+
+        start = host_now_ns();
+        for (uint32_t code = 0; code < codes; code++) {
+            float_sink += float_path_celsius(to_mv, code, (uint8_t)k);
+        }
+        uint64_t float_ns = host_now_ns() - start;
+
+        start = host_now_ns();
+        for (uint32_t code = 0; code < codes; code++) {
+            lut_sink += temp_lut_oversampled_to_centi(&lut, code, (uint8_t)k);
+        }
+        uint64_t lut_ns = host_now_ns() - start;
+
+        printf("%5d %8u %11.4f %11.4f %11u %11.2f %11.2f\n",
+               ADC_DECIMATOR_RAW_BITS + k, report.codes_checked, report.max_error_c,
+               report.rms_error_c, report.worst_code,
+               (double)float_ns / codes, (double)lut_ns / codes);
+
+        // Table entries and the interpolation each round to half a centi-degree
+        if (report.max_error_c > TEMP_LUT_MAX_ERROR_C) {
+            failures++;
+        }
+    }
+
+    if (failures > 0) {
+        printf("FAIL: %d setting(s) exceed %.3f C\n", failures, TEMP_LUT_MAX_ERROR_C);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,102 @@
+/**
+ * @file thermal_plant.c
+ * @brief Lumped thermal model implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <math.h>
+#include "heater_pid.h"
+#include "temp_lut.h"
+#include "thermal_plant.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+void thermal_plant_default_config(thermal_plant_config_t *config)
+{
+    *config = (thermal_plant_config_t){
+        .ambient_c = 20.0,
+        .initial_patty_c = 8.0,         // Out of the fridge
+        .heater_w = 400.0,
+        .element_j_per_k = 300.0,
+        .element_w_per_k = 20.0,
+        .plate_j_per_k = 2000.0,        // ~4 kg of cast iron
+        .plate_loss_w_per_k = 3.5,
+        .lid_open_factor = 6.0,
+        .patty_j_per_k = 560.0,         // 150 g patty
+        .contact_w_per_k = 1.5,
+        .patty_loss_w_per_k = 0.3,
+        .probe_tau_s = 5.0,
+        .max_step_s = 0.05,
+    };
+}
+
+void thermal_plant_init(thermal_plant_t *plant, const thermal_plant_config_t *config)
+{
+    *plant = (thermal_plant_t){
+        .config = *config,
+        .element_c = config->ambient_c,
+        .plate_c = config->ambient_c,
+        .patty_c = config->initial_patty_c,
+        .probe_c = config->ambient_c,
+    };
+}
+
+void thermal_plant_set_duty(thermal_plant_t *plant, int32_t duty)
+{
+    if (duty < 0) {
+        duty = 0;
+    } else if (duty > HEATER_PID_OUTPUT_MAX) {
+        duty = HEATER_PID_OUTPUT_MAX;
+    }
+    plant->duty = (double)duty / HEATER_PID_OUTPUT_MAX;
+}
+
+void thermal_plant_set_lid(thermal_plant_t *plant, bool open)
+{
+    plant->lid_open = open;
+}
+
+void thermal_plant_advance(thermal_plant_t *plant, double dt_s)
+{
+    const thermal_plant_config_t *c = &plant->config;
+    const double plate_loss = c->plate_loss_w_per_k * (plant->lid_open ? c->lid_open_factor : 1.0);
+    const double power_w = plant->duty * c->heater_w;
+
+    while (dt_s > 0.0) {
+        const double h = dt_s < c->max_step_s ? dt_s : c->max_step_s;
+
+        // Explicit Euler; max_step_s is far below the smallest time constant
+        double to_plate_w = c->element_w_per_k * (plant->element_c - plant->plate_c);
+        double to_patty_w = c->contact_w_per_k * (plant->plate_c - plant->patty_c);
+        double plate_w = to_plate_w - plate_loss * (plant->plate_c - c->ambient_c) - to_patty_w;
+        double patty_w = to_patty_w - c->patty_loss_w_per_k * (plant->patty_c - c->ambient_c);
+
+        plant->element_c += h * (power_w - to_plate_w) / c->element_j_per_k;
+        plant->plate_c += h * plate_w / c->plate_j_per_k;
+        plant->patty_c += h * patty_w / c->patty_j_per_k;
+        plant->probe_c += h * (plant->plate_c - plant->probe_c) / c->probe_tau_s;
+        plant->energy_j += h * power_w;
+        plant->time_s += h;
+        dt_s -= h;
+    }
+}
+
+uint32_t thermal_plant_adc_code(const thermal_plant_t *plant, adc_synth_t *synth, uint8_t extra_bits)
+{
+    // Inverse of temp_lut_reference_celsius(), then the linear full-scale mapping
+    const double mv = TEMP_SENSOR_SLOPE_MV_PER_C * plant->probe_c - TEMP_SENSOR_OFFSET_MV;
+    const double ideal = mv * ADC_SYNTH_MAX_CODE / TEMP_LUT_DEFAULT_FULL_SCALE_MV;
+
+    // Averaging 4^k conversions divides the noise by 2^k
+    const double scale = (double)(1U << extra_bits);
+    double code = (ideal + adc_synth_gaussian(synth) * synth->noise_lsb / scale) * scale;
+    const double max = (double)(((uint32_t)ADC_SYNTH_MAX_CODE << extra_bits) | ((1U << extra_bits) - 1));
+
+    if (code < 0.0) {
+        code = 0.0;
+    } else if (code > max) {
+        code = max;
+    }
+    return (uint32_t)lround(code);
+}
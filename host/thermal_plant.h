@@ -0,0 +1,123 @@
+/**
+ * @file thermal_plant.h
+ * @brief Lumped thermal model of the grill and patty for closed-loop host runs
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Three first-order nodes and the probe:
+ *
+ *   duty x heater_w -> element -> plate -> patty
+ *                                   |  \      |
+ *                                   |  probe  |
+ *                                ambient   ambient
+ *
+ * The element heats the plate through a conductance; the plate loses heat
+ * to ambient (more with the lid open) and to the patty lying on it. The
+ * zone probe sits in the plate and follows it with a first-order lag, as
+ * the firmware controls the zone temperature, not the patty core. PWM is
+ * modelled by its average power, which is exact enough because the 20 Hz
+ * PWM period is far shorter than every time constant here.
+ *
+ * thermal_plant_adc_code() turns the probe temperature into what the ADC
+ * pipeline delivers: the sensor's voltage (temp_lut constants), the 12-bit
+ * code for it and the oversampled code of one averaged reading with the
+ * noise left after averaging. The firmware temp_lut and filters then
+ * process it as they would on the target.
+ */
+
+#ifndef THERMAL_PLANT_H
+#define THERMAL_PLANT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_synth.h"
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Physical parameters
+ */
+typedef struct {
+    double ambient_c;           /**< Air temperature */
+    double initial_patty_c;     /**< Patty temperature at start; everything else starts at ambient */
+    double heater_w;            /**< Heater power at 100 % duty */
+    double element_j_per_k;     /**< Heating element heat capacity */
+    double element_w_per_k;     /**< Element to plate */
+    double plate_j_per_k;       /**< Plate heat capacity */
+    double plate_loss_w_per_k;  /**< Plate to ambient, lid closed */
+    double lid_open_factor;     /**< Plate loss multiplier with the lid open */
+    double patty_j_per_k;       /**< Patty heat capacity */
+    double contact_w_per_k;     /**< Plate to patty */
+    double patty_loss_w_per_k;  /**< Patty to ambient */
+    double probe_tau_s;         /**< Probe lag */
+    double max_step_s;          /**< Largest integration step (stability) */
+} thermal_plant_config_t;
+
+/**
+ * @brief Model state
+ */
+typedef struct {
+    thermal_plant_config_t config;
+    double element_c;
+    double plate_c;
+    double patty_c;
+    double probe_c;
+    double duty;                /**< 0..1 */
+    bool lid_open;
+    double time_s;              /**< Simulated time */
+    double energy_j;            /**< Heater energy delivered */
+} thermal_plant_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Parameters of a small covered grill with one patty on it
+ */
+void thermal_plant_default_config(thermal_plant_config_t *config);
+
+/**
+ * @brief Start a run at ambient, with the patty at its initial temperature
+ */
+void thermal_plant_init(thermal_plant_t *plant, const thermal_plant_config_t *config);
+
+/**
+ * @brief Apply a heater duty (held until the next call)
+ *
+ * @param plant Model
+ * @param duty Duty in heater_pid units (0..HEATER_PID_OUTPUT_MAX)
+ */
+void thermal_plant_set_duty(thermal_plant_t *plant, int32_t duty);
+
+/**
+ * @brief Open or close the lid
+ */
+void thermal_plant_set_lid(thermal_plant_t *plant, bool open);
+
+/**
+ * @brief Advance the model
+ *
+ * @param plant Model
+ * @param dt_s Time to advance (split into steps of at most max_step_s)
+ */
+void thermal_plant_advance(thermal_plant_t *plant, double dt_s);
+
+/**
+ * @brief One oversampled ADC reading of the probe
+ *
+ * @param plant Model
+ * @param synth Noise source (its noise_lsb is the per-conversion noise)
+ * @param extra_bits Oversampling bits (4^extra_bits conversions averaged)
+ * @return Code 12 + extra_bits wide, as adc_decimator would deliver
+ */
+uint32_t thermal_plant_adc_code(const thermal_plant_t *plant, adc_synth_t *synth, uint8_t extra_bits);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* THERMAL_PLANT_H */
@@ -0,0 +1,207 @@
+/**
+ * @file uart_fake.c
+ * @brief UART ports as pseudo-terminals, paced at the configured baud rate
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * uart_driver_install() opens a pty and prints its slave device on stderr
+ * (or links it to the path given to idf_fake_uart_link()), so a decoder can
+ * read the port as it would a USB-serial adapter. The wire is modelled by
+ * the time it is busy: each write occupies it for 10 bits per byte, and a
+ * writer that gets more than the driver's TX buffer ahead of it sleeps,
+ * as uart_write_bytes() blocks on a full ring buffer. Bytes nobody reads
+ * fill the pty and are then dropped, like a line with nothing attached.
+ */
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/uart.h"
+#include "esp_timer.h"
+#include "idf_fake.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define UART_FAKE_PORTS             3
+#define UART_FAKE_BITS_PER_BYTE     10      // Start, 8 data, stop
+#define UART_FAKE_DEFAULT_BAUD      115200
+
+/* ==================== DATA TYPES ==================== */
+
+typedef struct {
+    bool installed;
+    int master_fd;
+    int slave_fd;               // Kept open so the pty survives readers coming and going
+    int baud;
+    int tx_buffer_size;
+    int tx_pin;
+    int64_t line_free_us;       // When the wire has sent everything written so far
+} uart_fake_port_t;
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static pthread_mutex_t uart_lock = PTHREAD_MUTEX_INITIALIZER;
+static uart_fake_port_t ports[UART_FAKE_PORTS];
+static const char *link_path = NULL;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+void idf_fake_uart_link(const char *path)
+{
+    link_path = path;
+}
+
+/**
+ * @brief Sleep as a blocked task until the given time
+ */
+static void sleep_until(int64_t until_us)
+{
+    int64_t wait_us = until_us - esp_timer_get_time();
+    if (wait_us > 0) {
+        vTaskDelay((TickType_t)((wait_us * CONFIG_FREERTOS_HZ + 999999) / 1000000));
+    }
+}
+
+esp_err_t uart_driver_install(uart_port_t uart_num, int rx_buffer_size, int tx_buffer_size,
+                              int queue_size, QueueHandle_t *uart_queue, int intr_alloc_flags)
+{
+    if (uart_num < 0 || uart_num >= UART_FAKE_PORTS || tx_buffer_size < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    uart_fake_port_t *port = &ports[uart_num];
+    if (port->installed) {
+        return ESP_FAIL;
+    }
+
+    int master_fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master_fd < 0 || grantpt(master_fd) != 0 || unlockpt(master_fd) != 0) {
+        goto fail;
+    }
+    const char *slave_path = ptsname(master_fd);
+    int slave_fd = slave_path != NULL ? open(slave_path, O_RDWR | O_NOCTTY) : -1;
+    if (slave_fd < 0) {
+        goto fail;
+    }
+    // Binary data: no echo, no CR/LF translation, no line buffering
+    struct termios tio;
+    if (tcgetattr(slave_fd, &tio) == 0) {
+        cfmakeraw(&tio);
+        tcsetattr(slave_fd, TCSANOW, &tio);
+    }
+    fcntl(master_fd, F_SETFL, fcntl(master_fd, F_GETFL) | O_NONBLOCK);
+
+    if (link_path != NULL) {
+        unlink(link_path);
+        if (symlink(slave_path, link_path) != 0) {
+            fprintf(stderr, "uart%d: cannot link %s: %s\n", uart_num, link_path, strerror(errno));
+        }
+    }
+    fprintf(stderr, "uart%d: %s%s%s\n", uart_num, slave_path, link_path != NULL ? " -> " : "",
+            link_path != NULL ? link_path : "");
+
+    pthread_mutex_lock(&uart_lock);
+    *port = (uart_fake_port_t){
+        .installed = true,
+        .master_fd = master_fd,
+        .slave_fd = slave_fd,
+        .baud = UART_FAKE_DEFAULT_BAUD,
+        .tx_buffer_size = tx_buffer_size,
+        .tx_pin = UART_PIN_NO_CHANGE,
+    };
+    pthread_mutex_unlock(&uart_lock);
+    return ESP_OK;
+
+fail:
+    fprintf(stderr, "uart%d: no pty: %s\n", uart_num, strerror(errno));
+    if (master_fd >= 0) {
+        close(master_fd);
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t uart_driver_delete(uart_port_t uart_num)
+{
+    if (uart_num < 0 || uart_num >= UART_FAKE_PORTS || !ports[uart_num].installed) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&uart_lock);
+    close(ports[uart_num].master_fd);
+    close(ports[uart_num].slave_fd);
+    ports[uart_num].installed = false;
+    pthread_mutex_unlock(&uart_lock);
+    return ESP_OK;
+}
+
+esp_err_t uart_param_config(uart_port_t uart_num, const uart_config_t *uart_config)
+{
+    if (uart_num < 0 || uart_num >= UART_FAKE_PORTS || uart_config == NULL ||
+        uart_config->baud_rate <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&uart_lock);
+    ports[uart_num].baud = uart_config->baud_rate;
+    pthread_mutex_unlock(&uart_lock);
+    return ESP_OK;
+}
+
+esp_err_t uart_set_pin(uart_port_t uart_num, int tx_io_num, int rx_io_num, int rts_io_num,
+                       int cts_io_num)
+{
+    if (uart_num < 0 || uart_num >= UART_FAKE_PORTS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&uart_lock);
+    ports[uart_num].tx_pin = tx_io_num;
+    pthread_mutex_unlock(&uart_lock);
+    return ESP_OK;
+}
+
+int uart_write_bytes(uart_port_t uart_num, const void *src, size_t size)
+{
+    if (uart_num < 0 || uart_num >= UART_FAKE_PORTS || !ports[uart_num].installed || src == NULL) {
+        return -1;
+    }
+    uart_fake_port_t *port = &ports[uart_num];
+
+    pthread_mutex_lock(&uart_lock);
+    int64_t now_us = esp_timer_get_time();
+    int64_t start_us = port->line_free_us > now_us ? port->line_free_us : now_us;
+    port->line_free_us = start_us + (int64_t)size * UART_FAKE_BITS_PER_BYTE * 1000000 / port->baud;
+    // What the TX buffer can hold ahead of the wire
+    int64_t buffered_us = (int64_t)port->tx_buffer_size * UART_FAKE_BITS_PER_BYTE * 1000000 /
+                          port->baud;
+    int64_t resume_us = port->line_free_us - buffered_us;
+
+    // A short or failed write (pty full) loses the rest, as on an open line
+    if (write(port->master_fd, src, size) < 0 && errno != EAGAIN) {
+        fprintf(stderr, "uart%d: %s\n", uart_num, strerror(errno));
+    }
+    pthread_mutex_unlock(&uart_lock);
+
+    sleep_until(resume_us);
+    return (int)size;
+}
+
+esp_err_t uart_wait_tx_done(uart_port_t uart_num, TickType_t ticks_to_wait)
+{
+    if (uart_num < 0 || uart_num >= UART_FAKE_PORTS || !ports[uart_num].installed) {
+        return ESP_FAIL;
+    }
+    pthread_mutex_lock(&uart_lock);
+    int64_t done_us = ports[uart_num].line_free_us;
+    pthread_mutex_unlock(&uart_lock);
+
+    if (done_us > esp_timer_get_time() && ticks_to_wait == 0) {
+        return ESP_ERR_TIMEOUT;
+    }
+    sleep_until(done_us);
+    return ESP_OK;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file adc_decimator.c
+ * @brief Hardware-independent oversampling decimator implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include "adc_decimator.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+bool adc_decimator_init(adc_decimator_t *dec, uint8_t extra_bits, uint16_t decimation)
+{
+    if (extra_bits > ADC_DECIMATOR_MAX_EXTRA_BITS) {
+        return false;
+    }
+
+    uint32_t minimum = 1UL << (2 * extra_bits);
+    if (decimation == 0) {
+        decimation = (uint16_t)minimum;
+    }
+    if (decimation < minimum) {
+        return false;   // Not enough samples to gain the requested bits
+    }
+
+    dec->sum = 0;
+    dec->count = 0;
+    dec->decimation = decimation;
+    dec->extra_bits = extra_bits;
+    return true;
+}
+
+uint32_t adc_decimator_finish(adc_decimator_t *dec)
+{
+    uint32_t reading;
+
+    if (dec->count == 0) {
+        return 0;
+    }
+
+    if (dec->count == (1U << (2 * dec->extra_bits))) {
+        // Classic 4^k oversampling: sum / 2^k
+        reading = (dec->sum + ((1U << dec->extra_bits) >> 1)) >> dec->extra_bits;
+    } else {
+        // Averaging beyond 4^k: mean scaled to the output resolution
+        uint64_t scaled = (uint64_t)dec->sum << dec->extra_bits;
+        reading = (uint32_t)((scaled + dec->count / 2) / dec->count);
+    }
+
+    dec->sum = 0;
+    dec->count = 0;
+    return reading;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file adc_decimator.h
+ * @brief Hardware-independent oversampling decimator for ADC streams
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Sums raw 12-bit conversions and emits one reading per decimation block.
+ * With 4^k samples per block the result carries k extra bits of resolution
+ * (given at least ~1 LSB of noise on the input, which the ESP32-S3 SAR ADC
+ * provides). The per-sample work is a single add, so a whole DMA frame can
+ * be folded in a tight loop without per-sample driver calls or interrupts.
+ */
+
+#ifndef ADC_DECIMATOR_H
+#define ADC_DECIMATOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+/** @brief Resolution of the raw conversions fed to the decimator */
+#define ADC_DECIMATOR_RAW_BITS      12
+
+/** @brief Largest supported number of extra bits */
+#define ADC_DECIMATOR_MAX_EXTRA_BITS 6
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Decimator state
+ */
+typedef struct {
+    uint32_t sum;           /**< Running sum of the current block */
+    uint16_t count;         /**< Samples in the current block */
+    uint16_t decimation;    /**< Samples per output reading */
+    uint8_t extra_bits;     /**< Bits gained by oversampling */
+} adc_decimator_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Initialise a decimator
+ *
+ * @param dec Decimator to initialise
+ * @param extra_bits Extra bits of resolution (0 to ADC_DECIMATOR_MAX_EXTRA_BITS)
+ * @param decimation Samples per reading; 0 selects 4^extra_bits
+ * @return true on success, false if the parameters are out of range
+ */
+bool adc_decimator_init(adc_decimator_t *dec, uint8_t extra_bits, uint16_t decimation);
+
+/**
+ * @brief Resolution of the readings produced by a decimator
+ *
+ * @param dec Decimator
+ * @return Number of bits of each output reading
+ */
+static inline uint8_t adc_decimator_output_bits(const adc_decimator_t *dec)
+{
+    return (uint8_t)(ADC_DECIMATOR_RAW_BITS + dec->extra_bits);
+}
+
+/**
+ * @brief Close the current block and compute its reading
+ *
+ * @param dec Decimator
+ * @return Reading scaled to adc_decimator_output_bits()
+ */
+uint32_t adc_decimator_finish(adc_decimator_t *dec);
+
+/**
+ * @brief Add one raw conversion
+ *
+ * @param dec Decimator
+ * @param raw Raw 12-bit conversion result
+ * @param out Receives the reading when a block completes
+ * @return true if a reading was written to out
+ */
+static inline bool adc_decimator_push(adc_decimator_t *dec, uint16_t raw, uint32_t *out)
+{
+    dec->sum += raw;
+    if (++dec->count < dec->decimation) {
+        return false;
+    }
+    *out = adc_decimator_finish(dec);
+    return true;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_DECIMATOR_H */
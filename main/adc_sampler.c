@@ -0,0 +1,337 @@
+/**
+ * @file adc_sampler.c
+ * @brief DMA-driven continuous ADC sampling engine with oversampling
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_idf_version.h"
+#include "soc/soc_caps.h"
+#include "adc_decimator.h"
+#include "adc_sampler.h"
+#include "task_layout.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SAMPLER_FRAME_SAMPLES       512     // Conversions per DMA frame, all channels
+#define SAMPLER_POOL_FRAMES         4       // Frames buffered by the driver
+
+#define SAMPLER_FRAME_BYTES         (SAMPLER_FRAME_SAMPLES * SOC_ADC_DIGI_RESULT_BYTES)
+#define SAMPLER_NO_SLOT             0xFF
+
+/* ==================== DATA TYPES ==================== */
+
+typedef enum {
+    SAMPLER_STOPPED = 0,
+    SAMPLER_CONTINUOUS,
+    SAMPLER_BURST,              // Stops once burst_pending is empty
+} sampler_mode_t;
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "ADC_SAMPLER";
+
+static adc_continuous_handle_t adc_handle = NULL;
+static TaskHandle_t sampler_task_handle = NULL;
+static adc_sampler_config_t sampler_config;
+static adc_decimator_t decimators[ADC_SAMPLER_MAX_CHANNELS];
+static uint8_t channel_slot[SOC_ADC_MAX_CHANNEL_NUM];  // Channel number -> slot
+static adc_sampler_stats_t sampler_stats;
+static sampler_mode_t sampler_mode = SAMPLER_STOPPED;
+static SemaphoreHandle_t mode_lock = NULL;      // Mode changes: callers vs. the sampler task
+static uint32_t burst_pending = 0;              // Slots still owing a reading this burst
+
+static uint8_t frame_buffer[SAMPLER_FRAME_BYTES];
+static adc_continuous_data_t parsed_samples[SAMPLER_FRAME_SAMPLES];
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief DMA frame complete (ISR context): wake the sampler task
+ */
+static bool IRAM_ATTR adc_sampler_on_conv_done(adc_continuous_handle_t handle,
+                                               const adc_continuous_evt_data_t *edata,
+                                               void *user_data)
+{
+    BaseType_t task_woken = pdFALSE;
+    task_layout_release_from_isr(TASK_LAYOUT_SAMPLER);
+    vTaskNotifyGiveFromISR(sampler_task_handle, &task_woken);
+    return task_woken == pdTRUE;
+}
+
+/**
+ * @brief Driver pool overflow (ISR context): the task fell behind
+ */
+static bool IRAM_ATTR adc_sampler_on_pool_ovf(adc_continuous_handle_t handle,
+                                              const adc_continuous_evt_data_t *edata,
+                                              void *user_data)
+{
+    sampler_stats.pool_overflows++;
+    return false;
+}
+
+/**
+ * @brief Fold one DMA frame into the decimator and emit completed readings
+ */
+static void adc_sampler_process_frame(uint32_t length)
+{
+    uint32_t count = 0;
+
+    if (adc_continuous_parse_data(adc_handle, frame_buffer, length,
+                                  parsed_samples, &count) != ESP_OK) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t value;
+
+        if (!parsed_samples[i].valid || parsed_samples[i].channel >= SOC_ADC_MAX_CHANNEL_NUM) {
+            continue;
+        }
+        uint8_t slot = channel_slot[parsed_samples[i].channel];
+        if (slot == SAMPLER_NO_SLOT) {
+            continue;
+        }
+
+        adc_decimator_t *decimator = &decimators[slot];
+        sampler_stats.samples++;
+        if (adc_decimator_push(decimator, (uint16_t)parsed_samples[i].raw_data, &value)) {
+            adc_sampler_reading_t reading = {
+                .slot = slot,
+                .value = value,
+                .resolution_bits = adc_decimator_output_bits(decimator),
+                .samples = decimator->decimation,
+                .timestamp_us = esp_timer_get_time(),
+            };
+            sampler_stats.readings++;
+            __atomic_and_fetch(&burst_pending, ~(1U << slot), __ATOMIC_RELAXED);
+            if (sampler_config.callback != NULL) {
+                sampler_config.callback(&reading, sampler_config.callback_ctx);
+            }
+        }
+    }
+
+    sampler_stats.frames++;
+}
+
+/**
+ * @brief Stop the controller once every channel has its burst reading
+ *
+ * Runs in the sampler task, so emptying the decimators cannot race with
+ * adc_sampler_process_frame().
+ */
+static void adc_sampler_end_burst(void)
+{
+    xSemaphoreTake(mode_lock, portMAX_DELAY);
+    if (sampler_mode == SAMPLER_BURST && __atomic_load_n(&burst_pending, __ATOMIC_RELAXED) == 0) {
+        adc_continuous_stop(adc_handle);
+        adc_continuous_flush_pool(adc_handle);      // Frames converted after the last reading
+        for (uint8_t slot = 0; slot < sampler_config.channel_count; slot++) {
+            adc_decimator_init(&decimators[slot], sampler_config.oversample_bits,
+                               sampler_config.decimation);
+        }
+        sampler_mode = SAMPLER_STOPPED;
+        sampler_stats.bursts++;
+    }
+    xSemaphoreGive(mode_lock);
+}
+
+/**
+ * @brief Sampler task: sleeps until DMA completes a frame
+ */
+static void adc_sampler_task(void *pvParameters)
+{
+    ESP_LOGI(TAG, "ADC sampler task started");
+
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        task_layout_note_wake(TASK_LAYOUT_SAMPLER);
+
+        // Drain every frame the driver has buffered
+        while (1) {
+            uint32_t length = 0;
+            esp_err_t ret = adc_continuous_read(adc_handle, frame_buffer, SAMPLER_FRAME_BYTES,
+                                                &length, 0);
+            if (ret != ESP_OK) {
+                break;
+            }
+            adc_sampler_process_frame(length);
+            if (sampler_mode == SAMPLER_BURST) {
+                adc_sampler_end_burst();
+            }
+        }
+    }
+}
+
+esp_err_t adc_sampler_init(const adc_sampler_config_t *config)
+{
+    esp_err_t ret;
+
+    if (config == NULL || config->sample_freq_hz == 0 || config->channel_count == 0 ||
+        config->channel_count > ADC_SAMPLER_MAX_CHANNELS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (adc_handle != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    memset(channel_slot, SAMPLER_NO_SLOT, sizeof(channel_slot));
+    for (uint8_t slot = 0; slot < config->channel_count; slot++) {
+        adc_channel_t channel = config->channels[slot];
+        if ((unsigned)channel >= SOC_ADC_MAX_CHANNEL_NUM || channel_slot[channel] != SAMPLER_NO_SLOT) {
+            ESP_LOGE(TAG, "Invalid or duplicate channel %d", (int)channel);
+            return ESP_ERR_INVALID_ARG;
+        }
+        if (!adc_decimator_init(&decimators[slot], config->oversample_bits, config->decimation)) {
+            ESP_LOGE(TAG, "Invalid oversampling: %u bits with decimation %u",
+                     config->oversample_bits, config->decimation);
+            return ESP_ERR_INVALID_ARG;
+        }
+        channel_slot[channel] = slot;
+    }
+
+    sampler_config = *config;
+    memset(&sampler_stats, 0, sizeof(sampler_stats));
+    mode_lock = xSemaphoreCreateMutex();
+    if (mode_lock == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    adc_continuous_handle_cfg_t handle_config = {
+        .max_store_buf_size = SAMPLER_FRAME_BYTES * SAMPLER_POOL_FRAMES,
+        .conv_frame_size = SAMPLER_FRAME_BYTES,
+    };
+    ret = adc_continuous_new_handle(&handle_config, &adc_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create continuous ADC handle: %s", esp_err_to_name(ret));
+        goto err_lock;
+    }
+
+    // One pattern entry per channel; the controller walks the table round-robin
+    adc_digi_pattern_config_t pattern[ADC_SAMPLER_MAX_CHANNELS];
+    for (uint8_t slot = 0; slot < config->channel_count; slot++) {
+        pattern[slot] = (adc_digi_pattern_config_t) {
+            .atten = config->atten,
+            .channel = config->channels[slot],
+            .unit = config->unit,
+            .bit_width = SOC_ADC_DIGI_MAX_BITWIDTH,
+        };
+    }
+    adc_continuous_config_t dig_config = {
+        .pattern_num = config->channel_count,
+        .adc_pattern = pattern,
+        .sample_freq_hz = config->sample_freq_hz,
+        .conv_mode = ADC_CONV_SINGLE_UNIT_1,
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(6, 0, 0)
+        .format = ADC_DIGI_OUTPUT_FORMAT_TYPE2,
+#endif
+    };
+    ret = adc_continuous_config(adc_handle, &dig_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure continuous ADC: %s", esp_err_to_name(ret));
+        goto err_handle;
+    }
+
+    ret = task_layout_create(TASK_LAYOUT_SAMPLER, adc_sampler_task, NULL, &sampler_task_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create sampler task");
+        goto err_handle;
+    }
+
+    adc_continuous_evt_cbs_t callbacks = {
+        .on_conv_done = adc_sampler_on_conv_done,
+        .on_pool_ovf = adc_sampler_on_pool_ovf,
+    };
+    ret = adc_continuous_register_event_callbacks(adc_handle, &callbacks, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to register ADC callbacks: %s", esp_err_to_name(ret));
+        goto err_task;
+    }
+
+    ESP_LOGI(TAG, "ADC sampler: %u channel(s) at %" PRIu32 " Hz each, %u samples/reading, %u-bit readings",
+             config->channel_count, config->sample_freq_hz / config->channel_count,
+             decimators[0].decimation, adc_decimator_output_bits(&decimators[0]));
+    return ESP_OK;
+
+err_task:
+    vTaskDelete(sampler_task_handle);
+    sampler_task_handle = NULL;
+err_handle:
+    adc_continuous_deinit(adc_handle);
+    adc_handle = NULL;
+err_lock:
+    vSemaphoreDelete(mode_lock);
+    mode_lock = NULL;
+    return ret;
+}
+
+esp_err_t adc_sampler_start(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (adc_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(mode_lock, portMAX_DELAY);
+    if (sampler_mode == SAMPLER_STOPPED) {
+        ret = adc_continuous_start(adc_handle);
+    }
+    if (ret == ESP_OK) {
+        sampler_mode = SAMPLER_CONTINUOUS;
+    }
+    xSemaphoreGive(mode_lock);
+    return ret;
+}
+
+esp_err_t adc_sampler_stop(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (adc_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(mode_lock, portMAX_DELAY);
+    if (sampler_mode != SAMPLER_STOPPED) {
+        ret = adc_continuous_stop(adc_handle);
+        sampler_mode = SAMPLER_STOPPED;
+    }
+    xSemaphoreGive(mode_lock);
+    return ret;
+}
+
+esp_err_t adc_sampler_burst(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (adc_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(mode_lock, portMAX_DELAY);
+    if (sampler_mode != SAMPLER_BURST) {
+        __atomic_store_n(&burst_pending, (1U << sampler_config.channel_count) - 1, __ATOMIC_RELAXED);
+        if (sampler_mode == SAMPLER_STOPPED) {
+            ret = adc_continuous_start(adc_handle);
+        }
+        if (ret == ESP_OK) {
+            sampler_mode = SAMPLER_BURST;
+        }
+    }
+    xSemaphoreGive(mode_lock);
+    return ret;
+}
+
+esp_err_t adc_sampler_get_stats(adc_sampler_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = sampler_stats;
+    return ESP_OK;
+}
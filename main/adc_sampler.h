@@ -0,0 +1,142 @@
+/**
+ * @file adc_sampler.h
+ * @brief DMA-driven continuous ADC sampling engine with oversampling
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The ADC digital controller converts at a fixed rate and DMA fills frames in
+ * the background. A frame-done interrupt only notifies the sampler task, which
+ * folds each completed frame into the oversampling decimator and hands the
+ * decimated readings to a callback. No CPU time is spent per conversion.
+ *
+ * Several channels can share one scan pattern: the controller converts them
+ * round-robin in hardware, so sample_freq_hz is split evenly between them and
+ * each channel has its own decimator.
+ *
+ * adc_sampler_burst() runs the controller only until every channel has
+ * delivered one reading and then stops it. Between bursts the driver releases
+ * its power management lock, so the chip can sleep (power_mgmt.h).
+ */
+
+#ifndef ADC_SAMPLER_H
+#define ADC_SAMPLER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_adc/adc_continuous.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define ADC_SAMPLER_MAX_CHANNELS    8       // Channels in one scan pattern
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief One decimated, oversampled reading
+ */
+typedef struct {
+    uint8_t slot;               /**< Index of the channel in adc_sampler_config_t.channels */
+    uint32_t value;             /**< Oversampled code, resolution_bits wide */
+    uint8_t resolution_bits;    /**< 12 + oversample bits */
+    uint16_t samples;           /**< Raw conversions averaged into this reading */
+    uint64_t timestamp_us;      /**< Time the reading was produced */
+} adc_sampler_reading_t;
+
+/**
+ * @brief Reading consumer, called from the sampler task
+ *
+ * @param reading Decimated reading
+ * @param ctx User context from the configuration
+ */
+typedef void (*adc_sampler_cb_t)(const adc_sampler_reading_t *reading, void *ctx);
+
+/**
+ * @brief Sampling engine configuration
+ */
+typedef struct {
+    adc_unit_t unit;            /**< ADC unit (ADC_UNIT_1) */
+    adc_channel_t channels[ADC_SAMPLER_MAX_CHANNELS];  /**< Channels to scan, in pattern order */
+    uint8_t channel_count;      /**< Number of channels in use (1 to ADC_SAMPLER_MAX_CHANNELS) */
+    adc_atten_t atten;          /**< Input attenuation, shared by all channels */
+    uint32_t sample_freq_hz;    /**< Raw conversion rate summed over all channels */
+    uint8_t oversample_bits;    /**< Extra bits of resolution (4^k samples per reading) */
+    uint16_t decimation;        /**< Samples per reading, 0 = 4^oversample_bits */
+    adc_sampler_cb_t callback;  /**< Reading consumer */
+    void *callback_ctx;         /**< Context passed to the consumer */
+} adc_sampler_config_t;
+
+/**
+ * @brief Sampling engine statistics
+ */
+typedef struct {
+    uint32_t frames;            /**< DMA frames processed */
+    uint32_t samples;           /**< Raw conversions folded into readings */
+    uint32_t readings;          /**< Decimated readings delivered */
+    uint32_t pool_overflows;    /**< Frames lost because the task fell behind */
+    uint32_t bursts;            /**< Bursts completed (adc_sampler_burst) */
+} adc_sampler_stats_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Create the continuous ADC driver and the sampler task
+ *
+ * @param config Sampling configuration
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if config is NULL or invalid
+ * @return ESP_ERR_INVALID_STATE if already initialised
+ * @return ESP_ERR_NO_MEM if the task or buffers cannot be allocated
+ * @return Other ESP error codes from the ADC driver
+ */
+esp_err_t adc_sampler_init(const adc_sampler_config_t *config);
+
+/**
+ * @brief Start continuous DMA conversions (also ends burst mode)
+ *
+ * @return ESP_OK on success, also if already running
+ * @return ESP_ERR_INVALID_STATE if not initialised
+ */
+esp_err_t adc_sampler_start(void);
+
+/**
+ * @brief Stop DMA conversions
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if not initialised
+ */
+esp_err_t adc_sampler_stop(void);
+
+/**
+ * @brief Take one reading per channel, then stop the controller
+ *
+ * The decimators are emptied when a burst ends, so each burst reading holds
+ * samples of its own burst only. While running continuously, conversions stop
+ * after the next reading of every channel. Nothing happens if a burst is
+ * already in progress.
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if not initialised
+ * @return Other ESP error codes from the ADC driver
+ */
+esp_err_t adc_sampler_burst(void);
+
+/**
+ * @brief Get sampling statistics
+ *
+ * @param stats Pointer to store statistics
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if stats is NULL
+ */
+esp_err_t adc_sampler_get_stats(adc_sampler_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_SAMPLER_H */
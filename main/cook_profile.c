@@ -0,0 +1,173 @@
+/**
+ * @file cook_profile.c
+ * @brief Per-product doneness bands loaded from a binary blob
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "cook_profile.h"
+#include "crc32.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define BLOB_HEADER_BYTES       8
+#define BLOB_PROFILE_BYTES      (COOK_PROFILE_NAME_LEN + 2 + 2 + 1)
+#define BLOB_BAND_BYTES         (2 + 2 + COOK_PROFILE_BAND_NAME_LEN)
+#define BLOB_CRC_BYTES          4
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int16_t get_i16(const uint8_t *p)
+{
+    return (int16_t)((uint16_t)p[0] | ((uint16_t)p[1] << 8));
+}
+
+/**
+ * @brief Copy a NUL-padded name field and terminate it
+ */
+static void get_name(char *dst, const uint8_t *src, size_t len)
+{
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+static bool in_domain(int celsius)
+{
+    return celsius >= COOK_PROFILE_TEMP_MIN && celsius <= COOK_PROFILE_TEMP_MAX;
+}
+
+/**
+ * @brief Fill the direct-index table; rejects bands that overlap
+ */
+static esp_err_t compile_profile(cook_profile_t *profile)
+{
+    memset(profile->band_of, COOK_PROFILE_NO_BAND, sizeof(profile->band_of));
+
+    for (uint8_t band = 0; band < profile->band_count; band++) {
+        const cook_band_t *b = &profile->bands[band];
+        for (int c = b->min_c; c <= b->max_c; c++) {
+            uint8_t *entry = &profile->band_of[c - COOK_PROFILE_TEMP_MIN];
+            if (*entry != COOK_PROFILE_NO_BAND) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            *entry = band;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t cook_profile_load(cook_profile_set_t *set, const uint8_t *blob, size_t len)
+{
+    if (set == NULL || blob == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (len < BLOB_HEADER_BYTES + BLOB_CRC_BYTES) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    if (get_u32(blob + len - BLOB_CRC_BYTES) != crc32_update(0, blob, len - BLOB_CRC_BYTES)) {
+        return ESP_ERR_INVALID_CRC;
+    }
+    if (get_u32(blob) != COOK_PROFILE_MAGIC || blob[4] != COOK_PROFILE_VERSION) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+    if (blob[5] == 0 || blob[5] > COOK_PROFILE_MAX_PROFILES) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Decoded on the heap so a bad blob leaves `set` untouched without a
+    // second permanent copy of the tables
+    esp_err_t ret = ESP_OK;
+    cook_profile_set_t *staging = calloc(1, sizeof(*staging));
+    if (staging == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    staging->count = blob[5];
+
+    const uint8_t *p = blob + BLOB_HEADER_BYTES;
+    const uint8_t *end = blob + len - BLOB_CRC_BYTES;
+
+    for (uint8_t i = 0; i < staging->count; i++) {
+        cook_profile_t *profile = &staging->profiles[i];
+
+        if ((size_t)(end - p) < BLOB_PROFILE_BYTES) {
+            ret = ESP_ERR_INVALID_SIZE;
+            goto cleanup;
+        }
+        get_name(profile->name, p, COOK_PROFILE_NAME_LEN);
+        profile->safe_min_c = get_i16(p + COOK_PROFILE_NAME_LEN);
+        profile->safe_max_c = get_i16(p + COOK_PROFILE_NAME_LEN + 2);
+        profile->band_count = p[COOK_PROFILE_NAME_LEN + 4];
+        p += BLOB_PROFILE_BYTES;
+
+        if (profile->band_count == 0 || profile->band_count > COOK_PROFILE_MAX_BANDS ||
+            profile->safe_min_c > profile->safe_max_c) {
+            ret = ESP_ERR_INVALID_ARG;
+            goto cleanup;
+        }
+        if ((size_t)(end - p) < (size_t)profile->band_count * BLOB_BAND_BYTES) {
+            ret = ESP_ERR_INVALID_SIZE;
+            goto cleanup;
+        }
+
+        for (uint8_t band = 0; band < profile->band_count; band++) {
+            cook_band_t *b = &profile->bands[band];
+            b->min_c = get_i16(p);
+            b->max_c = get_i16(p + 2);
+            get_name(b->name, p + 4, COOK_PROFILE_BAND_NAME_LEN);
+            p += BLOB_BAND_BYTES;
+
+            if (b->min_c > b->max_c || !in_domain(b->min_c) || !in_domain(b->max_c)) {
+                ret = ESP_ERR_INVALID_ARG;
+                goto cleanup;
+            }
+        }
+
+        ret = compile_profile(profile);
+        if (ret != ESP_OK) {
+            goto cleanup;
+        }
+    }
+
+    if (p != end) {
+        ret = ESP_ERR_INVALID_SIZE;
+        goto cleanup;
+    }
+
+    staging->active = 0;
+    memcpy(set, staging, sizeof(*set));
+
+cleanup:
+    free(staging);
+    return ret;
+}
+
+esp_err_t cook_profile_select(cook_profile_set_t *set, uint8_t index)
+{
+    if (set == NULL || index >= set->count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    set->active = index;
+    return ESP_OK;
+}
+
+int cook_profile_find(const cook_profile_set_t *set, const char *name)
+{
+    for (uint8_t i = 0; i < set->count; i++) {
+        if (strcmp(set->profiles[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+const char *cook_profile_band_name(const cook_profile_t *profile, uint8_t band)
+{
+    return band < profile->band_count ? profile->bands[band].name : "";
+}
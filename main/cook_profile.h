@@ -0,0 +1,169 @@
+/**
+ * @file cook_profile.h
+ * @brief Per-product doneness bands loaded from a binary blob
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * A profile (beef, chicken, fish, ...) names a safe input range and up to
+ * COOK_PROFILE_MAX_BANDS doneness bands. Profiles arrive as one compact
+ * little-endian blob:
+ *
+ *   header   | magic "CPRF" (4) | version (1) | profile count (1) | reserved (2) |
+ *   profile  | name (8, NUL-padded) | safe min (i16) | safe max (i16) | band count (1) |
+ *   band     | min (i16) | max (i16) | name (12, NUL-padded) |      (band count times)
+ *   trailer  | crc32 of everything before it (4) |
+ *
+ * Temperatures are whole degrees C and bands are inclusive. Loading checks
+ * the blob and compiles every profile into a direct-index table with one
+ * entry per degree of the COOK_PROFILE_TEMP_MIN..COOK_PROFILE_TEMP_MAX
+ * domain, so classifying a temperature is a range check and one array
+ * access, and switching profiles is an index change.
+ */
+
+#ifndef COOK_PROFILE_H
+#define COOK_PROFILE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define COOK_PROFILE_MAGIC          0x46525043UL    // "CPRF"
+#define COOK_PROFILE_VERSION        1
+#define COOK_PROFILE_MAX_PROFILES   8
+#define COOK_PROFILE_MAX_BANDS      8
+#define COOK_PROFILE_NAME_LEN       8       // Profile name bytes in the blob
+#define COOK_PROFILE_BAND_NAME_LEN  12      // Band name bytes in the blob (fits a 16-column line)
+#define COOK_PROFILE_TEMP_MIN       0       // Classified domain in degrees C
+#define COOK_PROFILE_TEMP_MAX       999
+#define COOK_PROFILE_TEMP_SPAN      (COOK_PROFILE_TEMP_MAX - COOK_PROFILE_TEMP_MIN + 1)
+
+/** @brief Classification result for a temperature outside every band */
+#define COOK_PROFILE_NO_BAND        0xFF
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief One doneness band (inclusive)
+ */
+typedef struct {
+    char name[COOK_PROFILE_BAND_NAME_LEN + 1];
+    int16_t min_c;
+    int16_t max_c;
+} cook_band_t;
+
+/**
+ * @brief A decoded and compiled profile
+ */
+typedef struct {
+    char name[COOK_PROFILE_NAME_LEN + 1];
+    int16_t safe_min_c;
+    int16_t safe_max_c;
+    uint8_t band_count;
+    cook_band_t bands[COOK_PROFILE_MAX_BANDS];
+    uint8_t band_of[COOK_PROFILE_TEMP_SPAN];    /**< Band index per degree, or COOK_PROFILE_NO_BAND */
+} cook_profile_t;
+
+/**
+ * @brief All loaded profiles and the active one
+ */
+typedef struct {
+    cook_profile_t profiles[COOK_PROFILE_MAX_PROFILES];
+    uint8_t count;
+    uint8_t active;
+} cook_profile_set_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Decode, validate and compile a profile blob
+ *
+ * On failure the set is left unchanged. The blob is decoded into a
+ * temporary heap copy of the set, freed before returning. The first profile
+ * becomes active.
+ *
+ * @param set Destination
+ * @param blob Blob bytes
+ * @param len Blob length
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_SIZE if the blob is truncated or has trailing bytes
+ * @return ESP_ERR_INVALID_CRC if the checksum does not match
+ * @return ESP_ERR_INVALID_VERSION on a bad magic or unknown version
+ * @return ESP_ERR_INVALID_ARG on empty, out-of-domain or overlapping bands
+ * @return ESP_ERR_NO_MEM if the temporary copy cannot be allocated
+ */
+esp_err_t cook_profile_load(cook_profile_set_t *set, const uint8_t *blob, size_t len);
+
+/**
+ * @brief Make a profile active
+ *
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG if index is out of range
+ */
+esp_err_t cook_profile_select(cook_profile_set_t *set, uint8_t index);
+
+/**
+ * @brief Find a profile by name (case-sensitive)
+ *
+ * @return Profile index, or -1 if not found
+ */
+int cook_profile_find(const cook_profile_set_t *set, const char *name);
+
+/**
+ * @brief Currently active profile
+ */
+static inline const cook_profile_t *cook_profile_active(const cook_profile_set_t *set)
+{
+    return &set->profiles[set->active];
+}
+
+/**
+ * @brief Band index of a temperature in degrees C
+ *
+ * @return Band index, or COOK_PROFILE_NO_BAND
+ */
+static inline uint8_t cook_profile_classify(const cook_profile_t *profile, int celsius)
+{
+    unsigned index = (unsigned)(celsius - COOK_PROFILE_TEMP_MIN);
+    return index < COOK_PROFILE_TEMP_SPAN ? profile->band_of[index] : COOK_PROFILE_NO_BAND;
+}
+
+/**
+ * @brief Band index of a temperature in centi-degrees C (rounded down to a degree)
+ */
+static inline uint8_t cook_profile_classify_centi(const cook_profile_t *profile, int32_t centi)
+{
+    int32_t celsius = centi >= 0 ? centi / 100 : -((-centi + 99) / 100);
+    return cook_profile_classify(profile, (int)celsius);
+}
+
+/**
+ * @brief Whether a temperature is inside the profile's safe range
+ */
+static inline bool cook_profile_is_safe(const cook_profile_t *profile, int celsius)
+{
+    return celsius >= profile->safe_min_c && celsius <= profile->safe_max_c;
+}
+
+/**
+ * @brief Name of a band, or "" for COOK_PROFILE_NO_BAND
+ */
+const char *cook_profile_band_name(const cook_profile_t *profile, uint8_t band);
+
+/**
+ * @brief Built-in beef/chicken/fish profiles (cook_profile_data.c)
+ */
+extern const uint8_t cook_profile_default_blob[];
+extern const size_t cook_profile_default_blob_size;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COOK_PROFILE_H */
@@ -0,0 +1,35 @@
+/**
+ * @file cook_profile_data.c
+ * @brief Built-in cooking profiles (generated)
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Generated by host/profile_tool from host/cook_profiles.txt.
+ * Edit the description and regenerate instead of changing the bytes.
+ */
+
+#include "cook_profile.h"
+
+const uint8_t cook_profile_default_blob[] = {
+    0x43, 0x50, 0x52, 0x46, 0x01, 0x03, 0x00, 0x00, 0x42, 0x45, 0x45, 0x46,
+    0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x28, 0x00, 0x04, 0x14, 0x00, 0x19,
+    0x00, 0x42, 0x4c, 0x55, 0x45, 0x20, 0x52, 0x41, 0x52, 0x45, 0x00, 0x00,
+    0x00, 0x1a, 0x00, 0x1e, 0x00, 0x4d, 0x45, 0x44, 0x49, 0x55, 0x4d, 0x20,
+    0x52, 0x41, 0x52, 0x45, 0x00, 0x1f, 0x00, 0x23, 0x00, 0x57, 0x45, 0x4c,
+    0x4c, 0x20, 0x44, 0x4f, 0x4e, 0x45, 0x00, 0x00, 0x00, 0x24, 0x00, 0x28,
+    0x00, 0x53, 0x4f, 0x4c, 0x45, 0x20, 0x52, 0x41, 0x52, 0x45, 0x00, 0x00,
+    0x00, 0x43, 0x48, 0x49, 0x43, 0x4b, 0x45, 0x4e, 0x00, 0x14, 0x00, 0x28,
+    0x00, 0x03, 0x14, 0x00, 0x20, 0x00, 0x55, 0x4e, 0x44, 0x45, 0x52, 0x43,
+    0x4f, 0x4f, 0x4b, 0x45, 0x44, 0x00, 0x21, 0x00, 0x24, 0x00, 0x4a, 0x55,
+    0x53, 0x54, 0x20, 0x44, 0x4f, 0x4e, 0x45, 0x00, 0x00, 0x00, 0x25, 0x00,
+    0x28, 0x00, 0x44, 0x52, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x46, 0x49, 0x53, 0x48, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00,
+    0x28, 0x00, 0x04, 0x14, 0x00, 0x18, 0x00, 0x52, 0x41, 0x52, 0x45, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x4d,
+    0x45, 0x44, 0x49, 0x55, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+    0x00, 0x22, 0x00, 0x46, 0x4c, 0x41, 0x4b, 0x59, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x23, 0x00, 0x28, 0x00, 0x4f, 0x56, 0x45, 0x52, 0x43,
+    0x4f, 0x4f, 0x4b, 0x45, 0x44, 0x00, 0x00, 0x7d, 0x3e, 0x72, 0x0a,
+};
+
+const size_t cook_profile_default_blob_size = sizeof(cook_profile_default_blob);
@@ -0,0 +1,294 @@
+/**
+ * @file cpu_profiler.c
+ * @brief Sliding-window CPU load from FreeRTOS run-time stats
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/idf_additions.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "cpu_profiler.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define PROFILER_RING_LEN           (CPU_PROFILER_WINDOW_S + 1)     // Window needs both ends
+#define PROFILER_ROW_COUNT          (TASK_LAYOUT_COUNT + CPU_PROFILER_SECTION_COUNT + 1)
+
+/* ==================== DATA TYPES ==================== */
+
+typedef configRUN_TIME_COUNTER_TYPE run_time_t;
+
+/**
+ * @brief Cumulative counters at one instant (differences give the window)
+ */
+typedef struct {
+    run_time_t total;                           // Run-time clock (us)
+    run_time_t idle[CPU_PROFILER_CORES];
+    run_time_t task[TASK_LAYOUT_COUNT];
+    run_time_t other;                           // Sum of the remaining non-idle tasks
+    uint32_t section[CPU_PROFILER_SECTION_COUNT];
+} profiler_snapshot_t;
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "CPU_PROFILER";
+
+static const char *const section_names[CPU_PROFILER_SECTION_COUNT] = {
+    [CPU_PROFILER_SECTION_LCD] = "lcd bus",
+};
+
+static uint32_t section_us[CPU_PROFILER_SECTION_COUNT];    // Cumulative, wraps
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static esp_timer_handle_t snapshot_timer = NULL;
+static profiler_snapshot_t ring[PROFILER_RING_LEN];
+static uint8_t ring_head = 0;           // Next slot to write
+static uint8_t ring_count = 0;
+static portMUX_TYPE ring_lock = portMUX_INITIALIZER_UNLOCKED;
+static TaskStatus_t task_status[CPU_PROFILER_MAX_TASKS];   // esp_timer task only
+#endif
+
+/* ==================== IMPLEMENTATION ==================== */
+
+void cpu_profiler_section_add(cpu_profiler_section_t section, uint32_t elapsed_us)
+{
+    if (section < CPU_PROFILER_SECTION_COUNT) {
+        __atomic_fetch_add(&section_us[section], elapsed_us, __ATOMIC_RELAXED);
+    }
+}
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static bool take_snapshot(profiler_snapshot_t *snapshot)
+{
+    memset(snapshot, 0, sizeof(*snapshot));
+
+    UBaseType_t count = uxTaskGetSystemState(task_status, CPU_PROFILER_MAX_TASKS, &snapshot->total);
+    if (count == 0) {
+        return false;       // More tasks than CPU_PROFILER_MAX_TASKS
+    }
+
+    TaskHandle_t idle[CPU_PROFILER_CORES];
+    for (int core = 0; core < CPU_PROFILER_CORES; core++) {
+        idle[core] = xTaskGetIdleTaskHandleForCore(core);
+    }
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        const TaskStatus_t *status = &task_status[i];
+        bool matched = false;
+
+        for (int core = 0; core < CPU_PROFILER_CORES && !matched; core++) {
+            if (status->xHandle == idle[core]) {
+                snapshot->idle[core] = status->ulRunTimeCounter;
+                matched = true;
+            }
+        }
+        for (int id = 0; id < TASK_LAYOUT_COUNT && !matched; id++) {
+            if (status->xHandle == task_layout_handle((task_layout_id_t)id)) {
+                snapshot->task[id] = status->ulRunTimeCounter;
+                matched = true;
+            }
+        }
+        if (!matched) {
+            snapshot->other += status->ulRunTimeCounter;
+        }
+    }
+
+    for (int section = 0; section < CPU_PROFILER_SECTION_COUNT; section++) {
+        snapshot->section[section] = __atomic_load_n(&section_us[section], __ATOMIC_RELAXED);
+    }
+    return true;
+}
+
+/**
+ * @brief Snapshot period elapsed (esp_timer task)
+ */
+static void cpu_profiler_timer_callback(void *arg)
+{
+    static uint32_t snapshots = 0;
+    profiler_snapshot_t snapshot;
+
+    if (!take_snapshot(&snapshot)) {
+        ESP_LOGW(TAG, "More than %d tasks, snapshot skipped", CPU_PROFILER_MAX_TASKS);
+        return;
+    }
+
+    portENTER_CRITICAL(&ring_lock);
+    ring[ring_head] = snapshot;
+    ring_head = (uint8_t)((ring_head + 1) % PROFILER_RING_LEN);
+    if (ring_count < PROFILER_RING_LEN) {
+        ring_count++;
+    }
+    portEXIT_CRITICAL(&ring_lock);
+
+    if (++snapshots % (CPU_PROFILER_LOG_S * 1000 / CPU_PROFILER_SAMPLE_MS) == 0) {
+        cpu_profiler_report_t report;
+        if (cpu_profiler_get(&report) == ESP_OK) {
+            cpu_profiler_log(&report);
+        }
+    }
+}
+#endif
+
+esp_err_t cpu_profiler_init(void)
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    if (snapshot_timer != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = cpu_profiler_timer_callback,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "cpu_profiler",
+    };
+    esp_err_t ret = esp_timer_create(&timer_args, &snapshot_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create snapshot timer: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ret = esp_timer_start_periodic(snapshot_timer, (uint64_t)CPU_PROFILER_SAMPLE_MS * 1000);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start snapshot timer: %s", esp_err_to_name(ret));
+        esp_timer_delete(snapshot_timer);
+        snapshot_timer = NULL;
+        return ret;
+    }
+
+    cpu_profiler_timer_callback(NULL);  // Start of the first window
+    return ESP_OK;
+#else
+    ESP_LOGW(TAG, "Enable CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS for CPU load");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+static uint16_t permille(run_time_t part, run_time_t whole)
+{
+    if (whole == 0) {
+        return 0;
+    }
+    uint64_t value = ((uint64_t)part * 1000 + whole / 2) / whole;
+    return (uint16_t)(value > 1000 ? 1000 : value);
+}
+#endif
+
+esp_err_t cpu_profiler_get(cpu_profiler_report_t *report)
+{
+#if CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+    profiler_snapshot_t oldest;
+    profiler_snapshot_t newest;
+
+    portENTER_CRITICAL(&ring_lock);
+    if (ring_count < 2) {
+        portEXIT_CRITICAL(&ring_lock);
+        return ESP_ERR_NOT_FOUND;
+    }
+    oldest = ring[(ring_head + PROFILER_RING_LEN - ring_count) % PROFILER_RING_LEN];
+    newest = ring[(ring_head + PROFILER_RING_LEN - 1) % PROFILER_RING_LEN];
+    portEXIT_CRITICAL(&ring_lock);
+
+    // Unsigned differences stay right across one counter wrap
+    run_time_t window = (run_time_t)(newest.total - oldest.total);
+    memset(report, 0, sizeof(*report));
+    report->window_ms = (uint32_t)(window / 1000);
+    for (int core = 0; core < CPU_PROFILER_CORES; core++) {
+        report->core[core] = 1000 - permille((run_time_t)(newest.idle[core] - oldest.idle[core]), window);
+    }
+    for (int id = 0; id < TASK_LAYOUT_COUNT; id++) {
+        report->task[id] = permille((run_time_t)(newest.task[id] - oldest.task[id]), window);
+    }
+    for (int section = 0; section < CPU_PROFILER_SECTION_COUNT; section++) {
+        report->section[section] = permille((run_time_t)(newest.section[section] - oldest.section[section]),
+                                            window);
+    }
+    // Tasks that ended inside the window can make this go backwards
+    report->other = newest.other > oldest.other ?
+                    permille((run_time_t)(newest.other - oldest.other), window) : 0;
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+int cpu_profiler_page_count(void)
+{
+    return 1 + (PROFILER_ROW_COUNT + 1) / 2;
+}
+
+/**
+ * @brief Label and load of row n: layout tasks, then sections, then other
+ */
+static void row_at(const cpu_profiler_report_t *report, int row, const char **name, uint16_t *load)
+{
+    if (row < TASK_LAYOUT_COUNT) {
+        *name = task_layout_entry((task_layout_id_t)row)->name;
+        *load = report->task[row];
+    } else if (row < TASK_LAYOUT_COUNT + CPU_PROFILER_SECTION_COUNT) {
+        *name = section_names[row - TASK_LAYOUT_COUNT];
+        *load = report->section[row - TASK_LAYOUT_COUNT];
+    } else {
+        *name = "other";
+        *load = report->other;
+    }
+}
+
+void cpu_profiler_format_page(const cpu_profiler_report_t *report, int page,
+                              char line0[CPU_PROFILER_LINE_LEN], char line1[CPU_PROFILER_LINE_LEN])
+{
+    if (report == NULL) {
+        snprintf(line0, CPU_PROFILER_LINE_LEN, "CPU load");
+        snprintf(line1, CPU_PROFILER_LINE_LEN, "no data yet");
+        return;
+    }
+    if (page <= 0) {
+        // Clamped so the compiler can prove each line fits
+        unsigned core0 = report->core[0] > 1000 ? 1000 : report->core[0];
+        unsigned core1 = report->core[1] > 1000 ? 1000 : report->core[1];
+        uint32_t window_s = (report->window_ms + 500) / 1000;
+        snprintf(line0, CPU_PROFILER_LINE_LEN, "Core0 %3u.%u%% %2us", core0 / 10, core0 % 10,
+                 (unsigned)(window_s > 99 ? 99 : window_s));
+        snprintf(line1, CPU_PROFILER_LINE_LEN, "Core1 %3u.%u%%", core1 / 10, core1 % 10);
+        return;
+    }
+
+    char *lines[2] = { line0, line1 };
+    for (int i = 0; i < 2; i++) {
+        int row = (page - 1) * 2 + i;
+        if (row >= PROFILER_ROW_COUNT) {
+            lines[i][0] = '\0';
+            continue;
+        }
+        const char *name;
+        uint16_t load;
+        row_at(report, row, &name, &load);
+        // Whole percent leaves room for the longest task name ("temp_monitor")
+        unsigned percent = load >= 995 ? 100 : (load + 5) / 10U;
+        snprintf(lines[i], CPU_PROFILER_LINE_LEN, "%-12.12s%3u%%", name, percent);
+    }
+}
+
+void cpu_profiler_log(const cpu_profiler_report_t *report)
+{
+    char line[256];
+    int length = snprintf(line, sizeof(line), "CPU %lu ms: core0 %u.%u%% core1 %u.%u%% |",
+                          (unsigned long)report->window_ms, report->core[0] / 10, report->core[0] % 10,
+                          report->core[1] / 10, report->core[1] % 10);
+
+    for (int row = 0; row < PROFILER_ROW_COUNT; row++) {
+        if (length < 0 || (size_t)length >= sizeof(line)) {
+            break;
+        }
+        const char *name;
+        uint16_t load;
+        row_at(report, row, &name, &load);
+        length += snprintf(line + length, sizeof(line) - length, " %s %u.%u%%", name,
+                           load / 10, load % 10);
+    }
+    ESP_LOGI(TAG, "%s", line);
+}
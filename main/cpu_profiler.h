@@ -0,0 +1,115 @@
+/**
+ * @file cpu_profiler.h
+ * @brief CPU load per core and per task over a sliding window
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Once a second a periodic esp_timer snapshots the FreeRTOS run-time
+ * counters (CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS, microseconds from
+ * esp_timer). The last CPU_PROFILER_WINDOW_S snapshots form the window:
+ *
+ * - core load: 100 % minus the share of the window that core's idle task ran
+ * - task load: run time of each task in the task layout, in % of one core
+ * - sections: code the application times itself inside a task, such as the
+ *   LCD bus writes in the UI loop (cpu_profiler_section_add())
+ * - other: every remaining task except the idle tasks
+ *
+ * The report is paged on the LCD (cpu_profiler_format_page()) and logged
+ * as one line on the serial port every CPU_PROFILER_LOG_S.
+ */
+
+#ifndef CPU_PROFILER_H
+#define CPU_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "task_layout.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define CPU_PROFILER_SAMPLE_MS      1000    // Snapshot period
+#define CPU_PROFILER_WINDOW_S       5       // Sliding window (snapshots)
+#define CPU_PROFILER_LOG_S          10      // Serial report period
+#define CPU_PROFILER_MAX_TASKS      32      // Tasks read per snapshot
+#define CPU_PROFILER_CORES          2
+#define CPU_PROFILER_LINE_LEN       17      // One LCD line and its terminator
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Code sections timed by the application
+ */
+typedef enum {
+    CPU_PROFILER_SECTION_LCD = 0,   /**< HD44780 bus writes (UI loop) */
+    CPU_PROFILER_SECTION_COUNT
+} cpu_profiler_section_t;
+
+/**
+ * @brief Loads over the window, in permille of one core
+ */
+typedef struct {
+    uint32_t window_ms;
+    uint16_t core[CPU_PROFILER_CORES];
+    uint16_t task[TASK_LAYOUT_COUNT];
+    uint16_t section[CPU_PROFILER_SECTION_COUNT];
+    uint16_t other;
+} cpu_profiler_report_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Start the periodic snapshots
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_NOT_SUPPORTED without FreeRTOS run-time stats
+ * @return ESP_ERR_INVALID_STATE if already started
+ * @return esp_timer errors otherwise
+ */
+esp_err_t cpu_profiler_init(void);
+
+/**
+ * @brief Add time spent in a section (caller's task)
+ */
+void cpu_profiler_section_add(cpu_profiler_section_t section, uint32_t elapsed_us);
+
+/**
+ * @brief Loads over the current window
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND until two snapshots exist,
+ *         ESP_ERR_NOT_SUPPORTED without run-time stats
+ */
+esp_err_t cpu_profiler_get(cpu_profiler_report_t *report);
+
+/**
+ * @brief LCD pages: cores first, then two rows per page
+ */
+int cpu_profiler_page_count(void);
+
+/**
+ * @brief Format one LCD page (16 characters per line)
+ *
+ * Core loads are shown to 0.1 %, task and section rows in whole percent
+ * next to a 12-character name.
+ *
+ * @param report Loads, or NULL while none are available
+ * @param page 0..cpu_profiler_page_count()-1
+ */
+void cpu_profiler_format_page(const cpu_profiler_report_t *report, int page,
+                              char line0[CPU_PROFILER_LINE_LEN], char line1[CPU_PROFILER_LINE_LEN]);
+
+/**
+ * @brief Log a report as one line
+ */
+void cpu_profiler_log(const cpu_profiler_report_t *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CPU_PROFILER_H */
@@ -0,0 +1,38 @@
+/**
+ * @file crc32.h
+ * @brief CRC-32 (IEEE 802.3) for on-flash and blob integrity checks
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Nibble-wise table (16 entries): small, no ROM dependency, identical on the
+ * target and in the host tools. Chain calls by passing the previous result.
+ */
+
+#ifndef CRC32_H
+#define CRC32_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stddef.h>
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Extend a CRC-32 over more data
+ *
+ * @param crc Previous CRC (0 to start)
+ * @param data Bytes to add
+ * @param len Number of bytes
+ * @return Updated CRC
+ */
+uint32_t crc32_update(uint32_t crc, const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC32_H */
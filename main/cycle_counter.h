@@ -0,0 +1,72 @@
+/**
+ * @file cycle_counter.h
+ * @brief Portable timestamp for measuring the cost of short code paths
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * On the ESP32-S3 this reads the CPU cycle counter (CCOUNT), which costs a
+ * single instruction. In the host tools and the Linux build of the firmware it
+ * falls back to the monotonic clock in nanoseconds. CYCLE_COUNTER_UNIT names the unit for reports.
+ */
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#endif
+
+#if defined(ESP_PLATFORM) && !CONFIG_IDF_TARGET_LINUX
+#define CYCLE_COUNTER_CCOUNT    1
+#include "esp_cpu.h"
+#else
+#include <time.h>
+#endif
+
+/* ==================== IMPLEMENTATION ==================== */
+
+#ifdef CYCLE_COUNTER_CCOUNT
+
+#define CYCLE_COUNTER_UNIT  "cycles"
+
+/**
+ * @brief Current timestamp (wraps; subtract as uint32_t)
+ */
+static inline uint32_t cycle_counter_now(void)
+{
+    return (uint32_t)esp_cpu_get_cycle_count();
+}
+
+#else
+
+#define CYCLE_COUNTER_UNIT  "ns"
+
+/**
+ * @brief Monotonic clock in nanoseconds (host only; the host tools time with it)
+ */
+static inline uint64_t host_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static inline uint32_t cycle_counter_now(void)
+{
+    return (uint32_t)host_now_ns();
+}
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYCLE_COUNTER_H */
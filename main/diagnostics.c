@@ -0,0 +1,188 @@
+/**
+ * @file diagnostics.c
+ * @brief Stack and heap watermark sampling
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "diagnostics.h"
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "DIAGNOSTICS";
+
+static const uint32_t heap_caps[DIAGNOSTICS_HEAP_COUNT] = {
+    [DIAGNOSTICS_HEAP_INTERNAL] = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    [DIAGNOSTICS_HEAP_DMA] = MALLOC_CAP_DMA,
+    [DIAGNOSTICS_HEAP_PSRAM] = MALLOC_CAP_SPIRAM,
+};
+static const char *const heap_names[DIAGNOSTICS_HEAP_COUNT] = { "int", "dma", "psram" };
+
+static esp_timer_handle_t sample_timer = NULL;
+static diagnostics_sample_t history[DIAGNOSTICS_HISTORY_LEN];
+static uint8_t history_head = 0;        // Next slot to write
+static uint8_t history_count = 0;
+static portMUX_TYPE history_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Sampling period elapsed (esp_timer task)
+ */
+static void diagnostics_timer_callback(void *arg)
+{
+    diagnostics_sample_t sample;
+    char line[DIAGNOSTICS_LINE_LEN];
+
+    diagnostics_sample(&sample);
+    diagnostics_format(&sample, line, sizeof(line));
+    ESP_LOGI(TAG, "%s", line);
+
+    for (int id = 0; id < TASK_LAYOUT_COUNT; id++) {
+        if (sample.stack_free[id] < DIAGNOSTICS_STACK_WARN_BYTES) {
+            ESP_LOGW(TAG, "Task %s has only %lu bytes of stack left",
+                     task_layout_entry((task_layout_id_t)id)->name,
+                     (unsigned long)sample.stack_free[id]);
+        }
+    }
+}
+
+esp_err_t diagnostics_init(uint32_t period_ms)
+{
+    if (sample_timer != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = diagnostics_timer_callback,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "diagnostics",
+    };
+    esp_err_t ret = esp_timer_create(&timer_args, &sample_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create sampling timer: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ret = esp_timer_start_periodic(sample_timer, (uint64_t)period_ms * 1000);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start sampling timer: %s", esp_err_to_name(ret));
+        esp_timer_delete(sample_timer);
+        sample_timer = NULL;
+        return ret;
+    }
+
+    diagnostics_timer_callback(NULL);   // Boot-time baseline
+    return ESP_OK;
+}
+
+void diagnostics_sample(diagnostics_sample_t *sample)
+{
+    diagnostics_sample_t now = {
+        .time_ms = (uint32_t)(esp_timer_get_time() / 1000),
+    };
+
+    // ESP-IDF reports the high-water mark in bytes
+    for (int id = 0; id < TASK_LAYOUT_COUNT; id++) {
+        TaskHandle_t handle = task_layout_handle((task_layout_id_t)id);
+        now.stack_free[id] = handle != NULL ? uxTaskGetStackHighWaterMark(handle)
+                                            : DIAGNOSTICS_NO_TASK;
+    }
+    for (int heap = 0; heap < DIAGNOSTICS_HEAP_COUNT; heap++) {
+        now.heap[heap].free_bytes = heap_caps_get_free_size(heap_caps[heap]);
+        now.heap[heap].min_free_bytes = heap_caps_get_minimum_free_size(heap_caps[heap]);
+        now.heap[heap].largest_block = heap_caps_get_largest_free_block(heap_caps[heap]);
+    }
+
+    portENTER_CRITICAL(&history_lock);
+    history[history_head] = now;
+    history_head = (uint8_t)((history_head + 1) % DIAGNOSTICS_HISTORY_LEN);
+    if (history_count < DIAGNOSTICS_HISTORY_LEN) {
+        history_count++;
+    }
+    portEXIT_CRITICAL(&history_lock);
+
+    if (sample != NULL) {
+        *sample = now;
+    }
+}
+
+esp_err_t diagnostics_latest(diagnostics_sample_t *sample)
+{
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+
+    portENTER_CRITICAL(&history_lock);
+    if (history_count > 0) {
+        *sample = history[(history_head + DIAGNOSTICS_HISTORY_LEN - 1) % DIAGNOSTICS_HISTORY_LEN];
+        ret = ESP_OK;
+    }
+    portEXIT_CRITICAL(&history_lock);
+    return ret;
+}
+
+size_t diagnostics_history(diagnostics_sample_t *samples, size_t max)
+{
+    portENTER_CRITICAL(&history_lock);
+    size_t count = history_count < max ? history_count : max;
+    // Oldest first; when max is short, keep the newest
+    size_t start = (history_head + DIAGNOSTICS_HISTORY_LEN - count) % DIAGNOSTICS_HISTORY_LEN;
+    for (size_t i = 0; i < count; i++) {
+        samples[i] = history[(start + i) % DIAGNOSTICS_HISTORY_LEN];
+    }
+    portEXIT_CRITICAL(&history_lock);
+    return count;
+}
+
+uint32_t diagnostics_min_stack_free(task_layout_id_t id)
+{
+    uint32_t min_free = DIAGNOSTICS_NO_TASK;
+
+    if (id >= TASK_LAYOUT_COUNT) {
+        return min_free;
+    }
+    portENTER_CRITICAL(&history_lock);
+    for (uint8_t i = 0; i < history_count; i++) {
+        if (history[i].stack_free[id] < min_free) {
+            min_free = history[i].stack_free[id];
+        }
+    }
+    portEXIT_CRITICAL(&history_lock);
+    return min_free;
+}
+
+int diagnostics_format(const diagnostics_sample_t *sample, char *buffer, size_t size)
+{
+    int length = snprintf(buffer, size, "stack");
+
+    for (int id = 0; id < TASK_LAYOUT_COUNT; id++) {
+        if (length < 0 || (size_t)length >= size) {
+            return length;
+        }
+        const char *name = task_layout_entry((task_layout_id_t)id)->name;
+        if (sample->stack_free[id] == DIAGNOSTICS_NO_TASK) {
+            length += snprintf(buffer + length, size - length, " %s -", name);
+        } else {
+            length += snprintf(buffer + length, size - length, " %s %lu", name,
+                               (unsigned long)sample->stack_free[id]);
+        }
+    }
+    for (int heap = 0; heap < DIAGNOSTICS_HEAP_COUNT; heap++) {
+        const diagnostics_heap_stats_t *stats = &sample->heap[heap];
+        if (length < 0 || (size_t)length >= size) {
+            return length;
+        }
+        if (stats->free_bytes == 0 && stats->min_free_bytes == 0) {
+            continue;       // No such memory (PSRAM not fitted)
+        }
+        length += snprintf(buffer + length, size - length, " | %s %luk min %luk blk %luk",
+                           heap_names[heap], (unsigned long)(stats->free_bytes / 1024),
+                           (unsigned long)(stats->min_free_bytes / 1024),
+                           (unsigned long)(stats->largest_block / 1024));
+    }
+    return length;
+}
@@ -0,0 +1,122 @@
+/**
+ * @file diagnostics.h
+ * @brief Periodic stack and heap watermarks for right-sizing memory
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * A periodic esp_timer samples:
+ * - the stack high-water mark of every task in the task layout: the least
+ *   free stack the task has ever had, in bytes
+ * - per heap capability (internal, DMA-capable, PSRAM): bytes free now, the
+ *   lowest free ever, and the largest free block (fragmentation)
+ *
+ * The last DIAGNOSTICS_HISTORY_LEN samples are kept in a ring. Each sample
+ * is logged as one compact line, and a warning names any task with less
+ * than DIAGNOSTICS_STACK_WARN_BYTES left.
+ */
+
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "task_layout.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define DIAGNOSTICS_PERIOD_MS       10000   // Sampling period
+#define DIAGNOSTICS_HISTORY_LEN     12      // Samples kept (2 minutes)
+#define DIAGNOSTICS_STACK_WARN_BYTES 512    // Less free stack than this is logged as a warning
+#define DIAGNOSTICS_NO_TASK         UINT32_MAX  // Stack free of a task not created (yet)
+#define DIAGNOSTICS_LINE_LEN        256     // Enough for diagnostics_format()
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Heaps reported, by capability
+ */
+typedef enum {
+    DIAGNOSTICS_HEAP_INTERNAL = 0,  /**< MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT */
+    DIAGNOSTICS_HEAP_DMA,           /**< MALLOC_CAP_DMA */
+    DIAGNOSTICS_HEAP_PSRAM,         /**< MALLOC_CAP_SPIRAM (all zero without PSRAM) */
+    DIAGNOSTICS_HEAP_COUNT
+} diagnostics_heap_t;
+
+/**
+ * @brief One heap's counters
+ */
+typedef struct {
+    uint32_t free_bytes;
+    uint32_t min_free_bytes;        /**< Lowest free since boot */
+    uint32_t largest_block;         /**< Largest single allocation possible now */
+} diagnostics_heap_stats_t;
+
+/**
+ * @brief One sample
+ */
+typedef struct {
+    uint32_t time_ms;
+    uint32_t stack_free[TASK_LAYOUT_COUNT];     /**< High-water mark, bytes */
+    diagnostics_heap_stats_t heap[DIAGNOSTICS_HEAP_COUNT];
+} diagnostics_sample_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Take a first sample and start periodic sampling
+ *
+ * Call after the tasks are created.
+ *
+ * @param period_ms Sampling period (DIAGNOSTICS_PERIOD_MS)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if already started
+ * @return esp_timer errors otherwise
+ */
+esp_err_t diagnostics_init(uint32_t period_ms);
+
+/**
+ * @brief Take a sample now and add it to the history
+ *
+ * @param sample Copy of the sample (may be NULL)
+ */
+void diagnostics_sample(diagnostics_sample_t *sample);
+
+/**
+ * @brief Most recent sample
+ *
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND before the first sample
+ */
+esp_err_t diagnostics_latest(diagnostics_sample_t *sample);
+
+/**
+ * @brief Copy the history, oldest sample first
+ *
+ * @return Samples copied
+ */
+size_t diagnostics_history(diagnostics_sample_t *samples, size_t max);
+
+/**
+ * @brief Lowest free stack of a task over the history (its worst high-water mark)
+ */
+uint32_t diagnostics_min_stack_free(task_layout_id_t id);
+
+/**
+ * @brief Format a sample as one compact line
+ *
+ * Example: "stack heater_ctrl 1892 ... | int 214k min 198k blk 110k | dma ..."
+ *
+ * @return Characters written (as snprintf)
+ */
+int diagnostics_format(const diagnostics_sample_t *sample, char *buffer, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DIAGNOSTICS_H */
@@ -0,0 +1,168 @@
+/**
+ * @file doneness.c
+ * @brief Time-to-doneness prediction from a sliding linear regression
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdbool.h>
+#include <string.h>
+#include "doneness.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static void sums_add(doneness_estimator_t *est, int64_t t, int64_t y)
+{
+    est->sum_t += t;
+    est->sum_y += y;
+    est->sum_tt += t * t;
+    est->sum_ty += t * y;
+}
+
+static void sums_remove(doneness_estimator_t *est, int64_t t, int64_t y)
+{
+    est->sum_t -= t;
+    est->sum_y -= y;
+    est->sum_tt -= t * t;
+    est->sum_ty -= t * y;
+}
+
+/**
+ * @brief Move the time origin forward by d without touching the samples
+ *
+ * With t' = t - d: sum(t') = sum(t) - n*d, sum(t'^2) = sum(t^2) - 2d*sum(t)
+ * + n*d^2 and sum(t'y) = sum(ty) - d*sum(y).
+ */
+static void sums_rebase(doneness_estimator_t *est, int64_t d)
+{
+    const int64_t n = est->count;
+
+    est->sum_tt += -2 * d * est->sum_t + n * d * d;
+    est->sum_t -= n * d;
+    est->sum_ty -= d * est->sum_y;
+    est->base_ms += d;
+}
+
+static uint16_t oldest_index(const doneness_estimator_t *est)
+{
+    return (uint16_t)((est->head + DONENESS_WINDOW_SAMPLES - est->count) % DONENESS_WINDOW_SAMPLES);
+}
+
+static uint16_t newest_index(const doneness_estimator_t *est)
+{
+    return (uint16_t)((est->head + DONENESS_WINDOW_SAMPLES - 1) % DONENESS_WINDOW_SAMPLES);
+}
+
+void doneness_init(doneness_estimator_t *est)
+{
+    memset(est, 0, sizeof(*est));
+}
+
+void doneness_push(doneness_estimator_t *est, int64_t time_ms, int32_t centi)
+{
+    if (est->count == 0) {
+        est->base_ms = time_ms;
+    }
+
+    if (est->count == DONENESS_WINDOW_SAMPLES) {
+        const uint16_t old = est->head;     // Full ring: the slot to overwrite is the oldest
+        sums_remove(est, est->time_ms[old] - est->base_ms, est->centi[old]);
+        est->count--;
+    }
+
+    est->time_ms[est->head] = time_ms;
+    est->centi[est->head] = centi;
+    est->head = (uint16_t)((est->head + 1) % DONENESS_WINDOW_SAMPLES);
+    est->count++;
+    sums_add(est, time_ms - est->base_ms, centi);
+
+    // Keep the origin at the oldest sample so relative times span one window
+    const int64_t shift = est->time_ms[oldest_index(est)] - est->base_ms;
+    if (shift != 0) {
+        sums_rebase(est, shift);
+    }
+}
+
+esp_err_t doneness_slope(const doneness_estimator_t *est, float *centi_per_ms)
+{
+    const int64_t n = est->count;
+    const int64_t denominator = n * est->sum_tt - est->sum_t * est->sum_t;
+
+    if (n < 2 || denominator <= 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    *centi_per_ms = (float)(n * est->sum_ty - est->sum_t * est->sum_y) / (float)denominator;
+    return ESP_OK;
+}
+
+/**
+ * @brief Seconds until the fit reaches `target`, or DONENESS_UNKNOWN
+ */
+static int32_t seconds_until(float fitted, float centi_per_s, int32_t target)
+{
+    float seconds = ((float)target - fitted) / centi_per_s;
+
+    if (seconds < 0.0f || seconds > (float)DONENESS_MAX_SECONDS) {
+        return DONENESS_UNKNOWN;
+    }
+    return (int32_t)(seconds + 0.5f);
+}
+
+esp_err_t doneness_predict(const doneness_estimator_t *est, int32_t band_min_centi,
+                           int32_t band_max_centi, doneness_prediction_t *prediction)
+{
+    if (est == NULL || prediction == NULL || band_min_centi > band_max_centi) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(prediction, 0, sizeof(*prediction));
+    prediction->state = DONENESS_WARMING_UP;
+    prediction->seconds_to_enter = DONENESS_UNKNOWN;
+    prediction->seconds_to_leave = DONENESS_UNKNOWN;
+
+    float slope;
+    if (est->count < DONENESS_MIN_SAMPLES || doneness_slope(est, &slope) != ESP_OK) {
+        return ESP_OK;
+    }
+
+    // Evaluate the fit at the newest reading: y = mean_y + slope * (t - mean_t)
+    const float n = (float)est->count;
+    const float t_newest = (float)(est->time_ms[newest_index(est)] - est->base_ms);
+    const float fitted = ((float)est->sum_y + slope * (n * t_newest - (float)est->sum_t)) / n;
+    const float centi_per_s = slope * 1000.0f;
+    const float centi_per_min = slope * 60000.0f;
+    const bool heating = centi_per_min >= (float)DONENESS_MIN_SLOPE;
+
+    prediction->fitted_centi = (int32_t)(fitted >= 0.0f ? fitted + 0.5f : fitted - 0.5f);
+    prediction->slope_centi_per_min = (int32_t)(centi_per_min >= 0.0f ? centi_per_min + 0.5f
+                                                                       : centi_per_min - 0.5f);
+
+    if (fitted > (float)band_max_centi) {
+        prediction->state = DONENESS_PAST;
+    } else if (fitted >= (float)band_min_centi) {
+        prediction->state = DONENESS_IN_BAND;
+        prediction->seconds_to_enter = 0;
+        if (heating) {
+            prediction->seconds_to_leave = seconds_until(fitted, centi_per_s, band_max_centi);
+        }
+    } else if (heating) {
+        prediction->state = DONENESS_APPROACHING;
+        prediction->seconds_to_enter = seconds_until(fitted, centi_per_s, band_min_centi);
+        prediction->seconds_to_leave = seconds_until(fitted, centi_per_s, band_max_centi);
+    } else {
+        prediction->state = DONENESS_STALLED;
+    }
+    return ESP_OK;
+}
+
+const char *doneness_state_name(doneness_state_t state)
+{
+    switch (state) {
+        case DONENESS_WARMING_UP:  return "warming up";
+        case DONENESS_APPROACHING: return "approaching";
+        case DONENESS_STALLED:     return "stalled";
+        case DONENESS_IN_BAND:     return "in band";
+        case DONENESS_PAST:        return "past";
+        default:                   return "unknown";
+    }
+}
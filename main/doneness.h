@@ -0,0 +1,127 @@
+/**
+ * @file doneness.h
+ * @brief Time-to-doneness prediction from a sliding linear regression
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Fits temperature = a + b * time over the last DONENESS_WINDOW_SAMPLES
+ * readings and extrapolates when the reading enters and leaves a target band.
+ *
+ * The fit keeps the running sums n, sum(t), sum(y), sum(t*t) and sum(t*y) in
+ * 64-bit integers. A push adds the new sample and subtracts the one leaving
+ * the window, so it is O(1) and the window is never rescanned; the ring only
+ * remembers each sample so it can be subtracted later. Times are kept
+ * relative to the oldest sample in the window; moving that origin is an O(1)
+ * shift of the sums, so the integers never grow with uptime and stay exact.
+ *
+ * The module does no locking; the caller serialises push and predict.
+ */
+
+#ifndef DONENESS_H
+#define DONENESS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define DONENESS_WINDOW_SAMPLES     120     // 60 s at the 500 ms monitoring rate
+#define DONENESS_MIN_SAMPLES        10      // Readings needed before predicting
+#define DONENESS_MIN_SLOPE          5       // Centi-degrees per minute that count as heating
+#define DONENESS_MAX_SECONDS        (24 * 3600)     // Longer predictions are reported as unknown
+#define DONENESS_UNKNOWN            (-1)    // Seconds value when no prediction is possible
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Where the reading is relative to the target band
+ */
+typedef enum {
+    DONENESS_WARMING_UP = 0,    /**< Not enough readings yet */
+    DONENESS_APPROACHING,       /**< Below the band and heating */
+    DONENESS_STALLED,           /**< Below the band, not heating */
+    DONENESS_IN_BAND,           /**< Inside the band */
+    DONENESS_PAST,              /**< Above the band */
+} doneness_state_t;
+
+/**
+ * @brief Prediction result (fixed-size fields, logged as-is)
+ */
+typedef struct {
+    uint8_t state;              /**< doneness_state_t */
+    uint8_t reserved[3];
+    int32_t fitted_centi;       /**< Regression value at the newest reading */
+    int32_t slope_centi_per_min;
+    int32_t seconds_to_enter;   /**< 0 once in the band, DONENESS_UNKNOWN if never */
+    int32_t seconds_to_leave;   /**< DONENESS_UNKNOWN if never */
+} doneness_prediction_t;
+
+/**
+ * @brief Estimator state
+ */
+typedef struct {
+    int64_t time_ms[DONENESS_WINDOW_SAMPLES];   /**< Absolute time of each sample */
+    int32_t centi[DONENESS_WINDOW_SAMPLES];
+    uint16_t head;              /**< Next slot to write */
+    uint16_t count;             /**< Samples in the window */
+
+    int64_t base_ms;            /**< Origin of the relative times in the sums */
+    int64_t sum_t;
+    int64_t sum_y;
+    int64_t sum_tt;
+    int64_t sum_ty;
+} doneness_estimator_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Clear the window
+ */
+void doneness_init(doneness_estimator_t *est);
+
+/**
+ * @brief Add a reading, dropping the oldest one once the window is full
+ *
+ * @param est Estimator
+ * @param time_ms Reading time (monotonic, milliseconds)
+ * @param centi Temperature in centi-degrees C
+ */
+void doneness_push(doneness_estimator_t *est, int64_t time_ms, int32_t centi);
+
+/**
+ * @brief Slope of the current fit
+ *
+ * @param est Estimator
+ * @param centi_per_ms Receives the slope in centi-degrees per millisecond
+ * @return ESP_OK, or ESP_ERR_INVALID_STATE with fewer than two distinct times
+ */
+esp_err_t doneness_slope(const doneness_estimator_t *est, float *centi_per_ms);
+
+/**
+ * @brief Predict when the reading enters and leaves [band_min, band_max]
+ *
+ * @param est Estimator
+ * @param band_min_centi Lower edge of the target band
+ * @param band_max_centi Upper edge of the target band
+ * @param prediction Receives the result
+ * @return ESP_OK on success (state DONENESS_WARMING_UP until enough data)
+ * @return ESP_ERR_INVALID_ARG on NULL pointers or an empty band
+ */
+esp_err_t doneness_predict(const doneness_estimator_t *est, int32_t band_min_centi,
+                           int32_t band_max_centi, doneness_prediction_t *prediction);
+
+/**
+ * @brief Short state name for logs
+ */
+const char *doneness_state_name(doneness_state_t state);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DONENESS_H */
@@ -0,0 +1,35 @@
+/**
+ * @file encoder_accel.c
+ * @brief Hardware-independent rotary encoder acceleration implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include "encoder_accel.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+int16_t encoder_accel_step(encoder_accel_t *accel, const encoder_accel_config_t *config,
+                           int8_t direction, uint64_t now_us)
+{
+    uint32_t multiplier = 1;
+    int8_t dir = direction < 0 ? -1 : 1;
+
+    if (accel->last_direction == dir && config->max_multiplier > 1) {
+        uint64_t interval = now_us - accel->last_detent_us;
+
+        if (interval <= config->fast_interval_us) {
+            multiplier = config->max_multiplier;
+        } else if (interval < config->slow_interval_us) {
+            // Linear ramp between the slow and fast thresholds
+            uint32_t span = config->slow_interval_us - config->fast_interval_us;
+            uint32_t into = config->slow_interval_us - (uint32_t)interval;
+            multiplier = 1 + (into * (uint32_t)(config->max_multiplier - 1) + span / 2) / span;
+        }
+    }
+
+    accel->last_detent_us = now_us;
+    accel->last_direction = dir;
+
+    return (int16_t)(dir * (int16_t)multiplier);
+}
@@ -0,0 +1,68 @@
+/**
+ * @file encoder_accel.h
+ * @brief Hardware-independent rotary encoder acceleration
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Converts detents reported by the pulse counter into value steps. Slow
+ * turning moves one step per detent; spinning the knob quickly multiplies
+ * the step so large temperature changes need only a short flick. The logic is
+ * free of PCNT and FreeRTOS dependencies so the host encoder fake can drive it.
+ */
+
+#ifndef ENCODER_ACCEL_H
+#define ENCODER_ACCEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Acceleration curve configuration
+ *
+ * Detent intervals at or above slow_interval_us give one step; intervals at or
+ * below fast_interval_us give max_multiplier steps; in between the multiplier
+ * is interpolated linearly.
+ */
+typedef struct {
+    uint32_t slow_interval_us;  /**< Detent interval treated as deliberate turning */
+    uint32_t fast_interval_us;  /**< Detent interval treated as a fast spin */
+    uint8_t max_multiplier;     /**< Steps per detent at full speed (1 disables acceleration) */
+} encoder_accel_config_t;
+
+/**
+ * @brief Acceleration state, zero-initialise before use
+ */
+typedef struct {
+    uint64_t last_detent_us;    /**< Time of the previous detent */
+    int8_t last_direction;      /**< Direction of the previous detent (-1, 0, +1) */
+} encoder_accel_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Turn one detent into a signed number of value steps
+ *
+ * A change of direction always yields a single step so the user can fine-tune
+ * after overshooting. Safe to call from interrupt context.
+ *
+ * @param accel Acceleration state
+ * @param config Acceleration curve
+ * @param direction +1 for clockwise, -1 for counter-clockwise
+ * @param now_us Timestamp of the detent in microseconds
+ * @return Signed step count (never zero)
+ */
+int16_t encoder_accel_step(encoder_accel_t *accel, const encoder_accel_config_t *config,
+                           int8_t direction, uint64_t now_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ENCODER_ACCEL_H */
@@ -0,0 +1,163 @@
+/**
+ * @file event_bus.c
+ * @brief Queue-set event bus implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "event_bus.h"
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "EVENT_BUS";
+
+static QueueSetHandle_t bus_set = NULL;
+static uint32_t bus_capacity = 0;           // Queue slots the set was sized for
+static uint32_t bus_used = 0;
+static QueueSetMemberHandle_t bus_members[EVENT_BUS_SOURCE_COUNT];
+static SemaphoreHandle_t bus_signals[EVENT_BUS_SOURCE_COUNT];   // NULL for queue sources
+static uint32_t bus_counts[EVENT_BUS_SOURCE_COUNT];             // Written by the waiting task only
+static esp_timer_handle_t ui_timer = NULL;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static bool is_signal_source(event_bus_source_t source)
+{
+    return source == EVENT_BUS_READINGS || source == EVENT_BUS_UI_TIMER ||
+           source == EVENT_BUS_REDRAW;
+}
+
+/**
+ * @brief UI timer expired (esp_timer task)
+ */
+static void ui_timer_callback(void *arg)
+{
+    event_bus_signal(EVENT_BUS_UI_TIMER);
+}
+
+esp_err_t event_bus_init(uint32_t queue_capacity)
+{
+    if (bus_set != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Each binary semaphore takes one slot in the set on top of the queues
+    uint32_t signal_count = 0;
+    for (int source = 0; source < EVENT_BUS_SOURCE_COUNT; source++) {
+        signal_count += is_signal_source((event_bus_source_t)source) ? 1 : 0;
+    }
+    bus_set = xQueueCreateSet(queue_capacity + signal_count);
+    if (bus_set == NULL) {
+        ESP_LOGE(TAG, "Failed to create queue set");
+        return ESP_ERR_NO_MEM;
+    }
+    bus_capacity = queue_capacity;
+    bus_used = 0;
+
+    for (int source = 0; source < EVENT_BUS_SOURCE_COUNT; source++) {
+        bus_members[source] = NULL;
+        bus_signals[source] = NULL;
+        bus_counts[source] = 0;
+        if (!is_signal_source((event_bus_source_t)source)) {
+            continue;
+        }
+        bus_signals[source] = xSemaphoreCreateBinary();
+        if (bus_signals[source] == NULL ||
+            xQueueAddToSet(bus_signals[source], bus_set) != pdPASS) {
+            ESP_LOGE(TAG, "Failed to add signal source %d", source);
+            return ESP_ERR_NO_MEM;
+        }
+        bus_members[source] = bus_signals[source];
+    }
+
+    const esp_timer_create_args_t timer_args = {
+        .callback = ui_timer_callback,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "ui_timer",
+    };
+    if (esp_timer_create(&timer_args, &ui_timer) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create UI timer");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+esp_err_t event_bus_add_queue(event_bus_source_t source, QueueHandle_t queue, uint32_t length)
+{
+    if (source >= EVENT_BUS_SOURCE_COUNT || is_signal_source(source) || queue == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (bus_set == NULL || bus_members[source] != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (bus_used + length > bus_capacity) {
+        ESP_LOGE(TAG, "Queue set full: %lu + %lu slots > %lu", (unsigned long)bus_used,
+                 (unsigned long)length, (unsigned long)bus_capacity);
+        return ESP_ERR_NO_MEM;
+    }
+    // FreeRTOS refuses queues that already hold items
+    if (xQueueAddToSet(queue, bus_set) != pdPASS) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    bus_members[source] = queue;
+    bus_used += length;
+    return ESP_OK;
+}
+
+void event_bus_signal(event_bus_source_t source)
+{
+    if (source < EVENT_BUS_SOURCE_COUNT && bus_signals[source] != NULL) {
+        xSemaphoreGive(bus_signals[source]);    // Fails harmlessly if already pending
+    }
+}
+
+esp_err_t event_bus_start_ui_timer(uint32_t delay_ms)
+{
+    if (ui_timer == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (esp_timer_is_active(ui_timer)) {
+        esp_timer_stop(ui_timer);
+    }
+    return esp_timer_start_once(ui_timer, (uint64_t)delay_ms * 1000);
+}
+
+void event_bus_stop_ui_timer(void)
+{
+    if (ui_timer != NULL && esp_timer_is_active(ui_timer)) {
+        esp_timer_stop(ui_timer);
+    }
+}
+
+event_bus_source_t event_bus_wait(TickType_t timeout)
+{
+    if (bus_set == NULL) {
+        return EVENT_BUS_TIMEOUT;
+    }
+
+    QueueSetMemberHandle_t member = xQueueSelectFromSet(bus_set, timeout);
+    if (member == NULL) {
+        return EVENT_BUS_TIMEOUT;
+    }
+    for (int source = 0; source < EVENT_BUS_SOURCE_COUNT; source++) {
+        if (bus_members[source] != member) {
+            continue;
+        }
+        if (bus_signals[source] != NULL) {
+            xSemaphoreTake(bus_signals[source], 0);
+        }
+        bus_counts[source]++;
+        return (event_bus_source_t)source;
+    }
+    return EVENT_BUS_TIMEOUT;
+}
+
+uint32_t event_bus_count(event_bus_source_t source)
+{
+    return source < EVENT_BUS_SOURCE_COUNT ? bus_counts[source] : 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file event_bus.h
+ * @brief One blocking wait for everything the main loop reacts to
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Every source the UI handles is a member of one FreeRTOS queue set, so the
+ * main task sleeps in event_bus_wait() until one of them has work and wakes
+ * as soon as it does, instead of polling the key queue and sleeping between
+ * passes:
+ *
+ * - queue sources (keys and encoder turns, alarm events): the producer's own
+ *   queue joins the set; when event_bus_wait() names it, the caller receives
+ *   exactly one item from that queue
+ * - signal sources (new readings, UI timer, redraw): a binary semaphore per source
+ *   that event_bus_wait() takes itself; signals raised while the previous
+ *   one is pending collapse into one
+ *
+ * The UI timer is a one-shot esp_timer for screens shown for a while (the
+ * status screen) that used to block the loop in vTaskDelay().
+ */
+
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_err.h"
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Sources the main loop waits on
+ */
+typedef enum {
+    EVENT_BUS_KEY = 0,          /**< Queue: key_event_t from the keypad and encoder */
+    EVENT_BUS_ALARM,            /**< Queue: temp_alarm_event_t from the monitoring task */
+    EVENT_BUS_READINGS,         /**< Signal: new readings and prediction published */
+    EVENT_BUS_UI_TIMER,         /**< Signal: one-shot UI timer expired */
+    EVENT_BUS_REDRAW,           /**< Signal: LCD was borrowed (console benchmark), redraw it */
+    EVENT_BUS_SOURCE_COUNT,
+    EVENT_BUS_TIMEOUT = EVENT_BUS_SOURCE_COUNT  /**< event_bus_wait() timed out */
+} event_bus_source_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Create the queue set, the signal sources and the UI timer
+ *
+ * @param queue_capacity Sum of the lengths of the queues that will be added
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if already initialized
+ * @return ESP_ERR_NO_MEM if the set, a semaphore or the timer cannot be created
+ *         (the bus is then unusable; sources cannot be removed from a set)
+ */
+esp_err_t event_bus_init(uint32_t queue_capacity);
+
+/**
+ * @brief Add a producer's queue as a source
+ *
+ * The queue must still be empty: add it before anything can post to it.
+ *
+ * @param source EVENT_BUS_KEY or EVENT_BUS_ALARM
+ * @param queue Queue to add
+ * @param length Its length (counted against queue_capacity)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG for a signal source or a NULL queue
+ * @return ESP_ERR_INVALID_STATE if not initialized, already added or not empty
+ * @return ESP_ERR_NO_MEM if the set's capacity would be exceeded
+ */
+esp_err_t event_bus_add_queue(event_bus_source_t source, QueueHandle_t queue, uint32_t length);
+
+/**
+ * @brief Raise a signal source from task context
+ */
+void event_bus_signal(event_bus_source_t source);
+
+/**
+ * @brief Start (or restart) the one-shot UI timer
+ *
+ * @param delay_ms Time until EVENT_BUS_UI_TIMER is signalled
+ * @return ESP_OK on success, esp_timer errors otherwise
+ */
+esp_err_t event_bus_start_ui_timer(uint32_t delay_ms);
+
+/**
+ * @brief Cancel the UI timer if it is running
+ */
+void event_bus_stop_ui_timer(void);
+
+/**
+ * @brief Block until a source has work
+ *
+ * For a queue source the caller must then receive one item from that
+ * queue; a signal source has already been consumed.
+ *
+ * @param timeout Ticks to wait (portMAX_DELAY to wait forever)
+ * @return Source with work, or EVENT_BUS_TIMEOUT (also at once if not initialized)
+ */
+event_bus_source_t event_bus_wait(TickType_t timeout);
+
+/**
+ * @brief Wake-ups delivered for a source since boot
+ */
+uint32_t event_bus_count(event_bus_source_t source);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_BUS_H */
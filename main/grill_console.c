@@ -0,0 +1,387 @@
+/**
+ * @file grill_console.c
+ * @brief Serial shell for live tuning, driver statistics and micro-benchmarks
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <inttypes.h>
+#include "cycle_counter.h"
+#include "grill_console.h"
+
+#ifdef ESP_PLATFORM
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_console.h"
+#endif
+#endif
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+static int cmd_get(int argc, char **argv);
+static int cmd_set(int argc, char **argv);
+static int cmd_stats(int argc, char **argv);
+static int cmd_bench(int argc, char **argv);
+#if !defined(ESP_PLATFORM) || CONFIG_IDF_TARGET_LINUX
+static int cmd_help(int argc, char **argv);
+#endif
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+#ifdef ESP_PLATFORM
+static const char *TAG = "CONSOLE";
+#endif
+
+static const grill_console_cmd_t console_cmds[] = {
+    { "get",   "[name]",        "Show parameters and their ranges", cmd_get },
+    { "set",   "<name> <value>", "Change a parameter", cmd_set },
+    { "stats", "[name]",        "Print driver and loop statistics", cmd_stats },
+    { "bench", "<name>|all [runs]", "Time code paths: min / median / p99 / max", cmd_bench },
+#if !defined(ESP_PLATFORM) || CONFIG_IDF_TARGET_LINUX
+    { "help",  "",              "List the commands", cmd_help },
+#endif
+};
+
+#define CONSOLE_CMD_COUNT   (sizeof(console_cmds) / sizeof(console_cmds[0]))
+
+static const grill_console_config_t *console_config = NULL;
+static const grill_console_cmd_t *extra_cmds = NULL;
+static size_t extra_cmd_count = 0;
+static uint32_t bench_timings[GRILL_CONSOLE_BENCH_MAX_RUNS];   // Console task only
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static const grill_console_param_t *find_param(const char *name)
+{
+    for (size_t i = 0; i < console_config->param_count; i++) {
+        if (strcmp(console_config->params[i].name, name) == 0) {
+            return &console_config->params[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Parse a whole decimal argument
+ */
+static bool parse_int(const char *text, long *value)
+{
+    char *end;
+    *value = strtol(text, &end, 10);
+    return end != text && *end == '\0';
+}
+
+static void print_param(const grill_console_param_t *param)
+{
+    printf("%-14s %8" PRId32 "  [%" PRId32 "..%" PRId32 "]%s  %s\n", param->name, param->get(),
+           param->min, param->max, param->set == NULL ? " ro" : "", param->help);
+}
+
+static int cmd_get(int argc, char **argv)
+{
+    if (argc > 2) {
+        printf("usage: get [name]\n");
+        return 1;
+    }
+    if (argc == 2) {
+        const grill_console_param_t *param = find_param(argv[1]);
+        if (param == NULL) {
+            printf("unknown parameter '%s'\n", argv[1]);
+            return 1;
+        }
+        print_param(param);
+        return 0;
+    }
+    for (size_t i = 0; i < console_config->param_count; i++) {
+        print_param(&console_config->params[i]);
+    }
+    return 0;
+}
+
+static int cmd_set(int argc, char **argv)
+{
+    if (argc != 3) {
+        printf("usage: set <name> <value>\n");
+        return 1;
+    }
+
+    const grill_console_param_t *param = find_param(argv[1]);
+    if (param == NULL) {
+        printf("unknown parameter '%s'\n", argv[1]);
+        return 1;
+    }
+    if (param->set == NULL) {
+        printf("%s is read-only\n", param->name);
+        return 1;
+    }
+
+    long value;
+    if (!parse_int(argv[2], &value) || value < param->min || value > param->max) {
+        printf("%s must be an integer in %" PRId32 "..%" PRId32 "\n", param->name,
+               param->min, param->max);
+        return 1;
+    }
+    esp_err_t ret = param->set((int32_t)value);
+    if (ret != ESP_OK) {
+        printf("set %s failed: %s\n", param->name, esp_err_to_name(ret));
+        return 1;
+    }
+    print_param(param);
+    return 0;
+}
+
+static int cmd_stats(int argc, char **argv)
+{
+    bool found = false;
+
+    for (size_t i = 0; i < console_config->stats_count; i++) {
+        const grill_console_stats_t *stats = &console_config->stats[i];
+        if (argc >= 2 && strcmp(stats->name, argv[1]) != 0) {
+            continue;
+        }
+        printf("[%s] %s\n", stats->name, stats->help);
+        stats->print();
+        found = true;
+    }
+    if (!found && argc >= 2) {
+        printf("unknown statistics '%s'\n", argv[1]);
+        return 1;
+    }
+    return 0;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Time one benchmark and print its line: name, runs, min, median, p99, max
+ */
+static int run_bench(const grill_console_bench_t *bench, long runs)
+{
+    if (bench->begin != NULL) {
+        esp_err_t ret = bench->begin();
+        if (ret != ESP_OK) {
+            printf("bench %s unavailable: %s\n", bench->name, esp_err_to_name(ret));
+            return 1;
+        }
+    }
+    for (long i = 0; i < runs; i++) {
+        uint32_t start = cycle_counter_now();
+        bench->run((uint32_t)i);
+        bench_timings[i] = cycle_counter_now() - start;
+    }
+    if (bench->end != NULL) {
+        bench->end();
+    }
+
+    // Nearest-rank percentile: the smallest timing at or above 99 % of the runs
+    qsort(bench_timings, (size_t)runs, sizeof(bench_timings[0]), compare_u32);
+    long p99 = (runs * 99 + 99) / 100 - 1;
+    printf("bench %s runs=%ld min=%" PRIu32 " median=%" PRIu32 " p99=%" PRIu32 " max=%" PRIu32
+           " unit=" CYCLE_COUNTER_UNIT "\n",
+           bench->name, runs, bench_timings[0], bench_timings[runs / 2], bench_timings[p99],
+           bench_timings[runs - 1]);
+    return 0;
+}
+
+static int cmd_bench(int argc, char **argv)
+{
+    const grill_console_bench_t *bench = NULL;
+    bool all = argc >= 2 && strcmp(argv[1], "all") == 0;
+    long runs = GRILL_CONSOLE_BENCH_RUNS;
+
+    for (size_t i = 0; argc >= 2 && i < console_config->bench_count; i++) {
+        if (strcmp(console_config->benches[i].name, argv[1]) == 0) {
+            bench = &console_config->benches[i];
+        }
+    }
+    if ((bench == NULL && !all) || argc > 3 ||
+        (argc == 3 && (!parse_int(argv[2], &runs) || runs < 1 || runs > GRILL_CONSOLE_BENCH_MAX_RUNS))) {
+        printf("usage: bench <name>|all [1..%d]\n", GRILL_CONSOLE_BENCH_MAX_RUNS);
+        for (size_t i = 0; i < console_config->bench_count; i++) {
+            printf("  %-10s %s\n", console_config->benches[i].name, console_config->benches[i].help);
+        }
+        return 1;
+    }
+
+    if (!all) {
+        return run_bench(bench, runs);
+    }
+    int failed = 0;
+    for (size_t i = 0; i < console_config->bench_count; i++) {
+        failed |= run_bench(&console_config->benches[i], runs);
+    }
+    return failed;
+}
+
+#if !defined(ESP_PLATFORM) || CONFIG_IDF_TARGET_LINUX
+static void print_cmds(const grill_console_cmd_t *cmds, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        printf("%-6s %-15s %s\n", cmds[i].name, cmds[i].hint, cmds[i].help);
+    }
+}
+
+static int cmd_help(int argc, char **argv)
+{
+    print_cmds(console_cmds, CONSOLE_CMD_COUNT);
+    print_cmds(extra_cmds, extra_cmd_count);
+    return 0;
+}
+#endif
+
+esp_err_t grill_console_add_commands(const grill_console_cmd_t *commands, size_t count)
+{
+    if (commands == NULL || count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (console_config != NULL || extra_cmds != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    extra_cmds = commands;
+    extra_cmd_count = count;
+    return ESP_OK;
+}
+
+int grill_console_run_line(const char *line)
+{
+    char buffer[GRILL_CONSOLE_LINE_LEN];
+    char *argv[GRILL_CONSOLE_MAX_ARGS];
+    int argc = 0;
+
+    if (console_config == NULL) {
+        return 1;
+    }
+    snprintf(buffer, sizeof(buffer), "%s", line);
+    for (char *token = strtok(buffer, " \t\r\n"); token != NULL && argc < GRILL_CONSOLE_MAX_ARGS;
+         token = strtok(NULL, " \t\r\n")) {
+        argv[argc++] = token;
+    }
+    if (argc == 0) {
+        return 0;
+    }
+
+    for (size_t i = 0; i < CONSOLE_CMD_COUNT; i++) {
+        if (strcmp(console_cmds[i].name, argv[0]) == 0) {
+            return console_cmds[i].func(argc, argv);
+        }
+    }
+    for (size_t i = 0; i < extra_cmd_count; i++) {
+        if (strcmp(extra_cmds[i].name, argv[0]) == 0) {
+            return extra_cmds[i].func(argc, argv);
+        }
+    }
+    printf("unknown command '%s'\n", argv[0]);
+    return 1;
+}
+
+#if defined(ESP_PLATFORM) && CONFIG_IDF_TARGET_LINUX
+/**
+ * @brief Host shell: one command per stdin line
+ */
+static void grill_console_stdin_task(void *pvParameters)
+{
+    char line[GRILL_CONSOLE_LINE_LEN];
+
+    while (1) {
+        printf(GRILL_CONSOLE_PROMPT);
+        fflush(stdout);
+        if (fgets(line, sizeof(line), stdin) == NULL) {
+            break;      // End of input: the application keeps running
+        }
+        grill_console_run_line(line);
+    }
+    vTaskDelete(NULL);
+}
+#endif
+
+esp_err_t grill_console_start(const grill_console_config_t *config)
+{
+    if (config == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (console_config != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    console_config = config;
+
+#if defined(ESP_PLATFORM) && CONFIG_IDF_TARGET_LINUX
+    if (xTaskCreate(grill_console_stdin_task, "console", GRILL_CONSOLE_TASK_STACK, NULL,
+                    GRILL_CONSOLE_TASK_PRIORITY, NULL) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create the console task");
+        console_config = NULL;
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+#elif defined(ESP_PLATFORM)
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = GRILL_CONSOLE_PROMPT;
+    repl_config.max_cmdline_length = GRILL_CONSOLE_LINE_LEN;
+    repl_config.task_stack_size = GRILL_CONSOLE_TASK_STACK;
+    repl_config.task_priority = GRILL_CONSOLE_TASK_PRIORITY;
+
+    // Same port as the log output
+#if CONFIG_ESP_CONSOLE_UART_DEFAULT || CONFIG_ESP_CONSOLE_UART_CUSTOM
+    esp_console_dev_uart_config_t hw_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    esp_err_t ret = esp_console_new_repl_uart(&hw_config, &repl_config, &repl);
+#elif CONFIG_ESP_CONSOLE_USB_CDC
+    esp_console_dev_usb_cdc_config_t hw_config = ESP_CONSOLE_DEV_CDC_CONFIG_DEFAULT();
+    esp_err_t ret = esp_console_new_repl_usb_cdc(&hw_config, &repl_config, &repl);
+#elif CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG
+    esp_console_dev_usb_serial_jtag_config_t hw_config = ESP_CONSOLE_DEV_USB_SERIAL_JTAG_CONFIG_DEFAULT();
+    esp_err_t ret = esp_console_new_repl_usb_serial_jtag(&hw_config, &repl_config, &repl);
+#else
+    esp_err_t ret = ESP_ERR_NOT_SUPPORTED;     // Console output disabled in menuconfig
+#endif
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create the console REPL: %s", esp_err_to_name(ret));
+        goto err;
+    }
+
+    for (size_t i = 0; i < CONSOLE_CMD_COUNT + extra_cmd_count; i++) {
+        const grill_console_cmd_t *entry = i < CONSOLE_CMD_COUNT ? &console_cmds[i]
+                                                                 : &extra_cmds[i - CONSOLE_CMD_COUNT];
+        const esp_console_cmd_t cmd = {
+            .command = entry->name,
+            .help = entry->help,
+            .hint = entry->hint,
+            .func = entry->func,
+        };
+        ret = esp_console_cmd_register(&cmd);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to register '%s': %s", cmd.command, esp_err_to_name(ret));
+            goto err;
+        }
+    }
+    ret = esp_console_register_help_command();
+    if (ret == ESP_OK) {
+        ret = esp_console_start_repl(repl);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start the console REPL: %s", esp_err_to_name(ret));
+        goto err;
+    }
+    return ESP_OK;
+
+err:
+    if (repl != NULL) {
+        repl->del(repl);
+    }
+    console_config = NULL;
+    return ret;
+#else
+    return ESP_OK;      // Host tools call grill_console_run_line() themselves
+#endif
+}
@@ -0,0 +1,148 @@
+/**
+ * @file grill_console.h
+ * @brief Serial shell for live tuning, driver statistics and micro-benchmarks
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The application hands over three tables and the console provides:
+ *
+ * - get [name]          every parameter (or one) with its range
+ * - set name value      change a parameter at runtime (range-checked)
+ * - stats [name]        driver and loop statistics
+ * - bench name [runs]   time a code path; min / median / p99 / max in
+ *                       CYCLE_COUNTER_UNIT, so the first (cold cache) and
+ *                       preempted runs do not hide the typical cost
+ * - bench all [runs]    every benchmark in turn
+ * - help                the commands (esp_console's help on target)
+ *
+ * Each benchmark prints one line of key=value pairs, for scripts that
+ * compare runs across commits:
+ *
+ *   bench scan runs=100 min=... median=... p99=... max=... unit=cycles
+ *
+ * grill_console_add_commands() adds commands of its own, such as the
+ * simulated hardware controls of the Linux host application.
+ *
+ * Command handling is plain argc/argv and does not depend on ESP-IDF. On
+ * the ESP32-S3 the commands are registered with esp_console and its REPL
+ * (line editing, history) runs on whichever port the console is configured
+ * for: UART, USB CDC or USB-Serial-JTAG. In the Linux host build the same
+ * commands are read from stdin and answered on stdout.
+ */
+
+#ifndef GRILL_CONSOLE_H
+#define GRILL_CONSOLE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define GRILL_CONSOLE_PROMPT        "grill> "
+#define GRILL_CONSOLE_LINE_LEN      128     // Longest command line
+#define GRILL_CONSOLE_MAX_ARGS      8
+#define GRILL_CONSOLE_BENCH_RUNS    100     // Default runs of a benchmark
+#define GRILL_CONSOLE_BENCH_MAX_RUNS 1000   // Timings kept for the median
+#define GRILL_CONSOLE_TASK_STACK    4096    // REPL task (target) / stdin task (host)
+#define GRILL_CONSOLE_TASK_PRIORITY 1       // Below every task in the layout
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief A runtime parameter
+ */
+typedef struct {
+    const char *name;
+    const char *help;                   /**< Unit or meaning */
+    int32_t min;
+    int32_t max;
+    int32_t (*get)(void);
+    esp_err_t (*set)(int32_t value);    /**< NULL: read-only */
+} grill_console_param_t;
+
+/**
+ * @brief A statistics group, printed to stdout
+ */
+typedef struct {
+    const char *name;
+    const char *help;
+    void (*print)(void);
+} grill_console_stats_t;
+
+/**
+ * @brief A benchmark: run() is timed once per run
+ *
+ * begin() and end() (both optional) are not timed: they take and give back
+ * whatever the code path shares with the running application.
+ */
+typedef struct {
+    const char *name;
+    const char *help;
+    esp_err_t (*begin)(void);
+    void (*run)(uint32_t iteration);
+    void (*end)(void);
+} grill_console_bench_t;
+
+/**
+ * @brief An extra command: plain argc/argv, returns 0 on success
+ */
+typedef struct {
+    const char *name;
+    const char *hint;                   /**< Arguments, e.g. "<zone> <celsius>" */
+    const char *help;
+    int (*func)(int argc, char **argv);
+} grill_console_cmd_t;
+
+/**
+ * @brief Tables served by the console (kept by reference)
+ */
+typedef struct {
+    const grill_console_param_t *params;
+    size_t param_count;
+    const grill_console_stats_t *stats;
+    size_t stats_count;
+    const grill_console_bench_t *benches;
+    size_t bench_count;
+} grill_console_config_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Register the commands and start the shell task
+ *
+ * @param config Tables (must outlive the console)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if config is NULL
+ * @return ESP_ERR_INVALID_STATE if already started
+ * @return ESP_ERR_NO_MEM or esp_console errors otherwise
+ */
+esp_err_t grill_console_start(const grill_console_config_t *config);
+
+/**
+ * @brief Add commands (before grill_console_start(), once)
+ *
+ * @param commands Table (must outlive the console)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if the table is empty
+ * @return ESP_ERR_INVALID_STATE if started or a table was already added
+ */
+esp_err_t grill_console_add_commands(const grill_console_cmd_t *commands, size_t count);
+
+/**
+ * @brief Run one command line (the host shell, and tools feeding scripts)
+ *
+ * @return Command exit code: 0 on success
+ */
+int grill_console_run_line(const char *line);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GRILL_CONSOLE_H */
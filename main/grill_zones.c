@@ -0,0 +1,312 @@
+/**
+ * @file grill_zones.c
+ * @brief Multi-zone grill temperature sensing implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "grill_zones.h"
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Zone values, one array per field (indexed by zone)
+ */
+typedef struct {
+    int32_t centi[GRILL_ZONES_MAX];
+    int32_t raw_centi[GRILL_ZONES_MAX];
+    uint32_t updates[GRILL_ZONES_MAX];
+    int64_t timestamp_us[GRILL_ZONES_MAX];
+} grill_zone_values_t;
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "GRILL_ZONES";
+
+static grill_zones_config_t zones_config;
+static uint8_t zone_count = 0;
+static grill_zone_values_t zone_values;
+static sensor_filter_t zone_filters[GRILL_ZONES_MAX];   // Touched only by the sampler task
+static bool zones_burst = false;                         // Burst readings bypass the filters
+static portMUX_TYPE zone_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static temp_history_t *zone_history = NULL;              // zone_count entries
+static SemaphoreHandle_t history_mutex = NULL;
+static esp_timer_handle_t history_timer = NULL;
+static int64_t history_pushed_us = 0;                    // Time of the last point (history_mutex)
+static uint32_t history_missed = 0;                      // Ticks that found the mutex busy (timer task)
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Convert, filter and store one reading (called from the ADC sampler task)
+ */
+static void grill_zones_on_reading(const adc_sampler_reading_t *reading, void *ctx)
+{
+    const uint8_t zone = reading->slot;
+    if (zone >= zone_count) {
+        return;
+    }
+
+    // Conversion and filtering happen outside the lock; only the store is guarded
+    int32_t raw = temp_lut_oversampled_to_centi(zones_config.lut, reading->value,
+                                                zones_config.oversample_bits);
+    int32_t filtered;
+    if (__atomic_load_n(&zones_burst, __ATOMIC_RELAXED)) {
+        // One reading per period would stretch the filter lag to seconds; the
+        // reading is already an oversampled average, so pass it through and
+        // let the pipeline re-seed when continuous sampling resumes
+        sensor_filter_reset(&zone_filters[zone]);
+        filtered = raw;
+    } else {
+        filtered = sensor_filter_process(&zone_filters[zone], raw);
+    }
+
+    portENTER_CRITICAL(&zone_lock);
+    zone_values.centi[zone] = filtered;
+    zone_values.raw_centi[zone] = raw;
+    zone_values.updates[zone]++;
+    zone_values.timestamp_us[zone] = (int64_t)reading->timestamp_us;
+    portEXIT_CRITICAL(&zone_lock);
+}
+
+/**
+ * @brief Append the current value of every zone to its history, points times
+ */
+static void grill_zones_history_push(uint32_t points, int64_t now_us)
+{
+    int32_t centi[GRILL_ZONES_MAX];
+    uint8_t count = grill_zones_get_all(centi, GRILL_ZONES_MAX);
+
+    for (uint8_t zone = 0; zone < count; zone++) {
+        int32_t value = centi[zone] == GRILL_ZONE_NO_READING ? TEMP_HISTORY_GAP : centi[zone];
+        for (uint32_t i = 0; i < points; i++) {
+            temp_history_push(&zone_history[zone], value);
+        }
+    }
+    history_pushed_us = now_us;
+}
+
+/**
+ * @brief One history point per zone (esp_timer task)
+ *
+ * Never waits for a reader: blocking here would stall every esp_timer in the
+ * system. A tick that finds the mutex busy is made up by the next one.
+ */
+static void grill_zones_history_tick(void *arg)
+{
+    if (xSemaphoreTake(history_mutex, 0) != pdTRUE) {
+        history_missed++;
+        return;
+    }
+    uint32_t points = history_missed < TEMP_HISTORY_FULL_POINTS ? history_missed + 1
+                                                                : TEMP_HISTORY_FULL_POINTS;
+    grill_zones_history_push(points, esp_timer_get_time());
+    history_missed = 0;
+    xSemaphoreGive(history_mutex);
+}
+
+esp_err_t grill_zones_init(const grill_zones_config_t *config)
+{
+    esp_err_t ret;
+
+    if (config == NULL || config->lut == NULL || config->zone_count == 0 ||
+        config->zone_count > GRILL_ZONES_MAX || config->sample_freq_hz_per_zone == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (zone_count != 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    for (uint8_t zone = 0; zone < config->zone_count; zone++) {
+        ret = sensor_filter_init(&zone_filters[zone], config->filter_stages,
+                                 config->filter_stage_count);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Invalid zone filter configuration: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        zone_values.centi[zone] = GRILL_ZONE_NO_READING;
+        zone_values.raw_centi[zone] = GRILL_ZONE_NO_READING;
+        zone_values.updates[zone] = 0;
+        zone_values.timestamp_us[zone] = 0;
+    }
+    zones_config = *config;
+
+    zone_history = calloc(config->zone_count, sizeof(temp_history_t));
+    history_mutex = xSemaphoreCreateMutex();
+    if (zone_history == NULL || history_mutex == NULL) {
+        ESP_LOGE(TAG, "Failed to allocate zone histories");
+        ret = ESP_ERR_NO_MEM;
+        goto err_history;
+    }
+    for (uint8_t zone = 0; zone < config->zone_count; zone++) {
+        temp_history_init(&zone_history[zone]);
+    }
+
+    esp_timer_create_args_t timer_args = {
+        .callback = grill_zones_history_tick,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "zone_history",
+        .skip_unhandled_events = true,
+    };
+    ret = esp_timer_create(&timer_args, &history_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create history timer: %s", esp_err_to_name(ret));
+        goto err_history;
+    }
+
+    adc_sampler_config_t sampler_config = {
+        .unit = ADC_UNIT_1,
+        .channel_count = config->zone_count,
+        .atten = config->atten,
+        .sample_freq_hz = config->sample_freq_hz_per_zone * config->zone_count,
+        .oversample_bits = config->oversample_bits,
+        .decimation = 0,
+        .callback = grill_zones_on_reading,
+        .callback_ctx = NULL,
+    };
+    memcpy(sampler_config.channels, config->channels,
+           config->zone_count * sizeof(config->channels[0]));
+
+    ret = adc_sampler_init(&sampler_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to initialize ADC sampler: %s", esp_err_to_name(ret));
+        goto err_timer;
+    }
+
+    zone_count = config->zone_count;
+    ESP_LOGI(TAG, "%u zone(s) sharing one scan pattern, %u bytes of history per zone",
+             zone_count, (unsigned)sizeof(temp_history_t));
+    return ESP_OK;
+
+err_timer:
+    esp_timer_delete(history_timer);
+    history_timer = NULL;
+err_history:
+    if (history_mutex != NULL) {
+        vSemaphoreDelete(history_mutex);
+        history_mutex = NULL;
+    }
+    free(zone_history);
+    zone_history = NULL;
+    return ret;
+}
+
+esp_err_t grill_zones_start(void)
+{
+    if (zone_count == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    history_pushed_us = esp_timer_get_time();
+    return grill_zones_sample(true);
+}
+
+esp_err_t grill_zones_sample(bool continuous)
+{
+    const int64_t period_us = 1000000 / TEMP_HISTORY_SAMPLE_HZ;
+    esp_err_t ret;
+
+    if (zone_count == 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    __atomic_store_n(&zones_burst, !continuous, __ATOMIC_RELAXED);
+    if (continuous) {
+        ret = adc_sampler_start();
+        if (ret == ESP_OK && !esp_timer_is_active(history_timer)) {
+            ret = esp_timer_start_periodic(history_timer, (uint64_t)period_us);
+        }
+        return ret;
+    }
+
+    // The points the timer would have pushed since the last one, at the latest values
+    esp_timer_stop(history_timer);
+    xSemaphoreTake(history_mutex, portMAX_DELAY);
+    history_missed = 0;                                  // Timer stopped: counted in due below
+    int64_t now_us = esp_timer_get_time();
+    int64_t due = (now_us - history_pushed_us) / period_us;
+    if (due > 0) {
+        grill_zones_history_push(due < TEMP_HISTORY_FULL_POINTS ? (uint32_t)due : TEMP_HISTORY_FULL_POINTS,
+                                 history_pushed_us + due * period_us);
+    }
+    xSemaphoreGive(history_mutex);
+
+    return adc_sampler_burst();
+}
+
+uint8_t grill_zones_count(void)
+{
+    return zone_count;
+}
+
+esp_err_t grill_zones_get(uint8_t zone, grill_zone_snapshot_t *snapshot)
+{
+    if (snapshot == NULL || zone >= zone_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&zone_lock);
+    snapshot->centi = zone_values.centi[zone];
+    snapshot->raw_centi = zone_values.raw_centi[zone];
+    snapshot->updates = zone_values.updates[zone];
+    snapshot->timestamp_us = zone_values.timestamp_us[zone];
+    portEXIT_CRITICAL(&zone_lock);
+
+    return snapshot->updates == 0 ? ESP_ERR_NOT_FOUND : ESP_OK;
+}
+
+uint8_t grill_zones_get_all(int32_t *centi, uint8_t max_zones)
+{
+    if (centi == NULL) {
+        return 0;
+    }
+
+    uint8_t count = zone_count < max_zones ? zone_count : max_zones;
+    portENTER_CRITICAL(&zone_lock);
+    memcpy(centi, zone_values.centi, count * sizeof(centi[0]));
+    portEXIT_CRITICAL(&zone_lock);
+    return count;
+}
+
+size_t grill_zones_history_read(uint8_t zone, temp_history_tier_t tier, size_t skip_newest,
+                                size_t max_points, temp_history_point_t *out)
+{
+    if (zone >= zone_count) {
+        return 0;
+    }
+
+    xSemaphoreTake(history_mutex, portMAX_DELAY);
+    size_t n = temp_history_read(&zone_history[zone], tier, skip_newest, max_points, out);
+    xSemaphoreGive(history_mutex);
+    return n;
+}
+
+void grill_zones_get_filter_cost(uint32_t *avg_ticks, uint32_t *max_ticks)
+{
+    uint64_t total = 0;
+    uint32_t samples = 0;
+    uint32_t worst = 0;
+
+    for (uint8_t zone = 0; zone < zone_count; zone++) {
+        total += zone_filters[zone].stats.total_ticks;
+        samples += zone_filters[zone].stats.samples;
+        if (zone_filters[zone].stats.max_ticks > worst) {
+            worst = zone_filters[zone].stats.max_ticks;
+        }
+    }
+
+    if (avg_ticks != NULL) {
+        *avg_ticks = samples > 0 ? (uint32_t)(total / samples) : 0;
+    }
+    if (max_ticks != NULL) {
+        *max_ticks = worst;
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ * @file grill_zones.h
+ * @brief Multi-zone grill temperature sensing
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * All zone probes share one continuous ADC scan pattern: the controller
+ * converts the channels round-robin and the single sampler task decimates,
+ * converts (temp_lut) and filters (sensor_filter) every zone as its readings
+ * arrive. There is no task per zone.
+ *
+ * Zone values are stored as parallel arrays indexed by zone, so "all zone
+ * temperatures" is one contiguous copy. Readers take per-zone or all-zone
+ * snapshots under a short critical section.
+ *
+ * Each zone also keeps a tiered temp_history fed by a periodic esp_timer at
+ * TEMP_HISTORY_SAMPLE_HZ: sizeof(temp_history_t) bytes per zone, allocated
+ * once at init. The timer never waits for the history mutex; a tick that
+ * finds a reader holding it pushes its point with the next tick instead.
+ *
+ * grill_zones_sample() switches between continuous conversions and one burst
+ * per call. In burst mode the history timer is off too and each call fills
+ * in the history points that fell due since the last one, so the sensing
+ * path wakes the chip once per call instead of at the history rate.
+ */
+
+#ifndef GRILL_ZONES_H
+#define GRILL_ZONES_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "esp_adc/adc_continuous.h"
+#include "adc_sampler.h"
+#include "sensor_filter.h"
+#include "temp_lut.h"
+#include "temp_history.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define GRILL_ZONES_MAX             ADC_SAMPLER_MAX_CHANNELS
+
+/** @brief Value of a zone that has not produced a reading yet */
+#define GRILL_ZONE_NO_READING       INT32_MIN
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Zone subsystem configuration
+ */
+typedef struct {
+    adc_channel_t channels[GRILL_ZONES_MAX];    /**< ADC1 channel of each zone probe */
+    uint8_t zone_count;                         /**< Zones in use (1 to GRILL_ZONES_MAX) */
+    adc_atten_t atten;                          /**< Attenuation shared by all probes */
+    uint32_t sample_freq_hz_per_zone;           /**< Raw conversion rate of each zone */
+    uint8_t oversample_bits;                    /**< Extra bits per reading (4^k samples) */
+    const temp_lut_t *lut;                      /**< Raw-to-temperature table shared by all zones */
+    const sensor_filter_stage_config_t *filter_stages;  /**< Filter applied to every zone */
+    uint8_t filter_stage_count;
+} grill_zones_config_t;
+
+/**
+ * @brief Consistent view of one zone
+ */
+typedef struct {
+    int32_t centi;              /**< Filtered temperature (centi-degrees C) */
+    int32_t raw_centi;          /**< Unfiltered temperature of the latest reading */
+    uint32_t updates;           /**< Readings processed for this zone */
+    int64_t timestamp_us;       /**< Time of the latest reading */
+} grill_zone_snapshot_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Configure the shared scan pattern and per-zone filters
+ *
+ * @param config Zone configuration (copied; lut must stay valid)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG on invalid configuration
+ * @return ESP_ERR_INVALID_STATE if already initialised
+ * @return ESP_ERR_NO_MEM if the zone histories cannot be allocated
+ * @return Other ESP error codes from the ADC sampler
+ */
+esp_err_t grill_zones_init(const grill_zones_config_t *config);
+
+/**
+ * @brief Start conversions and history recording on all zones
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if not initialised
+ */
+esp_err_t grill_zones_start(void);
+
+/**
+ * @brief Choose continuous sampling or take one burst (any task, once per period)
+ *
+ * Continuous: the ADC and the history timer run without pause; the heater
+ * needs a fresh reading every control period. Otherwise the ADC stops after
+ * one new reading per zone (adc_sampler_burst()) and the history catches up
+ * with the latest values. Burst readings bypass the sensor filters, whose
+ * time constants are set for the continuous rate and would stretch by the
+ * ratio of the two rates; the filters re-seed when continuous sampling
+ * resumes.
+ *
+ * @param continuous true for continuous conversions
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if not initialised
+ * @return Other ESP error codes from the ADC sampler or esp_timer
+ */
+esp_err_t grill_zones_sample(bool continuous);
+
+/**
+ * @brief Number of configured zones (0 before init)
+ */
+uint8_t grill_zones_count(void);
+
+/**
+ * @brief Snapshot one zone
+ *
+ * @param zone Zone index
+ * @param snapshot Receives the zone values
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if zone is out of range or snapshot is NULL
+ * @return ESP_ERR_NOT_FOUND if the zone has not produced a reading yet
+ */
+esp_err_t grill_zones_get(uint8_t zone, grill_zone_snapshot_t *snapshot);
+
+/**
+ * @brief Snapshot the filtered temperature of every zone at once
+ *
+ * Zones without a reading yet are reported as GRILL_ZONE_NO_READING.
+ *
+ * @param centi Destination array
+ * @param max_zones Capacity of centi
+ * @return Number of zones written
+ */
+uint8_t grill_zones_get_all(int32_t *centi, uint8_t max_zones);
+
+/**
+ * @brief Read the temperature history of one zone
+ *
+ * Same semantics as temp_history_read(); blocks briefly while the history
+ * timer is appending.
+ *
+ * @param zone Zone index
+ * @param tier History tier
+ * @param skip_newest Number of newest points to skip
+ * @param max_points Capacity of out
+ * @param out Destination, oldest point first
+ * @return Number of points written (0 if zone is out of range)
+ */
+size_t grill_zones_history_read(uint8_t zone, temp_history_tier_t tier, size_t skip_newest,
+                                size_t max_points, temp_history_point_t *out);
+
+/**
+ * @brief Filter cost over all zones in cycle_counter units
+ *
+ * @param avg_ticks Receives the mean cost per reading (may be NULL)
+ * @param max_ticks Receives the worst cost per reading (may be NULL)
+ */
+void grill_zones_get_filter_cost(uint32_t *avg_ticks, uint32_t *max_ticks);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GRILL_ZONES_H */
@@ -0,0 +1,317 @@
+/**
+ * @file heater_control.c
+ * @brief Closed-loop heater control implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "driver/gptimer.h"
+#include "driver/ledc.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "cycle_counter.h"
+#include "grill_zones.h"
+#include "heater_control.h"
+#include "task_layout.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define CONTROL_TIMER_RESOLUTION_HZ 1000000     // 1 us timer ticks
+#define HEATER_LEDC_MODE            LEDC_LOW_SPEED_MODE
+#define HEATER_LEDC_TIMER           LEDC_TIMER_0
+#define HEATER_LEDC_CHANNEL         LEDC_CHANNEL_0
+#define HEATER_LEDC_RESOLUTION      LEDC_TIMER_13_BIT
+#define HEATER_LEDC_DUTY_FULL       (1U << HEATER_LEDC_RESOLUTION)
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Running sums behind heater_control_metrics_t
+ */
+typedef struct {
+    heater_control_metrics_t last;
+    uint64_t jitter_total_us;
+    uint32_t jitter_samples;
+    uint64_t exec_total;
+} control_stats_t;
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "HEATER_CONTROL";
+
+static heater_control_config_t control_config;
+static heater_pid_t control_pid;                 // Touched only by the control task
+static gptimer_handle_t control_timer = NULL;
+static TaskHandle_t control_task_handle = NULL;
+static int32_t control_setpoint = HEATER_CONTROL_OFF;
+static bool control_started = false;            // heater_control_start() called
+static control_stats_t control_stats = {
+    .last = { .setpoint_centi = HEATER_CONTROL_OFF, .measured_centi = GRILL_ZONE_NO_READING },
+};
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Control period elapsed (ISR context): wake the control task
+ */
+static bool IRAM_ATTR heater_control_on_alarm(gptimer_handle_t timer,
+                                              const gptimer_alarm_event_data_t *edata,
+                                              void *user_ctx)
+{
+    BaseType_t task_woken = pdFALSE;
+    task_layout_release_from_isr(TASK_LAYOUT_HEATER);
+    vTaskNotifyGiveFromISR(control_task_handle, &task_woken);
+    return task_woken == pdTRUE;
+}
+
+static void heater_set_duty(int32_t duty)
+{
+    uint32_t ledc_duty = (uint32_t)(((uint64_t)duty * HEATER_LEDC_DUTY_FULL) / HEATER_PID_OUTPUT_MAX);
+    ledc_set_duty(HEATER_LEDC_MODE, HEATER_LEDC_CHANNEL, ledc_duty);
+    ledc_update_duty(HEATER_LEDC_MODE, HEATER_LEDC_CHANNEL);
+}
+
+/**
+ * @brief Run or park the control timer (control task only)
+ *
+ * @return true if the timer now runs
+ */
+static bool heater_timer_run(bool run)
+{
+    esp_err_t ret;
+
+    if (run) {
+        ulTaskNotifyTake(pdTRUE, 0);        // Drop the start request: periods count from here
+        ret = gptimer_enable(control_timer);
+        if (ret == ESP_OK) {
+            gptimer_set_raw_count(control_timer, 0);    // A whole period to the first alarm
+            ret = gptimer_start(control_timer);
+            if (ret != ESP_OK) {
+                gptimer_disable(control_timer);
+            }
+        }
+    } else {
+        ret = gptimer_stop(control_timer);
+        if (ret == ESP_OK) {
+            ret = gptimer_disable(control_timer);
+        }
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to %s control timer: %s", run ? "start" : "stop", esp_err_to_name(ret));
+    }
+    return run == (ret == ESP_OK);
+}
+
+/**
+ * @brief One control step per timer period
+ */
+static void heater_control_task(void *pvParameters)
+{
+    const int64_t period_us = (int64_t)control_config.pid.period_ms * 1000;
+    int64_t previous_wake_us = 0;
+    bool was_on = false;
+    bool timer_running = false;
+
+    while (1) {
+        // Every give is one period; more than one pending means steps were missed
+        uint32_t periods = ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int32_t setpoint = __atomic_load_n(&control_setpoint, __ATOMIC_RELAXED);
+
+        // Parked: only a start request with a setpoint restarts the periods
+        if (!timer_running) {
+            if (setpoint == HEATER_CONTROL_OFF || !__atomic_load_n(&control_started, __ATOMIC_RELAXED)) {
+                continue;
+            }
+            timer_running = heater_timer_run(true);
+            previous_wake_us = 0;
+            periods = 1;
+        }
+        task_layout_note_wake(TASK_LAYOUT_HEATER);
+        int64_t wake_us = esp_timer_get_time();
+        uint32_t start = cycle_counter_now();
+
+        grill_zone_snapshot_t zone;
+        bool reading_ok = grill_zones_get(control_config.zone, &zone) == ESP_OK &&
+                          zone.centi != GRILL_ZONE_NO_READING &&
+                          wake_us - zone.timestamp_us <= HEATER_CONTROL_STALE_MS * 1000;
+
+        int32_t duty = 0;
+        if (setpoint != HEATER_CONTROL_OFF && reading_ok) {
+            duty = heater_pid_step(&control_pid, setpoint, zone.centi);
+            was_on = true;
+        } else if (was_on) {
+            heater_pid_reset(&control_pid);     // Start clean when the heater comes back
+            was_on = false;
+        }
+        heater_set_duty(duty);
+
+        uint32_t elapsed = cycle_counter_now() - start;
+
+        portENTER_CRITICAL(&stats_lock);
+        heater_control_metrics_t *last = &control_stats.last;
+        last->steps++;
+        last->overruns += periods > 1 ? periods - 1 : 0;
+        last->sensor_faults += (setpoint != HEATER_CONTROL_OFF && !reading_ok) ? 1 : 0;
+        if (previous_wake_us != 0) {
+            int64_t deviation = (wake_us - previous_wake_us) - period_us * periods;
+            uint32_t jitter = (uint32_t)(deviation < 0 ? -deviation : deviation);
+            control_stats.jitter_total_us += jitter;
+            control_stats.jitter_samples++;
+            if (jitter > last->jitter_max_us) {
+                last->jitter_max_us = jitter;
+            }
+        }
+        control_stats.exec_total += elapsed;
+        if (elapsed > last->exec_max) {
+            last->exec_max = elapsed;
+        }
+        last->setpoint_centi = setpoint;
+        last->measured_centi = reading_ok ? zone.centi : GRILL_ZONE_NO_READING;
+        last->duty = duty;
+        last->p_term = control_pid.p_term;
+        last->i_term = control_pid.i_term;
+        last->d_term = control_pid.d_term;
+        last->ff_term = control_pid.ff_term;
+        portEXIT_CRITICAL(&stats_lock);
+
+        previous_wake_us = wake_us;
+
+        // Heater written off: no periods needed until the next setpoint
+        if (setpoint == HEATER_CONTROL_OFF) {
+            timer_running = heater_timer_run(false);
+            previous_wake_us = 0;
+        }
+    }
+}
+
+esp_err_t heater_control_init(const heater_control_config_t *config)
+{
+    esp_err_t ret;
+
+    if (config == NULL || config->pwm_freq_hz == 0 || config->zone >= grill_zones_count()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (control_task_handle != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    ret = heater_pid_init(&control_pid, &config->pid);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Invalid PID tuning");
+        return ret;
+    }
+    control_config = *config;
+
+    // Heater output first, and off, before anything can drive it
+    ledc_timer_config_t timer_config = {
+        .speed_mode = HEATER_LEDC_MODE,
+        .duty_resolution = HEATER_LEDC_RESOLUTION,
+        .timer_num = HEATER_LEDC_TIMER,
+        .freq_hz = config->pwm_freq_hz,
+        .clk_cfg = LEDC_AUTO_CLK,
+    };
+    ret = ledc_timer_config(&timer_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure PWM timer: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    ledc_channel_config_t channel_config = {
+        .gpio_num = config->pwm_gpio,
+        .speed_mode = HEATER_LEDC_MODE,
+        .channel = HEATER_LEDC_CHANNEL,
+        .intr_type = LEDC_INTR_DISABLE,
+        .timer_sel = HEATER_LEDC_TIMER,
+        .duty = 0,
+        .hpoint = 0,
+    };
+    ret = ledc_channel_config(&channel_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure PWM channel: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = task_layout_create(TASK_LAYOUT_HEATER, heater_control_task, NULL, &control_task_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create control task");
+        return ret;
+    }
+
+    gptimer_config_t gptimer_config = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = CONTROL_TIMER_RESOLUTION_HZ,
+    };
+    ret = gptimer_new_timer(&gptimer_config, &control_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create control timer: %s", esp_err_to_name(ret));
+        goto err_task;
+    }
+    gptimer_event_callbacks_t callbacks = {
+        .on_alarm = heater_control_on_alarm,
+    };
+    ret = gptimer_register_event_callbacks(control_timer, &callbacks, NULL);
+    if (ret != ESP_OK) {
+        goto err_timer;
+    }
+    gptimer_alarm_config_t alarm_config = {
+        .alarm_count = (uint64_t)config->pid.period_ms * (CONTROL_TIMER_RESOLUTION_HZ / 1000),
+        .reload_count = 0,
+        .flags.auto_reload_on_alarm = true,
+    };
+    ret = gptimer_set_alarm_action(control_timer, &alarm_config);
+    if (ret != ESP_OK) {
+        goto err_timer;
+    }
+
+    ESP_LOGI(TAG, "Heater PWM on GPIO%d at %" PRIu32 " Hz, zone %u control every %" PRIu32 " ms",
+             config->pwm_gpio, config->pwm_freq_hz, config->zone, config->pid.period_ms);
+    return ESP_OK;
+
+err_timer:
+    ESP_LOGE(TAG, "Failed to set up control timer: %s", esp_err_to_name(ret));
+    gptimer_del_timer(control_timer);
+    control_timer = NULL;
+err_task:
+    vTaskDelete(control_task_handle);
+    control_task_handle = NULL;
+    return ret;
+}
+
+esp_err_t heater_control_start(void)
+{
+    if (control_timer == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    __atomic_store_n(&control_started, true, __ATOMIC_RELAXED);
+    xTaskNotifyGive(control_task_handle);       // Runs the timer now if a setpoint is set
+    return ESP_OK;
+}
+
+void heater_control_set_setpoint(int32_t setpoint_centi)
+{
+    int32_t previous = __atomic_exchange_n(&control_setpoint, setpoint_centi, __ATOMIC_RELAXED);
+
+    // From off to on: wake the parked task to start the timer
+    if (previous == HEATER_CONTROL_OFF && setpoint_centi != HEATER_CONTROL_OFF &&
+        control_task_handle != NULL) {
+        xTaskNotifyGive(control_task_handle);
+    }
+}
+
+int32_t heater_control_get_setpoint(void)
+{
+    return __atomic_load_n(&control_setpoint, __ATOMIC_RELAXED);
+}
+
+void heater_control_get_metrics(heater_control_metrics_t *metrics)
+{
+    portENTER_CRITICAL(&stats_lock);
+    *metrics = control_stats.last;
+    metrics->jitter_avg_us = control_stats.jitter_samples > 0 ?
+                             (uint32_t)(control_stats.jitter_total_us / control_stats.jitter_samples) : 0;
+    metrics->exec_avg = metrics->steps > 0 ? (uint32_t)(control_stats.exec_total / metrics->steps) : 0;
+    portEXIT_CRITICAL(&stats_lock);
+}
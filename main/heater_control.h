@@ -0,0 +1,122 @@
+/**
+ * @file heater_control.h
+ * @brief Closed-loop heater control at a fixed rate
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * A GPTimer alarm fires every control period (20 ms = 50 Hz) and wakes a
+ * high-priority control task. Each step reads the filtered temperature of
+ * one grill zone, runs heater_pid and writes the duty to an LEDC PWM channel
+ * driving the heater's solid-state relay. The timer, not the task, sets the
+ * pace, so the rate does not drift with the step's own run time.
+ *
+ * The heater is off (0 % duty, controller reset) while there is no setpoint,
+ * and also when the zone has no reading or its reading is older than
+ * HEATER_CONTROL_STALE_MS. Without a setpoint the task stops and disables the
+ * timer after writing 0 % duty: the timer driver then drops its power
+ * management lock and nothing wakes the chip at 50 Hz (power_mgmt.h). A new
+ * setpoint starts it again.
+ *
+ * Each step is timed. heater_control_get_metrics() reports:
+ * - period jitter: how far each wake-up interval is from the nominal period
+ * - execution time: cycles from wake-up to duty written
+ * - overruns: timer periods missed because a step ran late
+ * - the last setpoint, measurement, duty and PID terms
+ */
+
+#ifndef HEATER_CONTROL_H
+#define HEATER_CONTROL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "driver/gpio.h"
+#include "heater_pid.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define HEATER_CONTROL_OFF          INT32_MIN   // Setpoint that turns the heater off
+#define HEATER_CONTROL_STALE_MS     500         // Older zone readings count as a sensor fault
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Control subsystem configuration
+ */
+typedef struct {
+    gpio_num_t pwm_gpio;            /**< Heater SSR drive pin */
+    uint32_t pwm_freq_hz;           /**< LEDC PWM frequency */
+    uint8_t zone;                   /**< grill_zones zone fed back to the controller */
+    heater_pid_config_t pid;        /**< Tuning; pid.period_ms is the control period */
+} heater_control_config_t;
+
+/**
+ * @brief Loop health and last-step values
+ */
+typedef struct {
+    uint32_t steps;                 /**< Control steps run */
+    uint32_t overruns;              /**< Timer periods missed */
+    uint32_t sensor_faults;         /**< Steps with no or stale reading (heater off) */
+    uint32_t jitter_avg_us;         /**< Mean |wake interval - period| */
+    uint32_t jitter_max_us;         /**< Worst |wake interval - period| */
+    uint32_t exec_avg;              /**< Mean step time (CYCLE_COUNTER_UNIT) */
+    uint32_t exec_max;              /**< Worst step time (CYCLE_COUNTER_UNIT) */
+    int32_t setpoint_centi;         /**< HEATER_CONTROL_OFF when off */
+    int32_t measured_centi;
+    int32_t duty;                   /**< 0..HEATER_PID_OUTPUT_MAX */
+    int32_t p_term;                 /**< PID terms of the last step (duty units) */
+    int32_t i_term;
+    int32_t d_term;
+    int32_t ff_term;
+} heater_control_metrics_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Set up the PWM output (heater off), the controller, the task and the timer
+ *
+ * The zone subsystem must be initialised first.
+ *
+ * @param config Configuration (copied)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG on invalid configuration or tuning
+ * @return ESP_ERR_INVALID_STATE if already initialised
+ * @return ESP_ERR_NO_MEM if the task cannot be created
+ */
+esp_err_t heater_control_init(const heater_control_config_t *config);
+
+/**
+ * @brief Start control: the timer runs from now on whenever there is a setpoint
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if not initialised
+ */
+esp_err_t heater_control_start(void);
+
+/**
+ * @brief Change the target temperature (any task)
+ *
+ * @param setpoint_centi Target in centi-degrees C, or HEATER_CONTROL_OFF
+ */
+void heater_control_set_setpoint(int32_t setpoint_centi);
+
+/**
+ * @brief Current target (HEATER_CONTROL_OFF when off)
+ */
+int32_t heater_control_get_setpoint(void);
+
+/**
+ * @brief Copy the loop metrics
+ */
+void heater_control_get_metrics(heater_control_metrics_t *metrics);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEATER_CONTROL_H */
@@ -0,0 +1,121 @@
+/**
+ * @file heater_pid.c
+ * @brief Fixed-point PID implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stddef.h>
+#include <math.h>
+#include "heater_pid.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define PID_ONE_Q                   (1LL << HEATER_PID_Q)
+#define PID_OUTPUT_MAX_Q            ((int64_t)HEATER_PID_OUTPUT_MAX << HEATER_PID_Q)
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Convert a gain to Q16.16, rejecting negative or oversized values
+ */
+static bool to_q(float value, int32_t *q)
+{
+    double scaled = (double)value * (double)PID_ONE_Q;
+
+    if (!(scaled >= 0.0) || scaled > (double)INT32_MAX) {
+        return false;
+    }
+    *q = (int32_t)lround(scaled);
+    return true;
+}
+
+/**
+ * @brief Q16.16 to output units, rounded to nearest
+ */
+static int32_t from_q(int64_t value_q)
+{
+    return (int32_t)((value_q + (PID_ONE_Q / 2)) >> HEATER_PID_Q);
+}
+
+esp_err_t heater_pid_init(heater_pid_t *pid, const heater_pid_config_t *config)
+{
+    if (pid == NULL || config == NULL || config->period_ms == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // 1 % duty = 100 output units and 1 C = 100 centi, so %/C is units/centi
+    const float dt_s = (float)config->period_ms / 1000.0f;
+    heater_pid_t converted = { .ambient_centi = config->ambient_centi };
+    if (!(config->kd_filter_s >= 0.0f) ||
+        !to_q(config->kp, &converted.kp_q) ||
+        !to_q(config->ki * dt_s, &converted.ki_q) ||
+        !to_q(config->kd / dt_s, &converted.kd_q) ||
+        !to_q(dt_s / (config->kd_filter_s + dt_s), &converted.kd_alpha_q) ||
+        !to_q(config->kff, &converted.kff_q)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    *pid = converted;
+    heater_pid_reset(pid);
+    return ESP_OK;
+}
+
+void heater_pid_reset(heater_pid_t *pid)
+{
+    pid->integral_q = 0;
+    pid->derivative_q = 0;
+    pid->previous_centi = 0;
+    pid->primed = false;
+    pid->p_term = 0;
+    pid->i_term = 0;
+    pid->d_term = 0;
+    pid->ff_term = 0;
+    pid->output = 0;
+    pid->saturated = false;
+}
+
+int32_t heater_pid_step(heater_pid_t *pid, int32_t setpoint_centi, int32_t measured_centi)
+{
+    const int64_t error = (int64_t)setpoint_centi - measured_centi;
+
+    const int64_t p_q = (int64_t)pid->kp_q * error;
+    if (pid->primed) {
+        // First-order low-pass: d += alpha * (raw - d)
+        const int64_t raw_q = -(int64_t)pid->kd_q * ((int64_t)measured_centi - pid->previous_centi);
+        pid->derivative_q += ((raw_q - pid->derivative_q) * pid->kd_alpha_q) >> HEATER_PID_Q;
+    }
+    const int64_t d_q = pid->derivative_q;
+    const int64_t ff_q = (int64_t)pid->kff_q * ((int64_t)setpoint_centi - pid->ambient_centi);
+    pid->previous_centi = measured_centi;
+    pid->primed = true;
+
+    // Conditional integration: hold the integral while saturated in the error's direction
+    const int64_t without_i_q = p_q + d_q + ff_q;
+    int64_t integral_q = pid->integral_q + (int64_t)pid->ki_q * error;
+    const int64_t candidate_q = without_i_q + integral_q;
+    if ((candidate_q > PID_OUTPUT_MAX_Q && error > 0) || (candidate_q < 0 && error < 0)) {
+        integral_q = pid->integral_q;
+    }
+    if (integral_q > PID_OUTPUT_MAX_Q) {
+        integral_q = PID_OUTPUT_MAX_Q;
+    } else if (integral_q < -PID_OUTPUT_MAX_Q) {
+        integral_q = -PID_OUTPUT_MAX_Q;
+    }
+    pid->integral_q = integral_q;
+
+    int64_t output_q = without_i_q + integral_q;
+    pid->saturated = (output_q < 0 || output_q > PID_OUTPUT_MAX_Q);
+    if (output_q < 0) {
+        output_q = 0;
+    } else if (output_q > PID_OUTPUT_MAX_Q) {
+        output_q = PID_OUTPUT_MAX_Q;
+    }
+
+    pid->p_term = from_q(p_q);
+    pid->i_term = from_q(integral_q);
+    pid->d_term = from_q(d_q);
+    pid->ff_term = from_q(ff_q);
+    pid->output = from_q(output_q);
+    return pid->output;
+}
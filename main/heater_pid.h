@@ -0,0 +1,111 @@
+/**
+ * @file heater_pid.h
+ * @brief Fixed-point PID with feed-forward and anti-windup for the heater
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Temperatures are centi-degrees C and the output is heater duty in
+ * HEATER_PID_OUTPUT_MAX steps (0.01 %). Gains are given in percent units in
+ * heater_pid_config_t and converted once to Q16.16 per-sample factors, so
+ * heater_pid_step() is integer multiply-adds only (no float, no division):
+ *
+ *   out = Kp*e + I + Kd*d(-pv)/dt + Kff*(sp - ambient)
+ *
+ * - The derivative acts on the measurement, so setpoint steps do not kick.
+ *   It is low-passed (first order, kd_filter_s): at a 20 ms period a single
+ *   0.01 C quantisation step would otherwise move the output by Kd/dt/100.
+ * - Feed-forward supplies the duty that holds sp against losses to ambient;
+ *   the integral only has to trim the model error.
+ * - Anti-windup: the integral does not grow while the output is saturated
+ *   in the direction the error pushes, and is clamped to the output range.
+ *
+ * The module is hardware-independent; heater_control runs it at a fixed rate.
+ */
+
+#ifndef HEATER_PID_H
+#define HEATER_PID_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define HEATER_PID_OUTPUT_MAX       10000   // 100.00 % duty
+#define HEATER_PID_Q                16      // Fraction bits of gains and terms
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Controller tuning (converted to fixed point by heater_pid_init)
+ */
+typedef struct {
+    float kp;                   /**< % duty per C of error */
+    float ki;                   /**< % duty per C of error per second */
+    float kd;                   /**< % duty per C/s of measurement change */
+    float kd_filter_s;          /**< Derivative low-pass time constant (0 = unfiltered) */
+    float kff;                  /**< % duty per C of setpoint above ambient */
+    int32_t ambient_centi;      /**< Ambient temperature for the feed-forward */
+    uint32_t period_ms;         /**< Control period (step interval) */
+} heater_pid_config_t;
+
+/**
+ * @brief Controller state (all terms Q16.16 in output units)
+ */
+typedef struct {
+    int32_t kp_q;               /**< Output units per centi-degree */
+    int32_t ki_q;               /**< Per centi-degree, per step */
+    int32_t kd_q;               /**< Per centi-degree change between steps */
+    int32_t kd_alpha_q;         /**< Derivative low-pass weight of the new sample, dt / (tau + dt) */
+    int32_t kff_q;              /**< Per centi-degree above ambient */
+    int32_t ambient_centi;
+
+    int64_t integral_q;         /**< Integral term */
+    int64_t derivative_q;       /**< Filtered derivative term */
+    int32_t previous_centi;     /**< Measurement of the previous step */
+    bool primed;                /**< previous_centi valid */
+
+    // Last step, for metrics and tuning
+    int32_t p_term;             /**< Output units */
+    int32_t i_term;
+    int32_t d_term;
+    int32_t ff_term;
+    int32_t output;             /**< Duty, 0..HEATER_PID_OUTPUT_MAX */
+    bool saturated;             /**< Output clamped in the last step */
+} heater_pid_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Convert the tuning to fixed point and reset the state
+ *
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG on a zero period, negative gains or
+ *         filter time, or gains that do not fit Q16.16
+ */
+esp_err_t heater_pid_init(heater_pid_t *pid, const heater_pid_config_t *config);
+
+/**
+ * @brief Forget the integral, the derivative and the previous measurement (heater turned off)
+ */
+void heater_pid_reset(heater_pid_t *pid);
+
+/**
+ * @brief Run one control step
+ *
+ * @param pid Controller
+ * @param setpoint_centi Target temperature
+ * @param measured_centi Filtered measurement
+ * @return Duty, 0..HEATER_PID_OUTPUT_MAX
+ */
+int32_t heater_pid_step(heater_pid_t *pid, int32_t setpoint_centi, int32_t measured_centi);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEATER_PID_H */
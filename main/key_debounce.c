@@ -0,0 +1,111 @@
+/**
+ * @file key_debounce.c
+ * @brief Hardware-independent key debounce core implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include "key_debounce.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Lock-out debounce: react to the first edge, then hold off
+ *
+ * Reproduces the original scanner behaviour: lowest latency, but a single
+ * noise spike on an idle key is reported as a full press.
+ */
+static bool debounce_lockout(key_debounce_t *key, const key_debounce_config_t *config,
+                             bool reading, uint64_t now_us)
+{
+    if (reading == key->state) {
+        return false;
+    }
+
+    if (now_us - key->last_change_time < config->debounce_us) {
+        return false;
+    }
+
+    key->state = reading;
+    key->last_change_time = now_us;
+    return true;
+}
+
+/**
+ * @brief Stability debounce: the raw level must hold for the whole window
+ */
+static bool debounce_stable(key_debounce_t *key, const key_debounce_config_t *config,
+                            bool reading, uint64_t now_us)
+{
+    if (reading != key->raw) {
+        key->raw = reading;
+        key->last_change_time = now_us;
+        return false;
+    }
+
+    if (reading == key->state) {
+        return false;
+    }
+
+    if (now_us - key->last_change_time < config->debounce_us) {
+        return false;
+    }
+
+    key->state = reading;
+    return true;
+}
+
+/**
+ * @brief Integrator debounce: counts towards the reading, flips at the rails
+ */
+static bool debounce_integrator(key_debounce_t *key, const key_debounce_config_t *config,
+                                bool reading, uint64_t now_us)
+{
+    uint8_t max = config->integrator_samples ? config->integrator_samples : 1;
+
+    if (reading) {
+        if (key->integrator < max) {
+            key->integrator++;
+        }
+    } else if (key->integrator > 0) {
+        key->integrator--;
+    }
+
+    if (key->integrator == max && !key->state) {
+        key->state = true;
+        key->last_change_time = now_us;
+        return true;
+    }
+
+    if (key->integrator == 0 && key->state) {
+        key->state = false;
+        key->last_change_time = now_us;
+        return true;
+    }
+
+    return false;
+}
+
+bool key_debounce_update(key_debounce_t *key, const key_debounce_config_t *config,
+                         bool reading, uint64_t now_us)
+{
+    switch (config->mode) {
+        case KEY_DEBOUNCE_STABLE:
+            return debounce_stable(key, config, reading, now_us);
+        case KEY_DEBOUNCE_INTEGRATOR:
+            return debounce_integrator(key, config, reading, now_us);
+        case KEY_DEBOUNCE_LOCKOUT:
+        default:
+            return debounce_lockout(key, config, reading, now_us);
+    }
+}
+
+const char *key_debounce_mode_name(key_debounce_mode_t mode)
+{
+    switch (mode) {
+        case KEY_DEBOUNCE_LOCKOUT:    return "lockout";
+        case KEY_DEBOUNCE_STABLE:     return "stable";
+        case KEY_DEBOUNCE_INTEGRATOR: return "integrator";
+        default:                      return "unknown";
+    }
+}
@@ -0,0 +1,83 @@
+/**
+ * @file key_debounce.h
+ * @brief Hardware-independent key debounce core for the matrix keyboard
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The debounce decision for a single key is kept free of GPIO, timer and
+ * FreeRTOS dependencies so the exact logic used by the scanner can also be
+ * driven by the host-side keypad simulator (see host/debounce_bench.c).
+ */
+
+#ifndef KEY_DEBOUNCE_H
+#define KEY_DEBOUNCE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Debounce algorithm selection
+ */
+typedef enum {
+    KEY_DEBOUNCE_LOCKOUT = 0,   /**< Accept the first edge, then ignore changes for the window */
+    KEY_DEBOUNCE_STABLE,        /**< Accept a change only after the raw level held for the window */
+    KEY_DEBOUNCE_INTEGRATOR,    /**< Saturating counter, flips state at either rail */
+} key_debounce_mode_t;
+
+/**
+ * @brief Debounce configuration shared by every key of the matrix
+ */
+typedef struct {
+    key_debounce_mode_t mode;       /**< Algorithm used for all keys */
+    uint32_t debounce_us;           /**< Window for LOCKOUT and STABLE modes */
+    uint8_t integrator_samples;     /**< Counter range for INTEGRATOR mode (1-255) */
+} key_debounce_config_t;
+
+/**
+ * @brief Per-key debounce state
+ *
+ * Zero-initialisation yields a released key with no pending change.
+ */
+typedef struct {
+    uint64_t last_change_time;  /**< LOCKOUT: last accepted edge, STABLE: last raw edge */
+    bool state;                 /**< Debounced key state (true = pressed) */
+    bool raw;                   /**< Last raw reading (STABLE mode) */
+    uint8_t integrator;         /**< Saturating counter (INTEGRATOR mode) */
+} key_debounce_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Feed one raw reading of a key into its debounce state
+ *
+ * @param key Per-key state to update
+ * @param config Debounce configuration
+ * @param reading Raw level read from the matrix (true = contact closed)
+ * @param now_us Timestamp of the reading in microseconds
+ *
+ * @return true if the debounced state changed and an event must be emitted
+ * @return false otherwise
+ */
+bool key_debounce_update(key_debounce_t *key, const key_debounce_config_t *config,
+                         bool reading, uint64_t now_us);
+
+/**
+ * @brief Get a short human-readable name of a debounce mode
+ *
+ * @param mode Debounce algorithm
+ * @return Pointer to a static string
+ */
+const char *key_debounce_mode_name(key_debounce_mode_t mode);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* KEY_DEBOUNCE_H */
@@ -20,61 +20,112 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/queue.h"
+#include "freertos/semphr.h"
 #include "driver/gpio.h"
-#include "esp_adc/adc_oneshot.h"
 #include "esp_adc/adc_cali.h"
 #include "esp_adc/adc_cali_scheme.h"
 #include "esp_log.h"
 #include "esp_err.h"
 #include "esp_timer.h"
+#include "esp_pm.h"
 #include "matrix_keyboard.h"
+#include "key_debounce.h"
+#include "rotary_encoder.h"
+#include "grill_zones.h"
+#include "cycle_counter.h"
+#include "session_store.h"
+#include "doneness.h"
+#include "cook_profile.h"
+#include "temp_alarm.h"
+#include "seqlock.h"
+#include "heater_control.h"
+#include "event_bus.h"
+#include "ui_fsm.h"
+#include "task_layout.h"
+#include "diagnostics.h"
+#include "cpu_profiler.h"
+#include "power_mgmt.h"
+#include "grill_console.h"
+#include "telemetry.h"
 #include "hd44780.h"
 
 /* ==================== CONFIGURATION CONSTANTS ==================== */
 
-#define MATRIX_ROWS                 4
-#define MATRIX_COLS                 4
-#define DEBOUNCE_TIME_MS           50      // Professional debounce timing
-#define SCAN_INTERVAL_MS           10      // Fast scanning for responsiveness
-#define KEY_QUEUE_SIZE             16      // Buffer for key events
+// Matrix size, debounce window and scan period: matrix_keyboard.h (Kconfig)
+#define DEBOUNCE_TIME_MIN_MS       10      // Console range of debounce_ms
+#define DEBOUNCE_TIME_MAX_MS       200
+#define SCAN_INTERVAL_MIN_MS       5       // Console range of scan_ms
+#define SCAN_INTERVAL_MAX_MS       50
 
 /* ==================== HAMBURGER GRILL CONSTANTS ==================== */
-#define BLUE_RARE_MIN              20      // BLUE RARE temperature range
-#define BLUE_RARE_MAX              25
-#define MEDIUM_RARE_MIN            26      // MEDIUM RARE temperature range
-#define MEDIUM_RARE_MAX            30
-#define WELL_DONE_MIN              31      // WELL DONE temperature range
-#define WELL_DONE_MAX              35
-#define SOLE_RARE_MIN              36      // SOLE RARE temperature range
-#define SOLE_RARE_MAX              40
-
-#define TEMP_SENSOR_ADC_CHANNEL    ADC_CHANNEL_0  // ADC channel for potentiometer
+// Doneness bands and safe ranges come from the cooking profiles (cook_profile_data.c)
+#define PROFILE_KEY                'A'     // Cycles the cooking profile while entering a temperature
+#define CPU_PAGE_KEY               'B'     // Pages through the CPU load screens
+
+#define TEMP_SENSOR_ADC_CHANNEL    ADC_CHANNEL_0  // ADC channel for potentiometer (zone 0)
+#define GRILL_ZONE_COUNT           4       // Zone probes scanned in one ADC pattern (max 8)
 #define ADC_ATTEN                  ADC_ATTEN_DB_12
 #define ADC_WIDTH                  ADC_BITWIDTH_12
-#define TEMP_UPDATE_INTERVAL_MS    500     // Temperature reading interval
+#define TEMP_UPDATE_INTERVAL_MS    CONFIG_GRILL_TEMP_UPDATE_MS  // Reading interval (console: monitor_ms)
+#define TEMP_UPDATE_MIN_MS         100
+#define TEMP_UPDATE_MAX_MS         5000
+#define ADC_SAMPLE_FREQ_HZ         20000   // Conversion rate per zone (x zones <= 83.3 kHz total)
+#define ADC_OVERSAMPLE_BITS        4       // 4^4 = 256 samples per reading -> 16-bit, ~78 Hz
+#define TEMP_LUT_REPORT_AT_BOOT    1       // Log LUT accuracy against the float path at init
+#define TEMP_INPUT_MAX             999     // Largest temperature the entry accepts (3 digits)
+#define SESSION_ZONE_LOG_INTERVAL_MS 10000 // Zone temperatures written to the session log
+#define TELEMETRY_COUNTERS_INTERVAL_MS 1000 // Driver counters in the telemetry stream
+#define DONENESS_DISPLAY_INTERVAL_MS 1000  // LCD refresh of the time-to-doneness line
+#define STATUS_SCREEN_MS           2000    // '#' status screen, then back to the meat term
+#define MESSAGE_SCREEN_MS          1500    // Transient messages before the normal display returns
+#define ALARM_HYSTERESIS_CENTI     50      // 0.5 C past a band or safe-range edge before it changes
+#define ALARM_BAND_DWELL_MS        2000    // A new band must hold this long
+#define ALARM_DWELL_MS             3000    // An alarm must hold this long to raise or clear
+#define ALARM_RATE_CENTI_PER_MIN   600     // FAST CHANGE above 6 C/min
+#define ALARM_RATE_HYSTERESIS      200     // ... cleared below 4 C/min
+#define ALARM_QUEUE_SIZE           8       // Alarm events waiting for the main loop
+#define HEATER_CONTROL_PERIOD_MS   20      // 50 Hz control loop (GPTimer paced)
+#define HEATER_PWM_FREQ_HZ         20      // Slow PWM for the heater's solid-state relay
+#define HEATER_KP                  20.0f   // % duty per C of error
+#define HEATER_KI                  0.02f   // % duty per C of error per second
+#define HEATER_KD                  20.0f   // % duty per C/s of temperature change
+#define HEATER_KD_FILTER_S         1.0f    // Derivative low-pass: a 0.01 C step kicks 0.2 %, not 10 %
+#define HEATER_KFF                 0.5f    // % duty per C above ambient (holding losses)
+#define HEATER_AMBIENT_CENTI       2000    // Ambient assumed by the feed-forward
+
+/* ==================== ROTARY ENCODER CONFIGURATION ==================== */
+#define ENCODER_PIN_A              GPIO_NUM_12    // Encoder phase A (PCNT edge input)
+#define ENCODER_PIN_B              GPIO_NUM_13    // Encoder phase B (PCNT level input)
+#define HEATER_PWM_GPIO            GPIO_NUM_14    // Heater SSR drive (LEDC PWM)
+#define ENCODER_SLOW_INTERVAL_MS   120     // Detent interval below which acceleration starts
+#define ENCODER_FAST_INTERVAL_MS   15      // Detent interval giving full acceleration
+#define ENCODER_MAX_MULTIPLIER     10      // Steps per detent at full speed
+#define ENCODER_IDLE_MS            1000    // Knob rest before the PCNT unit lets the chip sleep
 
 /* ==================== GPIO PIN ASSIGNMENTS ==================== */
-/* ESP32-S3 GPIO pins - easily configurable for different layouts */
+/* ESP32-S3 GPIO pins from menuconfig ("Hamburger Grill"): compile-time constants */
 
 // Row pins (outputs) - GPIO pins for driving rows
 static const gpio_num_t row_pins[MATRIX_ROWS] = {
-    GPIO_NUM_1,   // Row 0
-    GPIO_NUM_2,   // Row 1
-    GPIO_NUM_42,  // Row 2
-    GPIO_NUM_41   // Row 3
+    CONFIG_GRILL_KEYPAD_ROW0_GPIO,
+    CONFIG_GRILL_KEYPAD_ROW1_GPIO,
+    CONFIG_GRILL_KEYPAD_ROW2_GPIO,
+    CONFIG_GRILL_KEYPAD_ROW3_GPIO,
 };
 
 // Column pins (inputs with pullup) - GPIO pins for reading columns
 static const gpio_num_t col_pins[MATRIX_COLS] = {
-    GPIO_NUM_40,  // Col 0
-    GPIO_NUM_39,  // Col 1
-    GPIO_NUM_38,  // Col 2
-    GPIO_NUM_37   // Col 3
+    CONFIG_GRILL_KEYPAD_COL0_GPIO,
+    CONFIG_GRILL_KEYPAD_COL1_GPIO,
+    CONFIG_GRILL_KEYPAD_COL2_GPIO,
+#if MATRIX_COLS > 3
+    CONFIG_GRILL_KEYPAD_COL3_GPIO,
+#endif
 };
 
 /* ==================== KEY MAPPING CONFIGURATION ==================== */
-/* Professional keypad layout - easily customizable */
-static const char key_map[MATRIX_ROWS][MATRIX_COLS] = {
+/* The 4x4 layout; a 4x3 keypad is its first three columns */
+static const char key_map[MATRIX_ROWS][4] = {
     {'1', '2', '3', 'A'},
     {'4', '5', '6', 'B'},
     {'7', '8', '9', 'C'},
@@ -89,12 +140,12 @@ static hd44780_t lcd = {
     .font = HD44780_FONT_5X8,
     .lines = 2,
     .pins = {
-        .rs = GPIO_NUM_10,   // Register Select
-        .e  = GPIO_NUM_11,   // Enable
-        .d4 = GPIO_NUM_16,   // Data bit 4
-        .d5 = GPIO_NUM_17,   // Data bit 5  
-        .d6 = GPIO_NUM_18,   // Data bit 6
-        .d7 = GPIO_NUM_7,    // Data bit 7
+        .rs = CONFIG_GRILL_LCD_RS_GPIO,   // Register Select
+        .e  = CONFIG_GRILL_LCD_E_GPIO,    // Enable
+        .d4 = CONFIG_GRILL_LCD_D4_GPIO,   // Data bit 4
+        .d5 = CONFIG_GRILL_LCD_D5_GPIO,   // Data bit 5
+        .d6 = CONFIG_GRILL_LCD_D6_GPIO,   // Data bit 6
+        .d7 = CONFIG_GRILL_LCD_D7_GPIO,   // Data bit 7
         .bl = HD44780_NOT_USED  // No backlight control
     }
 };
@@ -102,47 +153,92 @@ static hd44780_t lcd = {
 /* ==================== DATA STRUCTURES ==================== */
 
 /**
- * @brief System state enumeration
+ * @brief UI screens (states of the ui_fsm transition table)
  */
 typedef enum {
     STATE_ASK_TEMPERATURE,      // Ask user to input temperature
     STATE_INPUTTING_TEMPERATURE, // User is typing temperature
     STATE_SHOWING_MEAT_TERM,    // Show determined meat term
-    STATE_SHOWING_STATUS        // Show status temporarily
+    STATE_SHOWING_STATUS,       // Show status temporarily
+    STATE_SHOWING_MESSAGE,      // Show a function key message temporarily
+    STATE_SHOWING_CPU_LOAD,     // Page through CPU load per core and task
+    STATE_COUNT
 } system_state_t;
 
 /**
- * @brief Hamburger cooking levels enumeration
+ * @brief UI events (argument: key character, or encoder steps)
  */
 typedef enum {
-    BLUE_RARE = 0,
-    MEDIUM_RARE,
-    WELL_DONE,
-    SOLE_RARE,
-    NO_DETERMINATION
-} cooking_level_t;
+    UI_EVENT_DIGIT,             // '0'-'9'
+    UI_EVENT_CONFIRM,           // '#'
+    UI_EVENT_CANCEL,            // '*'
+    UI_EVENT_PROFILE,           // PROFILE_KEY
+    UI_EVENT_CPU_PAGE,          // CPU_PAGE_KEY
+    UI_EVENT_FUNCTION,          // Other letter keys
+    UI_EVENT_ENCODER,           // Accelerated encoder steps
+    UI_EVENT_TIMEOUT,           // Timed screen expired (UI timer)
+    UI_EVENT_COUNT
+} ui_event_t;
+
+/**
+ * @brief Cooking level: band index in the active cooking profile
+ */
+typedef uint8_t cooking_level_t;
+
+#define NO_DETERMINATION           COOK_PROFILE_NO_BAND
 
 /**
- * @brief Grill system state structure
+ * @brief Grill system state structure (owned by the main loop)
  */
 typedef struct {
-    system_state_t current_state;           // Current system state
     cooking_level_t determined_level;       // Automatically determined cooking level
     int input_temperature;                  // Temperature input by user
     char temp_input_buffer[4];              // Buffer for temperature input (max 3 digits)
     int temp_input_index;                   // Current position in input buffer
-    float sensor_temp;                      // Current temperature from sensor (potentiometer)
     bool temp_in_range;                     // Temperature within determined range
     bool warning_active;                    // Warning state for out of range
+    char function_key;                      // Key shown on the function message screen
+    int cpu_page;                           // CPU load page shown
 } grill_state_t;
 
+/**
+ * @brief Sensor readings published by the monitoring task (seqlock snapshot)
+ */
+typedef struct {
+    float sensor_temp;                      // Current temperature from sensor (potentiometer)
+    int32_t zone_temps[GRILL_ZONE_COUNT];   // Filtered zone temperatures (centi-degrees C)
+    uint32_t time_ms;                       // When the readings were taken
+} grill_readings_t;
+
+/**
+ * @brief Cooking target published by the main loop for the monitoring task (seqlock snapshot)
+ */
+typedef struct {
+    int32_t input_temperature;              // Confirmed input temperature, -1 if none
+    cooking_level_t determined_level;       // Band of the input temperature
+    uint8_t profile;                        // Active cooking profile index
+    uint8_t reserved[2];                    // Pads the snapshot to whole words
+} grill_target_t;
+
+// seqlock copies whole 32-bit words
+_Static_assert(sizeof(grill_readings_t) % sizeof(uint32_t) == 0, "grill_readings_t must be whole words");
+_Static_assert(sizeof(grill_target_t) % sizeof(uint32_t) == 0, "grill_target_t must be whole words");
+_Static_assert(GRILL_ZONE_NO_READING == TELEMETRY_NO_VALUE && HEATER_CONTROL_OFF == TELEMETRY_NO_VALUE &&
+               TEMP_ALARM_RATE_UNKNOWN == TELEMETRY_NO_VALUE, "telemetry sends the sentinels as they are");
+// send_telemetry_counters() adds each counter at most once into arrays of TELEMETRY_MAX_COUNTERS
+_Static_assert(TELEMETRY_COUNTER_COUNT <= TELEMETRY_MAX_COUNTERS, "counters no longer fit in one record");
+
 /**
  * @brief Matrix keyboard state management structure
  */
 typedef struct {
-    bool current_state[MATRIX_ROWS][MATRIX_COLS];    // Current key states
-    bool previous_state[MATRIX_ROWS][MATRIX_COLS];   // Previous key states
-    uint64_t last_change_time[MATRIX_ROWS][MATRIX_COLS]; // Debounce timing
+    key_debounce_t keys[MATRIX_ROWS][MATRIX_COLS];   // Per-key debounce state
+    key_debounce_config_t debounce;                   // Debounce algorithm and window
+    uint32_t debounce_ms;                             // Window the config was derived from
+    uint32_t scan_interval_ms;                        // Scan period (read by the scan task)
+    SemaphoreHandle_t scan_lock;                      // Rows and debounce state: scan task vs console
+    matrix_keyboard_stats_t stats;                    // Counters (scan task)
+    int64_t init_time_us;
     bool initialized;                                 // Driver initialization flag
 } matrix_keyboard_t;
 
@@ -153,47 +249,267 @@ static matrix_keyboard_t keyboard = {0};
 static QueueHandle_t key_event_queue = NULL;
 static TaskHandle_t scan_task_handle = NULL;
 static grill_state_t grill_system = {
-    .current_state = STATE_ASK_TEMPERATURE,
     .determined_level = NO_DETERMINATION,
     .input_temperature = -1,
     .temp_input_buffer = {0},
     .temp_input_index = 0,
-    .sensor_temp = 0.0,
     .temp_in_range = false,
-    .warning_active = false
+    .warning_active = false,
+    .function_key = 0,
+    .cpu_page = 0
 };
+static ui_fsm_t grill_ui;                   // Screen state machine (main loop only)
+static int lcd_cost_depth = 0;              // Nesting of timed LCD writes (main loop only)
+static int64_t lcd_cost_started_us = 0;
+static SemaphoreHandle_t lcd_lock = NULL;   // LCD bus: main loop vs console benchmark
+static esp_pm_lock_handle_t lcd_pm_lock = NULL; // Full CPU speed during bus writes (NULL: no PM)
+static key_debounce_t console_debounce_saved;   // Key state around the debounce benchmark
+static uint32_t temp_update_interval_ms = TEMP_UPDATE_INTERVAL_MS;  // Monitoring period (console)
 
-// Cooking level names for display
-static const char* cooking_names[] = {
-    "BLUE RARE",     // 20-25°C
-    "MEDIUM RARE",   // 26-30°C  
-    "WELL DONE",     // 31-35°C
-    "SOLE RARE"      // 36-40°C
+// State shared between the cores: each snapshot has one writer and lock-free readers
+static seqlock_t readings_lock = SEQLOCK_INIT;
+static grill_readings_t shared_readings;
+static seqlock_t target_lock = SEQLOCK_INIT;
+static grill_target_t shared_target = {
+    .input_temperature = -1,
+    .determined_level = NO_DETERMINATION,
 };
 
-// ADC handles for new API
-static adc_oneshot_unit_handle_t adc1_handle;
+// Cooking profiles (beef, chicken, fish); the active one classifies temperatures
+static cook_profile_set_t cook_profiles;
+
+// ADC calibration handle and raw-to-temperature table (shared by all zones)
 static adc_cali_handle_t adc1_cali_handle;
+static temp_lut_t temp_lut;
+
+// ADC1 channel of each zone probe; zone 0 is the original potentiometer input
+static const adc_channel_t zone_channels[GRILL_ZONE_COUNT] = {
+    TEMP_SENSOR_ADC_CHANNEL,    // GPIO1
+    ADC_CHANNEL_2,              // GPIO3
+    ADC_CHANNEL_3,              // GPIO4
+    ADC_CHANNEL_4,              // GPIO5
+};
+
+// Filter stages, run on every oversampled reading of every zone (~78 Hz each)
+// while sampling continuously; standby burst readings (2 Hz) bypass them
+static const sensor_filter_stage_config_t temp_filter_stages[] = {
+    { .type = SENSOR_FILTER_MEDIAN, .median = { .window = 5 } },    // Reject single-reading spikes
+    { .type = SENSOR_FILTER_IIR,    .iir = { .shift = 3 } },        // ~100 ms time constant
+};
+
+// Zone 0 trend for the time-to-doneness prediction (fed by the monitoring task)
+static doneness_estimator_t temp_trend;
+static doneness_prediction_t doneness_prediction;
+static portMUX_TYPE doneness_lock = portMUX_INITIALIZER_UNLOCKED;
+
+// Band and alarm engine on zone 0 (owned by the monitoring task); its events
+// reach the main loop through a queue, which keeps the active-alarm mask
+static temp_alarm_t temp_alarm;
+static QueueHandle_t alarm_event_queue = NULL;
+static uint8_t active_alarms = 0;
 
 /* ==================== FUNCTION PROTOTYPES ==================== */
 
 static esp_err_t matrix_keyboard_gpio_init(void);
 static void matrix_keyboard_scan_task(void *pvParameters);
-static bool is_key_debounced(uint8_t row, uint8_t col);
+static bool is_key_debounced(uint8_t row, uint8_t col, bool reading);
 static void process_key_change(uint8_t row, uint8_t col, bool new_state);
 static void matrix_keyboard_scan_once(void);
+static bool matrix_keyboard_is_idle(void);
+static void matrix_keyboard_on_column(void *arg);
+static void matrix_keyboard_park(bool park);
+static void update_debounce_config(void);
+static esp_err_t matrix_keyboard_set_debounce_mode(key_debounce_mode_t mode);
 
 // Hamburger grill system functions
 static esp_err_t temperature_sensor_init(void);
 static float read_temperature_sensor(void);
 static void update_grill_display(void);
-static bool is_temperature_in_range(float temp, cooking_level_t level);
+static bool get_cooking_level_band(const cook_profile_t *profile, cooking_level_t level,
+                                   int *min_c, int *max_c);
+static void update_doneness_line(void);
+static void handle_alarm_event(const temp_alarm_event_t *event);
+static void publish_grill_target(void);
+static bool get_grill_readings(grill_readings_t *readings);
 static bool is_temperature_in_safe_range(int temperature);
 static cooking_level_t determine_meat_term_from_temperature(int temperature);
-static void handle_temperature_input(char key);
-static void process_temperature_input(void);
-static void handle_control_keys(char key);
+static const char *cooking_level_name(cooking_level_t level);
+static void select_next_cook_profile(void);
+static ui_event_t ui_event_for_key(char key);
+static void ui_dispatch(ui_event_t event, int32_t arg);
+static void log_ui_trace(void);
+static void enter_status_screen(void);
+static bool ui_input_not_full(int32_t key);
+static bool ui_has_input(int32_t key);
+static void ui_append_digit(int32_t key);
+static void ui_adjust_input(int32_t delta);
+static void ui_next_profile(int32_t key);
+static void ui_confirm_input(int32_t key);
+static void ui_reset_input(int32_t key);
+static void ui_set_function_key(int32_t key);
+static bool ui_has_target(int32_t key);
+static void ui_first_cpu_page(int32_t key);
+static void ui_next_cpu_page(int32_t key);
+static void lcd_bus_take(void);
+static void lcd_bus_give(void);
+static void lcd_cost_begin(void);
+static void lcd_cost_end(void);
+static void handle_key_event(const key_event_t *key_event);
+static bool is_doneness_line_shown(void);
 static void temperature_monitoring_task(void *pvParameters);
+static int32_t console_get_debounce_ms(void);
+static esp_err_t console_set_debounce_ms(int32_t value);
+static int32_t console_get_debounce_mode(void);
+static esp_err_t console_set_debounce_mode(int32_t value);
+static int32_t console_get_scan_ms(void);
+static esp_err_t console_set_scan_ms(int32_t value);
+static int32_t console_get_monitor_ms(void);
+static esp_err_t console_set_monitor_ms(int32_t value);
+static int32_t console_get_log_level(void);
+static esp_err_t console_set_log_level(int32_t value);
+static void console_print_keys(void);
+static void console_print_adc(void);
+static void console_print_heater(void);
+static void console_print_session_log(void);
+static void console_print_ui(void);
+static void console_print_memory(void);
+static void console_print_cpu(void);
+static void console_print_power(void);
+static void console_print_telemetry(void);
+static void console_print_pins(void);
+static esp_err_t console_lcd_begin(void);
+static void console_lcd_run(uint32_t iteration);
+static void console_lcd_end(void);
+static esp_err_t console_scan_begin(void);
+static void console_scan_run(uint32_t iteration);
+static void console_scan_end(void);
+static void console_lcd_bus_end(void);
+static void console_nibble_run(uint32_t iteration);
+static void console_byte_run(uint32_t iteration);
+static void console_puts_run(uint32_t iteration);
+static esp_err_t console_debounce_begin(void);
+static void console_debounce_run(uint32_t iteration);
+static void console_debounce_end(void);
+static void console_adc_run(uint32_t iteration);
+static void console_sensor_run(uint32_t iteration);
+static void console_classify_run(uint32_t iteration);
+static void console_telemetry_run(uint32_t iteration);
+static void send_telemetry_counters(void);
+
+/* ==================== UI STATE MACHINE ==================== */
+
+static const char *const ui_event_names[UI_EVENT_COUNT] = {
+    [UI_EVENT_DIGIT] = "DIGIT",
+    [UI_EVENT_CONFIRM] = "CONFIRM",
+    [UI_EVENT_CANCEL] = "CANCEL",
+    [UI_EVENT_PROFILE] = "PROFILE",
+    [UI_EVENT_CPU_PAGE] = "CPU_PAGE",
+    [UI_EVENT_FUNCTION] = "FUNCTION",
+    [UI_EVENT_ENCODER] = "ENCODER",
+    [UI_EVENT_TIMEOUT] = "TIMEOUT",
+};
+
+// Entry actions draw the screen; timed screens end with UI_EVENT_TIMEOUT
+static const ui_fsm_state_t ui_states[STATE_COUNT] = {
+    [STATE_ASK_TEMPERATURE]       = { "ASK",     update_grill_display, NULL, 0 },
+    [STATE_INPUTTING_TEMPERATURE] = { "INPUT",   update_grill_display, NULL, 0 },
+    [STATE_SHOWING_MEAT_TERM]     = { "TERM",    update_grill_display, NULL, 0 },
+    [STATE_SHOWING_STATUS]        = { "STATUS",  enter_status_screen,  NULL, STATUS_SCREEN_MS },
+    [STATE_SHOWING_MESSAGE]       = { "MESSAGE", update_grill_display, NULL, MESSAGE_SCREEN_MS },
+    [STATE_SHOWING_CPU_LOAD]      = { "CPU",     update_grill_display, NULL, 0 },
+};
+
+// First match wins; events without a row are ignored
+static const ui_fsm_transition_t ui_transitions[] = {
+    // from                        event              to                           guard              action
+    { STATE_ASK_TEMPERATURE,       UI_EVENT_DIGIT,    STATE_INPUTTING_TEMPERATURE, NULL,              ui_append_digit },
+    { STATE_ASK_TEMPERATURE,       UI_EVENT_ENCODER,  STATE_INPUTTING_TEMPERATURE, NULL,              ui_adjust_input },
+    { STATE_ASK_TEMPERATURE,       UI_EVENT_PROFILE,  STATE_ASK_TEMPERATURE,       NULL,              ui_next_profile },
+    { STATE_INPUTTING_TEMPERATURE, UI_EVENT_DIGIT,    STATE_INPUTTING_TEMPERATURE, ui_input_not_full, ui_append_digit },
+    { STATE_INPUTTING_TEMPERATURE, UI_EVENT_ENCODER,  STATE_INPUTTING_TEMPERATURE, NULL,              ui_adjust_input },
+    { STATE_INPUTTING_TEMPERATURE, UI_EVENT_CONFIRM,  STATE_SHOWING_MEAT_TERM,     ui_has_input,      ui_confirm_input },
+    { STATE_SHOWING_MEAT_TERM,     UI_EVENT_CONFIRM,  STATE_SHOWING_STATUS,        NULL,              NULL },
+    { STATE_SHOWING_MEAT_TERM,     UI_EVENT_FUNCTION, STATE_SHOWING_MESSAGE,       NULL,              ui_set_function_key },
+    { STATE_SHOWING_STATUS,        UI_EVENT_TIMEOUT,  STATE_SHOWING_MEAT_TERM,     NULL,              NULL },
+    { STATE_SHOWING_STATUS,        UI_EVENT_CONFIRM,  STATE_SHOWING_MEAT_TERM,     NULL,              NULL },
+    { STATE_SHOWING_MESSAGE,       UI_EVENT_TIMEOUT,  STATE_SHOWING_MEAT_TERM,     NULL,              NULL },
+    { STATE_SHOWING_MESSAGE,       UI_EVENT_CONFIRM,  STATE_SHOWING_MEAT_TERM,     NULL,              NULL },
+    { STATE_SHOWING_MESSAGE,       UI_EVENT_FUNCTION, STATE_SHOWING_MESSAGE,       NULL,              ui_set_function_key },
+    { STATE_SHOWING_MESSAGE,       UI_EVENT_DIGIT,    STATE_SHOWING_MEAT_TERM,     NULL,              NULL },
+    { STATE_SHOWING_MESSAGE,       UI_EVENT_ENCODER,  STATE_SHOWING_MEAT_TERM,     NULL,              NULL },
+    { STATE_ASK_TEMPERATURE,       UI_EVENT_CPU_PAGE, STATE_SHOWING_CPU_LOAD,      NULL,              ui_first_cpu_page },
+    { STATE_SHOWING_MEAT_TERM,     UI_EVENT_CPU_PAGE, STATE_SHOWING_CPU_LOAD,      NULL,              ui_first_cpu_page },
+    { STATE_SHOWING_MESSAGE,       UI_EVENT_CPU_PAGE, STATE_SHOWING_CPU_LOAD,      NULL,              ui_first_cpu_page },
+    { STATE_SHOWING_CPU_LOAD,      UI_EVENT_CPU_PAGE, STATE_SHOWING_CPU_LOAD,      NULL,              ui_next_cpu_page },
+    { STATE_SHOWING_CPU_LOAD,      UI_EVENT_CONFIRM,  STATE_SHOWING_MEAT_TERM,     ui_has_target,     NULL },
+    { STATE_SHOWING_CPU_LOAD,      UI_EVENT_CONFIRM,  STATE_ASK_TEMPERATURE,       NULL,              NULL },
+    { UI_FSM_ANY_STATE,            UI_EVENT_CANCEL,   STATE_ASK_TEMPERATURE,       NULL,              ui_reset_input },
+};
+
+static const ui_fsm_timer_t ui_timer_hooks = {
+    .start = event_bus_start_ui_timer,
+    .stop = event_bus_stop_ui_timer,
+};
+
+/* ==================== CONSOLE TABLES ==================== */
+
+static const grill_console_param_t console_params[] = {
+    { "debounce_ms", "keypad debounce window (ms)", DEBOUNCE_TIME_MIN_MS, DEBOUNCE_TIME_MAX_MS,
+      console_get_debounce_ms, console_set_debounce_ms },
+    { "debounce_mode", "0 lockout, 1 stable, 2 integrator", KEY_DEBOUNCE_LOCKOUT,
+      KEY_DEBOUNCE_INTEGRATOR, console_get_debounce_mode, console_set_debounce_mode },
+    { "scan_ms", "keypad scan period (ms)", SCAN_INTERVAL_MIN_MS, SCAN_INTERVAL_MAX_MS,
+      console_get_scan_ms, console_set_scan_ms },
+    { "monitor_ms", "reading / alarm / doneness period (ms)", TEMP_UPDATE_MIN_MS, TEMP_UPDATE_MAX_MS,
+      console_get_monitor_ms, console_set_monitor_ms },
+    { "log_level", "0 none .. 5 verbose (all tags)", ESP_LOG_NONE, ESP_LOG_VERBOSE,
+      console_get_log_level, console_set_log_level },
+};
+
+static const grill_console_stats_t console_stats[] = {
+    { "keys", "keypad driver", console_print_keys },
+    { "adc", "continuous ADC sampler and zone filters", console_print_adc },
+    { "heater", "control loop", console_print_heater },
+    { "log", "flash session log", console_print_session_log },
+    { "ui", "screen state machine and main loop events", console_print_ui },
+    { "memory", "latest stack and heap watermarks", console_print_memory },
+    { "cpu", "CPU load window", console_print_cpu },
+    { "pins", "GPIO assignment (fixed at build time)", console_print_pins },
+    { "power", "light-sleep wakeups and sleep time, PM locks", console_print_power },
+    { "telemetry", "binary stream: records, drops by priority, ring use", console_print_telemetry },
+};
+
+static const grill_console_bench_t console_benches[] = {
+    { "lcd", "clear and write both lines (HD44780 4-bit bus)",
+      console_lcd_begin, console_lcd_run, console_lcd_end },
+    { "scan", "one keypad matrix pass (includes the 1 ms row settle per row)",
+      console_scan_begin, console_scan_run, console_scan_end },
+    { "nibble", "one 4-bit bus cycle (write_nibble, no command delay)",
+      console_lcd_begin, console_nibble_run, console_lcd_bus_end },
+    { "byte", "one byte as two bus cycles (write_byte, no command delay)",
+      console_lcd_begin, console_byte_run, console_lcd_bus_end },
+    { "puts", "hd44780_puts of a full 16-character line",
+      console_lcd_begin, console_puts_run, console_lcd_end },
+    { "debounce", "one key through the debounce check",
+      console_debounce_begin, console_debounce_run, console_debounce_end },
+    { "adc", "oversampled code to temperature (LUT)",
+      NULL, console_adc_run, NULL },
+    { "sensor", "read_temperature_sensor (latest filtered zone 0)",
+      NULL, console_sensor_run, NULL },
+    { "classify", "temperature to cooking level in the active profile",
+      NULL, console_classify_run, NULL },
+    { "telemetry", "encode a zones record (payload, CRC, COBS) into a scratch frame",
+      NULL, console_telemetry_run, NULL },
+};
+
+static const grill_console_config_t console_tables = {
+    .params = console_params,
+    .param_count = sizeof(console_params) / sizeof(console_params[0]),
+    .stats = console_stats,
+    .stats_count = sizeof(console_stats) / sizeof(console_stats[0]),
+    .benches = console_benches,
+    .bench_count = sizeof(console_benches) / sizeof(console_benches[0]),
+};
 
 /* ==================== IMPLEMENTATION ==================== */
 
@@ -246,22 +562,44 @@ static esp_err_t matrix_keyboard_gpio_init(void)
         }
     }
     
+    // Column interrupts end the idle wait of the scan task (matrix_keyboard_park)
+    ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "Failed to install GPIO ISR service: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    for (int i = 0; i < MATRIX_COLS; i++) {
+        ret = gpio_isr_handler_add(col_pins[i], matrix_keyboard_on_column, NULL);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to add column %d interrupt: %s", i, esp_err_to_name(ret));
+            return ret;
+        }
+        gpio_intr_disable(col_pins[i]);
+    }
+    
+    // Keep rows driven and column pull-ups on through light sleep
+    for (int i = 0; i < MATRIX_ROWS; i++) {
+        gpio_sleep_sel_dis(row_pins[i]);
+    }
+    for (int i = 0; i < MATRIX_COLS; i++) {
+        gpio_sleep_sel_dis(col_pins[i]);
+    }
+    
     ESP_LOGI(TAG, "GPIO configuration completed successfully");
     return ESP_OK;
 }
 
 /**
- * @brief Check if key state change is debounced (professional implementation)
+ * @brief Feed a raw reading into the key's debounce state (professional implementation)
  * @param row Row index
  * @param col Column index
- * @return true if debounced, false if still bouncing
+ * @param reading Raw contact level (true = closed)
+ * @return true if the debounced state changed, false if unchanged or still bouncing
  */
-static bool is_key_debounced(uint8_t row, uint8_t col)
+static bool is_key_debounced(uint8_t row, uint8_t col, bool reading)
 {
-    uint64_t current_time = esp_timer_get_time();
-    uint64_t time_diff = current_time - keyboard.last_change_time[row][col];
-    
-    return (time_diff >= (DEBOUNCE_TIME_MS * 1000));
+    return key_debounce_update(&keyboard.keys[row][col], &keyboard.debounce,
+                               reading, esp_timer_get_time());
 }
 
 /**
@@ -272,22 +610,28 @@ static bool is_key_debounced(uint8_t row, uint8_t col)
  */
 static void process_key_change(uint8_t row, uint8_t col, bool new_state)
 {
-    // Update timing for debounce
-    keyboard.last_change_time[row][col] = esp_timer_get_time();
-    keyboard.current_state[row][col] = new_state;
-    
     // Create key event
     key_event_t event = {
         .row = row,
         .col = col,
         .key_char = key_map[row][col],
         .pressed = new_state,
-        .timestamp = esp_timer_get_time()
+        .timestamp = esp_timer_get_time(),
+        .source = KEY_EVENT_SOURCE_MATRIX,
+        .delta = 0
     };
     
-    // Send event to queue (non-blocking)
+    // Send event to queue (non-blocking); the stream gets every change, even a dropped one
+    telemetry_key(event.key_char, new_state, row, col);
+    if (new_state) {
+        keyboard.stats.total_key_presses++;
+    } else {
+        keyboard.stats.total_key_releases++;
+    }
     BaseType_t result = xQueueSend(key_event_queue, &event, 0);
     if (result != pdTRUE) {
+        // Atomic: matrix_keyboard_post_event_from_isr() counts its drops here too
+        __atomic_fetch_add(&keyboard.stats.queue_overflows, 1, __ATOMIC_RELAXED);
         ESP_LOGW(TAG, "Key event queue full, dropping event for key '%c'", 
                  event.key_char);
     } else {
@@ -298,6 +642,60 @@ static void process_key_change(uint8_t row, uint8_t col, bool new_state)
     }
 }
 
+/**
+ * @brief Whether every key is released with no change pending in the debouncer
+ */
+static bool matrix_keyboard_is_idle(void)
+{
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        for (int col = 0; col < MATRIX_COLS; col++) {
+            const key_debounce_t *key = &keyboard.keys[row][col];
+            if (key->state || key->raw || key->integrator > 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief A column went low with every row driven (ISR): a key went down
+ */
+static void matrix_keyboard_on_column(void *arg)
+{
+    BaseType_t task_woken = pdFALSE;
+    
+    // Level interrupts: the scan task re-enables them when it parks again
+    for (int col = 0; col < MATRIX_COLS; col++) {
+        gpio_intr_disable(col_pins[col]);
+    }
+    vTaskNotifyGiveFromISR(scan_task_handle, &task_woken);
+    portYIELD_FROM_ISR(task_woken);
+}
+
+/**
+ * @brief Park or resume the scanner (scan lock held)
+ *
+ * Parked, all rows are driven low so any key pulls its column low, which
+ * raises the column interrupt and, in light sleep, wakes the chip.
+ */
+static void matrix_keyboard_park(bool park)
+{
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        gpio_set_level(row_pins[row], park ? 0 : 1);
+    }
+    for (int col = 0; col < MATRIX_COLS; col++) {
+        if (park) {
+            gpio_set_intr_type(col_pins[col], GPIO_INTR_LOW_LEVEL);
+            gpio_wakeup_enable(col_pins[col], GPIO_INTR_LOW_LEVEL);
+            gpio_intr_enable(col_pins[col]);
+        } else {
+            gpio_intr_disable(col_pins[col]);
+            gpio_wakeup_disable(col_pins[col]);
+        }
+    }
+}
+
 /**
  * @brief Perform one complete matrix scan cycle
  */
@@ -314,14 +712,12 @@ static void matrix_keyboard_scan_once(void)
         // Read all columns for this row
         for (int col = 0; col < MATRIX_COLS; col++) {
             bool current_reading = !gpio_get_level(col_pins[col]); // Inverted logic
-            bool previous_state = keyboard.current_state[row][col];
             
-            // Check for state change
-            if (current_reading != previous_state) {
-                // Verify debouncing
-                if (is_key_debounced(row, col)) {
-                    process_key_change(row, col, current_reading);
-                }
+            // Debounce and report accepted state changes
+            if (is_key_debounced(row, col, current_reading)) {
+                process_key_change(row, col, current_reading);
+            } else if (current_reading != keyboard.keys[row][col].state) {
+                keyboard.stats.debounce_rejections++;
             }
         }
         
@@ -341,11 +737,32 @@ static void matrix_keyboard_scan_task(void *pvParameters)
     TickType_t last_wake_time = xTaskGetTickCount();
     
     while (1) {
-        // Perform matrix scan
+        uint32_t interval_ms = keyboard.scan_interval_ms;
+        task_layout_note_period(TASK_LAYOUT_SCAN, interval_ms * 1000);
+        
+        // Perform matrix scan (the console may hold the rows for a benchmark)
+        xSemaphoreTake(keyboard.scan_lock, portMAX_DELAY);
         matrix_keyboard_scan_once();
+        bool idle = matrix_keyboard_is_idle();
+        if (idle) {
+            ulTaskNotifyTake(pdTRUE, 0);    // Drop gives from before this scan
+            matrix_keyboard_park(true);
+        }
+        xSemaphoreGive(keyboard.scan_lock);
+        
+        if (idle) {
+            // Nothing pressed: no periodic wakeups until a key goes down
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            xSemaphoreTake(keyboard.scan_lock, portMAX_DELAY);
+            matrix_keyboard_park(false);
+            keyboard.stats.idle_wakeups++;
+            xSemaphoreGive(keyboard.scan_lock);
+            last_wake_time = xTaskGetTickCount();
+            continue;
+        }
         
         // Maintain precise timing using vTaskDelayUntil
-        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(SCAN_INTERVAL_MS));
+        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(interval_ms));
     }
 }
 
@@ -373,24 +790,36 @@ esp_err_t matrix_keyboard_init(void)
         return ESP_ERR_NO_MEM;
     }
     
+    // The main loop waits on the bus; join it while the queue is still empty
+    ret = event_bus_add_queue(EVENT_BUS_KEY, key_event_queue, KEY_QUEUE_SIZE);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add key queue to the event bus: %s", esp_err_to_name(ret));
+        vQueueDelete(key_event_queue);
+        return ret;
+    }
+    
     // Initialize keyboard state
     memset(&keyboard, 0, sizeof(matrix_keyboard_t));
+    keyboard.scan_lock = xSemaphoreCreateMutex();
+    if (keyboard.scan_lock == NULL) {
+        ESP_LOGE(TAG, "Failed to create scan lock");
+        vQueueDelete(key_event_queue);
+        return ESP_ERR_NO_MEM;
+    }
+    keyboard.debounce.mode = KEY_DEBOUNCE_LOCKOUT;
+    keyboard.debounce_ms = DEBOUNCE_TIME_MS;
+    keyboard.scan_interval_ms = SCAN_INTERVAL_MS;
+    update_debounce_config();
+    keyboard.init_time_us = esp_timer_get_time();
     keyboard.initialized = true;
     
-    // Create scanning task with appropriate priority
-    BaseType_t task_result = xTaskCreate(
-        matrix_keyboard_scan_task,
-        "matrix_scan",
-        2048,                    // Stack size
-        NULL,                    // Parameters
-        5,                       // Priority (higher than normal)
-        &scan_task_handle
-    );
-    
-    if (task_result != pdPASS) {
+    // Create scanning task on the sensing core (task_layout.c)
+    ret = task_layout_create(TASK_LAYOUT_SCAN, matrix_keyboard_scan_task, NULL, &scan_task_handle);
+    if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to create scanning task");
+        vSemaphoreDelete(keyboard.scan_lock);
         vQueueDelete(key_event_queue);
-        return ESP_ERR_NO_MEM;
+        return ret;
     }
     
     ESP_LOGI(TAG, "Matrix keyboard driver initialized successfully");
@@ -418,8 +847,156 @@ esp_err_t matrix_keyboard_get_key(key_event_t *event, uint32_t timeout_ms)
     return ESP_ERR_TIMEOUT;
 }
 
+/**
+ * @brief Post an event from another input device (ISR context)
+ * @param event Event to queue
+ * @param higher_priority_task_woken Set to true if a context switch is needed
+ * @return ESP_OK if queued, ESP_ERR_NO_MEM if the queue is full
+ */
+esp_err_t matrix_keyboard_post_event_from_isr(const key_event_t *event,
+                                              bool *higher_priority_task_woken)
+{
+    if (event == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!keyboard.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    BaseType_t woken = pdFALSE;
+    BaseType_t result = xQueueSendFromISR(key_event_queue, event, &woken);
+    if (higher_priority_task_woken != NULL && woken == pdTRUE) {
+        *higher_priority_task_woken = true;
+    }
+    if (result != pdTRUE) {
+        __atomic_fetch_add(&keyboard.stats.queue_overflows, 1, __ATOMIC_RELAXED);
+        return ESP_ERR_NO_MEM;
+    }
+    
+    return ESP_OK;
+}
+
+/**
+ * @brief Check if the keyboard driver is initialized
+ * @return true if initialized
+ */
+bool matrix_keyboard_is_initialized(void)
+{
+    return keyboard.initialized;
+}
+
+/**
+ * @brief Derive the debouncer window and integrator range from the timing
+ */
+static void update_debounce_config(void)
+{
+    uint32_t samples = keyboard.debounce_ms / keyboard.scan_interval_ms;
+    keyboard.debounce.debounce_us = keyboard.debounce_ms * 1000;
+    keyboard.debounce.integrator_samples = (uint8_t)(samples > 0 ? samples : 1);
+}
+
+/**
+ * @brief Set custom debounce time (takes effect on the next scan)
+ */
+esp_err_t matrix_keyboard_set_debounce_time(uint32_t debounce_ms)
+{
+    if (!keyboard.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (debounce_ms < DEBOUNCE_TIME_MIN_MS || debounce_ms > DEBOUNCE_TIME_MAX_MS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    xSemaphoreTake(keyboard.scan_lock, portMAX_DELAY);
+    keyboard.debounce_ms = debounce_ms;
+    update_debounce_config();
+    xSemaphoreGive(keyboard.scan_lock);
+    return ESP_OK;
+}
+
+/**
+ * @brief Set custom scan interval (takes effect after the current period)
+ */
+esp_err_t matrix_keyboard_set_scan_interval(uint32_t interval_ms)
+{
+    if (!keyboard.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (interval_ms < SCAN_INTERVAL_MIN_MS || interval_ms > SCAN_INTERVAL_MAX_MS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    xSemaphoreTake(keyboard.scan_lock, portMAX_DELAY);
+    keyboard.scan_interval_ms = interval_ms;
+    update_debounce_config();
+    xSemaphoreGive(keyboard.scan_lock);
+    return ESP_OK;
+}
+
+/**
+ * @brief Set the debounce algorithm (all keys restart from their current state)
+ */
+static esp_err_t matrix_keyboard_set_debounce_mode(key_debounce_mode_t mode)
+{
+    if (!keyboard.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    xSemaphoreTake(keyboard.scan_lock, portMAX_DELAY);
+    keyboard.debounce.mode = mode;
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        for (int col = 0; col < MATRIX_COLS; col++) {
+            keyboard.keys[row][col].raw = keyboard.keys[row][col].state;
+            keyboard.keys[row][col].integrator =
+                keyboard.keys[row][col].state ? keyboard.debounce.integrator_samples : 0;
+        }
+    }
+    xSemaphoreGive(keyboard.scan_lock);
+    return ESP_OK;
+}
+
+/**
+ * @brief Get driver statistics for diagnostics
+ */
+esp_err_t matrix_keyboard_get_stats(matrix_keyboard_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!keyboard.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    *stats = keyboard.stats;
+    stats->uptime_us = esp_timer_get_time() - keyboard.init_time_us;
+    return ESP_OK;
+}
+
+/**
+ * @brief Reset driver statistics
+ */
+esp_err_t matrix_keyboard_reset_stats(void)
+{
+    if (!keyboard.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    xSemaphoreTake(keyboard.scan_lock, portMAX_DELAY);
+    memset(&keyboard.stats, 0, sizeof(keyboard.stats));
+    xSemaphoreGive(keyboard.scan_lock);
+    return ESP_OK;
+}
+
 /* ==================== HAMBURGER GRILL SYSTEM IMPLEMENTATION ==================== */
 
+/**
+ * @brief Calibrated raw-to-voltage conversion used to build the temperature LUT
+ */
+static esp_err_t temp_lut_cali_voltage(void *ctx, int raw, int *voltage_mv)
+{
+    return adc_cali_raw_to_voltage((adc_cali_handle_t)ctx, raw, voltage_mv);
+}
+
 /**
  * @brief Initialize ADC for temperature sensor emulation
  */
@@ -427,38 +1004,59 @@ static esp_err_t temperature_sensor_init(void)
 {
     esp_err_t ret = ESP_OK;
     
-    // Initialize ADC1 oneshot unit
-    adc_oneshot_unit_init_cfg_t init_config1 = {
+    // Initialize ADC calibration (curve fitting depends on unit and attenuation only)
+    adc_cali_curve_fitting_config_t cali_config = {
         .unit_id = ADC_UNIT_1,
+        .chan = TEMP_SENSOR_ADC_CHANNEL,
+        .atten = ADC_ATTEN,
+        .bitwidth = ADC_WIDTH,
     };
-    ret = adc_oneshot_new_unit(&init_config1, &adc1_handle);
+    ret = adc_cali_create_scheme_curve_fitting(&cali_config, &adc1_cali_handle);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to initialize ADC1 unit: %s", esp_err_to_name(ret));
-        return ret;
+        ESP_LOGW(TAG, "ADC calibration failed, using default values: %s", esp_err_to_name(ret));
+        adc1_cali_handle = NULL;
     }
     
-    // Configure ADC1 channel
-    adc_oneshot_chan_cfg_t config = {
-        .bitwidth = ADC_WIDTH,
+    // Fold calibration and sensor equation into the raw-to-temperature table
+    temp_lut_voltage_fn_t to_mv = adc1_cali_handle != NULL ? temp_lut_cali_voltage : NULL;
+    ret = temp_lut_build(&temp_lut, to_mv, adc1_cali_handle);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Calibrated LUT build failed, using default values: %s", esp_err_to_name(ret));
+        to_mv = NULL;
+        temp_lut_build(&temp_lut, NULL, NULL);
+    }
+    
+    // All zones share one continuous scan pattern, LUT and filter configuration
+    grill_zones_config_t zones_config = {
+        .zone_count = GRILL_ZONE_COUNT,
         .atten = ADC_ATTEN,
+        .sample_freq_hz_per_zone = ADC_SAMPLE_FREQ_HZ,
+        .oversample_bits = ADC_OVERSAMPLE_BITS,
+        .lut = &temp_lut,
+        .filter_stages = temp_filter_stages,
+        .filter_stage_count = sizeof(temp_filter_stages) / sizeof(temp_filter_stages[0]),
     };
-    ret = adc_oneshot_config_channel(adc1_handle, TEMP_SENSOR_ADC_CHANNEL, &config);
+    memcpy(zones_config.channels, zone_channels, sizeof(zone_channels));
+    ret = grill_zones_init(&zones_config);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to configure ADC channel: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "Failed to initialize grill zones: %s", esp_err_to_name(ret));
         return ret;
     }
     
-    // Initialize ADC calibration
-    adc_cali_curve_fitting_config_t cali_config = {
-        .unit_id = ADC_UNIT_1,
-        .chan = TEMP_SENSOR_ADC_CHANNEL,
-        .atten = ADC_ATTEN,
-        .bitwidth = ADC_WIDTH,
-    };
-    ret = adc_cali_create_scheme_curve_fitting(&cali_config, &adc1_cali_handle);
+#if TEMP_LUT_REPORT_AT_BOOT
+    temp_lut_accuracy_t accuracy;
+    if (temp_lut_check_accuracy(&temp_lut, to_mv, adc1_cali_handle, ADC_OVERSAMPLE_BITS,
+                                &accuracy) == ESP_OK) {
+        ESP_LOGI(TAG, "Temperature LUT vs float: %" PRIu32 " codes, max %.3f C (code %" PRIu32 "), rms %.4f C",
+                 accuracy.codes_checked, accuracy.max_error_c, accuracy.worst_code,
+                 accuracy.rms_error_c);
+    }
+#endif
+    
+    ret = grill_zones_start();
     if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "ADC calibration failed, using default values: %s", esp_err_to_name(ret));
-        adc1_cali_handle = NULL;
+        ESP_LOGE(TAG, "Failed to start zone sampling: %s", esp_err_to_name(ret));
+        return ret;
     }
     
     ESP_LOGI(TAG, "Temperature sensor (ADC) initialized successfully");
@@ -469,56 +1067,134 @@ static esp_err_t temperature_sensor_init(void)
  * @brief Read temperature from potentiometer using sensor equation
  * V = 0.046 * T - 0.40
  * Solving for T: T = (V + 0.40) / 0.046
+ *
+ * Calibration and the equation are precomputed in temp_lut and every reading
+ * has already been through the filter pipeline in the sampler task; this only
+ * publishes the latest filtered value of zone 0 at the caller's rate.
  */
 static float read_temperature_sensor(void)
 {
-    int adc_raw = 0;
-    esp_err_t ret = adc_oneshot_read(adc1_handle, TEMP_SENSOR_ADC_CHANNEL, &adc_raw);
+    grill_zone_snapshot_t snapshot;
     
-    if (ret != ESP_OK) {
-        ESP_LOGW(TAG, "ADC read failed: %s", esp_err_to_name(ret));
+    if (grill_zones_get(0, &snapshot) != ESP_OK) {
+        ESP_LOGW(TAG, "ADC read failed: no sample yet");
         return 25.0; // Return default temperature
     }
     
-    // Convert to voltage (mV)
-    int voltage_mv = 0;
-    if (adc1_cali_handle != NULL) {
-        ret = adc_cali_raw_to_voltage(adc1_cali_handle, adc_raw, &voltage_mv);
-        if (ret != ESP_OK) {
-            ESP_LOGW(TAG, "ADC calibration failed: %s", esp_err_to_name(ret));
-            // Use basic conversion if calibration fails
-            voltage_mv = (adc_raw * 3300) / 4095; // 3.3V reference, 12-bit ADC
-        }
+    return snapshot.centi / 100.0f;
+}
+
+/**
+ * @brief Temperature band of a cooking level in °C
+ * @return false for NO_DETERMINATION
+ */
+static bool get_cooking_level_band(const cook_profile_t *profile, cooking_level_t level,
+                                   int *min_c, int *max_c)
+{
+    if (level >= profile->band_count) {
+        return false;
+    }
+    *min_c = profile->bands[level].min_c;
+    *max_c = profile->bands[level].max_c;
+    return true;
+}
+
+/**
+ * @brief Format a prediction in at most 6 characters
+ *
+ * "59m07s" below 100 minutes, "23h40m" up to DONENESS_MAX_SECONDS (24 h);
+ * the modulo keeps every field within two digits for the format checker.
+ */
+static void format_doneness_time(char out[7], int32_t seconds)
+{
+    uint32_t total = seconds > 0 ? (uint32_t)seconds : 0;
+    
+    if (total < 100 * 60) {
+        snprintf(out, 7, "%um%02us", (unsigned)(total / 60) % 100U, (unsigned)(total % 60));
     } else {
-        // Use basic conversion without calibration
-        voltage_mv = (adc_raw * 3300) / 4095; // 3.3V reference, 12-bit ADC
+        snprintf(out, 7, "%uh%02um", (unsigned)(total / 3600) % 100U, (unsigned)(total / 60 % 60));
     }
+}
+
+/**
+ * @brief Show the latest time-to-doneness prediction on LCD line 2
+ */
+static void update_doneness_line(void)
+{
+    doneness_prediction_t prediction;
+    char line[17];
+    char time_text[7];
     
-    float voltage_v = voltage_mv / 1000.0;  // Convert to volts
+    portENTER_CRITICAL(&doneness_lock);
+    prediction = doneness_prediction;
+    portEXIT_CRITICAL(&doneness_lock);
+    
+    switch (prediction.state) {
+        case DONENESS_APPROACHING:
+            if (prediction.seconds_to_enter != DONENESS_UNKNOWN) {
+                format_doneness_time(time_text, prediction.seconds_to_enter);
+                snprintf(line, sizeof(line), "Ready in %s", time_text);
+            } else {
+                snprintf(line, sizeof(line), "Ready: >1 day");
+            }
+            break;
+        case DONENESS_IN_BAND:
+            if (prediction.seconds_to_leave != DONENESS_UNKNOWN) {
+                format_doneness_time(time_text, prediction.seconds_to_leave);
+                snprintf(line, sizeof(line), "Done %s left", time_text);
+            } else {
+                snprintf(line, sizeof(line), "Done - holding");
+            }
+            break;
+        case DONENESS_PAST:
+            snprintf(line, sizeof(line), "Past target!");
+            break;
+        case DONENESS_STALLED:
+            snprintf(line, sizeof(line), "Not heating");
+            break;
+        default:
+            snprintf(line, sizeof(line), "Estimating...");
+            break;
+    }
     
-    // Apply sensor equation: T = (V + 0.40) / 0.046
-    float temperature = (voltage_v + 0.40) / 0.046;
+    // An active alarm replaces the prediction until it clears
+    for (int id = 0; id < TEMP_ALARM_COUNT; id++) {
+        if (active_alarms & (1U << id)) {
+            snprintf(line, sizeof(line), "!! %s", temp_alarm_name((temp_alarm_id_t)id));
+            break;
+        }
+    }
     
-    return temperature;
+    // Pad to the full width so a shorter message overwrites the previous one
+    char padded[17];
+    snprintf(padded, sizeof(padded), "%-16s", line);
+    lcd_cost_begin();
+    hd44780_gotoxy(&lcd, 0, 1);
+    hd44780_puts(&lcd, padded);
+    lcd_cost_end();
 }
 
 /**
- * @brief Check if temperature is within the selected cooking level range
+ * @brief Log an alarm-engine event and track the active alarms (main loop)
  */
-static bool is_temperature_in_range(float temp, cooking_level_t level)
+static void handle_alarm_event(const temp_alarm_event_t *event)
 {
-    switch(level) {
-        case BLUE_RARE:
-            return (temp >= BLUE_RARE_MIN && temp <= BLUE_RARE_MAX);
-        case MEDIUM_RARE:
-            return (temp >= MEDIUM_RARE_MIN && temp <= MEDIUM_RARE_MAX);
-        case WELL_DONE:
-            return (temp >= WELL_DONE_MIN && temp <= WELL_DONE_MAX);
-        case SOLE_RARE:
-            return (temp >= SOLE_RARE_MIN && temp <= SOLE_RARE_MAX);
-        default:
-            return false;
+    if (event->type == TEMP_ALARM_EVENT_BAND) {
+        ESP_LOGI(TAG, "Band: %s -> %s at %.2f°C",
+                 event->previous == NO_DETERMINATION ? "-" : cooking_level_name(event->previous),
+                 event->id == NO_DETERMINATION ? "-" : cooking_level_name(event->id),
+                 event->centi / 100.0f);
+    } else if (event->type == TEMP_ALARM_EVENT_RAISED) {
+        active_alarms |= (uint8_t)(1U << event->id);
+        ESP_LOGW(TAG, "Alarm %s raised at %.2f°C", temp_alarm_name((temp_alarm_id_t)event->id),
+                 event->centi / 100.0f);
+    } else {
+        active_alarms &= (uint8_t)~(1U << event->id);
+        ESP_LOGI(TAG, "Alarm %s cleared at %.2f°C", temp_alarm_name((temp_alarm_id_t)event->id),
+                 event->centi / 100.0f);
     }
+    session_store_log(SESSION_RECORD_ALARM, event, sizeof(*event));
+    grill_system.warning_active = (active_alarms != 0);
 }
 
 /**
@@ -526,14 +1202,17 @@ static bool is_temperature_in_range(float temp, cooking_level_t level)
  */
 static void update_grill_display(void)
 {
+    lcd_cost_begin();
     hd44780_clear(&lcd);
     hd44780_gotoxy(&lcd, 0, 0);
     
-    switch(grill_system.current_state) {
+    switch((system_state_t)grill_ui.state) {
         case STATE_ASK_TEMPERATURE:
             hd44780_puts(&lcd, "Enter Temp (C):");
             hd44780_gotoxy(&lcd, 0, 1);
-            hd44780_puts(&lcd, "Use 0-9, # OK");
+            char prompt[17];
+            snprintf(prompt, sizeof(prompt), "%-7s 0-9 #OK", cook_profile_active(&cook_profiles)->name);
+            hd44780_puts(&lcd, prompt);
             break;
             
         case STATE_INPUTTING_TEMPERATURE:
@@ -551,24 +1230,22 @@ static void update_grill_display(void)
             
         case STATE_SHOWING_MEAT_TERM:
             if (is_temperature_in_safe_range(grill_system.input_temperature)) {
-                // Temperature is in safe range (20-40°C)
+                // Temperature is in the profile's safe range
                 if (grill_system.determined_level != NO_DETERMINATION) {
-                    // Show determined meat term
-                    hd44780_puts(&lcd, cooking_names[grill_system.determined_level]);
-                    hd44780_gotoxy(&lcd, 0, 1);
-                    // Second line remains EMPTY for safe temperatures
-                    hd44780_puts(&lcd, "                "); // Clear second line
+                    // Show determined meat term with the time-to-doneness below it
+                    hd44780_puts(&lcd, cooking_level_name(grill_system.determined_level));
+                    update_doneness_line();
                 } else {
-                    // This shouldn't happen for temperatures in 20-40 range, but just in case
+                    // The safe range has a gap between bands
                     hd44780_puts(&lcd, "Unknown Term");
                     hd44780_gotoxy(&lcd, 0, 1);
                     hd44780_puts(&lcd, "                "); // Clear second line
                 }
             } else {
-                // Temperature is outside safe range (< 20°C or > 40°C)
+                // Temperature is outside the profile's safe range
                 if (grill_system.determined_level != NO_DETERMINATION) {
                     // Show determined meat term (if any)
-                    hd44780_puts(&lcd, cooking_names[grill_system.determined_level]);
+                    hd44780_puts(&lcd, cooking_level_name(grill_system.determined_level));
                 } else {
                     // Show that temperature is out of range
                     hd44780_puts(&lcd, "Out of Range");
@@ -579,8 +1256,15 @@ static void update_grill_display(void)
             }
             break;
             
-        case STATE_SHOWING_STATUS:
-            hd44780_puts(&lcd, "Status Check:");
+        case STATE_SHOWING_STATUS: {
+            grill_readings_t readings;
+            if (get_grill_readings(&readings) && readings.zone_temps[0] != GRILL_ZONE_NO_READING) {
+                char header[17];
+                snprintf(header, sizeof(header), "Status %6.1fC", readings.zone_temps[0] / 100.0f);
+                hd44780_puts(&lcd, header);
+            } else {
+                hd44780_puts(&lcd, "Status Check:");
+            }
             hd44780_gotoxy(&lcd, 0, 1);
             if (grill_system.input_temperature != -1) {
                 char status[16];
@@ -592,132 +1276,460 @@ static void update_grill_display(void)
                 hd44780_puts(&lcd, "No temperature");
             }
             break;
-    }
-}
-
-/**
- * @brief Determine meat cooking term based on input temperature
- */
+        }
+            
+        case STATE_SHOWING_MESSAGE: {
+            // Additional functions (future expansion)
+            char func_msg[20];
+            snprintf(func_msg, sizeof(func_msg), "Function %c", grill_system.function_key);
+            hd44780_puts(&lcd, func_msg);
+            hd44780_gotoxy(&lcd, 0, 1);
+            hd44780_puts(&lcd, "Not Available");
+            break;
+        }
+            
+        case STATE_SHOWING_CPU_LOAD: {
+            cpu_profiler_report_t report;
+            char line0[CPU_PROFILER_LINE_LEN];
+            char line1[CPU_PROFILER_LINE_LEN];
+            bool loaded = cpu_profiler_get(&report) == ESP_OK;
+            cpu_profiler_format_page(loaded ? &report : NULL, grill_system.cpu_page, line0, line1);
+            hd44780_puts(&lcd, line0);
+            hd44780_gotoxy(&lcd, 0, 1);
+            hd44780_puts(&lcd, line1);
+            break;
+        }
+            
+        default:
+            break;
+    }
+    lcd_cost_end();
+}
+
+/**
+ * @brief Display name of a cooking level in the active profile
+ */
+static const char *cooking_level_name(cooking_level_t level)
+{
+    return cook_profile_band_name(cook_profile_active(&cook_profiles), level);
+}
+
+/**
+ * @brief Determine meat cooking term based on input temperature
+ */
 static cooking_level_t determine_meat_term_from_temperature(int temperature)
 {
-    if (temperature >= BLUE_RARE_MIN && temperature <= BLUE_RARE_MAX) {
-        return BLUE_RARE;
-    } else if (temperature >= MEDIUM_RARE_MIN && temperature <= MEDIUM_RARE_MAX) {
-        return MEDIUM_RARE;
-    } else if (temperature >= WELL_DONE_MIN && temperature <= WELL_DONE_MAX) {
-        return WELL_DONE;
-    } else if (temperature >= SOLE_RARE_MIN && temperature <= SOLE_RARE_MAX) {
-        return SOLE_RARE;
+    return cook_profile_classify(cook_profile_active(&cook_profiles), temperature);
+}
+
+/**
+ * @brief Check if input temperature is within the active profile's safe range
+ */
+static bool is_temperature_in_safe_range(int temperature)
+{
+    return cook_profile_is_safe(cook_profile_active(&cook_profiles), temperature);
+}
+
+/**
+ * @brief Publish the cooking target after the main loop changed it
+ */
+static void publish_grill_target(void)
+{
+    grill_target_t target = {
+        .input_temperature = grill_system.input_temperature,
+        .determined_level = grill_system.determined_level,
+        .profile = cook_profiles.active,
+    };
+    seqlock_write(&target_lock, &shared_target, &target, sizeof(target));
+    
+    // The heater holds the middle of the selected band; no band, no heat
+    int band_min;
+    int band_max;
+    if (get_cooking_level_band(cook_profile_active(&cook_profiles), grill_system.determined_level,
+                               &band_min, &band_max)) {
+        grill_zones_sample(true);           // Fresh readings for the first control steps
+        heater_control_set_setpoint((band_min * 100 + band_max * 100 + 99) / 2);
     } else {
-        return NO_DETERMINATION;
+        heater_control_set_setpoint(HEATER_CONTROL_OFF);
     }
 }
 
 /**
- * @brief Check if input temperature is within safe cooking range (20-40°C)
+ * @brief Latest consistent sensor readings (either core, never blocks the writer)
+ *
+ * @return false before the first readings or if every attempt overlapped a write
  */
-static bool is_temperature_in_safe_range(int temperature)
+static bool get_grill_readings(grill_readings_t *readings)
 {
-    return (temperature >= 20 && temperature <= 40);
+    if (seqlock_writes(&readings_lock) == 0) {
+        return false;
+    }
+    return seqlock_read(&readings_lock, &shared_readings, readings, sizeof(*readings),
+                        SEQLOCK_READ_TRIES) != 0;
 }
 
 /**
- * @brief Handle temperature input from keypad
+ * @brief Switch to the next cooking profile (beef -> chicken -> fish -> ...)
  */
-static void handle_temperature_input(char key)
+static void select_next_cook_profile(void)
+{
+    uint8_t next = (uint8_t)((cook_profiles.active + 1) % cook_profiles.count);
+    
+    cook_profile_select(&cook_profiles, next);
+    publish_grill_target();
+    session_store_log(SESSION_RECORD_PROFILE, &next, sizeof(next));
+    ESP_LOGI(TAG, "Cooking profile: %s", cook_profile_active(&cook_profiles)->name);
+}
+
+/**
+ * @brief Map a pressed key to its UI event
+ * @return UI_EVENT_COUNT for keys the UI does not use
+ */
+static ui_event_t ui_event_for_key(char key)
 {
     if (key >= '0' && key <= '9') {
-        // Add digit to temperature input
-        if (grill_system.temp_input_index < 3) { // Max 3 digits (up to 999°C)
-            grill_system.temp_input_buffer[grill_system.temp_input_index] = key;
-            grill_system.temp_input_index++;
-            grill_system.temp_input_buffer[grill_system.temp_input_index] = '\0';
-            
-            // Update state to show we're inputting
-            if (grill_system.current_state == STATE_ASK_TEMPERATURE) {
-                grill_system.current_state = STATE_INPUTTING_TEMPERATURE;
-            }
-            
-            ESP_LOGI(TAG, "Temperature input: %s", grill_system.temp_input_buffer);
-        }
-    } else if (key == '#') {
-        // Confirm temperature input
-        process_temperature_input();
-    } else if (key == '*') {
-        // Clear input and reset
-        memset(grill_system.temp_input_buffer, 0, sizeof(grill_system.temp_input_buffer));
-        grill_system.temp_input_index = 0;
-        grill_system.current_state = STATE_ASK_TEMPERATURE;
-        grill_system.determined_level = NO_DETERMINATION;
-        grill_system.input_temperature = -1;
-        ESP_LOGI(TAG, "Temperature input cleared");
+        return UI_EVENT_DIGIT;
+    }
+    if (key == '#') {
+        return UI_EVENT_CONFIRM;
+    }
+    if (key == '*') {
+        return UI_EVENT_CANCEL;
+    }
+    if (key == PROFILE_KEY) {
+        return UI_EVENT_PROFILE;
+    }
+    if (key == CPU_PAGE_KEY) {
+        return UI_EVENT_CPU_PAGE;
+    }
+    if (key >= 'A' && key <= 'D') {
+        return UI_EVENT_FUNCTION;
     }
+    return UI_EVENT_COUNT;
+}
+
+/**
+ * @brief Feed one event to the UI state machine (main loop)
+ * @param arg Key character, or accelerated encoder steps for UI_EVENT_ENCODER
+ */
+static void ui_dispatch(ui_event_t event, int32_t arg)
+{
+    uint8_t from = grill_ui.state;
     
+    if (ui_fsm_dispatch(&grill_ui, (uint8_t)event, arg, esp_timer_get_time() / 1000)) {
+        ESP_LOGD(TAG, "UI %s --%s--> %s", ui_fsm_state_name(&grill_ui, from),
+                 ui_event_names[event], ui_fsm_state_name(&grill_ui, grill_ui.state));
+    } else if (event != UI_EVENT_ENCODER && event != UI_EVENT_TIMEOUT) {
+        ESP_LOGW(TAG, "Key '%c' not used on the %s screen", (char)arg,
+                 ui_fsm_state_name(&grill_ui, from));
+    }
+}
+
+/**
+ * @brief Log the last UI transitions, oldest first (debug level)
+ */
+static void log_ui_trace(void)
+{
+    ui_fsm_trace_entry_t trace[UI_FSM_TRACE_LEN];
+    size_t count = ui_fsm_trace_read(&grill_ui, trace, UI_FSM_TRACE_LEN);
+    
+    ESP_LOGD(TAG, "UI trace: %lu transitions, %lu events ignored",
+             (unsigned long)grill_ui.taken, (unsigned long)grill_ui.ignored);
+    for (size_t i = 0; i < count; i++) {
+        ESP_LOGD(TAG, "  %8lu ms %-7s %-8s %4ld -> %s", (unsigned long)trace[i].time_ms,
+                 ui_fsm_state_name(&grill_ui, trace[i].from), ui_event_names[trace[i].event],
+                 (long)trace[i].arg,
+                 trace[i].to == UI_FSM_NO_STATE ? "(ignored)" : ui_fsm_state_name(&grill_ui, trace[i].to));
+    }
+}
+
+/**
+ * @brief Entry action of the status screen
+ */
+static void enter_status_screen(void)
+{
     update_grill_display();
+    log_ui_trace();
+}
+
+/**
+ * @brief Guard: another digit fits in the input buffer
+ */
+static bool ui_input_not_full(int32_t key)
+{
+    return grill_system.temp_input_index < 3; // Max 3 digits (up to 999°C)
+}
+
+/**
+ * @brief Guard: a temperature has been entered
+ */
+static bool ui_has_input(int32_t key)
+{
+    return grill_system.temp_input_index > 0;
+}
+
+/**
+ * @brief Append a digit to the temperature input
+ */
+static void ui_append_digit(int32_t key)
+{
+    grill_system.temp_input_buffer[grill_system.temp_input_index] = (char)key;
+    grill_system.temp_input_index++;
+    grill_system.temp_input_buffer[grill_system.temp_input_index] = '\0';
+    
+    ESP_LOGI(TAG, "Temperature input: %s", grill_system.temp_input_buffer);
+}
+
+/**
+ * @brief Adjust the temperature being entered with the rotary encoder
+ * @param delta Accelerated encoder steps (positive = clockwise)
+ */
+static void ui_adjust_input(int32_t delta)
+{
+    int value = (grill_system.temp_input_index > 0) ? atoi(grill_system.temp_input_buffer) : 0;
+    
+    value += delta;
+    if (value < 0) {
+        value = 0;
+    } else if (value > TEMP_INPUT_MAX) {
+        value = TEMP_INPUT_MAX;
+    }
+    
+    grill_system.temp_input_index = snprintf(grill_system.temp_input_buffer,
+                                             sizeof(grill_system.temp_input_buffer),
+                                             "%d", value);
+    
+    ESP_LOGI(TAG, "Temperature input (encoder %+ld): %s", (long)delta, grill_system.temp_input_buffer);
+}
+
+/**
+ * @brief Switch to the next cooking profile (only before a temperature is being entered)
+ */
+static void ui_next_profile(int32_t key)
+{
+    select_next_cook_profile();
 }
 
 /**
  * @brief Process the temperature input and determine meat term
  */
-static void process_temperature_input(void)
+static void ui_confirm_input(int32_t key)
 {
-    if (grill_system.temp_input_index > 0) {
-        // Convert string to integer
-        grill_system.input_temperature = atoi(grill_system.temp_input_buffer);
-        
-        ESP_LOGI(TAG, "Processing temperature: %d°C", grill_system.input_temperature);
-        
-        // Always try to determine meat cooking term
-        grill_system.determined_level = determine_meat_term_from_temperature(grill_system.input_temperature);
-        
-        // Check if temperature is in safe range (20-40°C)
-        bool in_safe_range = is_temperature_in_safe_range(grill_system.input_temperature);
-        
-        if (in_safe_range) {
-            if (grill_system.determined_level != NO_DETERMINATION) {
-                ESP_LOGI(TAG, "Temperature %d°C -> %s (SAFE RANGE)", 
-                        grill_system.input_temperature, cooking_names[grill_system.determined_level]);
-            } else {
-                ESP_LOGI(TAG, "Temperature %d°C in safe range but no specific meat term", 
-                        grill_system.input_temperature);
-            }
+    // Convert string to integer
+    grill_system.input_temperature = atoi(grill_system.temp_input_buffer);
+    
+    ESP_LOGI(TAG, "Processing temperature: %d°C", grill_system.input_temperature);
+    
+    // Always try to determine meat cooking term
+    grill_system.determined_level = determine_meat_term_from_temperature(grill_system.input_temperature);
+    publish_grill_target();
+    
+    int16_t logged_temp = (int16_t)grill_system.input_temperature;
+    uint8_t logged_level = (uint8_t)grill_system.determined_level;
+    session_store_log(SESSION_RECORD_TEMP_INPUT, &logged_temp, sizeof(logged_temp));
+    session_store_log(SESSION_RECORD_LEVEL, &logged_level, sizeof(logged_level));
+    
+    // Check if temperature is in the profile's safe range
+    const cook_profile_t *profile = cook_profile_active(&cook_profiles);
+    bool in_safe_range = is_temperature_in_safe_range(grill_system.input_temperature);
+    
+    if (in_safe_range) {
+        if (grill_system.determined_level != NO_DETERMINATION) {
+            ESP_LOGI(TAG, "Temperature %d°C -> %s (SAFE RANGE)", 
+                    grill_system.input_temperature, cooking_level_name(grill_system.determined_level));
         } else {
-            ESP_LOGW(TAG, "Temperature %d°C is OUTSIDE safe range (20-40°C) - WARNING!", 
+            ESP_LOGI(TAG, "Temperature %d°C in safe range but no specific meat term", 
                     grill_system.input_temperature);
         }
-        
-        // Always go to showing meat term state
-        grill_system.current_state = STATE_SHOWING_MEAT_TERM;
-        update_grill_display();
+    } else {
+        ESP_LOGW(TAG, "Temperature %d°C is OUTSIDE %s safe range (%d-%d°C) - WARNING!", 
+                grill_system.input_temperature, profile->name,
+                profile->safe_min_c, profile->safe_max_c);
     }
 }
 
 /**
- * @brief Handle control keys (status, reset)
+ * @brief Clear the input and the cooking target (any screen)
  */
-static void handle_control_keys(char key)
+static void ui_reset_input(int32_t key)
 {
-    if (key == '#' && grill_system.current_state == STATE_SHOWING_MEAT_TERM) {
-        // Show status for 2 seconds
-        grill_system.current_state = STATE_SHOWING_STATUS;
-        update_grill_display();
-        vTaskDelay(pdMS_TO_TICKS(2000));
-        grill_system.current_state = STATE_SHOWING_MEAT_TERM;
-        update_grill_display();
-        
-    } else if (key == '*') {
-        // Reset to ask temperature again
-        memset(grill_system.temp_input_buffer, 0, sizeof(grill_system.temp_input_buffer));
-        grill_system.temp_input_index = 0;
-        grill_system.current_state = STATE_ASK_TEMPERATURE;
-        grill_system.determined_level = NO_DETERMINATION;
-        grill_system.input_temperature = -1;
-        grill_system.warning_active = false;
-        ESP_LOGI(TAG, "System reset - asking for new temperature");
-        update_grill_display();
+    memset(grill_system.temp_input_buffer, 0, sizeof(grill_system.temp_input_buffer));
+    grill_system.temp_input_index = 0;
+    grill_system.determined_level = NO_DETERMINATION;
+    grill_system.input_temperature = -1;
+    grill_system.warning_active = false;
+    publish_grill_target();
+    ESP_LOGI(TAG, "System reset - asking for new temperature");
+}
+
+/**
+ * @brief Remember which function key the message screen is about
+ */
+static void ui_set_function_key(int32_t key)
+{
+    grill_system.function_key = (char)key;
+    ESP_LOGI(TAG, "Function %c pressed (not implemented)", (char)key);
+}
+
+/**
+ * @brief Guard: a confirmed temperature (the meat term screen has something to show)
+ */
+static bool ui_has_target(int32_t key)
+{
+    return grill_system.input_temperature != -1;
+}
+
+/**
+ * @brief Open the CPU load screens on the per-core page
+ */
+static void ui_first_cpu_page(int32_t key)
+{
+    cpu_profiler_report_t report;
+    
+    grill_system.cpu_page = 0;
+    if (cpu_profiler_get(&report) == ESP_OK) {
+        cpu_profiler_log(&report);
+    }
+}
+
+/**
+ * @brief Next CPU load page (wraps to the first)
+ */
+static void ui_next_cpu_page(int32_t key)
+{
+    grill_system.cpu_page = (grill_system.cpu_page + 1) % cpu_profiler_page_count();
+}
+
+/**
+ * @brief Own the LCD bus: the lock against the other writer, and full CPU speed
+ *        while the HD44780 cycle-counted delays run (power_mgmt.h)
+ */
+static void lcd_bus_take(void)
+{
+    xSemaphoreTake(lcd_lock, portMAX_DELAY);
+    if (lcd_pm_lock != NULL) {
+        esp_pm_lock_acquire(lcd_pm_lock);
+    }
+}
+
+static void lcd_bus_give(void)
+{
+    if (lcd_pm_lock != NULL) {
+        esp_pm_lock_release(lcd_pm_lock);
+    }
+    xSemaphoreGive(lcd_lock);
+}
+
+/**
+ * @brief Time LCD bus writes for the CPU profiler and hold the bus against the
+ *        console benchmark (main loop; nested calls count once)
+ */
+static void lcd_cost_begin(void)
+{
+    if (lcd_cost_depth++ == 0) {
+        lcd_bus_take();
+        lcd_cost_started_us = esp_timer_get_time();
+    }
+}
+
+/**
+ * @brief End of an LCD write started with lcd_cost_begin()
+ */
+static void lcd_cost_end(void)
+{
+    if (--lcd_cost_depth == 0) {
+        cpu_profiler_section_add(CPU_PROFILER_SECTION_LCD,
+                                 (uint32_t)(esp_timer_get_time() - lcd_cost_started_us));
+        lcd_bus_give();
+    }
+}
+
+/**
+ * @brief Whether line 2 currently shows the time-to-doneness / alarm line
+ */
+static bool is_doneness_line_shown(void)
+{
+    return grill_ui.state == STATE_SHOWING_MEAT_TERM &&
+           grill_system.determined_level != NO_DETERMINATION &&
+           is_temperature_in_safe_range(grill_system.input_temperature);
+}
+
+/**
+ * @brief Dispatch one keypad or encoder event (main loop)
+ */
+static void handle_key_event(const key_event_t *key_event)
+{
+    ESP_LOGD(TAG, "Key event handled %" PRId64 " us after it was queued",
+             esp_timer_get_time() - key_event->timestamp);
+    task_layout_note_response(TASK_LAYOUT_UI, key_event->timestamp);
+    
+    if (key_event->source == KEY_EVENT_SOURCE_ENCODER) {
+        // Only the temperature entry screens have encoder transitions
+        ui_dispatch(UI_EVENT_ENCODER, key_event->delta);
+        return;
+    }
+    if (!key_event->pressed) {
+        return;
+    }
+    
+    // Key press event - Enhanced console output
+    ESP_LOGI(TAG, "🔑 KEY PRESSED: '%c' at position [%d,%d]", 
+             key_event->key_char, key_event->row, key_event->col);
+    
+    printf(">>> Key '%c' PRESSED <<<\n", key_event->key_char);
+    session_store_log(SESSION_RECORD_KEY, &key_event->key_char, sizeof(key_event->key_char));
+    
+    char key = key_event->key_char;
+    ui_event_t event = ui_event_for_key(key);
+    
+    if (event != UI_EVENT_COUNT) {
+        ui_dispatch(event, key);
+    } else {
+        ESP_LOGW(TAG, "Invalid key '%c' for current state", key);
     }
 }
 
+/**
+ * @brief Driver counters into the telemetry stream (monitoring task)
+ */
+static void send_telemetry_counters(void)
+{
+    telemetry_counter_id_t ids[TELEMETRY_MAX_COUNTERS];
+    uint32_t values[TELEMETRY_MAX_COUNTERS];
+    size_t count = 0;
+    matrix_keyboard_stats_t keys;
+    adc_sampler_stats_t adc;
+    heater_control_metrics_t heater;
+    power_mgmt_stats_t power;
+    telemetry_stats_t link;
+    
+    // Each id at most once: count stays within TELEMETRY_COUNTER_COUNT (asserted above)
+#define ADD_COUNTER(id, value) do { ids[count] = (id); values[count] = (uint32_t)(value); count++; } while (0)
+    if (matrix_keyboard_get_stats(&keys) == ESP_OK) {
+        ADD_COUNTER(TELEMETRY_COUNTER_KEY_PRESSES, keys.total_key_presses);
+        ADD_COUNTER(TELEMETRY_COUNTER_KEY_OVERFLOWS, keys.queue_overflows);
+    }
+    if (adc_sampler_get_stats(&adc) == ESP_OK) {
+        ADD_COUNTER(TELEMETRY_COUNTER_ADC_FRAMES, adc.frames);
+        ADD_COUNTER(TELEMETRY_COUNTER_ADC_READINGS, adc.readings);
+        ADD_COUNTER(TELEMETRY_COUNTER_ADC_OVERFLOWS, adc.pool_overflows);
+    }
+    heater_control_get_metrics(&heater);
+    ADD_COUNTER(TELEMETRY_COUNTER_HEATER_STEPS, heater.steps);
+    ADD_COUNTER(TELEMETRY_COUNTER_HEATER_OVERRUNS, heater.overruns);
+    ADD_COUNTER(TELEMETRY_COUNTER_HEATER_FAULTS, heater.sensor_faults);
+    if (power_mgmt_get_stats(&power) == ESP_OK) {
+        ADD_COUNTER(TELEMETRY_COUNTER_SLEEP_WAKEUPS, power.wakeups);
+        ADD_COUNTER(TELEMETRY_COUNTER_SLEEP_MS, power.asleep_us / 1000);
+    }
+    if (telemetry_get_stats(&link) == ESP_OK) {
+        ADD_COUNTER(TELEMETRY_COUNTER_TX_BYTES, link.bytes_sent);
+    }
+#undef ADD_COUNTER
+    
+    telemetry_counters(ids, values, count);
+}
+
 
 
 /**
@@ -726,19 +1738,523 @@ static void handle_control_keys(char key)
 static void temperature_monitoring_task(void *pvParameters)
 {
     TickType_t last_wake_time = xTaskGetTickCount();
+    uint32_t session_log_elapsed_ms = 0;
+    uint32_t telemetry_elapsed_ms = 0;
+    grill_readings_t readings;
+    grill_target_t target = { .input_temperature = -1, .determined_level = NO_DETERMINATION };
     
     while (1) {
+        uint32_t interval_ms = temp_update_interval_ms;
+        task_layout_note_period(TASK_LAYOUT_MONITOR, interval_ms * 1000);
+        
         // This task is now simplified since we only care about input temperature
         // Keep reading sensor for future use if needed
-        grill_system.sensor_temp = read_temperature_sensor();
+        readings.sensor_temp = read_temperature_sensor();
+        grill_zones_get_all(readings.zone_temps, GRILL_ZONE_COUNT);
+        int64_t now_ms = esp_timer_get_time() / 1000;
+        readings.time_ms = (uint32_t)now_ms;
+        seqlock_write(&readings_lock, &shared_readings, &readings, sizeof(readings));
+        
+        // Every reading goes to the telemetry stream; GRILL_ZONE_NO_READING and
+        // HEATER_CONTROL_OFF are both TELEMETRY_NO_VALUE
+        heater_control_metrics_t heater_now;
+        heater_control_get_metrics(&heater_now);
+        telemetry_zones(readings.zone_temps, GRILL_ZONE_COUNT, heater_now.setpoint_centi,
+                        heater_now.duty);
+        
+        // Cooking target from the main loop; if it is being rewritten, keep the last one
+        grill_target_t latest;
+        if (seqlock_read(&target_lock, &shared_target, &latest, sizeof(latest), SEQLOCK_READ_TRIES)) {
+            target = latest;
+        }
+        const cook_profile_t *profile = &cook_profiles.profiles[target.profile];
         
         // No automatic display updates needed - only input temperature matters
-        ESP_LOGD(TAG, "Sensor: %.1f°C, Input: %d°C", 
-                grill_system.sensor_temp, grill_system.input_temperature);
+        uint32_t filter_avg;
+        uint32_t filter_max;
+        grill_zones_get_filter_cost(&filter_avg, &filter_max);
+        ESP_LOGD(TAG, "Sensor: %.1f°C, Input: %d°C, filter %" PRIu32 " " CYCLE_COUNTER_UNIT
+                 "/sample (max %" PRIu32 ")",
+                readings.sensor_temp, (int)target.input_temperature, filter_avg, filter_max);
+        for (int zone = 0; zone < GRILL_ZONE_COUNT; zone++) {
+            int32_t centi = readings.zone_temps[zone];
+            if (centi == GRILL_ZONE_NO_READING) {
+                ESP_LOGD(TAG, "Zone %d: no reading", zone);
+            } else {
+                ESP_LOGD(TAG, "Zone %d: %.2f°C", zone, centi / 100.0f);
+            }
+        }
+        
+        // Trend of zone 0 and time-to-doneness for the selected level
+        if (readings.zone_temps[0] != GRILL_ZONE_NO_READING) {
+            doneness_push(&temp_trend, now_ms, readings.zone_temps[0]);
+        }
+        doneness_prediction_t prediction = { .state = DONENESS_WARMING_UP };
+        int band_min;
+        int band_max;
+        if (get_cooking_level_band(profile, target.determined_level, &band_min, &band_max)) {
+            doneness_predict(&temp_trend, band_min * 100, band_max * 100, &prediction);
+        }
+        portENTER_CRITICAL(&doneness_lock);
+        bool prediction_changed = (prediction.state != doneness_prediction.state);
+        doneness_prediction = prediction;
+        portEXIT_CRITICAL(&doneness_lock);
+        
+        // Bands and alarms change only on real transitions; the main loop reports them
+        if (temp_alarm.profile != profile) {
+            temp_alarm_set_profile(&temp_alarm, profile);
+        }
+        if (readings.zone_temps[0] != GRILL_ZONE_NO_READING) {
+            float slope;
+            int32_t rate = TEMP_ALARM_RATE_UNKNOWN;
+            if (temp_trend.count >= DONENESS_MIN_SAMPLES && doneness_slope(&temp_trend, &slope) == ESP_OK) {
+                rate = (int32_t)lroundf(slope * 60000.0f);
+            }
+            temp_alarm_event_t events[TEMP_ALARM_MAX_EVENTS];
+            size_t event_count = temp_alarm_update(&temp_alarm, now_ms,
+                                                   readings.zone_temps[0], rate, events);
+            for (size_t i = 0; i < event_count; i++) {
+                telemetry_alarm(events[i].type, events[i].id, events[i].previous, events[i].centi,
+                                events[i].rate_centi_per_min);
+                if (xQueueSend(alarm_event_queue, &events[i], 0) != pdTRUE) {
+                    ESP_LOGW(TAG, "Alarm event queue full - event dropped");
+                }
+            }
+        }
+        
+        telemetry_elapsed_ms += interval_ms;
+        if (telemetry_elapsed_ms >= TELEMETRY_COUNTERS_INTERVAL_MS) {
+            telemetry_elapsed_ms = 0;
+            send_telemetry_counters();
+        }
+        
+        session_log_elapsed_ms += interval_ms;
+        if (session_log_elapsed_ms >= SESSION_ZONE_LOG_INTERVAL_MS) {
+            session_log_elapsed_ms = 0;
+            session_store_log(SESSION_RECORD_ZONE_TEMPS, readings.zone_temps,
+                              sizeof(readings.zone_temps));
+            
+            heater_control_metrics_t heater;
+            heater_control_get_metrics(&heater);
+            if (heater.setpoint_centi != HEATER_CONTROL_OFF) {
+                ESP_LOGI(TAG, "Heater: %.2f°C -> %.2f°C, duty %.1f%% (P %d I %d D %d FF %d)",
+                         heater.measured_centi / 100.0f, heater.setpoint_centi / 100.0f,
+                         heater.duty / 100.0f, (int)heater.p_term, (int)heater.i_term,
+                         (int)heater.d_term, (int)heater.ff_term);
+            }
+            ESP_LOGI(TAG, "Control loop: %" PRIu32 " steps, jitter avg %" PRIu32 " us max %" PRIu32
+                     " us, step %" PRIu32 " " CYCLE_COUNTER_UNIT " (max %" PRIu32 "), %" PRIu32
+                     " overruns, %" PRIu32 " sensor faults",
+                     heater.steps, heater.jitter_avg_us, heater.jitter_max_us, heater.exec_avg,
+                     heater.exec_max, heater.overruns, heater.sensor_faults);
+        }
+        if (prediction.state != DONENESS_WARMING_UP &&
+            (prediction_changed || session_log_elapsed_ms == 0)) {
+            session_store_log(SESSION_RECORD_DONENESS, &prediction, sizeof(prediction));
+            ESP_LOGI(TAG, "Doneness: %s, %.2f°C at %+.2f°C/min, enter %" PRId32 " s, leave %" PRId32 " s",
+                     doneness_state_name((doneness_state_t)prediction.state),
+                     prediction.fitted_centi / 100.0f, prediction.slope_centi_per_min / 100.0f,
+                     prediction.seconds_to_enter, prediction.seconds_to_leave);
+        }
+        
+        // Readings and prediction are published; let the main loop refresh the display
+        event_bus_signal(EVENT_BUS_READINGS);
+        
+        // Heating needs a reading every control period; otherwise one burst per
+        // period (the next cycle's readings) leaves the ADC and the chip idle
+        grill_zones_sample(heater_control_get_setpoint() != HEATER_CONTROL_OFF);
         
         // Wait for next measurement
-        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(TEMP_UPDATE_INTERVAL_MS));
+        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(interval_ms));
+    }
+}
+
+/* ==================== CONSOLE COMMANDS ==================== */
+
+static int32_t console_get_debounce_ms(void)
+{
+    return (int32_t)keyboard.debounce_ms;
+}
+
+static esp_err_t console_set_debounce_ms(int32_t value)
+{
+    return matrix_keyboard_set_debounce_time((uint32_t)value);
+}
+
+static int32_t console_get_debounce_mode(void)
+{
+    return (int32_t)keyboard.debounce.mode;
+}
+
+static esp_err_t console_set_debounce_mode(int32_t value)
+{
+    return matrix_keyboard_set_debounce_mode((key_debounce_mode_t)value);
+}
+
+static int32_t console_get_scan_ms(void)
+{
+    return (int32_t)keyboard.scan_interval_ms;
+}
+
+static esp_err_t console_set_scan_ms(int32_t value)
+{
+    return matrix_keyboard_set_scan_interval((uint32_t)value);
+}
+
+static int32_t console_get_monitor_ms(void)
+{
+    return (int32_t)temp_update_interval_ms;
+}
+
+/**
+ * @brief Monitoring period (the task picks it up after its current wait)
+ */
+static esp_err_t console_set_monitor_ms(int32_t value)
+{
+    temp_update_interval_ms = (uint32_t)value;
+    return ESP_OK;
+}
+
+static int32_t console_get_log_level(void)
+{
+    return (int32_t)esp_log_level_get("*");
+}
+
+static esp_err_t console_set_log_level(int32_t value)
+{
+    esp_log_level_set("*", (esp_log_level_t)value);
+    return ESP_OK;
+}
+
+static void console_print_keys(void)
+{
+    matrix_keyboard_stats_t stats;
+    
+    if (matrix_keyboard_get_stats(&stats) != ESP_OK) {
+        printf("keypad not initialized\n");
+        return;
+    }
+    printf("presses %" PRIu32 " releases %" PRIu32 " queue overflows %" PRIu32
+           " held back by debounce %" PRIu32 " uptime %" PRIu64 " s\n",
+           stats.total_key_presses, stats.total_key_releases, stats.queue_overflows,
+           stats.debounce_rejections, stats.uptime_us / 1000000);
+    printf("idle waits ended by a key %" PRIu32 "\n", stats.idle_wakeups);
+    printf("debounce %s %" PRIu32 " ms (integrator %u), scan %" PRIu32 " ms\n",
+           key_debounce_mode_name(keyboard.debounce.mode), keyboard.debounce_ms,
+           keyboard.debounce.integrator_samples, keyboard.scan_interval_ms);
+}
+
+static void console_print_adc(void)
+{
+    adc_sampler_stats_t stats;
+    uint32_t filter_avg;
+    uint32_t filter_max;
+    
+    if (adc_sampler_get_stats(&stats) == ESP_OK) {
+        printf("frames %" PRIu32 " samples %" PRIu32 " readings %" PRIu32 " pool overflows %" PRIu32
+               " bursts %" PRIu32 "\n", stats.frames, stats.samples, stats.readings,
+               stats.pool_overflows, stats.bursts);
+    }
+    grill_zones_get_filter_cost(&filter_avg, &filter_max);
+    printf("%d zones at %d Hz, %d oversample bits; filter avg %" PRIu32 " max %" PRIu32
+           " " CYCLE_COUNTER_UNIT "\n", GRILL_ZONE_COUNT, ADC_SAMPLE_FREQ_HZ, ADC_OVERSAMPLE_BITS,
+           filter_avg, filter_max);
+}
+
+static void console_print_heater(void)
+{
+    heater_control_metrics_t heater;
+    
+    heater_control_get_metrics(&heater);
+    printf("steps %" PRIu32 " overruns %" PRIu32 " sensor faults %" PRIu32 "\n",
+           heater.steps, heater.overruns, heater.sensor_faults);
+    printf("jitter avg %" PRIu32 " us max %" PRIu32 " us, step avg %" PRIu32 " max %" PRIu32
+           " " CYCLE_COUNTER_UNIT "\n", heater.jitter_avg_us, heater.jitter_max_us,
+           heater.exec_avg, heater.exec_max);
+    if (heater.setpoint_centi != HEATER_CONTROL_OFF) {
+        printf("%.2f C -> %.2f C, duty %.1f %%\n", heater.measured_centi / 100.0f,
+               heater.setpoint_centi / 100.0f, heater.duty / 100.0f);
+    }
+}
+
+static void console_print_session_log(void)
+{
+    session_log_stats_t stats;
+    
+    if (session_store_get_stats(&stats) != ESP_OK) {
+        printf("session log unavailable\n");
+        return;
+    }
+    printf("appended %" PRIu32 " dropped %" PRIu32 " flushed %" PRIu32 " flash writes %" PRIu32 "\n",
+           stats.appended, stats.dropped, stats.flushed, stats.flash_writes);
+    printf("erases %" PRIu32 ", sector wear %" PRIu32 "..%" PRIu32 "\n",
+           stats.sector_erases, stats.min_erase_count, stats.max_erase_count);
+}
+
+static void console_print_ui(void)
+{
+    static const char *const source_names[EVENT_BUS_SOURCE_COUNT] = {
+        "keys", "alarms", "readings", "ui timer", "redraw"
+    };
+    
+    printf("screen %s, transitions %" PRIu32 " ignored %" PRIu32 "\n",
+           ui_fsm_state_name(&grill_ui, grill_ui.state), grill_ui.taken, grill_ui.ignored);
+    for (int source = 0; source < EVENT_BUS_SOURCE_COUNT; source++) {
+        printf("%s %" PRIu32 "%s", source_names[source], event_bus_count((event_bus_source_t)source),
+               source + 1 < EVENT_BUS_SOURCE_COUNT ? ", " : "\n");
+    }
+}
+
+static void console_print_memory(void)
+{
+    diagnostics_sample_t sample;
+    char line[DIAGNOSTICS_LINE_LEN];
+    
+    if (diagnostics_latest(&sample) != ESP_OK) {
+        printf("no sample yet\n");
+        return;
     }
+    diagnostics_format(&sample, line, sizeof(line));
+    printf("%s\n", line);
+}
+
+static void console_print_cpu(void)
+{
+    cpu_profiler_report_t report;
+    
+    esp_err_t ret = cpu_profiler_get(&report);
+    if (ret != ESP_OK) {
+        printf("no load window: %s\n", esp_err_to_name(ret));
+        return;
+    }
+    cpu_profiler_log(&report);
+}
+
+/**
+ * @brief Wakeups per second and share of time asleep, since the last query and since boot
+ */
+static void console_print_power(void)
+{
+    static power_mgmt_stats_t previous;
+    power_mgmt_stats_t now;
+    
+    esp_err_t ret = power_mgmt_get_stats(&now);
+    if (ret != ESP_OK) {
+        printf("no power statistics: %s\n", esp_err_to_name(ret));
+        return;
+    }
+    
+    static const power_mgmt_stats_t boot = { 0 };
+    const power_mgmt_stats_t *from[] = { &previous, &boot };
+    const char *label[] = { "last", "boot" };
+    for (int i = 0; i < 2; i++) {
+        double seconds = (now.uptime_us - from[i]->uptime_us) / 1e6;
+        uint32_t wakeups = now.wakeups - from[i]->wakeups;
+        uint64_t asleep_us = now.asleep_us - from[i]->asleep_us;
+        printf("since %s %.1f s: %" PRIu32 " wakeups (%.1f/s), asleep %.1f %%\n", label[i], seconds,
+               wakeups, seconds > 0 ? wakeups / seconds : 0.0,
+               seconds > 0 ? asleep_us / (seconds * 1e4) : 0.0);
+    }
+    previous = now;
+    power_mgmt_print_locks();
+}
+
+static void console_print_telemetry(void)
+{
+    telemetry_stats_t stats;
+    
+    esp_err_t ret = telemetry_get_stats(&stats);
+    if (ret != ESP_OK) {
+        printf("telemetry off: %s\n", esp_err_to_name(ret));
+        return;
+    }
+    printf("records %" PRIu32 " (syncs %" PRIu32 "), dropped low %" PRIu32 " normal %" PRIu32
+           " critical %" PRIu32 "\n", stats.records, stats.syncs, stats.dropped[TELEMETRY_PRIO_LOW],
+           stats.dropped[TELEMETRY_PRIO_NORMAL], stats.dropped[TELEMETRY_PRIO_CRITICAL]);
+    printf("bytes queued %" PRIu64 " sent %" PRIu64 " lost %" PRIu32 " in %" PRIu32 " writes\n",
+           stats.bytes_queued, stats.bytes_sent, stats.bytes_lost, stats.tx_writes);
+    printf("ring %" PRIu32 " / %d bytes, high water %" PRIu32 ", renumbered %" PRIu32 "\n",
+           stats.ring_used, TELEMETRY_RING_BYTES, stats.ring_high_water, stats.renumbered);
+}
+
+static void console_print_pins(void)
+{
+    printf("rows");
+    for (int row = 0; row < MATRIX_ROWS; row++) {
+        printf(" %d", row_pins[row]);
+    }
+    printf(", cols");
+    for (int col = 0; col < MATRIX_COLS; col++) {
+        printf(" %d", col_pins[col]);
+    }
+    printf("\nlcd rs %d e %d d4-d7 %d %d %d %d\n", lcd.pins.rs, lcd.pins.e, lcd.pins.d4,
+           lcd.pins.d5, lcd.pins.d6, lcd.pins.d7);
+    printf("encoder %d %d, heater %d, adc1 channels", ENCODER_PIN_A, ENCODER_PIN_B,
+           HEATER_PWM_GPIO);
+    for (int zone = 0; zone < GRILL_ZONE_COUNT; zone++) {
+        printf(" %d", zone_channels[zone]);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief Borrow the LCD from the main loop for the benchmark
+ */
+static esp_err_t console_lcd_begin(void)
+{
+    lcd_bus_take();
+    return ESP_OK;
+}
+
+static void console_lcd_run(uint32_t iteration)
+{
+    char line[17];
+    
+    snprintf(line, sizeof(line), "Run %-12" PRIu32, iteration);
+    hd44780_clear(&lcd);
+    hd44780_gotoxy(&lcd, 0, 0);
+    hd44780_puts(&lcd, "LCD benchmark");
+    hd44780_gotoxy(&lcd, 0, 1);
+    hd44780_puts(&lcd, line);
+}
+
+/**
+ * @brief Hand the LCD back and have the main loop redraw the screen
+ */
+static void console_lcd_end(void)
+{
+    lcd_bus_give();
+    event_bus_signal(EVENT_BUS_REDRAW);
+}
+
+/**
+ * @brief Resynchronize the 4-bit interface after raw bus writes, then redraw
+ */
+static void console_lcd_bus_end(void)
+{
+    hd44780_init(&lcd);
+    console_lcd_end();
+}
+
+/**
+ * @brief All-zero command nibbles: the pairs form no instruction
+ */
+static void console_nibble_run(uint32_t iteration)
+{
+    hd44780_write_nibble(&lcd, 0, false);
+}
+
+static void console_byte_run(uint32_t iteration)
+{
+    hd44780_write_byte(&lcd, 0, false);
+}
+
+/**
+ * @brief One line's worth of characters; the redraw afterwards repaints the screen
+ */
+static void console_puts_run(uint32_t iteration)
+{
+    hd44780_puts(&lcd, "Benchmark line..");
+}
+
+/**
+ * @brief Stop the scan task between passes for the benchmark
+ */
+static esp_err_t console_scan_begin(void)
+{
+    if (!keyboard.initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    xSemaphoreTake(keyboard.scan_lock, portMAX_DELAY);
+    return ESP_OK;
+}
+
+static void console_scan_run(uint32_t iteration)
+{
+    matrix_keyboard_scan_once();
+}
+
+/**
+ * @brief Release the scan task; if it was parked, it re-parks with fresh rows
+ */
+static void console_scan_end(void)
+{
+    xSemaphoreGive(keyboard.scan_lock);
+    xTaskNotifyGive(scan_task_handle);
+}
+
+/**
+ * @brief Hold the scan task and keep the state of the key the benchmark feeds
+ */
+static esp_err_t console_debounce_begin(void)
+{
+    esp_err_t ret = console_scan_begin();
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    console_debounce_saved = keyboard.keys[0][0];
+    return ESP_OK;
+}
+
+/**
+ * @brief Key '1' with a bouncing contact (pseudo-random levels)
+ */
+static void console_debounce_run(uint32_t iteration)
+{
+    static volatile int32_t sink = 0;
+    
+    sink += is_key_debounced(0, 0, (iteration * 2654435761u) >> 31);
+}
+
+/**
+ * @brief Put the key back as the scan task left it
+ */
+static void console_debounce_end(void)
+{
+    keyboard.keys[0][0] = console_debounce_saved;
+    console_scan_end();
+}
+
+/**
+ * @brief Convert one oversampled code (sweeps the table)
+ */
+static void console_adc_run(uint32_t iteration)
+{
+    static volatile int32_t sink = 0;     // Keeps the calls alive
+    uint32_t code = (iteration * 2654435761u) >> (32 - 12 - ADC_OVERSAMPLE_BITS);
+    
+    sink += temp_lut_oversampled_to_centi(&temp_lut, code, ADC_OVERSAMPLE_BITS);
+}
+
+static void console_sensor_run(uint32_t iteration)
+{
+    static volatile int32_t sink = 0;
+    
+    sink += (int32_t)read_temperature_sensor();
+}
+
+/**
+ * @brief Sweep 0..99 °C across the band edges
+ */
+static void console_classify_run(uint32_t iteration)
+{
+    static volatile int32_t sink = 0;
+    
+    sink += determine_meat_term_from_temperature((int)(iteration % 100));
+}
+
+static void console_telemetry_run(uint32_t iteration)
+{
+    // Encoded into a scratch frame: bench records never reach the live stream
+    static uint8_t frame[TELEMETRY_MAX_FRAME];
+    uint8_t payload[TELEMETRY_ZONES_PAYLOAD_MAX];
+    int32_t centi[GRILL_ZONE_COUNT];
+    
+    for (int zone = 0; zone < GRILL_ZONE_COUNT; zone++) {
+        centi[zone] = 2000 + (int32_t)(iteration % 100) * 100 + zone;
+    }
+    size_t len = telemetry_zones_payload(payload, centi, GRILL_ZONE_COUNT, TELEMETRY_NO_VALUE, 0);
+    telemetry_encode_frame(TELEMETRY_ZONES, (uint8_t)iteration, 500000, payload, len, frame);
 }
 
 /**
@@ -746,17 +2262,50 @@ static void temperature_monitoring_task(void *pvParameters)
  */
 void app_main(void)
 {
+    esp_err_t ret;
+    
     ESP_LOGI(TAG, "ESP32-S3 Hamburger Grill Control System Starting");
     ESP_LOGI(TAG, "Mechatronics Engineering Implementation v2.0");
     
-    // Initialize LCD display first
+    // Frequency scaling and light sleep before the drivers create their locks
+    ret = power_mgmt_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Power management unavailable: %s", esp_err_to_name(ret));
+    }
+    
+    // Core and priority of every task (this loop included) before any is created
+    ret = task_layout_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Task layout measurement failed to start: %s", esp_err_to_name(ret));
+    }
+    
+    // Initialize LCD display first (its bus lock too: init is a bus write)
     ESP_LOGI(TAG, "Initializing LCD display...");
-    esp_err_t ret = hd44780_init(&lcd);
+    lcd_lock = xSemaphoreCreateMutex();
+    if (lcd_lock == NULL) {
+        ESP_LOGE(TAG, "Failed to create LCD lock");
+        return;
+    }
+    // Without CONFIG_PM_ENABLE there is no frequency to hold: lcd_pm_lock stays NULL
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "lcd", &lcd_pm_lock) != ESP_OK) {
+        lcd_pm_lock = NULL;
+    }
+    lcd_bus_take();
+    ret = hd44780_init(&lcd);
+    lcd_bus_give();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "LCD initialization failed: %s", esp_err_to_name(ret));
         return;
     }
     
+    // Load the built-in cooking profiles (beef first)
+    ret = cook_profile_load(&cook_profiles, cook_profile_default_blob, cook_profile_default_blob_size);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Cooking profiles invalid: %s", esp_err_to_name(ret));
+        return;
+    }
+    ESP_LOGI(TAG, "Loaded %u cooking profiles", cook_profiles.count);
+    
     // Initialize temperature sensor (ADC)
     ESP_LOGI(TAG, "Initializing temperature sensor...");
     ret = temperature_sensor_init();
@@ -765,110 +2314,205 @@ void app_main(void)
         return;
     }
     
+    // Heater control: without it the grill still classifies, but cannot heat
+    heater_control_config_t heater_config = {
+        .pwm_gpio = HEATER_PWM_GPIO,
+        .pwm_freq_hz = HEATER_PWM_FREQ_HZ,
+        .zone = 0,
+        .pid = {
+            .kp = HEATER_KP,
+            .ki = HEATER_KI,
+            .kd = HEATER_KD,
+            .kd_filter_s = HEATER_KD_FILTER_S,
+            .kff = HEATER_KFF,
+            .ambient_centi = HEATER_AMBIENT_CENTI,
+            .period_ms = HEATER_CONTROL_PERIOD_MS,
+        },
+    };
+    ret = heater_control_init(&heater_config);
+    if (ret == ESP_OK) {
+        ret = heater_control_start();
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Heater control unavailable: %s", esp_err_to_name(ret));
+    }
+    
+    // Session log is optional: the grill still runs without the partition
+    ret = session_store_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Session log unavailable: %s", esp_err_to_name(ret));
+    }
+    
+    // Binary telemetry is optional too: nothing waits on the link
+    ret = telemetry_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Telemetry unavailable: %s", esp_err_to_name(ret));
+    }
+    
     // Display initial message on LCD
+    lcd_bus_take();
     hd44780_clear(&lcd);
     hd44780_gotoxy(&lcd, 0, 0);
     hd44780_puts(&lcd, "Hello World");
     hd44780_gotoxy(&lcd, 0, 1);
     hd44780_puts(&lcd, "Meca");
+    lcd_bus_give();
     vTaskDelay(pdMS_TO_TICKS(2000)); // Show welcome message for 2 seconds
     
+    // One wait for keys, alarm events, readings and UI timers (sources join below)
+    ret = event_bus_init(KEY_QUEUE_SIZE + ALARM_QUEUE_SIZE);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Event bus initialization failed: %s", esp_err_to_name(ret));
+        return;
+    }
+    
     // Initialize matrix keyboard driver
     ESP_LOGI(TAG, "Initializing matrix keyboard...");
     ret = matrix_keyboard_init();
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Matrix keyboard initialization failed: %s", 
                  esp_err_to_name(ret));
+        lcd_bus_take();
         hd44780_clear(&lcd);
         hd44780_gotoxy(&lcd, 0, 0);
         hd44780_puts(&lcd, "ERROR:");
         hd44780_gotoxy(&lcd, 0, 1);
         hd44780_puts(&lcd, "Keyboard Init");
+        lcd_bus_give();
         return;
     }
     
+    // Initialize rotary encoder (optional input, keypad still works without it)
+    rotary_encoder_config_t encoder_config = {
+        .pin_a = ENCODER_PIN_A,
+        .pin_b = ENCODER_PIN_B,
+        .glitch_filter_ns = ROTARY_ENCODER_GLITCH_NS,
+        // The filter's APB lock would keep the chip out of light sleep: idle the unit at rest
+        .idle_ms = POWER_MGMT_LIGHT_SLEEP ? ENCODER_IDLE_MS : 0,
+        .counts_per_detent = ROTARY_ENCODER_COUNTS_PER_DETENT,
+        .accel = {
+            .slow_interval_us = ENCODER_SLOW_INTERVAL_MS * 1000,
+            .fast_interval_us = ENCODER_FAST_INTERVAL_MS * 1000,
+            .max_multiplier = ENCODER_MAX_MULTIPLIER,
+        },
+    };
+    ret = rotary_encoder_init(&encoder_config);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Rotary encoder unavailable: %s", esp_err_to_name(ret));
+    }
+    
     // Start temperature monitoring task
     ESP_LOGI(TAG, "Starting temperature monitoring task...");
-    BaseType_t task_created = xTaskCreate(
-        temperature_monitoring_task,
-        "temp_monitor", 
-        4096,
-        NULL,
-        5,
-        NULL
-    );
-    
-    if (task_created != pdPASS) {
+    doneness_init(&temp_trend);
+    const temp_alarm_config_t alarm_config = {
+        .hysteresis_centi = ALARM_HYSTERESIS_CENTI,
+        .band_dwell_ms = ALARM_BAND_DWELL_MS,
+        .alarm_dwell_ms = ALARM_DWELL_MS,
+        .rate_centi_per_min = ALARM_RATE_CENTI_PER_MIN,
+        .rate_hysteresis = ALARM_RATE_HYSTERESIS,
+    };
+    temp_alarm_init(&temp_alarm, &alarm_config, cook_profile_active(&cook_profiles));
+    alarm_event_queue = xQueueCreate(ALARM_QUEUE_SIZE, sizeof(temp_alarm_event_t));
+    if (alarm_event_queue == NULL) {
+        ESP_LOGE(TAG, "Failed to create alarm event queue");
+        return;
+    }
+    ret = event_bus_add_queue(EVENT_BUS_ALARM, alarm_event_queue, ALARM_QUEUE_SIZE);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to add alarm queue to the event bus: %s", esp_err_to_name(ret));
+        return;
+    }
+    ret = task_layout_create(TASK_LAYOUT_MONITOR, temperature_monitoring_task, NULL, NULL);
+    if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to create temperature monitoring task");
         return;
     }
     
-    // Show initial grill interface
-    update_grill_display();
+    // Stack and heap watermarks of the tasks above (diagnostics only, not fatal)
+    ret = diagnostics_init(DIAGNOSTICS_PERIOD_MS);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Diagnostics unavailable: %s", esp_err_to_name(ret));
+    }
+    ret = cpu_profiler_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "CPU profiler unavailable: %s", esp_err_to_name(ret));
+    }
+    
+    // Show initial grill interface (entry action of the first screen)
+    ret = ui_fsm_init(&grill_ui, ui_states, STATE_COUNT, ui_transitions,
+                      sizeof(ui_transitions) / sizeof(ui_transitions[0]), &ui_timer_hooks,
+                      UI_EVENT_TIMEOUT, STATE_ASK_TEMPERATURE, esp_timer_get_time() / 1000);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Invalid UI state table: %s", esp_err_to_name(ret));
+        return;
+    }
     
     ESP_LOGI(TAG, "Hamburger Grill System Ready!");
+    lcd_bus_take();
     hd44780_puts(&lcd, "Press any key...");
+    lcd_bus_give();
     
     ESP_LOGI(TAG, "System ready - Matrix keyboard and LCD active");
-    ESP_LOGI(TAG, "Key mapping: 1-9,0,*,#,A-D");
+    ESP_LOGI(TAG, "Key mapping: 1-9,0,*,#, A=cooking profile, B=CPU load (encoder adjusts temperature)");
+    
+    // Serial shell for tuning and benchmarks (optional)
+    ret = grill_console_start(&console_tables);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Console unavailable: %s", esp_err_to_name(ret));
+    }
     
     // Main application loop - Hamburger Grill Control System
     key_event_t key_event;
+    temp_alarm_event_t alarm_event;
+    int64_t refreshed_us = 0;
     
     while (1) {
-        // Get key events with 100ms timeout
-        ret = matrix_keyboard_get_key(&key_event, 100);
-        
-        if (ret == ESP_OK) {
-            if (key_event.pressed) {
-                // Key press event - Enhanced console output
-                ESP_LOGI(TAG, "🔑 KEY PRESSED: '%c' at position [%d,%d]", 
-                         key_event.key_char, key_event.row, key_event.col);
-                
-                printf(">>> Key '%c' PRESSED <<<\n", key_event.key_char);
-                
-                // Handle hamburger grill temperature input and control
-                char key = key_event.key_char;
+        // Sleep until a key, alarm event, new reading or UI timer needs handling
+        switch (event_bus_wait(portMAX_DELAY)) {
+            case EVENT_BUS_KEY:
+                if (matrix_keyboard_get_key(&key_event, 0) == ESP_OK) {
+                    handle_key_event(&key_event);
+                }
+                break;
                 
-                // Process based on current system state
-                if (grill_system.current_state == STATE_ASK_TEMPERATURE || 
-                    grill_system.current_state == STATE_INPUTTING_TEMPERATURE) {
-                    // Handle temperature input (digits, #, *)
-                    handle_temperature_input(key);
-                    ESP_LOGI(TAG, "Temperature input key: %c", key);
-                    
-                } else if (grill_system.current_state == STATE_SHOWING_MEAT_TERM) {
-                    // Handle control commands when showing meat term
-                    if (key == '#' || key == '*') {
-                        handle_control_keys(key);
-                        ESP_LOGI(TAG, "Control key processed: %c", key);
-                    } else {
-                        ESP_LOGW(TAG, "Invalid key '%c' - use # for status, * for reset", key);
+            case EVENT_BUS_ALARM:
+                // Log every event; redraw the alarm line only when an alarm changes
+                if (xQueueReceive(alarm_event_queue, &alarm_event, 0) == pdTRUE) {
+                    handle_alarm_event(&alarm_event);
+                    if (alarm_event.type != TEMP_ALARM_EVENT_BAND && is_doneness_line_shown()) {
+                        update_doneness_line();
                     }
-                    
-                } else if (key >= 'A' && key <= 'D') {
-                    // Additional functions (future expansion)
-                    hd44780_clear(&lcd);
-                    hd44780_gotoxy(&lcd, 0, 0);
-                    char func_msg[20];
-                    snprintf(func_msg, sizeof(func_msg), "Function %c", key);
-                    hd44780_puts(&lcd, func_msg);
-                    hd44780_gotoxy(&lcd, 0, 1);
-                    hd44780_puts(&lcd, "Not Available");
-                    ESP_LOGI(TAG, "Function %c pressed (not implemented)", key);
-                    vTaskDelay(pdMS_TO_TICKS(1500));
-                    update_grill_display(); // Return to normal display
-                    
-                } else {
-                    // Invalid key for current state
-                    ESP_LOGW(TAG, "Invalid key '%c' for current state", key);
                 }
+                break;
+                
+            case EVENT_BUS_READINGS: {
+                // New prediction: keep the time-to-doneness line and CPU page current
+                int64_t now_us = esp_timer_get_time();
+                // (half a reading period of slack so wake-up jitter does not skip one)
+                if (now_us - refreshed_us <
+                    (DONENESS_DISPLAY_INTERVAL_MS - (int64_t)temp_update_interval_ms / 2) * 1000) {
+                    break;
+                }
+                if (is_doneness_line_shown()) {
+                    refreshed_us = now_us;
+                    update_doneness_line();
+                } else if (grill_ui.state == STATE_SHOWING_CPU_LOAD) {
+                    refreshed_us = now_us;
+                    update_grill_display();
+                }
+                break;
             }
-        } else if (ret == ESP_ERR_TIMEOUT) {
-            // No key events - system idle, temperature monitoring continues
+                
+            case EVENT_BUS_UI_TIMER:
+                ui_dispatch(UI_EVENT_TIMEOUT, 0);
+                break;
+                
+            case EVENT_BUS_REDRAW:
+                update_grill_display();
+                break;
+                
+            default:
+                break;
         }
-        
-        // Small delay to prevent excessive CPU usage
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
 }
\ No newline at end of file
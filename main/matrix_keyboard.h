@@ -20,27 +20,36 @@ extern "C" {
 /* ==================== INCLUDES ==================== */
 #include <stdint.h>
 #include <stdbool.h>
+#include "sdkconfig.h"
 #include "esp_err.h"
 
 /* ==================== CONFIGURATION CONSTANTS ==================== */
 
-/** @brief Number of rows in the matrix keyboard */
+/** @brief Number of rows in the matrix keyboard (*, 0 and # sit on the last) */
 #define MATRIX_ROWS                 4
 
-/** @brief Number of columns in the matrix keyboard */
-#define MATRIX_COLS                 4
+/** @brief Number of columns in the matrix keyboard (4x4, or a 4x3 phone pad) */
+#define MATRIX_COLS                 CONFIG_GRILL_KEYPAD_COLS
 
-/** @brief Debounce time in milliseconds (professional standard) */
-#define DEBOUNCE_TIME_MS           50
+/** @brief Debounce time in milliseconds at boot (professional standard) */
+#define DEBOUNCE_TIME_MS            CONFIG_GRILL_KEYPAD_DEBOUNCE_MS
 
-/** @brief Keyboard scanning interval in milliseconds */
-#define SCAN_INTERVAL_MS           10
+/** @brief Keyboard scanning interval in milliseconds at boot */
+#define SCAN_INTERVAL_MS            CONFIG_GRILL_KEYPAD_SCAN_MS
 
 /** @brief Maximum number of key events in the queue */
 #define KEY_QUEUE_SIZE             16
 
 /* ==================== DATA TYPES ==================== */
 
+/**
+ * @brief Input device that produced a key event
+ */
+typedef enum {
+    KEY_EVENT_SOURCE_MATRIX = 0,   /**< Matrix keypad press or release */
+    KEY_EVENT_SOURCE_ENCODER,      /**< Rotary encoder detent (see delta) */
+} key_event_source_t;
+
 /**
  * @brief Key event structure for professional event handling
  * 
@@ -50,9 +59,11 @@ extern "C" {
 typedef struct {
     uint8_t row;           /**< Row index (0 to MATRIX_ROWS-1) */
     uint8_t col;           /**< Column index (0 to MATRIX_COLS-1) */
-    char key_char;         /**< Mapped character for the key */
+    char key_char;         /**< Mapped character for the key ('+'/'-' for encoder) */
     bool pressed;          /**< true = key pressed, false = key released */
     uint64_t timestamp;    /**< Event timestamp in microseconds */
+    key_event_source_t source; /**< Device that produced the event */
+    int16_t delta;         /**< Accelerated encoder steps (0 for matrix keys) */
 } key_event_t;
 
 /**
@@ -124,6 +135,26 @@ esp_err_t matrix_keyboard_init_with_config(const matrix_keyboard_config_t *confi
  */
 esp_err_t matrix_keyboard_get_key(key_event_t *event, uint32_t timeout_ms);
 
+/**
+ * @brief Post an event from another input device into the key event queue
+ * 
+ * Lets interrupt-driven inputs such as the rotary encoder share the keypad
+ * event path. The event is dropped (and counted as an overflow) if the queue
+ * is full.
+ * 
+ * @param event Event to post
+ * @param higher_priority_task_woken Set to true if a context switch is needed
+ * 
+ * @return ESP_OK if the event was queued
+ * @return ESP_ERR_INVALID_ARG if event is NULL
+ * @return ESP_ERR_INVALID_STATE if keyboard driver is not initialized
+ * @return ESP_ERR_NO_MEM if the queue is full
+ * 
+ * @note Must only be called from interrupt context
+ */
+esp_err_t matrix_keyboard_post_event_from_isr(const key_event_t *event,
+                                              bool *higher_priority_task_woken);
+
 /**
  * @brief Check if the keyboard driver is initialized and operational
  * 
@@ -167,18 +198,20 @@ const char* matrix_keyboard_get_version(void);
 /**
  * @brief Set custom debounce time
  * 
- * @param debounce_ms New debounce time in milliseconds (10-200ms recommended)
+ * @param debounce_ms New debounce time in milliseconds (10-200ms)
  * @return ESP_OK on success
  * @return ESP_ERR_INVALID_ARG if debounce time is out of range
+ * @return ESP_ERR_INVALID_STATE if driver not initialized
  */
 esp_err_t matrix_keyboard_set_debounce_time(uint32_t debounce_ms);
 
 /**
  * @brief Set custom scan interval
  * 
- * @param interval_ms New scan interval in milliseconds (5-50ms recommended)
+ * @param interval_ms New scan interval in milliseconds (5-50ms)
  * @return ESP_OK on success
  * @return ESP_ERR_INVALID_ARG if interval is out of range
+ * @return ESP_ERR_INVALID_STATE if driver not initialized
  */
 esp_err_t matrix_keyboard_set_scan_interval(uint32_t interval_ms);
 
@@ -190,8 +223,9 @@ esp_err_t matrix_keyboard_set_scan_interval(uint32_t interval_ms);
 typedef struct {
     uint32_t total_key_presses;    /**< Total key presses since initialization */
     uint32_t total_key_releases;   /**< Total key releases since initialization */
-    uint32_t queue_overflows;      /**< Number of queue overflow events */
-    uint32_t debounce_rejections;  /**< Number of events rejected due to debouncing */
+    uint32_t queue_overflows;      /**< Events dropped on a full queue (scan and ISR posts) */
+    uint32_t debounce_rejections;  /**< Scans whose raw reading the debouncer held back */
+    uint32_t idle_wakeups;         /**< Idle waits (all keys up) ended by a column interrupt */
     uint64_t uptime_us;           /**< Driver uptime in microseconds */
 } matrix_keyboard_stats_t;
 
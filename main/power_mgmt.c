@@ -0,0 +1,114 @@
+/**
+ * @file power_mgmt.c
+ * @brief esp_pm configuration and light-sleep counters
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "power_mgmt.h"
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "POWER_MGMT";
+
+static bool pm_initialized = false;
+static int64_t init_time_us = 0;
+static uint32_t sleep_exits = 0;
+static uint64_t sleep_total_us = 0;
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+#if CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+/**
+ * @brief Back from light sleep (idle task, interrupts off): count it
+ */
+static esp_err_t IRAM_ATTR power_mgmt_on_sleep_exit(int64_t sleep_time_us, void *arg)
+{
+    portENTER_CRITICAL_ISR(&stats_lock);
+    sleep_exits++;
+    sleep_total_us += (uint64_t)sleep_time_us;
+    portEXIT_CRITICAL_ISR(&stats_lock);
+    return ESP_OK;
+}
+#endif
+
+esp_err_t power_mgmt_init(void)
+{
+#if CONFIG_PM_ENABLE
+    if (pm_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const esp_pm_config_t pm_config = {
+        .max_freq_mhz = POWER_MGMT_MAX_CPU_MHZ,
+        .min_freq_mhz = POWER_MGMT_MIN_CPU_MHZ,
+        .light_sleep_enable = POWER_MGMT_LIGHT_SLEEP,
+    };
+    esp_err_t ret = esp_pm_configure(&pm_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to configure power management: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+#if POWER_MGMT_LIGHT_SLEEP
+    // Keypad columns (matrix_keyboard) wake the chip once configured with gpio_wakeup_enable()
+    ret = esp_sleep_enable_gpio_wakeup();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "GPIO wakeup unavailable: %s", esp_err_to_name(ret));
+    }
+#endif
+
+#if CONFIG_PM_LIGHT_SLEEP_CALLBACKS
+    esp_pm_sleep_cbs_register_config_t callbacks = {
+        .exit_cb = power_mgmt_on_sleep_exit,
+    };
+    ret = esp_pm_light_sleep_register_cbs(&callbacks);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Sleep statistics unavailable: %s", esp_err_to_name(ret));
+    }
+#else
+    ESP_LOGW(TAG, "Enable CONFIG_PM_LIGHT_SLEEP_CALLBACKS for sleep statistics");
+#endif
+
+    init_time_us = esp_timer_get_time();
+    pm_initialized = true;
+    ESP_LOGI(TAG, "CPU %d-%d MHz, automatic light sleep %s", POWER_MGMT_MIN_CPU_MHZ,
+             POWER_MGMT_MAX_CPU_MHZ, POWER_MGMT_LIGHT_SLEEP ? "on" : "off");
+    return ESP_OK;
+#else
+    ESP_LOGW(TAG, "Enable CONFIG_PM_ENABLE for frequency scaling and light sleep");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t power_mgmt_get_stats(power_mgmt_stats_t *stats)
+{
+    if (stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!pm_initialized) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    portENTER_CRITICAL(&stats_lock);
+    stats->wakeups = sleep_exits;
+    stats->asleep_us = sleep_total_us;
+    portEXIT_CRITICAL(&stats_lock);
+    stats->uptime_us = esp_timer_get_time() - init_time_us;
+    return ESP_OK;
+}
+
+void power_mgmt_print_locks(void)
+{
+    printf("cpu %d-%d MHz, light sleep %s\n", POWER_MGMT_MIN_CPU_MHZ, POWER_MGMT_MAX_CPU_MHZ,
+           POWER_MGMT_LIGHT_SLEEP ? "on" : "off");
+    fflush(stdout);
+    esp_pm_dump_locks(stdout);
+}
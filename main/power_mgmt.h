@@ -0,0 +1,103 @@
+/**
+ * @file power_mgmt.h
+ * @brief Dynamic frequency scaling, automatic light sleep and sleep statistics
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * power_mgmt_init() configures esp_pm: the CPU runs at POWER_MGMT_MAX_CPU_MHZ
+ * only while some driver holds a lock and drops to POWER_MGMT_MIN_CPU_MHZ
+ * otherwise; with CONFIG_FREERTOS_USE_TICKLESS_IDLE the idle task enters
+ * light sleep whenever no lock is held and the next timeout is far enough
+ * away. Locks are held only while hardware is busy:
+ *
+ * - ADC DMA: by the driver, from adc_sampler start to stop. In standby the
+ *   zones are sampled in one burst per reading period (grill_zones_sample())
+ * - heater GPTimer: by the driver, only while there is a setpoint
+ *   (heater_control.h parks the timer otherwise)
+ * - LCD: "lcd" (CPU_FREQ_MAX) around each bus write in main.c, since the
+ *   HD44780 delays are CPU cycle loops and must not straddle a switch
+ * - keypad: none. Once every key is released the scan task drives all rows
+ *   low and sleeps on a column interrupt, which is also a light sleep wakeup
+ *   source (gpio_wakeup_enable())
+ * - encoder: the PCNT driver's "pcnt" (APB_FREQ_MAX, for the glitch filter)
+ *   and "encoder" (APB_FREQ_MAX), from the first edge of a turn until the
+ *   knob has rested for ENCODER_IDLE_MS. At rest the unit is disabled and
+ *   both phases are wakeup sources (rotary_encoder.h)
+ *
+ * Light-sleep exits are counted by an esp_pm exit callback
+ * (CONFIG_PM_LIGHT_SLEEP_CALLBACKS), together with the time spent asleep;
+ * the console prints both as wakeups per second and sleep share
+ * ("stats power"). On the Linux host build the FreeRTOS fake enters
+ * "light sleep" when every task is blocked, so the same counters show how
+ * long the firmware would stay idle.
+ *
+ * The UART console cannot receive while the chip sleeps: the first
+ * characters typed after a quiet period may be lost.
+ */
+
+#ifndef POWER_MGMT_H
+#define POWER_MGMT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define POWER_MGMT_MAX_CPU_MHZ      CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+#define POWER_MGMT_MIN_CPU_MHZ      40      // XTAL: the lowest frequency DFS may pick
+
+#if CONFIG_FREERTOS_USE_TICKLESS_IDLE
+#define POWER_MGMT_LIGHT_SLEEP      1
+#else
+#define POWER_MGMT_LIGHT_SLEEP      0
+#endif
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Cumulative sleep counters since power_mgmt_init()
+ */
+typedef struct {
+    int64_t uptime_us;          /**< Time since power_mgmt_init() */
+    uint32_t wakeups;           /**< Light-sleep exits */
+    uint64_t asleep_us;         /**< Time spent in light sleep */
+} power_mgmt_stats_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Configure DFS (and light sleep) and start counting sleeps
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_NOT_SUPPORTED without CONFIG_PM_ENABLE
+ * @return ESP_ERR_INVALID_STATE if already initialised
+ * @return Other esp_pm errors otherwise
+ */
+esp_err_t power_mgmt_init(void);
+
+/**
+ * @brief Copy the counters
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if stats is NULL
+ * @return ESP_ERR_INVALID_STATE before power_mgmt_init()
+ */
+esp_err_t power_mgmt_get_stats(power_mgmt_stats_t *stats);
+
+/**
+ * @brief Print the frequency range and the esp_pm lock table to stdout
+ */
+void power_mgmt_print_locks(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* POWER_MGMT_H */
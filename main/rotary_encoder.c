@@ -0,0 +1,380 @@
+/**
+ * @file rotary_encoder.c
+ * @brief Quadrature rotary encoder input backed by the ESP32-S3 pulse counter
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "driver/gpio.h"
+#include "driver/pulse_cnt.h"
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "matrix_keyboard.h"
+#include "rotary_encoder.h"
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "ROTARY_ENCODER";
+
+static pcnt_unit_handle_t pcnt_unit = NULL;
+static pcnt_channel_handle_t pcnt_chan_a = NULL;
+static pcnt_channel_handle_t pcnt_chan_b = NULL;
+static encoder_accel_config_t accel_config;
+static encoder_accel_t accel_state;
+static int encoder_pins[2] = { -1, -1 };        // Phase A and B
+static uint32_t idle_ms = 0;                    // 0: the unit stays enabled
+static esp_pm_lock_handle_t encoder_pm_lock = NULL; // Held while the unit counts (NULL: no PM)
+static esp_timer_handle_t encoder_timer = NULL; // Wake hand-over, then the idle check
+static bool unit_active = false;                // Unit enabled (esp_timer task after init)
+static bool wake_pending = false;               // Lock taken, unit not yet enabled
+static uint32_t last_activity_ms = 0;           // Last detent or wake (PCNT ISR, esp_timer task)
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief PCNT watch point callback, runs once per detent in ISR context
+ *
+ * The unit limits equal the watch points, so the hardware clears the count
+ * every time a detent completes and the next detent starts from zero.
+ */
+static bool rotary_encoder_on_reach(pcnt_unit_handle_t unit,
+                                    const pcnt_watch_event_data_t *edata,
+                                    void *user_ctx)
+{
+    uint64_t now = esp_timer_get_time();
+    int8_t direction = edata->watch_point_value > 0 ? 1 : -1;
+    bool task_woken = false;
+
+    key_event_t event = {
+        .row = 0,
+        .col = 0,
+        .key_char = direction > 0 ? '+' : '-',
+        .pressed = true,
+        .timestamp = now,
+        .source = KEY_EVENT_SOURCE_ENCODER,
+        .delta = encoder_accel_step(&accel_state, &accel_config, direction, now),
+    };
+
+    __atomic_store_n(&last_activity_ms, (uint32_t)(now / 1000), __ATOMIC_RELAXED);
+    matrix_keyboard_post_event_from_isr(&event, &task_woken);
+    return task_woken;
+}
+
+/**
+ * @brief A phase left the rest level while the unit was idle (GPIO ISR)
+ *
+ * The edge itself is not counted (rotary_encoder.h); the chip stays awake at
+ * full APB speed from here and the timer callback enables the unit before
+ * the next, counted, edge.
+ */
+static void IRAM_ATTR rotary_encoder_on_wake(void *arg)
+{
+    // Level interrupts: re-enabled when the unit goes idle again
+    gpio_intr_disable(encoder_pins[0]);
+    gpio_intr_disable(encoder_pins[1]);
+    if (encoder_pm_lock != NULL) {
+        esp_pm_lock_acquire(encoder_pm_lock);
+    }
+    wake_pending = true;
+    esp_timer_start_once(encoder_timer, 0);
+}
+
+/**
+ * @brief Enable and start the unit (esp_timer task, or init)
+ */
+static esp_err_t rotary_encoder_activate(void)
+{
+    esp_err_t ret = pcnt_unit_enable(pcnt_unit);
+    if (ret == ESP_OK) {
+        ret = pcnt_unit_start(pcnt_unit);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    unit_active = true;
+    wake_pending = false;
+    __atomic_store_n(&last_activity_ms, (uint32_t)(esp_timer_get_time() / 1000), __ATOMIC_RELAXED);
+    if (idle_ms > 0) {
+        esp_timer_start_once(encoder_timer, (uint64_t)idle_ms * 1000);
+    }
+    return ESP_OK;
+}
+
+/**
+ * @brief Disable the unit, which drops the driver's APB lock, and wait for
+ *        the next edge on the phase interrupts (esp_timer task)
+ */
+static void rotary_encoder_idle(void)
+{
+    pcnt_unit_stop(pcnt_unit);
+    pcnt_unit_clear_count(pcnt_unit);   // Zero at rest unless a counted edge was missed
+    pcnt_unit_disable(pcnt_unit);
+    unit_active = false;
+    if (encoder_pm_lock != NULL) {
+        esp_pm_lock_release(encoder_pm_lock);
+    }
+
+    // A phase already low raises the interrupt at once
+    gpio_intr_enable(encoder_pins[0]);
+    gpio_intr_enable(encoder_pins[1]);
+}
+
+/**
+ * @brief Wake hand-over or idle check (esp_timer task)
+ */
+static void rotary_encoder_on_timer(void *arg)
+{
+    if (!unit_active) {
+        if (rotary_encoder_activate() != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to re-enable the PCNT unit");
+            wake_pending = false;
+            if (encoder_pm_lock != NULL) {
+                esp_pm_lock_release(encoder_pm_lock);
+            }
+        }
+        return;
+    }
+
+    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    uint32_t quiet_ms = now_ms - __atomic_load_n(&last_activity_ms, __ATOMIC_RELAXED);
+    bool at_rest = gpio_get_level(encoder_pins[0]) && gpio_get_level(encoder_pins[1]);
+
+    if (quiet_ms < idle_ms || !at_rest) {
+        // Still turning (or between detents): check again once idle_ms could have passed
+        uint32_t wait_ms = quiet_ms < idle_ms ? idle_ms - quiet_ms : idle_ms;
+        esp_timer_start_once(encoder_timer, (uint64_t)wait_ms * 1000);
+        return;
+    }
+    rotary_encoder_idle();
+}
+
+/**
+ * @brief Lock, timer and phase interrupts for idling (init)
+ *
+ * The lock is taken here as if a wake edge had just arrived, so that going
+ * idle always releases one acquisition.
+ */
+static esp_err_t rotary_encoder_setup_idle(void)
+{
+    esp_err_t ret;
+
+    // Without CONFIG_PM_ENABLE there is no lock to hold: encoder_pm_lock stays NULL
+    if (esp_pm_lock_create(ESP_PM_APB_FREQ_MAX, 0, "encoder", &encoder_pm_lock) != ESP_OK) {
+        encoder_pm_lock = NULL;
+    }
+
+    esp_timer_create_args_t timer_args = {
+        .callback = rotary_encoder_on_timer,
+        .arg = NULL,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "encoder",
+    };
+    ret = esp_timer_create(&timer_args, &encoder_timer);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create idle timer: %s", esp_err_to_name(ret));
+        goto err_lock;
+    }
+
+    // After pcnt_new_channel(), which configures the pins as inputs with pull-ups
+    for (int i = 0; i < 2; i++) {
+        gpio_set_intr_type(encoder_pins[i], GPIO_INTR_LOW_LEVEL);
+        ret = gpio_isr_handler_add(encoder_pins[i], rotary_encoder_on_wake, NULL);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to add phase interrupt: %s", esp_err_to_name(ret));
+            goto err_handlers;
+        }
+        gpio_intr_disable(encoder_pins[i]);
+        gpio_wakeup_enable(encoder_pins[i], GPIO_INTR_LOW_LEVEL);
+        gpio_sleep_sel_dis(encoder_pins[i]);     // Keep the pull-ups through light sleep
+    }
+
+    if (encoder_pm_lock != NULL) {
+        esp_pm_lock_acquire(encoder_pm_lock);
+    }
+    wake_pending = true;
+    return ESP_OK;
+
+err_handlers:
+    for (int i = 0; i < 2; i++) {
+        gpio_wakeup_disable(encoder_pins[i]);
+        gpio_isr_handler_remove(encoder_pins[i]);
+    }
+    esp_timer_delete(encoder_timer);
+    encoder_timer = NULL;
+err_lock:
+    if (encoder_pm_lock != NULL) {
+        esp_pm_lock_delete(encoder_pm_lock);
+        encoder_pm_lock = NULL;
+    }
+    return ret;
+}
+
+/**
+ * @brief Undo rotary_encoder_setup_idle() (init failure, deinit)
+ */
+static void rotary_encoder_teardown_idle(void)
+{
+    if (encoder_timer == NULL) {
+        return;
+    }
+
+    for (int i = 0; i < 2; i++) {
+        gpio_intr_disable(encoder_pins[i]);
+        gpio_wakeup_disable(encoder_pins[i]);
+        gpio_isr_handler_remove(encoder_pins[i]);
+    }
+    esp_timer_stop(encoder_timer);
+    esp_timer_delete(encoder_timer);
+    encoder_timer = NULL;
+    if (encoder_pm_lock != NULL) {
+        if (unit_active || wake_pending) {
+            esp_pm_lock_release(encoder_pm_lock);
+        }
+        esp_pm_lock_delete(encoder_pm_lock);
+        encoder_pm_lock = NULL;
+    }
+    wake_pending = false;
+}
+
+esp_err_t rotary_encoder_init(const rotary_encoder_config_t *config)
+{
+    esp_err_t ret;
+
+    if (config == NULL || config->counts_per_detent <= 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (pcnt_unit != NULL || !matrix_keyboard_is_initialized()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ESP_LOGI(TAG, "Initializing rotary encoder on GPIO %d/%d", config->pin_a, config->pin_b);
+
+    accel_config = config->accel;
+    memset(&accel_state, 0, sizeof(accel_state));
+
+    // Limits at one detent: the hardware wraps to zero after every detent
+    pcnt_unit_config_t unit_config = {
+        .high_limit = config->counts_per_detent,
+        .low_limit = -config->counts_per_detent,
+    };
+    ret = pcnt_new_unit(&unit_config, &pcnt_unit);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create PCNT unit: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    if (config->glitch_filter_ns > 0) {
+        pcnt_glitch_filter_config_t filter_config = {
+            .max_glitch_ns = config->glitch_filter_ns,
+        };
+        ret = pcnt_unit_set_glitch_filter(pcnt_unit, &filter_config);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to set glitch filter: %s", esp_err_to_name(ret));
+            goto err_unit;
+        }
+    }
+
+    // Each phase counts only while the other is low: the two middle steps of a detent
+    pcnt_chan_config_t chan_a_config = {
+        .edge_gpio_num = config->pin_a,
+        .level_gpio_num = config->pin_b,
+    };
+    ret = pcnt_new_channel(pcnt_unit, &chan_a_config, &pcnt_chan_a);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create PCNT channel A: %s", esp_err_to_name(ret));
+        goto err_unit;
+    }
+
+    pcnt_chan_config_t chan_b_config = {
+        .edge_gpio_num = config->pin_b,
+        .level_gpio_num = config->pin_a,
+    };
+    ret = pcnt_new_channel(pcnt_unit, &chan_b_config, &pcnt_chan_b);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to create PCNT channel B: %s", esp_err_to_name(ret));
+        goto err_chan_a;
+    }
+
+    // Clockwise 00 -> 10 (A rises, B low) and 01 -> 00 (B falls, A low) count up
+    pcnt_channel_set_edge_action(pcnt_chan_a, PCNT_CHANNEL_EDGE_ACTION_INCREASE,
+                                 PCNT_CHANNEL_EDGE_ACTION_DECREASE);
+    pcnt_channel_set_level_action(pcnt_chan_a, PCNT_CHANNEL_LEVEL_ACTION_HOLD,
+                                  PCNT_CHANNEL_LEVEL_ACTION_KEEP);
+    pcnt_channel_set_edge_action(pcnt_chan_b, PCNT_CHANNEL_EDGE_ACTION_DECREASE,
+                                 PCNT_CHANNEL_EDGE_ACTION_INCREASE);
+    pcnt_channel_set_level_action(pcnt_chan_b, PCNT_CHANNEL_LEVEL_ACTION_HOLD,
+                                  PCNT_CHANNEL_LEVEL_ACTION_KEEP);
+
+    pcnt_unit_add_watch_point(pcnt_unit, config->counts_per_detent);
+    pcnt_unit_add_watch_point(pcnt_unit, -config->counts_per_detent);
+
+    pcnt_event_callbacks_t callbacks = {
+        .on_reach = rotary_encoder_on_reach,
+    };
+    ret = pcnt_unit_register_event_callbacks(pcnt_unit, &callbacks, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to register PCNT callbacks: %s", esp_err_to_name(ret));
+        goto err_chan_b;
+    }
+
+    encoder_pins[0] = config->pin_a;
+    encoder_pins[1] = config->pin_b;
+    idle_ms = config->idle_ms;
+    if (idle_ms > 0) {
+        ret = rotary_encoder_setup_idle();
+        if (ret != ESP_OK) {
+            goto err_chan_b;
+        }
+    }
+
+    ret = pcnt_unit_clear_count(pcnt_unit);
+    if (ret == ESP_OK) {
+        ret = rotary_encoder_activate();
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to start PCNT unit: %s", esp_err_to_name(ret));
+        goto err_idle;
+    }
+
+    ESP_LOGI(TAG, "Rotary encoder initialized successfully");
+    return ESP_OK;
+
+err_idle:
+    rotary_encoder_teardown_idle();
+err_chan_b:
+    pcnt_del_channel(pcnt_chan_b);
+    pcnt_chan_b = NULL;
+err_chan_a:
+    pcnt_del_channel(pcnt_chan_a);
+    pcnt_chan_a = NULL;
+err_unit:
+    pcnt_del_unit(pcnt_unit);
+    pcnt_unit = NULL;
+    return ret;
+}
+
+esp_err_t rotary_encoder_deinit(void)
+{
+    if (pcnt_unit == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    rotary_encoder_teardown_idle();
+    if (unit_active) {
+        pcnt_unit_stop(pcnt_unit);
+        pcnt_unit_disable(pcnt_unit);
+        unit_active = false;
+    }
+    pcnt_del_channel(pcnt_chan_a);
+    pcnt_del_channel(pcnt_chan_b);
+    pcnt_del_unit(pcnt_unit);
+
+    pcnt_chan_a = NULL;
+    pcnt_chan_b = NULL;
+    pcnt_unit = NULL;
+    return ESP_OK;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file rotary_encoder.h
+ * @brief Quadrature rotary encoder input backed by the ESP32-S3 pulse counter
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Both encoder phases are decoded in hardware by one PCNT unit behind the
+ * PCNT glitch filter. Watch points at plus and minus one detent raise an
+ * interrupt only when a full detent has been turned, so no task ever polls
+ * the encoder. Each detent is accelerated and posted to the matrix keyboard
+ * event queue as a key_event_t with source KEY_EVENT_SOURCE_ENCODER, so the
+ * application sees keys and knob turns on the same event path.
+ *
+ * Only the two middle steps of each detent's quadrature cycle are counted
+ * (01 -> 00 -> 10 of 11 -> 01 -> 00 -> 10 -> 11 clockwise): the edges that
+ * leave and return to the rest level (both phases high) are held. A bounce on a counted edge
+ * still cancels itself, and an edge leaving rest that the unit misses does
+ * not shift the detent phase.
+ *
+ * That is what makes idling possible: the glitch filter makes the PCNT
+ * driver hold an APB_FREQ_MAX lock while the unit is enabled, which rules out
+ * automatic light sleep. With idle_ms set, the unit is disabled once the
+ * knob has rested for idle_ms, and both phases become level interrupts and
+ * light sleep wakeup sources. The first edge of the next turn (lost while
+ * the chip sleeps, but never counted anyway) takes the "encoder"
+ * APB_FREQ_MAX lock in the interrupt and an esp_timer callback re-enables
+ * the unit, so the rest of the turn is counted with the filter on.
+ */
+
+#ifndef ROTARY_ENCODER_H
+#define ROTARY_ENCODER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include "esp_err.h"
+#include "encoder_accel.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+/** @brief PCNT counts per mechanical detent (middle two steps of a 1-cycle detent) */
+#define ROTARY_ENCODER_COUNTS_PER_DETENT    2
+
+/** @brief Default PCNT glitch filter width in nanoseconds */
+#define ROTARY_ENCODER_GLITCH_NS            1000
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Rotary encoder configuration
+ */
+typedef struct {
+    int pin_a;                      /**< GPIO for phase A */
+    int pin_b;                      /**< GPIO for phase B */
+    uint32_t glitch_filter_ns;      /**< Pulses shorter than this are ignored (0 = off) */
+    uint32_t idle_ms;               /**< Disable the unit after this long at rest (0 = never) */
+    int counts_per_detent;          /**< PCNT counts per detent */
+    encoder_accel_config_t accel;   /**< Acceleration curve */
+} rotary_encoder_config_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Initialise the encoder and start hardware counting
+ *
+ * @param config Encoder configuration
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if config is NULL or invalid
+ * @return ESP_ERR_INVALID_STATE if the encoder or keyboard is not ready
+ * @return Other ESP error codes from the PCNT driver
+ *
+ * @note matrix_keyboard_init() must be called first; detents are posted to
+ *       its event queue
+ */
+esp_err_t rotary_encoder_init(const rotary_encoder_config_t *config);
+
+/**
+ * @brief Stop counting and release the PCNT unit
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if the encoder was not initialised
+ */
+esp_err_t rotary_encoder_deinit(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ROTARY_ENCODER_H */
@@ -0,0 +1,173 @@
+/**
+ * @file sensor_filter.c
+ * @brief Streaming temperature filter pipeline implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "cycle_counter.h"
+#include "sensor_filter.h"
+
+/* ==================== STAGE IMPLEMENTATIONS ==================== */
+
+static int32_t median_process(sensor_filter_stage_t *stage, int32_t x)
+{
+    const uint8_t window = stage->config.median.window;
+    int32_t sorted[SENSOR_FILTER_MEDIAN_MAX];
+
+    stage->median.window[stage->median.head] = x;
+    stage->median.head = (uint8_t)((stage->median.head + 1) % window);
+    if (stage->median.fill < window) {
+        stage->median.fill++;
+    }
+
+    // Insertion sort of at most SENSOR_FILTER_MEDIAN_MAX values
+    const uint8_t n = stage->median.fill;
+    for (uint8_t i = 0; i < n; i++) {
+        int32_t v = stage->median.window[i];
+        int8_t j = (int8_t)i - 1;
+        while (j >= 0 && sorted[j] > v) {
+            sorted[j + 1] = sorted[j];
+            j--;
+        }
+        sorted[j + 1] = v;
+    }
+
+    return sorted[n / 2];
+}
+
+static int32_t iir_process(sensor_filter_stage_t *stage, int32_t x)
+{
+    const int32_t x_q8 = x * 256;
+
+    if (!stage->primed) {
+        stage->iir.state_q8 = x_q8;
+        stage->primed = true;
+    } else {
+        stage->iir.state_q8 += (x_q8 - stage->iir.state_q8) >> stage->config.iir.shift;
+    }
+
+    return (stage->iir.state_q8 + 128) >> 8;
+}
+
+static int32_t kalman_process(sensor_filter_stage_t *stage, int32_t x)
+{
+    const float z = (float)x;
+
+    if (!stage->primed) {
+        stage->kalman.estimate = z;
+        stage->kalman.error_cov = stage->config.kalman.measurement_noise;
+        stage->primed = true;
+        return x;
+    }
+
+    // Predict: constant value plus process noise; update with the measurement
+    float p = stage->kalman.error_cov + stage->config.kalman.process_noise;
+    float gain = p / (p + stage->config.kalman.measurement_noise);
+    stage->kalman.estimate += gain * (z - stage->kalman.estimate);
+    stage->kalman.error_cov = (1.0f - gain) * p;
+
+    float e = stage->kalman.estimate;
+    return (int32_t)(e >= 0.0f ? e + 0.5f : e - 0.5f);
+}
+
+static bool stage_config_valid(const sensor_filter_stage_config_t *config)
+{
+    switch (config->type) {
+        case SENSOR_FILTER_MEDIAN:
+            return config->median.window >= 3 &&
+                   config->median.window <= SENSOR_FILTER_MEDIAN_MAX &&
+                   (config->median.window & 1) != 0;
+        case SENSOR_FILTER_IIR:
+            return config->iir.shift >= 1 && config->iir.shift <= SENSOR_FILTER_IIR_MAX_SHIFT;
+        case SENSOR_FILTER_KALMAN:
+            return config->kalman.process_noise > 0.0f && config->kalman.measurement_noise > 0.0f;
+        default:
+            return false;
+    }
+}
+
+/* ==================== IMPLEMENTATION ==================== */
+
+esp_err_t sensor_filter_init(sensor_filter_t *filter, const sensor_filter_stage_config_t *stages,
+                             uint8_t count)
+{
+    if (filter == NULL || (count > 0 && stages == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (count > SENSOR_FILTER_MAX_STAGES) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        if (!stage_config_valid(&stages[i])) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    memset(filter, 0, sizeof(*filter));
+    for (uint8_t i = 0; i < count; i++) {
+        filter->stages[i].config = stages[i];
+    }
+    filter->stage_count = count;
+    return ESP_OK;
+}
+
+void sensor_filter_reset(sensor_filter_t *filter)
+{
+    for (uint8_t i = 0; i < filter->stage_count; i++) {
+        sensor_filter_stage_config_t config = filter->stages[i].config;
+        memset(&filter->stages[i], 0, sizeof(filter->stages[i]));
+        filter->stages[i].config = config;
+    }
+    filter->output = 0;
+}
+
+int32_t sensor_filter_process(sensor_filter_t *filter, int32_t centi)
+{
+    const uint32_t start = cycle_counter_now();
+    int32_t value = centi;
+
+    for (uint8_t i = 0; i < filter->stage_count; i++) {
+        sensor_filter_stage_t *stage = &filter->stages[i];
+        switch (stage->config.type) {
+            case SENSOR_FILTER_MEDIAN:
+                value = median_process(stage, value);
+                break;
+            case SENSOR_FILTER_IIR:
+                value = iir_process(stage, value);
+                break;
+            case SENSOR_FILTER_KALMAN:
+                value = kalman_process(stage, value);
+                break;
+        }
+    }
+    filter->output = value;
+
+    const uint32_t elapsed = cycle_counter_now() - start;
+    filter->stats.samples++;
+    filter->stats.total_ticks += elapsed;
+    if (elapsed > filter->stats.max_ticks) {
+        filter->stats.max_ticks = elapsed;
+    }
+
+    return value;
+}
+
+uint32_t sensor_filter_avg_ticks(const sensor_filter_t *filter)
+{
+    if (filter->stats.samples == 0) {
+        return 0;
+    }
+    return (uint32_t)(filter->stats.total_ticks / filter->stats.samples);
+}
+
+const char *sensor_filter_type_name(sensor_filter_type_t type)
+{
+    switch (type) {
+        case SENSOR_FILTER_MEDIAN: return "median";
+        case SENSOR_FILTER_IIR:    return "iir";
+        case SENSOR_FILTER_KALMAN: return "kalman";
+        default:                   return "unknown";
+    }
+}
@@ -0,0 +1,156 @@
+/**
+ * @file sensor_filter.h
+ * @brief Streaming temperature filter pipeline (median, IIR, Kalman)
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Samples are centi-degrees Celsius as produced by temp_lut. A pipeline is a
+ * short, fixed list of stages applied in order to every sample:
+ * - MEDIAN:  sliding-window median, rejects single-sample spikes
+ * - IIR:     first-order low-pass y += (x - y) / 2^shift in Q8 fixed point
+ * - KALMAN:  1-D constant-value Kalman filter
+ *
+ * Every stage holds its state in the pipeline struct (no allocation) and
+ * processes one sample at a time, so the pipeline runs at the ADC reading
+ * rate while consumers read the latest output at their own rate. The
+ * pipeline records how long each sample took in cycle_counter units.
+ */
+
+#ifndef SENSOR_FILTER_H
+#define SENSOR_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SENSOR_FILTER_MAX_STAGES    4
+#define SENSOR_FILTER_MEDIAN_MAX    9       // Largest median window (odd)
+#define SENSOR_FILTER_IIR_MAX_SHIFT 8       // Smallest alpha = 1/256
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Stage types
+ */
+typedef enum {
+    SENSOR_FILTER_MEDIAN = 0,
+    SENSOR_FILTER_IIR,
+    SENSOR_FILTER_KALMAN,
+} sensor_filter_type_t;
+
+/**
+ * @brief Stage configuration
+ */
+typedef struct {
+    sensor_filter_type_t type;
+    union {
+        struct {
+            uint8_t window;             /**< Odd window length, 3 to SENSOR_FILTER_MEDIAN_MAX */
+        } median;
+        struct {
+            uint8_t shift;              /**< alpha = 1 / 2^shift, 1 to SENSOR_FILTER_IIR_MAX_SHIFT */
+        } iir;
+        struct {
+            float process_noise;        /**< Q: expected drift per sample (centi-degrees^2) */
+            float measurement_noise;    /**< R: sensor noise variance (centi-degrees^2) */
+        } kalman;
+    };
+} sensor_filter_stage_config_t;
+
+/**
+ * @brief Stage state
+ */
+typedef struct {
+    sensor_filter_stage_config_t config;
+    bool primed;                        /**< Set once the first sample has seeded the state */
+    union {
+        struct {
+            int32_t window[SENSOR_FILTER_MEDIAN_MAX];
+            uint8_t head;
+            uint8_t fill;
+        } median;
+        struct {
+            int32_t state_q8;           /**< Output << 8 */
+        } iir;
+        struct {
+            float estimate;
+            float error_cov;
+        } kalman;
+    };
+} sensor_filter_stage_t;
+
+/**
+ * @brief Per-sample cost statistics (cycle_counter units)
+ */
+typedef struct {
+    uint32_t samples;
+    uint64_t total_ticks;
+    uint32_t max_ticks;
+} sensor_filter_stats_t;
+
+/**
+ * @brief Filter pipeline
+ */
+typedef struct {
+    sensor_filter_stage_t stages[SENSOR_FILTER_MAX_STAGES];
+    uint8_t stage_count;
+    int32_t output;                     /**< Last filtered sample */
+    sensor_filter_stats_t stats;
+} sensor_filter_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Initialise a pipeline from a list of stage configurations
+ *
+ * @param filter Pipeline to initialise
+ * @param stages Stage configurations, applied in order
+ * @param count Number of stages (0 passes samples through)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG on NULL pointers or out-of-range parameters
+ * @return ESP_ERR_INVALID_SIZE if count exceeds SENSOR_FILTER_MAX_STAGES
+ */
+esp_err_t sensor_filter_init(sensor_filter_t *filter, const sensor_filter_stage_config_t *stages,
+                             uint8_t count);
+
+/**
+ * @brief Clear all stage state; the next sample re-seeds the pipeline
+ *
+ * @param filter Pipeline
+ */
+void sensor_filter_reset(sensor_filter_t *filter);
+
+/**
+ * @brief Push one sample through every stage
+ *
+ * @param filter Pipeline
+ * @param centi Sample in centi-degrees C
+ * @return Filtered sample in centi-degrees C
+ */
+int32_t sensor_filter_process(sensor_filter_t *filter, int32_t centi);
+
+/**
+ * @brief Average per-sample cost in cycle_counter units
+ *
+ * @param filter Pipeline
+ * @return Mean ticks per sample, 0 before the first sample
+ */
+uint32_t sensor_filter_avg_ticks(const sensor_filter_t *filter);
+
+/**
+ * @brief Short name of a stage type for logs and reports
+ */
+const char *sensor_filter_type_name(sensor_filter_type_t type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SENSOR_FILTER_H */
@@ -0,0 +1,53 @@
+/**
+ * @file seqlock.c
+ * @brief Single-writer sequence lock implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include "seqlock.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+void seqlock_write(seqlock_t *lock, void *shared, const void *value, size_t size)
+{
+    uint32_t *dst = shared;
+    const uint32_t *src = value;
+    uint32_t sequence = __atomic_load_n(&lock->sequence, __ATOMIC_RELAXED);
+
+    // Odd sequence first; the release fence keeps the data stores after it
+    __atomic_store_n(&lock->sequence, sequence + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+        __atomic_store_n(&dst[i], src[i], __ATOMIC_RELAXED);
+    }
+
+    // Even again once every data store is visible
+    __atomic_store_n(&lock->sequence, sequence + 2, __ATOMIC_RELEASE);
+}
+
+uint32_t seqlock_read(const seqlock_t *lock, const void *shared, void *value, size_t size,
+                      uint32_t max_tries)
+{
+    const uint32_t *src = shared;
+    uint32_t *dst = value;
+
+    for (uint32_t attempt = 1; attempt <= max_tries; attempt++) {
+        uint32_t before = __atomic_load_n(&lock->sequence, __ATOMIC_ACQUIRE);
+        if (before & 1U) {
+            continue;   // Write in progress
+        }
+
+        for (size_t i = 0; i < size / sizeof(uint32_t); i++) {
+            dst[i] = __atomic_load_n(&src[i], __ATOMIC_RELAXED);
+        }
+
+        // The acquire fence keeps the data loads before the second sequence load
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&lock->sequence, __ATOMIC_RELAXED) == before) {
+            return attempt;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file seqlock.h
+ * @brief Single-writer sequence lock for sharing small structs across cores
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The writer never waits: it makes the sequence odd, copies the new value
+ * into the shared buffer and makes the sequence even again. A reader copies
+ * the buffer between two reads of the sequence and keeps the copy only if
+ * the sequence was even and unchanged, i.e. no write overlapped it. Readers
+ * take no lock, so a reader can never block the writer.
+ *
+ * Copies are done one 32-bit word at a time with relaxed atomics, so the
+ * shared value must be 4-byte aligned and a multiple of 4 bytes long (pad
+ * structs with reserved fields). There must be exactly one writer per lock.
+ *
+ * A reader that can preempt the writer on the same core (higher priority)
+ * would spin forever waiting for the write to finish, so reads are bounded:
+ * seqlock_read() gives up after max_tries and the caller keeps its previous
+ * copy.
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stddef.h>
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SEQLOCK_INIT                { 0 }
+#define SEQLOCK_READ_TRIES          16      // Attempts before a reader falls back to its last copy
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Sequence counter (odd while a write is in progress)
+ */
+typedef struct {
+    uint32_t sequence;
+} seqlock_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Publish a new value (single writer only, never blocks)
+ *
+ * @param lock Lock guarding shared
+ * @param shared Shared buffer (4-byte aligned)
+ * @param value New value
+ * @param size Bytes to copy (multiple of 4)
+ */
+void seqlock_write(seqlock_t *lock, void *shared, const void *value, size_t size);
+
+/**
+ * @brief Take a consistent copy of the shared value
+ *
+ * @param lock Lock guarding shared
+ * @param shared Shared buffer (4-byte aligned)
+ * @param value Receives the copy (4-byte aligned); may hold a torn copy on failure
+ * @param size Bytes to copy (multiple of 4)
+ * @param max_tries Attempts before giving up
+ * @return Attempts used (1 when no write overlapped), or 0 if every attempt overlapped a write
+ */
+uint32_t seqlock_read(const seqlock_t *lock, const void *shared, void *value, size_t size,
+                      uint32_t max_tries);
+
+/**
+ * @brief Number of completed writes
+ */
+static inline uint32_t seqlock_writes(const seqlock_t *lock)
+{
+    return __atomic_load_n(&lock->sequence, __ATOMIC_RELAXED) / 2;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEQLOCK_H */
@@ -0,0 +1,468 @@
+/**
+ * @file session_log.c
+ * @brief Append-only, CRC-checked record log implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "session_log.h"
+#include "crc32.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SECTOR_MAGIC            0x474F4C47UL    // "GLOG"
+#define SECTOR_HEADER_BYTES     16
+#define RECORD_MAGIC            0xA5
+#define RECORD_ERASED           0xFF
+#define RECORD_HEADER_BYTES     8
+#define RECORD_CRC_BYTES        4
+#define RECORD_MAX_BYTES        (RECORD_HEADER_BYTES + SESSION_LOG_MAX_PAYLOAD + RECORD_CRC_BYTES)
+#define RING_MASK               (SESSION_LOG_RAM_BYTES - 1)
+
+/* ==================== DATA TYPES ==================== */
+
+typedef struct {
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t erase_count;
+    uint32_t crc;
+} sector_header_t;
+
+/* ==================== HELPERS ==================== */
+
+static uint32_t record_size(uint16_t length)
+{
+    return (RECORD_HEADER_BYTES + length + RECORD_CRC_BYTES + 3U) & ~3U;
+}
+
+static void put_u16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint16_t get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * @brief Size of the encoded record starting at a ring position
+ */
+static uint32_t ring_record_size(const session_log_t *log, uint32_t at)
+{
+    uint8_t length_bytes[2] = {
+        log->ring[(at + 2) & RING_MASK],
+        log->ring[(at + 3) & RING_MASK],
+    };
+    return record_size(get_u16(length_bytes));
+}
+
+static void log_lock(session_log_t *log)
+{
+    if (log->lock != NULL) {
+        log->lock(log->lock_ctx);
+    }
+}
+
+static void log_unlock(session_log_t *log)
+{
+    if (log->unlock != NULL) {
+        log->unlock(log->lock_ctx);
+    }
+}
+
+static uint32_t sector_base(const session_log_t *log, uint16_t sector)
+{
+    return (uint32_t)sector * log->flash.sector_size;
+}
+
+static bool read_sector_header(const session_log_t *log, uint16_t sector, sector_header_t *header)
+{
+    uint8_t raw[SECTOR_HEADER_BYTES];
+
+    if (log->flash.read(log->flash.ctx, sector_base(log, sector), raw, sizeof(raw)) != ESP_OK) {
+        return false;
+    }
+    header->magic = get_u32(raw);
+    header->sequence = get_u32(raw + 4);
+    header->erase_count = get_u32(raw + 8);
+    header->crc = get_u32(raw + 12);
+    return header->magic == SECTOR_MAGIC && header->crc == crc32_update(0, raw, 12);
+}
+
+static void update_wear_stats(session_log_t *log)
+{
+    log->stats.min_erase_count = UINT32_MAX;
+    log->stats.max_erase_count = 0;
+    for (uint16_t i = 0; i < log->sector_count; i++) {
+        if (log->wear[i] < log->stats.min_erase_count) {
+            log->stats.min_erase_count = log->wear[i];
+        }
+        if (log->wear[i] > log->stats.max_erase_count) {
+            log->stats.max_erase_count = log->wear[i];
+        }
+    }
+}
+
+/**
+ * @brief Erase a sector and make it the current one
+ */
+static esp_err_t open_sector(session_log_t *log, uint16_t sector, uint32_t sequence)
+{
+    uint8_t raw[SECTOR_HEADER_BYTES];
+    esp_err_t ret;
+
+    ret = log->flash.erase(log->flash.ctx, sector_base(log, sector), log->flash.sector_size);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    log->wear[sector]++;
+    log->stats.sector_erases++;
+
+    put_u32(raw, SECTOR_MAGIC);
+    put_u32(raw + 4, sequence);
+    put_u32(raw + 8, log->wear[sector]);
+    put_u32(raw + 12, crc32_update(0, raw, 12));
+    ret = log->flash.write(log->flash.ctx, sector_base(log, sector), raw, sizeof(raw));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    log->sector = sector;
+    log->sequence = sequence;
+    log->erase_count = log->wear[sector];
+    log->offset = SECTOR_HEADER_BYTES;
+    update_wear_stats(log);
+    return ESP_OK;
+}
+
+/**
+ * @brief Advance to the oldest sector in the ring, carrying its erase count
+ */
+static esp_err_t rotate_sector(session_log_t *log)
+{
+    uint16_t next = (uint16_t)((log->sector + 1) % log->sector_count);
+    return open_sector(log, next, log->sequence + 1);
+}
+
+/**
+ * @brief Find where valid records end in the current sector
+ */
+static esp_err_t find_write_offset(session_log_t *log)
+{
+    uint8_t buf[RECORD_MAX_BYTES];
+    uint32_t offset = SECTOR_HEADER_BYTES;
+    const uint32_t base = sector_base(log, log->sector);
+
+    while (offset + RECORD_HEADER_BYTES <= log->flash.sector_size) {
+        esp_err_t ret = log->flash.read(log->flash.ctx, base + offset, buf, RECORD_HEADER_BYTES);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        if (buf[0] == RECORD_ERASED) {
+            break;
+        }
+
+        uint16_t length = get_u16(buf + 2);
+        uint32_t size = record_size(length);
+        bool valid = buf[0] == RECORD_MAGIC && length <= SESSION_LOG_MAX_PAYLOAD &&
+                     offset + size <= log->flash.sector_size;
+        if (valid) {
+            ret = log->flash.read(log->flash.ctx, base + offset + RECORD_HEADER_BYTES,
+                                  buf + RECORD_HEADER_BYTES, length + RECORD_CRC_BYTES);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+            valid = get_u32(buf + RECORD_HEADER_BYTES + length) ==
+                    crc32_update(0, buf, RECORD_HEADER_BYTES + length);
+        }
+        if (!valid) {
+            // Torn write from a power loss: never program over it, start a new sector
+            offset = log->flash.sector_size;
+            break;
+        }
+        offset += size;
+    }
+
+    log->offset = offset;
+    return ESP_OK;
+}
+
+/* ==================== IMPLEMENTATION ==================== */
+
+esp_err_t session_log_mount(session_log_t *log, const session_log_flash_t *flash)
+{
+    if (log == NULL || flash == NULL || flash->read == NULL || flash->write == NULL ||
+        flash->erase == NULL || flash->sector_size < SESSION_LOG_BATCH_BYTES ||
+        flash->size % flash->sector_size != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint32_t sectors = flash->size / flash->sector_size;
+    if (sectors < SESSION_LOG_MIN_SECTORS || sectors > SESSION_LOG_MAX_SECTORS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(log, 0, sizeof(*log));
+    log->flash = *flash;
+    log->sector_count = (uint16_t)sectors;
+
+    bool found = false;
+    for (uint16_t i = 0; i < log->sector_count; i++) {
+        sector_header_t header;
+        if (!read_sector_header(log, i, &header)) {
+            continue;
+        }
+        log->wear[i] = header.erase_count;
+        if (!found || (int32_t)(header.sequence - log->sequence) > 0) {
+            found = true;
+            log->sector = i;
+            log->sequence = header.sequence;
+            log->erase_count = header.erase_count;
+        }
+    }
+
+    esp_err_t ret;
+    if (found) {
+        ret = find_write_offset(log);
+        update_wear_stats(log);
+    } else {
+        ret = open_sector(log, 0, 1);
+        log->stats.sector_erases = 0;
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    log->mounted = true;
+    return ESP_OK;
+}
+
+void session_log_set_lock(session_log_t *log, void (*lock)(void *ctx),
+                          void (*unlock)(void *ctx), void *ctx)
+{
+    log->lock = lock;
+    log->unlock = unlock;
+    log->lock_ctx = ctx;
+}
+
+esp_err_t session_log_append(session_log_t *log, uint8_t type, uint32_t timestamp,
+                             const void *payload, uint16_t length)
+{
+    uint8_t record[RECORD_MAX_BYTES];
+
+    if (length > SESSION_LOG_MAX_PAYLOAD) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Encode outside the lock; padding bytes stay 0xFF like erased flash
+    const uint32_t size = record_size(length);
+    memset(record, 0xFF, size);
+    record[0] = RECORD_MAGIC;
+    record[1] = type;
+    put_u16(record + 2, length);
+    put_u32(record + 4, timestamp);
+    if (length > 0) {
+        memcpy(record + RECORD_HEADER_BYTES, payload, length);
+    }
+    put_u32(record + RECORD_HEADER_BYTES + length,
+            crc32_update(0, record, RECORD_HEADER_BYTES + length));
+
+    log_lock(log);
+    if (SESSION_LOG_RAM_BYTES - (log->ring_head - log->ring_tail) < size) {
+        log->stats.dropped++;
+        log_unlock(log);
+        return ESP_ERR_NO_MEM;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        log->ring[(log->ring_head + i) & RING_MASK] = record[i];
+    }
+    log->ring_head += size;
+    log->stats.appended++;
+    log_unlock(log);
+
+    return ESP_OK;
+}
+
+uint32_t session_log_pending(const session_log_t *log)
+{
+    return log->ring_head - log->ring_tail;
+}
+
+esp_err_t session_log_flush(session_log_t *log, bool force)
+{
+    if (!log->mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    while (1) {
+        log_lock(log);
+        const uint32_t pending = log->ring_head - log->ring_tail;
+        log_unlock(log);
+
+        if (pending == 0) {
+            return ESP_OK;
+        }
+
+        // Records between tail and head are stable: producers only write past head
+        const uint32_t room = log->flash.sector_size - log->offset;
+        const uint32_t next_size = ring_record_size(log, log->ring_tail);
+        if (next_size > room) {
+            esp_err_t ret = rotate_sector(log);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+            continue;
+        }
+
+        // Fill up to the next batch boundary so full batches stay page-aligned;
+        // a record straddling the boundary goes out in one unaligned batch
+        uint32_t limit = SESSION_LOG_BATCH_BYTES - (log->offset % SESSION_LOG_BATCH_BYTES);
+        if (next_size > limit) {
+            limit = SESSION_LOG_BATCH_BYTES;
+        }
+        if (limit > room) {
+            limit = room;
+        }
+        if (!force && pending < limit) {
+            return ESP_OK;
+        }
+
+        uint32_t batch_len = 0;
+        uint32_t records = 0;
+        while (batch_len < pending) {
+            const uint32_t at = log->ring_tail + batch_len;
+            const uint32_t size = ring_record_size(log, at);
+            if (batch_len + size > limit) {
+                break;
+            }
+            for (uint32_t i = 0; i < size; i++) {
+                log->batch[batch_len + i] = log->ring[(at + i) & RING_MASK];
+            }
+            batch_len += size;
+            records++;
+        }
+
+        esp_err_t ret = log->flash.write(log->flash.ctx, sector_base(log, log->sector) + log->offset,
+                                         log->batch, batch_len);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+        log->offset += batch_len;
+        log->stats.flash_writes++;
+        log->stats.flushed += records;
+
+        log_lock(log);
+        log->ring_tail += batch_len;
+        log_unlock(log);
+    }
+}
+
+void session_log_iter_begin(const session_log_t *log, session_log_iter_t *it)
+{
+    it->sectors_left = log->sector_count;
+    it->sector = (uint16_t)((log->sector + 1) % log->sector_count);   // Oldest
+    it->offset = 0;
+    it->corrupt = 0;
+}
+
+esp_err_t session_log_iter_next(const session_log_t *log, session_log_iter_t *it,
+                                session_log_record_t *record, uint8_t *payload)
+{
+    uint8_t buf[RECORD_MAX_BYTES];
+
+    while (it->sectors_left > 0) {
+        const uint32_t base = sector_base(log, it->sector);
+        bool next_sector = false;
+
+        if (it->offset == 0) {
+            sector_header_t header;
+            if (read_sector_header(log, it->sector, &header)) {
+                it->offset = SECTOR_HEADER_BYTES;
+            } else {
+                next_sector = true;     // Never written since format
+            }
+        }
+
+        if (!next_sector && it->offset + RECORD_HEADER_BYTES <= log->flash.sector_size) {
+            esp_err_t ret = log->flash.read(log->flash.ctx, base + it->offset, buf, RECORD_HEADER_BYTES);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+
+            uint16_t length = get_u16(buf + 2);
+            uint32_t size = record_size(length);
+            if (buf[0] == RECORD_MAGIC && length <= SESSION_LOG_MAX_PAYLOAD &&
+                it->offset + size <= log->flash.sector_size) {
+                ret = log->flash.read(log->flash.ctx, base + it->offset + RECORD_HEADER_BYTES,
+                                      buf + RECORD_HEADER_BYTES, length + RECORD_CRC_BYTES);
+                if (ret != ESP_OK) {
+                    return ret;
+                }
+                it->offset += size;
+
+                if (get_u32(buf + RECORD_HEADER_BYTES + length) !=
+                    crc32_update(0, buf, RECORD_HEADER_BYTES + length)) {
+                    it->corrupt++;
+                    continue;
+                }
+
+                record->type = buf[1];
+                record->length = length;
+                record->timestamp = get_u32(buf + 4);
+                memcpy(payload, buf + RECORD_HEADER_BYTES, length);
+                return ESP_OK;
+            }
+
+            // Erased space ends the sector; anything else is an unreadable tail
+            if (buf[0] != RECORD_ERASED) {
+                it->corrupt++;
+            }
+        }
+
+        it->sector = (uint16_t)((it->sector + 1) % log->sector_count);
+        it->offset = 0;
+        it->sectors_left--;
+    }
+
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t session_log_format(session_log_t *log)
+{
+    esp_err_t ret = log->flash.erase(log->flash.ctx, 0, log->flash.size);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    for (uint16_t i = 0; i < log->sector_count; i++) {
+        log->wear[i]++;
+    }
+
+    log_lock(log);
+    log->ring_tail = log->ring_head;
+    log_unlock(log);
+
+    // open_sector() erases sector 0 once more and counts that itself
+    log->stats.sector_erases += log->sector_count;
+    return open_sector(log, 0, log->sequence + 1);
+}
+
+void session_log_get_stats(const session_log_t *log, session_log_stats_t *stats)
+{
+    *stats = log->stats;
+}
@@ -0,0 +1,209 @@
+/**
+ * @file session_log.h
+ * @brief Append-only, CRC-checked record log on a raw flash region
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The region is used as a ring of erase sectors. Each sector starts with a
+ * header (sequence number, erase count) followed by packed records:
+ *
+ *   | magic | type | length | timestamp | payload ... | crc32 | pad to 4 |
+ *
+ * Records never span sectors. When the current sector is full the log moves
+ * to the next sector in the ring, which is always the oldest one: it is
+ * erased and its erase count carried forward, so every sector is erased
+ * exactly once per lap and wear stays even.
+ *
+ * session_log_append() only encodes the record into a RAM ring; nothing
+ * touches flash until session_log_flush(), which writes whole batches of
+ * records with one flash write each. This lets a background task own the
+ * flash while the UI appends without blocking. Optional lock hooks guard the
+ * RAM ring when producers and the flushing task run concurrently.
+ *
+ * Flash access goes through session_log_flash_t so the same code runs on an
+ * esp_partition on the target and on a file-backed region in the host tools.
+ */
+
+#ifndef SESSION_LOG_H
+#define SESSION_LOG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SESSION_LOG_MAX_PAYLOAD     64      // Largest record payload in bytes
+#define SESSION_LOG_RAM_BYTES       4096    // RAM ring holding unflushed records
+#define SESSION_LOG_BATCH_BYTES     1024    // Flash write size (multiple of the 256 B page)
+#define SESSION_LOG_MIN_SECTORS     2
+#define SESSION_LOG_MAX_SECTORS     128     // Region of up to 512 KB with 4 KB sectors
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Raw flash region the log lives in (offsets relative to the region)
+ */
+typedef struct {
+    esp_err_t (*read)(void *ctx, uint32_t offset, void *dst, size_t len);
+    esp_err_t (*write)(void *ctx, uint32_t offset, const void *src, size_t len);
+    esp_err_t (*erase)(void *ctx, uint32_t offset, size_t len);
+    void *ctx;
+    uint32_t size;              /**< Region size, a multiple of sector_size */
+    uint32_t sector_size;       /**< Erase granularity (4096 on SPI NOR) */
+} session_log_flash_t;
+
+/**
+ * @brief Decoded record header
+ */
+typedef struct {
+    uint8_t type;               /**< Application record type */
+    uint16_t length;            /**< Payload length */
+    uint32_t timestamp;         /**< Application timestamp (e.g. seconds since boot) */
+} session_log_record_t;
+
+/**
+ * @brief Log statistics
+ */
+typedef struct {
+    uint32_t appended;          /**< Records accepted into the RAM ring */
+    uint32_t dropped;           /**< Records rejected because the ring was full */
+    uint32_t flushed;           /**< Records written to flash */
+    uint32_t flash_writes;      /**< Flash write operations */
+    uint32_t sector_erases;     /**< Sectors erased since mount */
+    uint32_t min_erase_count;   /**< Least-worn sector */
+    uint32_t max_erase_count;   /**< Most-worn sector */
+} session_log_stats_t;
+
+/**
+ * @brief Log state
+ */
+typedef struct {
+    session_log_flash_t flash;
+    uint16_t sector_count;
+    uint16_t sector;            /**< Sector being written */
+    uint32_t offset;            /**< Next free byte within the sector */
+    uint32_t sequence;          /**< Sequence number of the current sector */
+    uint32_t erase_count;       /**< Erase count of the current sector */
+
+    uint32_t wear[SESSION_LOG_MAX_SECTORS];     /**< Erase count of every sector */
+
+    uint8_t ring[SESSION_LOG_RAM_BYTES];
+    uint32_t ring_head;         /**< Write position (free-running) */
+    uint32_t ring_tail;         /**< Read position (free-running) */
+
+    uint8_t batch[SESSION_LOG_BATCH_BYTES];     /**< Staging buffer for one flash write */
+
+    void (*lock)(void *ctx);
+    void (*unlock)(void *ctx);
+    void *lock_ctx;
+
+    session_log_stats_t stats;
+    bool mounted;
+} session_log_t;
+
+/**
+ * @brief Read-back position
+ */
+typedef struct {
+    uint16_t sectors_left;      /**< Sectors still to visit, oldest to newest */
+    uint16_t sector;
+    uint32_t offset;
+    uint32_t corrupt;           /**< Records skipped because of a bad CRC */
+} session_log_iter_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Mount a log, formatting the region if it holds no valid sectors
+ *
+ * Finds the newest sector from the sector headers and the end of its last
+ * valid record, so appending resumes after a reboot.
+ *
+ * @param log Log state
+ * @param flash Flash region
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG on NULL pointers or bad geometry
+ * @return Flash errors from the region callbacks
+ */
+esp_err_t session_log_mount(session_log_t *log, const session_log_flash_t *flash);
+
+/**
+ * @brief Install lock hooks for the RAM ring (NULL for single-threaded use)
+ */
+void session_log_set_lock(session_log_t *log, void (*lock)(void *ctx),
+                          void (*unlock)(void *ctx), void *ctx);
+
+/**
+ * @brief Queue a record in RAM; never touches flash
+ *
+ * @param log Log state
+ * @param type Application record type
+ * @param timestamp Application timestamp
+ * @param payload Payload bytes (may be NULL if length is 0)
+ * @param length Payload length (up to SESSION_LOG_MAX_PAYLOAD)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_SIZE if the payload is too long
+ * @return ESP_ERR_NO_MEM if the RAM ring is full (record dropped)
+ */
+esp_err_t session_log_append(session_log_t *log, uint8_t type, uint32_t timestamp,
+                             const void *payload, uint16_t length);
+
+/**
+ * @brief Bytes waiting in the RAM ring
+ */
+uint32_t session_log_pending(const session_log_t *log);
+
+/**
+ * @brief Write queued records to flash in batches
+ *
+ * Without force only full batches are written, so flash sees large writes;
+ * with force the remainder is written too.
+ *
+ * @param log Log state
+ * @param force Also write a final partial batch
+ * @return ESP_OK on success
+ * @return Flash errors from the region callbacks
+ */
+esp_err_t session_log_flush(session_log_t *log, bool force);
+
+/**
+ * @brief Start reading from the oldest record in flash
+ */
+void session_log_iter_begin(const session_log_t *log, session_log_iter_t *it);
+
+/**
+ * @brief Read the next valid record
+ *
+ * @param log Log state
+ * @param it Iterator
+ * @param record Receives the record header
+ * @param payload Receives the payload (SESSION_LOG_MAX_PAYLOAD bytes)
+ * @return ESP_OK when a record was read
+ * @return ESP_ERR_NOT_FOUND at the end of the log
+ * @return Flash errors from the region callbacks
+ */
+esp_err_t session_log_iter_next(const session_log_t *log, session_log_iter_t *it,
+                                session_log_record_t *record, uint8_t *payload);
+
+/**
+ * @brief Erase the whole region and start an empty log
+ */
+esp_err_t session_log_format(session_log_t *log);
+
+/**
+ * @brief Get log statistics
+ */
+void session_log_get_stats(const session_log_t *log, session_log_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SESSION_LOG_H */
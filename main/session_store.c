@@ -0,0 +1,199 @@
+/**
+ * @file session_store.c
+ * @brief Cooking-session log on the "sessionlog" flash partition
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stdlib.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_partition.h"
+#include "session_store.h"
+#include "task_layout.h"
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "SESSION_STORE";
+
+static const esp_partition_t *store_partition = NULL;
+static session_log_t *store_log = NULL;
+static SemaphoreHandle_t ring_mutex = NULL;     // RAM ring (session_log lock hooks)
+static SemaphoreHandle_t flash_mutex = NULL;    // Flash: writer flushes vs. read-back
+static TaskHandle_t writer_task_handle = NULL;
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static esp_err_t partition_read(void *ctx, uint32_t offset, void *dst, size_t len)
+{
+    return esp_partition_read((const esp_partition_t *)ctx, offset, dst, len);
+}
+
+static esp_err_t partition_write(void *ctx, uint32_t offset, const void *src, size_t len)
+{
+    return esp_partition_write((const esp_partition_t *)ctx, offset, src, len);
+}
+
+static esp_err_t partition_erase(void *ctx, uint32_t offset, size_t len)
+{
+    return esp_partition_erase_range((const esp_partition_t *)ctx, offset, len);
+}
+
+static void ring_lock(void *ctx)
+{
+    xSemaphoreTake((SemaphoreHandle_t)ctx, portMAX_DELAY);
+}
+
+static void ring_unlock(void *ctx)
+{
+    xSemaphoreGive((SemaphoreHandle_t)ctx);
+}
+
+/**
+ * @brief Writer task: flush full batches when notified, a partial one after a timeout
+ *
+ * With nothing pending the task blocks without a timeout, so an idle log
+ * never wakes the chip. The first record into an empty ring starts the wait.
+ */
+static void session_store_writer_task(void *pvParameters)
+{
+    while (1) {
+        TickType_t wait = (session_log_pending(store_log) == 0) ? portMAX_DELAY
+                                                                : pdMS_TO_TICKS(SESSION_STORE_IDLE_FLUSH_MS);
+        uint32_t notified = ulTaskNotifyTake(pdTRUE, wait);
+        bool force = (notified == 0);
+        uint32_t pending = session_log_pending(store_log);
+
+        if (pending == 0 || (!force && pending < SESSION_LOG_BATCH_BYTES)) {
+            continue;
+        }
+
+        xSemaphoreTake(flash_mutex, portMAX_DELAY);
+        esp_err_t ret = session_log_flush(store_log, force);
+        xSemaphoreGive(flash_mutex);
+
+        if (ret != ESP_OK) {
+            ESP_LOGW(TAG, "Flush failed: %s", esp_err_to_name(ret));
+        }
+    }
+}
+
+esp_err_t session_store_init(void)
+{
+    esp_err_t ret;
+
+    store_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                               SESSION_STORE_PARTITION_SUBTYPE,
+                                               SESSION_STORE_PARTITION_LABEL);
+    if (store_partition == NULL) {
+        ESP_LOGE(TAG, "No '%s' partition in the partition table", SESSION_STORE_PARTITION_LABEL);
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    store_log = calloc(1, sizeof(session_log_t));
+    ring_mutex = xSemaphoreCreateMutex();
+    flash_mutex = xSemaphoreCreateMutex();
+    if (store_log == NULL || ring_mutex == NULL || flash_mutex == NULL) {
+        ret = ESP_ERR_NO_MEM;
+        goto cleanup;
+    }
+
+    session_log_flash_t region = {
+        .read = partition_read,
+        .write = partition_write,
+        .erase = partition_erase,
+        .ctx = (void *)store_partition,
+        .size = store_partition->size,
+        .sector_size = store_partition->erase_size,
+    };
+    ret = session_log_mount(store_log, &region);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to mount session log: %s", esp_err_to_name(ret));
+        goto cleanup;
+    }
+    session_log_set_lock(store_log, ring_lock, ring_unlock, ring_mutex);
+
+    ret = task_layout_create(TASK_LAYOUT_SESSION_LOG, session_store_writer_task, NULL,
+                             &writer_task_handle);
+    if (ret != ESP_OK) {
+        goto cleanup;
+    }
+
+    session_log_stats_t stats;
+    session_log_get_stats(store_log, &stats);
+    ESP_LOGI(TAG, "Session log on '%s': %" PRIu32 " KB at 0x%" PRIx32 ", sector wear %" PRIu32 "..%" PRIu32,
+             store_partition->label, store_partition->size / 1024, store_partition->address,
+             stats.min_erase_count, stats.max_erase_count);
+
+    return session_store_log(SESSION_RECORD_BOOT, NULL, 0);
+
+cleanup:
+    if (flash_mutex != NULL) {
+        vSemaphoreDelete(flash_mutex);
+        flash_mutex = NULL;
+    }
+    if (ring_mutex != NULL) {
+        vSemaphoreDelete(ring_mutex);
+        ring_mutex = NULL;
+    }
+    free(store_log);
+    store_log = NULL;
+    return ret;
+}
+
+esp_err_t session_store_log(session_record_type_t type, const void *payload, uint16_t length)
+{
+    if (writer_task_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint32_t timestamp_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    bool was_empty = (session_log_pending(store_log) == 0);
+    esp_err_t ret = session_log_append(store_log, (uint8_t)type, timestamp_ms, payload, length);
+
+    // Wake the writer to start its flush timeout, and again once a full flash batch is waiting
+    if (was_empty || session_log_pending(store_log) >= SESSION_LOG_BATCH_BYTES) {
+        xTaskNotifyGive(writer_task_handle);
+    }
+    return ret;
+}
+
+esp_err_t session_store_read(session_store_visit_fn_t visit, void *ctx)
+{
+    if (store_log == NULL || visit == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    session_log_iter_t it;
+    session_log_record_t record;
+    uint8_t payload[SESSION_LOG_MAX_PAYLOAD];
+    esp_err_t ret;
+
+    // Hold off the writer so the oldest sector is not erased mid-walk
+    xSemaphoreTake(flash_mutex, portMAX_DELAY);
+    session_log_iter_begin(store_log, &it);
+    while ((ret = session_log_iter_next(store_log, &it, &record, payload)) == ESP_OK) {
+        if (!visit(&record, payload, ctx)) {
+            break;
+        }
+    }
+    xSemaphoreGive(flash_mutex);
+
+    if (it.corrupt > 0) {
+        ESP_LOGW(TAG, "Skipped %" PRIu32 " corrupt record(s)", it.corrupt);
+    }
+    return (ret == ESP_OK || ret == ESP_ERR_NOT_FOUND) ? ESP_OK : ret;
+}
+
+esp_err_t session_store_get_stats(session_log_stats_t *stats)
+{
+    if (store_log == NULL || stats == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    session_log_get_stats(store_log, stats);
+    return ESP_OK;
+}
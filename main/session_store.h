@@ -0,0 +1,108 @@
+/**
+ * @file session_store.h
+ * @brief Cooking-session log on the "sessionlog" flash partition
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Binds session_log to the data partition declared in partitions.csv and
+ * owns the flash: callers append records to RAM from any task and return
+ * immediately, while a low-priority writer task flushes full batches as they
+ * accumulate and a partial batch SESSION_STORE_IDLE_FLUSH_MS after it started.
+ * The UI therefore never waits on a flash write or sector erase, and with
+ * nothing pending the writer sleeps until the next record.
+ *
+ * Record timestamps are milliseconds since boot; a BOOT record marks every
+ * start so sessions can be told apart when reading the log back.
+ */
+
+#ifndef SESSION_STORE_H
+#define SESSION_STORE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "session_log.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define SESSION_STORE_PARTITION_LABEL   "sessionlog"
+#define SESSION_STORE_PARTITION_SUBTYPE 0x40    // Custom data subtype (partitions.csv)
+#define SESSION_STORE_IDLE_FLUSH_MS     5000    // Flush a partial batch this long after its first record
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Record types written by the application
+ */
+typedef enum {
+    SESSION_RECORD_BOOT = 1,        /**< No payload */
+    SESSION_RECORD_KEY,             /**< char key */
+    SESSION_RECORD_TEMP_INPUT,      /**< int16_t confirmed input temperature (C) */
+    SESSION_RECORD_LEVEL,           /**< uint8_t determined cooking level */
+    SESSION_RECORD_ZONE_TEMPS,      /**< int32_t centi-degrees per zone */
+    SESSION_RECORD_DONENESS,        /**< doneness_prediction_t */
+    SESSION_RECORD_PROFILE,         /**< uint8_t selected cooking profile index */
+    SESSION_RECORD_ALARM,           /**< temp_alarm_event_t band change or alarm raise/clear */
+} session_record_type_t;
+
+/**
+ * @brief Read-back callback; return false to stop early
+ */
+typedef bool (*session_store_visit_fn_t)(const session_log_record_t *record,
+                                         const uint8_t *payload, void *ctx);
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Mount the log on the session partition and start the writer task
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_NOT_FOUND if the partition table has no session partition
+ * @return ESP_ERR_NO_MEM if the log, mutex or task cannot be allocated
+ * @return Flash errors from mounting
+ */
+esp_err_t session_store_init(void);
+
+/**
+ * @brief Queue a record for the writer task (non-blocking)
+ *
+ * @param type Record type
+ * @param payload Payload bytes (may be NULL if length is 0)
+ * @param length Payload length (up to SESSION_LOG_MAX_PAYLOAD)
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if the store is not initialized
+ * @return ESP_ERR_NO_MEM if the RAM buffer is full (record dropped)
+ */
+esp_err_t session_store_log(session_record_type_t type, const void *payload, uint16_t length);
+
+/**
+ * @brief Visit every record in flash, oldest first
+ *
+ * Records still in the RAM buffer are not visited. The writer task is held
+ * off for the duration of the walk.
+ *
+ * @param visit Called for each record
+ * @param ctx Passed to visit
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if not initialized
+ * @return Flash errors from reading
+ */
+esp_err_t session_store_read(session_store_visit_fn_t visit, void *ctx);
+
+/**
+ * @brief Get log statistics
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not initialized
+ */
+esp_err_t session_store_get_stats(session_log_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SESSION_STORE_H */
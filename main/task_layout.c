@@ -0,0 +1,257 @@
+/**
+ * @file task_layout.c
+ * @brief Task placement table and response time measurement
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "task_layout.h"
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "TASK_LAYOUT";
+
+// Budgets: heater 10 % of its 20 ms period, sampler half a 12.8 ms DMA frame,
+// scan one scan interval, UI a key-to-screen delay nobody notices, telemetry
+// a drain start well inside the time its ring takes to fill
+static const task_layout_entry_t layout[TASK_LAYOUT_COUNT] = {
+    //                          name           stack  budget_us  core                     shared priority
+    [TASK_LAYOUT_HEATER]      = { "heater_ctrl", 3072,    2000, TASK_LAYOUT_SENSE_CORE, 7 },
+    [TASK_LAYOUT_SAMPLER]     = { "adc_sampler", 3072,    6400, TASK_LAYOUT_SENSE_CORE, 6 },
+    [TASK_LAYOUT_SCAN]        = { "matrix_scan", 2048,   10000, TASK_LAYOUT_SENSE_CORE, 5 },
+    [TASK_LAYOUT_UI]          = { "main",           0,   50000, TASK_LAYOUT_UI_CORE,    1 },
+    [TASK_LAYOUT_MONITOR]     = { "temp_monitor", 4096, 100000, TASK_LAYOUT_SENSE_CORE, 5 },
+    [TASK_LAYOUT_SESSION_LOG] = { "session_log", 3072, 1000000, TASK_LAYOUT_UI_CORE,    2 },
+    [TASK_LAYOUT_TELEMETRY]   = { "telemetry",   2560,  200000, TASK_LAYOUT_UI_CORE,    2 },
+};
+
+static TaskHandle_t handles[TASK_LAYOUT_COUNT];    // NULL until created
+
+#if TASK_LAYOUT_MEASURE
+typedef struct {
+    int64_t released_us;        // Last release (0: none pending)
+    int64_t next_us;            // Next period boundary of a periodic task
+    uint64_t total_us;
+    uint32_t count;
+    uint32_t max_us;
+    uint32_t over_budget;
+} response_slot_t;
+
+static response_slot_t responses[TASK_LAYOUT_COUNT];
+static portMUX_TYPE responses_lock = portMUX_INITIALIZER_UNLOCKED;
+#endif
+
+/* ==================== IMPLEMENTATION ==================== */
+
+const task_layout_entry_t *task_layout_entry(task_layout_id_t id)
+{
+    return id < TASK_LAYOUT_COUNT ? &layout[id] : NULL;
+}
+
+UBaseType_t task_layout_priority(task_layout_id_t id)
+{
+#if TASK_LAYOUT == TASK_LAYOUT_SHARED
+    return layout[id].shared_priority;
+#else
+    // Deadline-monotonic: one level above every task with a looser budget
+    UBaseType_t priority = TASK_LAYOUT_BASE_PRIORITY;
+    for (int other = 0; other < TASK_LAYOUT_COUNT; other++) {
+        if (layout[other].budget_us > layout[id].budget_us) {
+            priority++;
+        }
+    }
+    return priority;
+#endif
+}
+
+BaseType_t task_layout_core(task_layout_id_t id)
+{
+#if TASK_LAYOUT == TASK_LAYOUT_SHARED
+    return tskNO_AFFINITY;
+#else
+    return layout[id].core;
+#endif
+}
+
+esp_err_t task_layout_create(task_layout_id_t id, TaskFunction_t function, void *arg,
+                             TaskHandle_t *handle)
+{
+    if (id >= TASK_LAYOUT_COUNT || layout[id].stack == 0 || function == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (xTaskCreatePinnedToCore(function, layout[id].name, layout[id].stack, arg,
+                                task_layout_priority(id), &handles[id],
+                                task_layout_core(id)) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create task %s", layout[id].name);
+        return ESP_ERR_NO_MEM;
+    }
+    if (handle != NULL) {
+        *handle = handles[id];
+    }
+    return ESP_OK;
+}
+
+TaskHandle_t task_layout_handle(task_layout_id_t id)
+{
+    return id < TASK_LAYOUT_COUNT ? handles[id] : NULL;
+}
+
+#if TASK_LAYOUT_MEASURE
+static void record_response(task_layout_id_t id, int64_t response_us)
+{
+    response_slot_t *slot = &responses[id];
+    uint32_t response = response_us < 0 ? 0 : (uint32_t)response_us;
+
+    portENTER_CRITICAL(&responses_lock);
+    slot->total_us += response;
+    slot->count++;
+    if (response > slot->max_us) {
+        slot->max_us = response;
+    }
+    if (response > layout[id].budget_us) {
+        slot->over_budget++;
+    }
+    portEXIT_CRITICAL(&responses_lock);
+}
+
+void IRAM_ATTR task_layout_release_from_isr(task_layout_id_t id)
+{
+    // A release still pending keeps its (earlier) time
+    portENTER_CRITICAL_ISR(&responses_lock);
+    if (responses[id].released_us == 0) {
+        responses[id].released_us = esp_timer_get_time();
+    }
+    portEXIT_CRITICAL_ISR(&responses_lock);
+}
+
+void task_layout_note_wake(task_layout_id_t id)
+{
+    int64_t now_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&responses_lock);
+    int64_t released_us = responses[id].released_us;
+    responses[id].released_us = 0;
+    portEXIT_CRITICAL(&responses_lock);
+    if (released_us != 0) {
+        record_response(id, now_us - released_us);
+    }
+}
+
+void task_layout_note_response(task_layout_id_t id, int64_t released_us)
+{
+    record_response(id, esp_timer_get_time() - released_us);
+}
+
+void task_layout_note_period(task_layout_id_t id, uint32_t period_us)
+{
+    int64_t now_us = esp_timer_get_time();
+    response_slot_t *slot = &responses[id];
+
+    // The first wake, or one before the grid (tick phase), sets the grid
+    if (slot->next_us == 0 || now_us < slot->next_us) {
+        slot->next_us = now_us + period_us;
+        return;
+    }
+    record_response(id, now_us - slot->next_us);
+    slot->next_us += period_us;
+    if (now_us >= slot->next_us) {
+        slot->next_us = now_us + period_us;     // Whole periods were skipped
+    }
+}
+
+void task_layout_take_stats(task_layout_id_t id, task_layout_stats_t *stats)
+{
+    response_slot_t *slot = &responses[id];
+
+    portENTER_CRITICAL(&responses_lock);
+    stats->count = slot->count;
+    stats->mean_us = slot->count > 0 ? (uint32_t)(slot->total_us / slot->count) : 0;
+    stats->max_us = slot->max_us;
+    stats->over_budget = slot->over_budget;
+    slot->total_us = 0;
+    slot->count = 0;
+    slot->max_us = 0;
+    slot->over_budget = 0;
+    portEXIT_CRITICAL(&responses_lock);
+}
+
+/**
+ * @brief Synthetic load: busy for LOAD_BUSY_US of every LOAD_PERIOD_MS
+ */
+static void task_layout_load_task(void *pvParameters)
+{
+    TickType_t last_wake_time = xTaskGetTickCount();
+
+    while (1) {
+        int64_t busy_until = esp_timer_get_time() + TASK_LAYOUT_LOAD_BUSY_US;
+        while (esp_timer_get_time() < busy_until) {
+            // Spin: holds the core like a long computation would
+        }
+        vTaskDelayUntil(&last_wake_time, pdMS_TO_TICKS(TASK_LAYOUT_LOAD_PERIOD_MS));
+    }
+}
+
+/**
+ * @brief Log the response times of every task each report period
+ */
+static void task_layout_report_task(void *pvParameters)
+{
+    while (1) {
+        vTaskDelay(pdMS_TO_TICKS(TASK_LAYOUT_REPORT_MS));
+        ESP_LOGI(TAG, "Response times (%s layout, %d us load per %d ms on each core):",
+                 TASK_LAYOUT == TASK_LAYOUT_SPLIT ? "split" : "shared",
+                 TASK_LAYOUT_LOAD_BUSY_US, TASK_LAYOUT_LOAD_PERIOD_MS);
+        for (int id = 0; id < TASK_LAYOUT_COUNT; id++) {
+            task_layout_stats_t stats;
+            task_layout_take_stats((task_layout_id_t)id, &stats);
+            if (stats.count == 0) {
+                continue;
+            }
+            ESP_LOGI(TAG, "  %-12s n=%5lu mean=%6lu us max=%7lu us budget=%7lu us late=%lu",
+                     layout[id].name, (unsigned long)stats.count, (unsigned long)stats.mean_us,
+                     (unsigned long)stats.max_us, (unsigned long)layout[id].budget_us,
+                     (unsigned long)stats.over_budget);
+        }
+    }
+}
+#endif
+
+esp_err_t task_layout_init(void)
+{
+    for (int id = 0; id < TASK_LAYOUT_COUNT; id++) {
+        BaseType_t core = task_layout_core((task_layout_id_t)id);
+        ESP_LOGI(TAG, "%-12s core %s priority %2lu budget %7lu us", layout[id].name,
+                 core == TASK_LAYOUT_SENSE_CORE ? "1" : core == TASK_LAYOUT_UI_CORE ? "0" : "-",
+                 (unsigned long)task_layout_priority((task_layout_id_t)id),
+                 (unsigned long)layout[id].budget_us);
+    }
+
+    // app_main cannot move, only change priority; it starts on the UI core
+    handles[TASK_LAYOUT_UI] = xTaskGetCurrentTaskHandle();
+    vTaskPrioritySet(NULL, task_layout_priority(TASK_LAYOUT_UI));
+    if (task_layout_core(TASK_LAYOUT_UI) != tskNO_AFFINITY &&
+        xPortGetCoreID() != task_layout_core(TASK_LAYOUT_UI)) {
+        ESP_LOGW(TAG, "UI loop runs on core %d, layout expects core %d", (int)xPortGetCoreID(),
+                 (int)task_layout_core(TASK_LAYOUT_UI));
+    }
+
+#if TASK_LAYOUT_MEASURE
+    static const char *const load_names[] = { "layout_load0", "layout_load1" };
+    for (BaseType_t core = 0; core < 2; core++) {
+        if (xTaskCreatePinnedToCore(task_layout_load_task, load_names[core], 2048, NULL,
+                                    TASK_LAYOUT_LOAD_PRIORITY, NULL, core) != pdPASS) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (xTaskCreatePinnedToCore(task_layout_report_task, "layout_report", 3072, NULL,
+                                TASK_LAYOUT_BASE_PRIORITY, NULL, TASK_LAYOUT_UI_CORE) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    ESP_LOGW(TAG, "Measurement mode: synthetic load running on both cores");
+#endif
+    return ESP_OK;
+}
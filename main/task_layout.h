@@ -0,0 +1,172 @@
+/**
+ * @file task_layout.h
+ * @brief Core placement and priorities of every task, with a latency measurement mode
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * One table lists each task's stack, latency budget (the worst-case
+ * response it must meet) and core. Two layouts can be built:
+ *
+ * - TASK_LAYOUT_SPLIT (default): heater control, ADC sampling, keypad
+ *   scanning and the monitoring task are pinned to the sensing core; the
+ *   UI loop in app_main (which also drives the LCD bus), the flash writer,
+ *   the telemetry sender and the esp_timer task stay on the other. Priorities are
+ *   deadline-monotonic: a task runs one level above every task with a
+ *   looser budget.
+ * - TASK_LAYOUT_SHARED: the previous layout, kept for comparison: no core
+ *   affinity and the priorities the tasks used to be created with.
+ *
+ * With TASK_LAYOUT_MEASURE set to 1, each task records its response time
+ * (release to running), a busy-looping load task runs on each core, and
+ * a report of count / mean / worst / over-budget per task is logged every
+ * TASK_LAYOUT_REPORT_MS. Build once with each layout to compare them. The
+ * hooks compile to nothing when the mode is off.
+ */
+
+#ifndef TASK_LAYOUT_H
+#define TASK_LAYOUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TASK_LAYOUT_SHARED          0       // Unpinned, legacy priorities
+#define TASK_LAYOUT_SPLIT           1       // Sensing core / UI core, derived priorities
+
+#ifndef TASK_LAYOUT
+#define TASK_LAYOUT                 TASK_LAYOUT_SPLIT
+#endif
+
+#define TASK_LAYOUT_SENSE_CORE      1       // APP CPU: control, sampling, scanning
+#define TASK_LAYOUT_UI_CORE         0       // PRO CPU: app_main runs here from boot
+#define TASK_LAYOUT_BASE_PRIORITY   2       // Priority of the loosest budget
+
+#ifndef TASK_LAYOUT_MEASURE
+#define TASK_LAYOUT_MEASURE         0       // 1: synthetic load and response time reports
+#endif
+
+#define TASK_LAYOUT_REPORT_MS       5000    // Measurement report period
+#define TASK_LAYOUT_LOAD_PERIOD_MS  10      // Load task cycle
+#define TASK_LAYOUT_LOAD_BUSY_US    5000    // Busy part of each cycle (50 % of one core)
+#define TASK_LAYOUT_LOAD_PRIORITY   3       // A background job above the flash writer
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Tasks in the layout
+ */
+typedef enum {
+    TASK_LAYOUT_HEATER = 0,     /**< heater_ctrl: 50 Hz control step */
+    TASK_LAYOUT_SAMPLER,        /**< adc_sampler: drains ADC DMA frames */
+    TASK_LAYOUT_SCAN,           /**< matrix_scan: 10 ms keypad scan */
+    TASK_LAYOUT_UI,             /**< main: UI loop and LCD (created by ESP-IDF) */
+    TASK_LAYOUT_MONITOR,        /**< temp_monitor: 500 ms readings and alarms */
+    TASK_LAYOUT_SESSION_LOG,    /**< session_log: flash writer */
+    TASK_LAYOUT_TELEMETRY,      /**< telemetry: drains the telemetry ring to the link */
+    TASK_LAYOUT_COUNT
+} task_layout_id_t;
+
+/**
+ * @brief One task's placement
+ */
+typedef struct {
+    const char *name;
+    uint32_t stack;             /**< Bytes (0: created outside the layout) */
+    uint32_t budget_us;         /**< Worst-case response the task must meet */
+    BaseType_t core;            /**< Core in TASK_LAYOUT_SPLIT */
+    UBaseType_t shared_priority; /**< Priority in TASK_LAYOUT_SHARED */
+} task_layout_entry_t;
+
+/**
+ * @brief Response times of one task since the last report
+ */
+typedef struct {
+    uint32_t count;
+    uint32_t mean_us;
+    uint32_t max_us;
+    uint32_t over_budget;       /**< Responses slower than budget_us */
+} task_layout_stats_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Table entry of a task
+ */
+const task_layout_entry_t *task_layout_entry(task_layout_id_t id);
+
+/**
+ * @brief Priority of a task in the built layout
+ */
+UBaseType_t task_layout_priority(task_layout_id_t id);
+
+/**
+ * @brief Core of a task in the built layout (tskNO_AFFINITY when shared)
+ */
+BaseType_t task_layout_core(task_layout_id_t id);
+
+/**
+ * @brief Create a task with its name, stack, priority and core from the layout
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG for a task created outside the layout,
+ *         ESP_ERR_NO_MEM if the task cannot be created
+ */
+esp_err_t task_layout_create(task_layout_id_t id, TaskFunction_t function, void *arg,
+                             TaskHandle_t *handle);
+
+/**
+ * @brief Handle of a created task (the UI entry after task_layout_init()), or NULL
+ */
+TaskHandle_t task_layout_handle(task_layout_id_t id);
+
+/**
+ * @brief Log the layout, give the calling task (app_main) the UI priority,
+ *        and in measurement mode start the load and report tasks
+ */
+esp_err_t task_layout_init(void);
+
+#if TASK_LAYOUT_MEASURE
+/**
+ * @brief Mark the event that releases a task (ISR context)
+ */
+void task_layout_release_from_isr(task_layout_id_t id);
+
+/**
+ * @brief The task runs: record the time since its last release
+ */
+void task_layout_note_wake(task_layout_id_t id);
+
+/**
+ * @brief The task runs: record the time since a release it timestamped itself
+ */
+void task_layout_note_response(task_layout_id_t id, int64_t released_us);
+
+/**
+ * @brief A periodic task runs: record how late it is on its period grid
+ */
+void task_layout_note_period(task_layout_id_t id, uint32_t period_us);
+
+/**
+ * @brief Read and restart a task's response statistics
+ */
+void task_layout_take_stats(task_layout_id_t id, task_layout_stats_t *stats);
+#else
+static inline void task_layout_release_from_isr(task_layout_id_t id) {}
+static inline void task_layout_note_wake(task_layout_id_t id) {}
+static inline void task_layout_note_response(task_layout_id_t id, int64_t released_us) {}
+static inline void task_layout_note_period(task_layout_id_t id, uint32_t period_us) {}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TASK_LAYOUT_H */
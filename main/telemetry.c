@@ -0,0 +1,372 @@
+/**
+ * @file telemetry.c
+ * @brief Binary telemetry stream over a UART or the USB Serial/JTAG port
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_pm.h"
+#if CONFIG_GRILL_TELEMETRY_USB_SERIAL_JTAG
+#include "driver/usb_serial_jtag.h"
+#else
+#include "driver/uart.h"
+#endif
+#include "telemetry.h"
+#include "task_layout.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TELEMETRY_RING_MASK         (TELEMETRY_RING_BYTES - 1)
+#define TELEMETRY_UART_RX_BYTES     256     // The driver needs an RX buffer even for TX only
+
+_Static_assert(TELEMETRY_PRIO_COUNT == TELEMETRY_SYNC_PRIORITIES, "SYNC carries one drop counter per priority");
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *TAG = "TELEMETRY";
+
+// Free space each priority must leave in the ring after its record
+static const uint32_t ring_reserve[TELEMETRY_PRIO_COUNT] = {
+    [TELEMETRY_PRIO_LOW] = TELEMETRY_RING_BYTES / 2,
+    [TELEMETRY_PRIO_NORMAL] = TELEMETRY_RING_BYTES / 4,
+    [TELEMETRY_PRIO_CRITICAL] = 0,
+};
+
+static uint8_t ring[TELEMETRY_RING_BYTES];
+static uint32_t ring_head = 0;          // Bytes ever queued (producers)
+static uint32_t ring_tail = 0;          // Bytes ever handed to the transport (TX task)
+static uint8_t next_seq = 0;
+static int64_t last_record_us = 0;
+static int64_t last_sync_us = 0;
+static bool sync_pending = true;        // First record, or records dropped since the last SYNC
+static uint32_t ring_generation = 0;    // Bumped by every commit and drop (producers' snapshot check)
+static telemetry_stats_t stats;
+static portMUX_TYPE ring_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static TaskHandle_t tx_task_handle = NULL;
+static esp_pm_lock_handle_t tx_pm_lock = NULL;  // NULL without CONFIG_PM_ENABLE
+
+/* ==================== IMPLEMENTATION ==================== */
+
+#if CONFIG_GRILL_TELEMETRY
+#if CONFIG_GRILL_TELEMETRY_USB_SERIAL_JTAG
+static esp_err_t transport_init(void)
+{
+    usb_serial_jtag_driver_config_t config = {
+        .tx_buffer_size = TELEMETRY_TX_BUFFER_BYTES,
+        .rx_buffer_size = TELEMETRY_UART_RX_BYTES,
+    };
+    return usb_serial_jtag_driver_install(&config);
+}
+
+/**
+ * @brief Bytes accepted; without a host reading the port the rest is lost
+ */
+static size_t transport_write(const uint8_t *data, size_t len)
+{
+    int written = usb_serial_jtag_write_bytes(data, len, pdMS_TO_TICKS(TELEMETRY_USB_TIMEOUT_MS));
+    return written > 0 ? (size_t)written : 0;
+}
+
+static void transport_wait_done(void)
+{
+    // The USB peripheral sends from its own FIFO once the driver has handed it over
+}
+#else
+static esp_err_t transport_init(void)
+{
+    const uart_config_t config = {
+        .baud_rate = CONFIG_GRILL_TELEMETRY_UART_BAUD,
+        .data_bits = UART_DATA_8_BITS,
+        .parity = UART_PARITY_DISABLE,
+        .stop_bits = UART_STOP_BITS_1,
+        .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+        .source_clk = UART_SCLK_XTAL,   // Baud rate unaffected by frequency scaling
+    };
+    esp_err_t ret = uart_driver_install(CONFIG_GRILL_TELEMETRY_UART_NUM, TELEMETRY_UART_RX_BYTES,
+                                        TELEMETRY_TX_BUFFER_BYTES, 0, NULL, 0);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    ret = uart_param_config(CONFIG_GRILL_TELEMETRY_UART_NUM, &config);
+    if (ret == ESP_OK) {
+        ret = uart_set_pin(CONFIG_GRILL_TELEMETRY_UART_NUM, CONFIG_GRILL_TELEMETRY_UART_TX_GPIO,
+                           UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    }
+    if (ret != ESP_OK) {
+        uart_driver_delete(CONFIG_GRILL_TELEMETRY_UART_NUM);
+    }
+    return ret;
+}
+
+/**
+ * @brief Blocks while the driver's TX buffer is full: the ring absorbs the wait
+ */
+static size_t transport_write(const uint8_t *data, size_t len)
+{
+    int written = uart_write_bytes(CONFIG_GRILL_TELEMETRY_UART_NUM, data, len);
+    return written > 0 ? (size_t)written : 0;
+}
+
+static void transport_wait_done(void)
+{
+    uart_wait_tx_done(CONFIG_GRILL_TELEMETRY_UART_NUM, portMAX_DELAY);
+}
+#endif
+
+/**
+ * @brief TX task: drain the ring whenever a producer finds it empty
+ */
+static void telemetry_tx_task(void *pvParameters)
+{
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        if (tx_pm_lock != NULL) {
+            esp_pm_lock_acquire(tx_pm_lock);
+        }
+
+        while (1) {
+            // Bytes between tail and head are never touched by producers
+            portENTER_CRITICAL(&ring_lock);
+            uint32_t used = ring_head - ring_tail;
+            uint32_t start = ring_tail & TELEMETRY_RING_MASK;
+            portEXIT_CRITICAL(&ring_lock);
+            if (used == 0) {
+                break;
+            }
+            uint32_t span = TELEMETRY_RING_BYTES - start;
+            if (span > used) {
+                span = used;
+            }
+
+            size_t sent = transport_write(&ring[start], span);
+
+            portENTER_CRITICAL(&ring_lock);
+            ring_tail += span;
+            stats.tx_writes++;
+            stats.bytes_sent += sent;
+            stats.bytes_lost += span - sent;
+            portEXIT_CRITICAL(&ring_lock);
+        }
+
+        // The last bytes leave the FIFO before light sleep may stop the clock
+        transport_wait_done();
+        if (tx_pm_lock != NULL) {
+            esp_pm_lock_release(tx_pm_lock);
+        }
+    }
+}
+#endif
+
+esp_err_t telemetry_init(void)
+{
+#if CONFIG_GRILL_TELEMETRY
+    if (tx_task_handle != NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = transport_init();
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to install the transport: %s", esp_err_to_name(ret));
+        return ret;
+    }
+    // Without CONFIG_PM_ENABLE there is nothing to hold: tx_pm_lock stays NULL
+    if (esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "telemetry", &tx_pm_lock) != ESP_OK) {
+        tx_pm_lock = NULL;
+    }
+    ret = task_layout_create(TASK_LAYOUT_TELEMETRY, telemetry_tx_task, NULL, &tx_task_handle);
+    if (ret != ESP_OK) {
+        if (tx_pm_lock != NULL) {
+            esp_pm_lock_delete(tx_pm_lock);
+            tx_pm_lock = NULL;
+        }
+        return ret;
+    }
+
+#if CONFIG_GRILL_TELEMETRY_USB_SERIAL_JTAG
+    ESP_LOGI(TAG, "Streaming on USB Serial/JTAG, %d byte ring", TELEMETRY_RING_BYTES);
+#else
+    ESP_LOGI(TAG, "Streaming on UART%d TX GPIO %d at %d baud, %d byte ring",
+             CONFIG_GRILL_TELEMETRY_UART_NUM, CONFIG_GRILL_TELEMETRY_UART_TX_GPIO,
+             CONFIG_GRILL_TELEMETRY_UART_BAUD, TELEMETRY_RING_BYTES);
+#endif
+    return ESP_OK;
+#else
+    ESP_LOGW(TAG, "Enable CONFIG_GRILL_TELEMETRY for the binary telemetry stream");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ * @brief Copy a frame in at the head (ring_lock held, room checked)
+ */
+static void ring_put(const uint8_t *frame, size_t len)
+{
+    uint32_t start = ring_head & TELEMETRY_RING_MASK;
+    size_t first = TELEMETRY_RING_BYTES - start;
+
+    if (first > len) {
+        first = len;
+    }
+    memcpy(&ring[start], frame, first);
+    memcpy(ring, frame + first, len - first);
+    ring_head += len;
+}
+
+esp_err_t telemetry_send(telemetry_type_t type, telemetry_prio_t prio,
+                         const uint8_t *payload, size_t length)
+{
+    uint8_t frame[TELEMETRY_MAX_FRAME];
+    uint8_t sync_frame[TELEMETRY_MAX_FRAME];
+    uint32_t used;
+    size_t sync_len;
+    size_t len;
+
+    if (tx_task_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (length > TELEMETRY_MAX_PAYLOAD || prio >= TELEMETRY_PRIO_COUNT) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    // Sequence and time deltas follow ring order, but CRC and COBS run with
+    // interrupts enabled: encode from a snapshot, then commit only if no
+    // other record or drop came in between, else renumber and encode again
+    while (1) {
+        uint32_t dropped[TELEMETRY_PRIO_COUNT];
+        portENTER_CRITICAL(&ring_lock);
+        uint32_t generation = ring_generation;
+        uint8_t seq = next_seq;
+        int64_t previous_us = last_record_us;
+        bool need_sync = sync_pending;
+        int64_t sync_due_us = last_sync_us + TELEMETRY_SYNC_MS * 1000LL;
+        memcpy(dropped, stats.dropped, sizeof(dropped));
+        portEXIT_CRITICAL(&ring_lock);
+
+        int64_t now_us = esp_timer_get_time();
+        uint32_t delta_us = 0;
+        sync_len = 0;
+        if (need_sync || now_us >= sync_due_us) {
+            uint8_t sync[TELEMETRY_MAX_VARINT * (1 + TELEMETRY_SYNC_PRIORITIES)];
+            size_t sync_payload = telemetry_put_uvarint(sync, (uint64_t)now_us);
+            for (int i = 0; i < TELEMETRY_PRIO_COUNT; i++) {
+                sync_payload += telemetry_put_uvarint(&sync[sync_payload], dropped[i]);
+            }
+            // A SYNC resets the reader's time base: its own delta only has to fit
+            int64_t sync_delta = now_us - previous_us;
+            sync_len = telemetry_encode_frame(TELEMETRY_SYNC, seq++,
+                                              sync_delta > UINT32_MAX ? UINT32_MAX : (uint32_t)sync_delta,
+                                              sync, sync_payload, sync_frame);
+        } else {
+            delta_us = (uint32_t)(now_us - previous_us);
+        }
+        len = telemetry_encode_frame(type, seq++, delta_us, payload, length, frame);
+
+        portENTER_CRITICAL(&ring_lock);
+        if (ring_generation != generation) {
+            stats.renumbered++;
+            portEXIT_CRITICAL(&ring_lock);
+            continue;
+        }
+        ring_generation++;
+        used = ring_head - ring_tail;
+        if (used + sync_len + len + ring_reserve[prio] > TELEMETRY_RING_BYTES) {
+            stats.dropped[prio]++;
+            sync_pending = true;
+            portEXIT_CRITICAL(&ring_lock);
+            return ESP_ERR_NO_MEM;
+        }
+        if (sync_len > 0) {
+            ring_put(sync_frame, sync_len);
+            last_sync_us = now_us;
+            sync_pending = false;
+            stats.syncs++;
+            stats.records++;
+        }
+        ring_put(frame, len);
+        next_seq = seq;
+        last_record_us = now_us;
+        stats.records++;
+        stats.bytes_queued += sync_len + len;
+        used += sync_len + len;
+        if (used > stats.ring_high_water) {
+            stats.ring_high_water = used;
+        }
+        portEXIT_CRITICAL(&ring_lock);
+        break;
+    }
+
+    // The TX task drains until empty, so only the first record needs to wake it
+    if (used == sync_len + len) {
+        xTaskNotifyGive(tx_task_handle);
+    }
+    return ESP_OK;
+}
+
+esp_err_t telemetry_key(char key, bool pressed, uint8_t row, uint8_t col)
+{
+    const uint8_t payload[] = { (uint8_t)key, pressed ? 1 : 0, (uint8_t)(row << 4 | (col & 0x0F)) };
+
+    return telemetry_send(TELEMETRY_KEY, TELEMETRY_PRIO_CRITICAL, payload, sizeof(payload));
+}
+
+esp_err_t telemetry_zones(const int32_t *centi, size_t count, int32_t setpoint_centi,
+                          int32_t duty)
+{
+    uint8_t payload[TELEMETRY_ZONES_PAYLOAD_MAX];
+    size_t len = telemetry_zones_payload(payload, centi, count, setpoint_centi, duty);
+
+    if (len == 0) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    return telemetry_send(TELEMETRY_ZONES, TELEMETRY_PRIO_LOW, payload, len);
+}
+
+esp_err_t telemetry_alarm(uint8_t type, uint8_t id, uint8_t previous, int32_t centi,
+                          int32_t rate_centi_per_min)
+{
+    uint8_t payload[3 + 2 * 5];
+    size_t len = 0;
+
+    payload[len++] = type;
+    payload[len++] = id;
+    payload[len++] = previous;
+    len += telemetry_put_svarint(&payload[len], centi);
+    len += telemetry_put_svarint(&payload[len], rate_centi_per_min);
+    return telemetry_send(TELEMETRY_ALARM, TELEMETRY_PRIO_CRITICAL, payload, len);
+}
+
+esp_err_t telemetry_counters(const telemetry_counter_id_t *ids, const uint32_t *values,
+                             size_t count)
+{
+    uint8_t payload[1 + TELEMETRY_MAX_COUNTERS * 6];
+    size_t len = 0;
+
+    if (count > TELEMETRY_MAX_COUNTERS) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    payload[len++] = (uint8_t)count;
+    for (size_t i = 0; i < count; i++) {
+        payload[len++] = (uint8_t)ids[i];
+        len += telemetry_put_uvarint(&payload[len], values[i]);
+    }
+    return telemetry_send(TELEMETRY_COUNTERS, TELEMETRY_PRIO_NORMAL, payload, len);
+}
+
+esp_err_t telemetry_get_stats(telemetry_stats_t *out)
+{
+    if (out == NULL || tx_task_handle == NULL) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    portENTER_CRITICAL(&ring_lock);
+    *out = stats;
+    out->ring_used = ring_head - ring_tail;
+    portEXIT_CRITICAL(&ring_lock);
+    return ESP_OK;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file telemetry.h
+ * @brief Binary telemetry stream over a UART or the USB Serial/JTAG port
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Key events, zone readings, alarm transitions and driver counters leave
+ * the board as telemetry_codec.h records. Producers encode a record (CRC and
+ * COBS) with interrupts enabled and only copy it into a RAM ring under a
+ * spinlock; if another record or a drop got in between, the record is
+ * renumbered and encoded again. A producer returns at once; a low-priority
+ * task drains the ring into the transport and is the only one that ever
+ * waits on it.
+ *
+ * When the link cannot keep up the ring fills, and records are dropped by
+ * priority rather than in arrival order. A record is admitted only if the
+ * ring keeps its priority's reserve free afterwards:
+ *
+ * - TELEMETRY_PRIO_LOW (zone readings): half the ring
+ * - TELEMETRY_PRIO_NORMAL (counters): a quarter
+ * - TELEMETRY_PRIO_CRITICAL (keys, alarms, SYNC): nothing
+ *
+ * so periodic data gives way long before an event is lost. Drops are
+ * counted per priority and reported in the next SYNC record, which the
+ * sender emits before the first record after a drop.
+ *
+ * The transport is chosen in menuconfig ("Hamburger Grill" > "Telemetry"):
+ * a spare UART at CONFIG_GRILL_TELEMETRY_UART_BAUD (default UART1 TX on
+ * GPIO 15, to a USB-serial adapter) or the chip's USB Serial/JTAG CDC port.
+ * The TX task holds a "telemetry" NO_LIGHT_SLEEP lock only while bytes are
+ * in flight. On the Linux host build the UART is a pty
+ * (host/uart_fake.c), read by host/telemetry_decode.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "sdkconfig.h"
+#include "telemetry_codec.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TELEMETRY_RING_BYTES        4096    // Power of two: about 45 ms of a 921600 baud link
+#define TELEMETRY_TX_BUFFER_BYTES   1024    // Transport driver TX buffer
+#define TELEMETRY_USB_TIMEOUT_MS    20      // USB write wait before bytes count as lost
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Drop priority of a record
+ */
+typedef enum {
+    TELEMETRY_PRIO_LOW = 0,     /**< Periodic samples: dropped first */
+    TELEMETRY_PRIO_NORMAL,      /**< Counters */
+    TELEMETRY_PRIO_CRITICAL,    /**< Events: dropped only when the ring is full */
+    TELEMETRY_PRIO_COUNT
+} telemetry_prio_t;
+
+/**
+ * @brief Sender counters since telemetry_init()
+ */
+typedef struct {
+    uint32_t records;           /**< Records queued, SYNCs included */
+    uint32_t syncs;
+    uint32_t dropped[TELEMETRY_PRIO_COUNT];  /**< Records refused by priority */
+    uint64_t bytes_queued;
+    uint64_t bytes_sent;        /**< Accepted by the transport */
+    uint32_t bytes_lost;        /**< Refused by the transport (USB host not reading) */
+    uint32_t tx_writes;         /**< Transport write calls */
+    uint32_t ring_used;         /**< Bytes waiting now */
+    uint32_t ring_high_water;   /**< Most bytes ever waiting */
+    uint32_t renumbered;        /**< Records encoded again after another got in first */
+} telemetry_stats_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Install the transport and start the TX task
+ *
+ * @return ESP_OK on success
+ * @return ESP_ERR_NOT_SUPPORTED without CONFIG_GRILL_TELEMETRY
+ * @return ESP_ERR_INVALID_STATE if already running
+ * @return ESP_ERR_NO_MEM if the task cannot be created
+ * @return Driver errors from installing the transport
+ */
+esp_err_t telemetry_init(void);
+
+/**
+ * @brief Queue one record (any task, never blocks)
+ *
+ * @param type Record type
+ * @param prio Drop priority
+ * @param payload Payload bytes (up to TELEMETRY_MAX_PAYLOAD)
+ * @param length Payload length
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_STATE if telemetry is not running
+ * @return ESP_ERR_INVALID_SIZE if the payload is too long
+ * @return ESP_ERR_NO_MEM if the record was dropped
+ */
+esp_err_t telemetry_send(telemetry_type_t type, telemetry_prio_t prio,
+                         const uint8_t *payload, size_t length);
+
+/**
+ * @brief Key press or release (critical)
+ */
+esp_err_t telemetry_key(char key, bool pressed, uint8_t row, uint8_t col);
+
+/**
+ * @brief Zone readings in centi-degrees (low priority)
+ *
+ * @param centi Readings, TELEMETRY_NO_VALUE for a zone without one
+ * @param count Zones (up to TELEMETRY_MAX_ZONES)
+ * @param setpoint_centi Heater setpoint, TELEMETRY_NO_VALUE when off
+ * @param duty Heater duty in 0.01 %
+ */
+esp_err_t telemetry_zones(const int32_t *centi, size_t count, int32_t setpoint_centi,
+                          int32_t duty);
+
+/**
+ * @brief Alarm-engine event (critical; fields of temp_alarm_event_t)
+ *
+ * @param rate_centi_per_min TELEMETRY_NO_VALUE when no rate is known
+ */
+esp_err_t telemetry_alarm(uint8_t type, uint8_t id, uint8_t previous, int32_t centi,
+                          int32_t rate_centi_per_min);
+
+/**
+ * @brief Cumulative driver counters (normal priority)
+ *
+ * @param ids Counter ids
+ * @param values Counter values
+ * @param count Pairs (up to TELEMETRY_MAX_COUNTERS)
+ */
+esp_err_t telemetry_counters(const telemetry_counter_id_t *ids, const uint32_t *values,
+                             size_t count);
+
+/**
+ * @brief Copy the sender counters
+ *
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if telemetry is not running
+ */
+esp_err_t telemetry_get_stats(telemetry_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_H */
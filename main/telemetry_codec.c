@@ -0,0 +1,267 @@
+/**
+ * @file telemetry_codec.c
+ * @brief Binary telemetry records: COBS framing, varints and stream decoding
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "crc32.h"
+#include "telemetry_codec.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TELEMETRY_VERSION_SHIFT     5
+#define TELEMETRY_TYPE_MASK         0x1F
+#define TELEMETRY_CRC_BYTES         4
+#define TELEMETRY_MIN_RECORD        (1 + 1 + 1 + TELEMETRY_CRC_BYTES)
+
+/* ==================== GLOBAL VARIABLES ==================== */
+
+static const char *const type_names[TELEMETRY_TYPE_COUNT] = {
+    [TELEMETRY_SYNC] = "sync",
+    [TELEMETRY_KEY] = "key",
+    [TELEMETRY_ZONES] = "zones",
+    [TELEMETRY_ALARM] = "alarm",
+    [TELEMETRY_COUNTERS] = "counters",
+};
+
+static const char *const counter_names[TELEMETRY_COUNTER_COUNT] = {
+    [TELEMETRY_COUNTER_KEY_PRESSES] = "key_presses",
+    [TELEMETRY_COUNTER_KEY_OVERFLOWS] = "key_overflows",
+    [TELEMETRY_COUNTER_ADC_FRAMES] = "adc_frames",
+    [TELEMETRY_COUNTER_ADC_READINGS] = "adc_readings",
+    [TELEMETRY_COUNTER_ADC_OVERFLOWS] = "adc_overflows",
+    [TELEMETRY_COUNTER_HEATER_STEPS] = "heater_steps",
+    [TELEMETRY_COUNTER_HEATER_OVERRUNS] = "heater_overruns",
+    [TELEMETRY_COUNTER_HEATER_FAULTS] = "heater_faults",
+    [TELEMETRY_COUNTER_SLEEP_WAKEUPS] = "sleep_wakeups",
+    [TELEMETRY_COUNTER_SLEEP_MS] = "sleep_ms",
+    [TELEMETRY_COUNTER_TX_BYTES] = "tx_bytes",
+};
+
+/* ==================== IMPLEMENTATION ==================== */
+
+size_t telemetry_put_uvarint(uint8_t *dst, uint64_t value)
+{
+    size_t len = 0;
+
+    while (value >= 0x80) {
+        dst[len++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    dst[len++] = (uint8_t)value;
+    return len;
+}
+
+size_t telemetry_put_svarint(uint8_t *dst, int64_t value)
+{
+    return telemetry_put_uvarint(dst, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+size_t telemetry_get_uvarint(const uint8_t *src, size_t len, uint64_t *value)
+{
+    uint64_t result = 0;
+
+    for (size_t i = 0; i < len && i < TELEMETRY_MAX_VARINT; i++) {
+        result |= (uint64_t)(src[i] & 0x7F) << (7 * i);
+        if ((src[i] & 0x80) == 0) {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+size_t telemetry_get_svarint(const uint8_t *src, size_t len, int64_t *value)
+{
+    uint64_t zigzag;
+    size_t used = telemetry_get_uvarint(src, len, &zigzag);
+
+    if (used > 0) {
+        *value = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+    }
+    return used;
+}
+
+size_t telemetry_cobs_encode(const uint8_t *src, size_t len, uint8_t *dst)
+{
+    size_t code_at = 0;         // Where the current block's code byte goes
+    size_t out = 1;
+    uint8_t code = 1;           // Block length + 1
+
+    for (size_t i = 0; i < len; i++) {
+        if (src[i] != 0) {
+            dst[out++] = src[i];
+            code++;
+        }
+        if (src[i] == 0 || code == 0xFF) {
+            dst[code_at] = code;
+            code_at = out++;
+            code = 1;
+        }
+    }
+    dst[code_at] = code;
+    return out;
+}
+
+size_t telemetry_cobs_decode(const uint8_t *src, size_t len, uint8_t *dst)
+{
+    size_t in = 0;
+    size_t out = 0;
+
+    while (in < len) {
+        uint8_t code = src[in++];
+        if (code == 0 || in + code - 1 > len) {
+            return 0;
+        }
+        for (uint8_t i = 1; i < code; i++) {
+            if (src[in] == 0) {
+                return 0;
+            }
+            dst[out++] = src[in++];
+        }
+        // A full block (0xFF) carries no zero, nor does the end of the data
+        if (code != 0xFF && in < len) {
+            dst[out++] = 0;
+        }
+    }
+    return out;
+}
+
+size_t telemetry_zones_payload(uint8_t *payload, const int32_t *centi, size_t count,
+                               int32_t setpoint_centi, int32_t duty)
+{
+    size_t len = 0;
+
+    if (count > TELEMETRY_MAX_ZONES) {
+        return 0;
+    }
+    payload[len++] = (uint8_t)count;
+    for (size_t zone = 0; zone < count; zone++) {
+        len += telemetry_put_svarint(&payload[len], centi[zone]);
+    }
+    len += telemetry_put_svarint(&payload[len], setpoint_centi);
+    len += telemetry_put_svarint(&payload[len], duty);
+    return len;
+}
+
+size_t telemetry_encode_frame(uint8_t type, uint8_t seq, uint32_t delta_us,
+                              const uint8_t *payload, size_t length, uint8_t *frame)
+{
+    uint8_t record[TELEMETRY_MAX_RECORD];
+    size_t len = 0;
+
+    if (length > TELEMETRY_MAX_PAYLOAD || type > TELEMETRY_TYPE_MASK) {
+        return 0;
+    }
+    record[len++] = (uint8_t)(TELEMETRY_VERSION << TELEMETRY_VERSION_SHIFT | type);
+    record[len++] = seq;
+    len += telemetry_put_uvarint(&record[len], delta_us);
+    if (length > 0) {
+        memcpy(&record[len], payload, length);
+        len += length;
+    }
+    uint32_t crc = crc32_update(0, record, len);
+    for (int i = 0; i < TELEMETRY_CRC_BYTES; i++) {
+        record[len++] = (uint8_t)(crc >> (8 * i));
+    }
+
+    size_t frame_len = telemetry_cobs_encode(record, len, frame);
+    frame[frame_len++] = 0;
+    return frame_len;
+}
+
+esp_err_t telemetry_decode_frame(uint8_t *frame, size_t len, telemetry_record_t *record)
+{
+    if (len > TELEMETRY_MAX_FRAME) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    size_t record_len = telemetry_cobs_decode(frame, len, frame);
+    if (record_len < TELEMETRY_MIN_RECORD) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+
+    size_t body_len = record_len - TELEMETRY_CRC_BYTES;
+    uint32_t crc = 0;
+    for (int i = 0; i < TELEMETRY_CRC_BYTES; i++) {
+        crc |= (uint32_t)frame[body_len + i] << (8 * i);
+    }
+    if (crc32_update(0, frame, body_len) != crc) {
+        return ESP_ERR_INVALID_CRC;
+    }
+
+    record->version = frame[0] >> TELEMETRY_VERSION_SHIFT;
+    record->type = frame[0] & TELEMETRY_TYPE_MASK;
+    record->seq = frame[1];
+    if (record->version != TELEMETRY_VERSION) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    uint64_t delta;
+    size_t used = telemetry_get_uvarint(&frame[2], body_len - 2, &delta);
+    if (used == 0 || delta > UINT32_MAX) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    record->delta_us = (uint32_t)delta;
+    record->payload = &frame[2 + used];
+    record->length = body_len - 2 - used;
+    return ESP_OK;
+}
+
+void telemetry_stream_init(telemetry_stream_t *stream)
+{
+    memset(stream, 0, sizeof(*stream));
+}
+
+esp_err_t telemetry_stream_feed(telemetry_stream_t *stream, uint8_t *frame, size_t len,
+                                telemetry_record_t *record, int64_t *time_us)
+{
+    *time_us = -1;
+    esp_err_t ret = telemetry_decode_frame(frame, len, record);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_VERSION) {
+        stream->bad_frames++;
+        stream->synced = false;
+        return ret;
+    }
+
+    // Records of an unknown version are still numbered: the sequence stays checkable
+    if (stream->records + stream->unknown_version > 0) {
+        uint8_t missing = (uint8_t)(record->seq - stream->next_seq);
+        if (missing != 0) {
+            stream->seq_gaps += missing;
+            stream->synced = false;
+        }
+    }
+    stream->next_seq = (uint8_t)(record->seq + 1);
+    if (ret != ESP_OK) {
+        stream->unknown_version++;
+        stream->synced = false;     // Its delta is unreadable, so later times would be off
+        return ret;
+    }
+    stream->records++;
+
+    uint64_t sync_us;
+    if (record->type == TELEMETRY_SYNC &&
+        telemetry_get_uvarint(record->payload, record->length, &sync_us) > 0) {
+        stream->time_us = sync_us;
+        stream->synced = true;
+    } else if (stream->synced) {
+        stream->time_us += record->delta_us;
+    } else {
+        stream->unsynced++;
+        return ESP_OK;
+    }
+    *time_us = (int64_t)stream->time_us;
+    return ESP_OK;
+}
+
+const char *telemetry_type_name(uint8_t type)
+{
+    return type < TELEMETRY_TYPE_COUNT ? type_names[type] : "?";
+}
+
+const char *telemetry_counter_name(uint8_t id)
+{
+    return id < TELEMETRY_COUNTER_COUNT ? counter_names[id] : "?";
+}
@@ -0,0 +1,221 @@
+/**
+ * @file telemetry_codec.h
+ * @brief Binary telemetry records: COBS framing, varints and stream decoding
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Every record is one COBS-encoded frame ended by a zero byte, so a reader
+ * that starts mid-stream or loses bytes resynchronizes at the next zero.
+ * Before COBS a record is:
+ *
+ *   | version:3 type:5 | seq | delta_us (varint) | payload ... | crc32 (LE) |
+ *
+ * - seq counts records modulo 256; a gap means bytes were lost on the wire
+ *   (records dropped by the sender do not use a number)
+ * - delta_us is the time since the previous record of the stream, so a
+ *   typical timestamp takes two or three bytes
+ * - SYNC records carry the absolute time and the sender's drop counters;
+ *   the sender emits one at start, after drops and at least every
+ *   TELEMETRY_SYNC_MS of traffic. A reader dates records only from a SYNC
+ *   on, and again from the next SYNC after a gap or a bad frame
+ *
+ * Payload integers are LEB128 varints, signed ones zigzag-encoded. A reader
+ * skips records whose version it does not know. Nothing here depends on
+ * ESP-IDF: the firmware encodes, the host tools decode.
+ */
+
+#ifndef TELEMETRY_CODEC_H
+#define TELEMETRY_CODEC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TELEMETRY_VERSION           1
+#define TELEMETRY_SYNC_MS           1000    // Longest stretch of records between SYNCs
+#define TELEMETRY_MAX_PAYLOAD       72
+#define TELEMETRY_MAX_RECORD        (1 + 1 + 5 + TELEMETRY_MAX_PAYLOAD + 4)
+// COBS adds one byte per 254 and the leading code byte; then the zero delimiter
+#define TELEMETRY_MAX_FRAME         (TELEMETRY_MAX_RECORD + TELEMETRY_MAX_RECORD / 254 + 2)
+#define TELEMETRY_MAX_VARINT        10      // Bytes of a 64-bit varint
+#define TELEMETRY_MAX_ZONES         8
+#define TELEMETRY_ZONES_PAYLOAD_MAX (1 + (TELEMETRY_MAX_ZONES + 2) * 5)    // 32-bit zigzag varints
+#define TELEMETRY_MAX_COUNTERS      ((TELEMETRY_MAX_PAYLOAD - 1) / 6)  // Id byte and a 32-bit varint each
+#define TELEMETRY_NO_VALUE          INT32_MIN   // Zone without a reading, heater off, no rate
+#define TELEMETRY_SYNC_PRIORITIES   3       // Drop counters in a SYNC: low, normal, critical
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Record types (5 bits)
+ */
+typedef enum {
+    TELEMETRY_SYNC = 0,         /**< time_us, dropped per priority (low, normal, critical) */
+    TELEMETRY_KEY,              /**< key char, pressed (0/1), row << 4 | col */
+    TELEMETRY_ZONES,            /**< count, centi per zone, setpoint centi, duty (0.01 %) */
+    TELEMETRY_ALARM,            /**< temp_alarm event: type, id, previous, centi, rate */
+    TELEMETRY_COUNTERS,         /**< count, then (telemetry_counter_id_t, value) pairs */
+    TELEMETRY_TYPE_COUNT
+} telemetry_type_t;
+
+/**
+ * @brief Driver counters carried by TELEMETRY_COUNTERS (cumulative)
+ */
+typedef enum {
+    TELEMETRY_COUNTER_KEY_PRESSES = 0,
+    TELEMETRY_COUNTER_KEY_OVERFLOWS,
+    TELEMETRY_COUNTER_ADC_FRAMES,
+    TELEMETRY_COUNTER_ADC_READINGS,
+    TELEMETRY_COUNTER_ADC_OVERFLOWS,
+    TELEMETRY_COUNTER_HEATER_STEPS,
+    TELEMETRY_COUNTER_HEATER_OVERRUNS,
+    TELEMETRY_COUNTER_HEATER_FAULTS,
+    TELEMETRY_COUNTER_SLEEP_WAKEUPS,
+    TELEMETRY_COUNTER_SLEEP_MS,
+    TELEMETRY_COUNTER_TX_BYTES,
+    TELEMETRY_COUNTER_COUNT
+} telemetry_counter_id_t;
+
+/**
+ * @brief A decoded record (payload points into the caller's buffer)
+ */
+typedef struct {
+    uint8_t version;
+    uint8_t type;               /**< telemetry_type_t */
+    uint8_t seq;
+    uint32_t delta_us;
+    const uint8_t *payload;
+    size_t length;
+} telemetry_record_t;
+
+/**
+ * @brief Reader state: time base and error counts
+ */
+typedef struct {
+    bool synced;                /**< A SYNC was seen and nothing lost since */
+    uint8_t next_seq;
+    uint64_t time_us;           /**< Time of the last record (valid while synced) */
+    uint32_t records;           /**< Frames decoded */
+    uint32_t bad_frames;        /**< CRC, COBS or length errors */
+    uint32_t unknown_version;
+    uint32_t seq_gaps;          /**< Records lost on the wire */
+    uint32_t unsynced;          /**< Records received without a time base */
+} telemetry_stream_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Append an unsigned LEB128 varint
+ *
+ * @return Bytes written (1 to TELEMETRY_MAX_VARINT)
+ */
+size_t telemetry_put_uvarint(uint8_t *dst, uint64_t value);
+
+/**
+ * @brief Append a zigzag-encoded signed varint
+ */
+size_t telemetry_put_svarint(uint8_t *dst, int64_t value);
+
+/**
+ * @brief Read an unsigned varint
+ *
+ * @return Bytes consumed, 0 if truncated or longer than TELEMETRY_MAX_VARINT
+ */
+size_t telemetry_get_uvarint(const uint8_t *src, size_t len, uint64_t *value);
+
+/**
+ * @brief Read a zigzag-encoded signed varint
+ */
+size_t telemetry_get_svarint(const uint8_t *src, size_t len, int64_t *value);
+
+/**
+ * @brief COBS-encode a block (without the delimiter)
+ *
+ * @param dst Room for len + len / 254 + 1 bytes
+ * @return Encoded length
+ */
+size_t telemetry_cobs_encode(const uint8_t *src, size_t len, uint8_t *dst);
+
+/**
+ * @brief Decode a COBS block (delimiter removed); dst may equal src
+ *
+ * @return Decoded length, 0 if the block is malformed
+ */
+size_t telemetry_cobs_decode(const uint8_t *src, size_t len, uint8_t *dst);
+
+/**
+ * @brief Build a TELEMETRY_ZONES payload
+ *
+ * @param payload Room for TELEMETRY_ZONES_PAYLOAD_MAX bytes
+ * @param centi Readings, TELEMETRY_NO_VALUE for a zone without one
+ * @param count Zones (up to TELEMETRY_MAX_ZONES)
+ * @param setpoint_centi Heater setpoint, TELEMETRY_NO_VALUE when off
+ * @param duty Heater duty in 0.01 %
+ * @return Payload length, 0 if count exceeds TELEMETRY_MAX_ZONES
+ */
+size_t telemetry_zones_payload(uint8_t *payload, const int32_t *centi, size_t count,
+                               int32_t setpoint_centi, int32_t duty);
+
+/**
+ * @brief Build one frame: header, payload, CRC, COBS and the zero delimiter
+ *
+ * @param frame Room for TELEMETRY_MAX_FRAME bytes
+ * @return Frame length, 0 if the payload exceeds TELEMETRY_MAX_PAYLOAD
+ */
+size_t telemetry_encode_frame(uint8_t type, uint8_t seq, uint32_t delta_us,
+                              const uint8_t *payload, size_t length, uint8_t *frame);
+
+/**
+ * @brief Decode one frame in place (delimiter removed)
+ *
+ * @param frame Frame bytes; overwritten with the decoded record
+ * @param len Frame length
+ * @param record Receives the record, payload pointing into frame
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_SIZE if the frame is malformed or too short
+ * @return ESP_ERR_INVALID_CRC on a CRC mismatch
+ * @return ESP_ERR_INVALID_VERSION for a version this reader does not know
+ */
+esp_err_t telemetry_decode_frame(uint8_t *frame, size_t len, telemetry_record_t *record);
+
+/**
+ * @brief Start reading a stream (no time base until the first SYNC)
+ */
+void telemetry_stream_init(telemetry_stream_t *stream);
+
+/**
+ * @brief Decode a frame and date it
+ *
+ * @param stream Reader state
+ * @param frame Frame bytes (delimiter removed), decoded in place
+ * @param len Frame length
+ * @param record Receives the record
+ * @param time_us Receives the record time, or -1 without a time base
+ * @return Result of telemetry_decode_frame()
+ */
+esp_err_t telemetry_stream_feed(telemetry_stream_t *stream, uint8_t *frame, size_t len,
+                                telemetry_record_t *record, int64_t *time_us);
+
+/**
+ * @brief Name of a record type ("?" if unknown)
+ */
+const char *telemetry_type_name(uint8_t type);
+
+/**
+ * @brief Name of a counter ("?" if unknown)
+ */
+const char *telemetry_counter_name(uint8_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TELEMETRY_CODEC_H */
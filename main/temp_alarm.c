@@ -0,0 +1,156 @@
+/**
+ * @file temp_alarm.c
+ * @brief Band classification and temperature alarms with hysteresis and dwell
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "temp_alarm.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Band the reading counts as, given the committed band's hysteresis
+ *
+ * A committed band [min, max] C covers [min*100, max*100 + 99] centi; the
+ * reading stays in it until it is more than the hysteresis outside that span.
+ */
+static uint8_t effective_band(const temp_alarm_t *alarm, int32_t centi)
+{
+    const uint8_t band = alarm->band;
+
+    if (band < alarm->profile->band_count) {
+        const cook_band_t *b = &alarm->profile->bands[band];
+        if (centi >= b->min_c * 100 - alarm->config.hysteresis_centi &&
+            centi <= b->max_c * 100 + 99 + alarm->config.hysteresis_centi) {
+            return band;
+        }
+    }
+    return cook_profile_classify_centi(alarm->profile, centi);
+}
+
+/**
+ * @brief Advance a debounced condition
+ *
+ * @param trigger Condition state
+ * @param on Raise condition holds
+ * @param off Clear condition holds (on and off are exclusive; neither = hold)
+ * @return true if the active state changed
+ */
+static bool trigger_update(temp_alarm_trigger_t *trigger, bool on, bool off,
+                           int64_t now_ms, uint32_t dwell_ms)
+{
+    bool toward = trigger->active ? off : on;
+
+    if (!toward) {
+        trigger->pending = false;
+        return false;
+    }
+    if (!trigger->pending) {
+        trigger->pending = true;
+        trigger->since_ms = now_ms;
+    }
+    if (now_ms - trigger->since_ms < (int64_t)dwell_ms) {
+        return false;
+    }
+    trigger->active = !trigger->active;
+    trigger->pending = false;
+    return true;
+}
+
+static void emit(temp_alarm_t *alarm, temp_alarm_event_t *events, size_t *count,
+                 temp_alarm_event_type_t type, uint8_t id, uint8_t previous,
+                 int64_t now_ms, int32_t centi, int32_t rate)
+{
+    temp_alarm_event_t *event = &events[(*count)++];
+
+    event->type = (uint8_t)type;
+    event->id = id;
+    event->previous = previous;
+    event->reserved = 0;
+    event->centi = centi;
+    event->rate_centi_per_min = rate;
+    event->time_ms = (uint32_t)now_ms;
+    alarm->events++;
+}
+
+void temp_alarm_init(temp_alarm_t *alarm, const temp_alarm_config_t *config,
+                     const cook_profile_t *profile)
+{
+    memset(alarm, 0, sizeof(*alarm));
+    alarm->config = *config;
+    temp_alarm_set_profile(alarm, profile);
+}
+
+void temp_alarm_set_profile(temp_alarm_t *alarm, const cook_profile_t *profile)
+{
+    alarm->profile = profile;
+    alarm->high_centi = profile->safe_max_c * 100 + 99;
+    alarm->low_centi = profile->safe_min_c * 100;
+    alarm->band = COOK_PROFILE_NO_BAND;
+    alarm->candidate = COOK_PROFILE_NO_BAND;
+}
+
+size_t temp_alarm_update(temp_alarm_t *alarm, int64_t now_ms, int32_t centi,
+                         int32_t rate_centi_per_min, temp_alarm_event_t *events)
+{
+    const temp_alarm_config_t *cfg = &alarm->config;
+    size_t count = 0;
+
+    alarm->samples++;
+
+    // Band: hysteresis around the committed band, then a dwell on the new one.
+    // With no committed band there is no edge to hold on to, so the dwell runs
+    // while the reading is in any band and the band at its end is taken.
+    uint8_t band = effective_band(alarm, centi);
+    bool acquiring = alarm->band == COOK_PROFILE_NO_BAND && band != COOK_PROFILE_NO_BAND &&
+                     alarm->candidate != COOK_PROFILE_NO_BAND;
+    if (band != alarm->band && band != alarm->candidate && !acquiring) {
+        alarm->candidate_since_ms = now_ms;
+    } else if (band != alarm->band &&
+               now_ms - alarm->candidate_since_ms >= (int64_t)cfg->band_dwell_ms) {
+        emit(alarm, events, &count, TEMP_ALARM_EVENT_BAND, band, alarm->band,
+             now_ms, centi, rate_centi_per_min);
+        alarm->band = band;
+    }
+    alarm->candidate = band;
+
+    // Safe-range alarms
+    bool on[TEMP_ALARM_COUNT];
+    bool off[TEMP_ALARM_COUNT];
+    on[TEMP_ALARM_HIGH] = centi > alarm->high_centi;
+    off[TEMP_ALARM_HIGH] = centi <= alarm->high_centi - cfg->hysteresis_centi;
+    on[TEMP_ALARM_LOW] = centi < alarm->low_centi;
+    off[TEMP_ALARM_LOW] = centi >= alarm->low_centi + cfg->hysteresis_centi;
+
+    // Rate alarm; an unknown rate holds the current state
+    if (cfg->rate_centi_per_min > 0 && rate_centi_per_min != TEMP_ALARM_RATE_UNKNOWN) {
+        int32_t magnitude = rate_centi_per_min < 0 ? -rate_centi_per_min : rate_centi_per_min;
+        on[TEMP_ALARM_RATE] = magnitude > cfg->rate_centi_per_min;
+        off[TEMP_ALARM_RATE] = magnitude <= cfg->rate_centi_per_min - cfg->rate_hysteresis;
+    } else {
+        on[TEMP_ALARM_RATE] = false;
+        off[TEMP_ALARM_RATE] = cfg->rate_centi_per_min <= 0;
+    }
+
+    for (int id = 0; id < TEMP_ALARM_COUNT; id++) {
+        temp_alarm_trigger_t *trigger = &alarm->triggers[id];
+        if (trigger_update(trigger, on[id], off[id], now_ms, cfg->alarm_dwell_ms)) {
+            emit(alarm, events, &count,
+                 trigger->active ? TEMP_ALARM_EVENT_RAISED : TEMP_ALARM_EVENT_CLEARED,
+                 (uint8_t)id, 0, now_ms, centi, rate_centi_per_min);
+        }
+    }
+    return count;
+}
+
+const char *temp_alarm_name(temp_alarm_id_t id)
+{
+    switch (id) {
+        case TEMP_ALARM_HIGH: return "TOO HOT";
+        case TEMP_ALARM_LOW:  return "TOO COLD";
+        case TEMP_ALARM_RATE: return "FAST CHANGE";
+        default:              return "UNKNOWN";
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * @file temp_alarm.h
+ * @brief Band classification and temperature alarms with hysteresis and dwell
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * Turns a stream of readings into a stream of state changes. Every reading
+ * goes through temp_alarm_update(), which returns events only when something
+ * actually changed:
+ *
+ * - Band: the reading is classified with the active cook_profile, but the
+ *   current band is kept until the reading is more than hysteresis_centi
+ *   past its edge, and a new band must persist for band_dwell_ms before it
+ *   is reported. A reading hovering on 25/26 C therefore yields no events.
+ *   With no band yet (startup, profile change, back from outside every
+ *   band), the first band is taken once readings have stayed in bands for
+ *   band_dwell_ms.
+ * - HIGH / LOW: reading above / below the profile's safe range, raised after
+ *   alarm_dwell_ms outside it and cleared after alarm_dwell_ms back inside by
+ *   at least hysteresis_centi.
+ * - RATE: |rate of change| above rate_centi_per_min, with its own hysteresis.
+ *   The caller supplies the rate (e.g. the doneness regression slope).
+ *
+ * Event counts depend on real transitions, not on the sample rate. The
+ * module does no locking; one task owns an engine.
+ */
+
+#ifndef TEMP_ALARM_H
+#define TEMP_ALARM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "cook_profile.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TEMP_ALARM_MAX_EVENTS       (1 + TEMP_ALARM_COUNT)  // Most events one update can emit
+#define TEMP_ALARM_RATE_UNKNOWN     INT32_MIN               // Rate argument when no slope is available
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Alarm conditions
+ */
+typedef enum {
+    TEMP_ALARM_HIGH = 0,        /**< Above the profile's safe range */
+    TEMP_ALARM_LOW,             /**< Below the profile's safe range */
+    TEMP_ALARM_RATE,            /**< Changing faster than the rate limit */
+    TEMP_ALARM_COUNT
+} temp_alarm_id_t;
+
+/**
+ * @brief Event kinds
+ */
+typedef enum {
+    TEMP_ALARM_EVENT_BAND = 0,  /**< Committed band changed (id = new band, previous = old) */
+    TEMP_ALARM_EVENT_RAISED,    /**< Alarm became active (id = temp_alarm_id_t) */
+    TEMP_ALARM_EVENT_CLEARED,   /**< Alarm became inactive (id = temp_alarm_id_t) */
+} temp_alarm_event_type_t;
+
+/**
+ * @brief One state change (fixed-size fields, logged as-is)
+ */
+typedef struct {
+    uint8_t type;               /**< temp_alarm_event_type_t */
+    uint8_t id;                 /**< Band index or temp_alarm_id_t */
+    uint8_t previous;           /**< Previous band for band events */
+    uint8_t reserved;
+    int32_t centi;              /**< Reading that completed the transition */
+    int32_t rate_centi_per_min; /**< Rate at that reading (TEMP_ALARM_RATE_UNKNOWN if none) */
+    uint32_t time_ms;           /**< Time of the reading */
+} temp_alarm_event_t;
+
+/**
+ * @brief Engine tuning
+ */
+typedef struct {
+    int32_t hysteresis_centi;   /**< Distance past an edge before a band or alarm changes */
+    uint32_t band_dwell_ms;     /**< Time a new band must persist */
+    uint32_t alarm_dwell_ms;    /**< Time an alarm condition must persist to raise or clear */
+    int32_t rate_centi_per_min; /**< RATE threshold (0 disables the RATE alarm) */
+    int32_t rate_hysteresis;    /**< RATE clears below threshold minus this */
+} temp_alarm_config_t;
+
+/**
+ * @brief Debounced on/off condition
+ */
+typedef struct {
+    bool active;
+    bool pending;               /**< Opposite condition seen, waiting for dwell */
+    int64_t since_ms;           /**< Start of the pending period */
+} temp_alarm_trigger_t;
+
+/**
+ * @brief Engine state
+ */
+typedef struct {
+    temp_alarm_config_t config;
+    const cook_profile_t *profile;
+    int32_t high_centi;         /**< HIGH above this */
+    int32_t low_centi;          /**< LOW below this */
+
+    uint8_t band;               /**< Committed band (COOK_PROFILE_NO_BAND before the first) */
+    uint8_t candidate;          /**< Band waiting for its dwell */
+    int64_t candidate_since_ms;
+
+    temp_alarm_trigger_t triggers[TEMP_ALARM_COUNT];
+
+    uint32_t samples;           /**< Readings processed */
+    uint32_t events;            /**< Events emitted */
+} temp_alarm_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Initialise an engine for a profile
+ *
+ * @param alarm Engine
+ * @param config Tuning (copied)
+ * @param profile Bands and safe range to use
+ */
+void temp_alarm_init(temp_alarm_t *alarm, const temp_alarm_config_t *config,
+                     const cook_profile_t *profile);
+
+/**
+ * @brief Switch profile; the band is re-established from the next readings
+ *
+ * Active alarms stay active and clear through the normal path.
+ */
+void temp_alarm_set_profile(temp_alarm_t *alarm, const cook_profile_t *profile);
+
+/**
+ * @brief Process one reading
+ *
+ * @param alarm Engine
+ * @param now_ms Reading time (monotonic)
+ * @param centi Reading in centi-degrees C
+ * @param rate_centi_per_min Rate of change, or TEMP_ALARM_RATE_UNKNOWN
+ * @param events Receives up to TEMP_ALARM_MAX_EVENTS events
+ * @return Number of events written (0 when nothing changed)
+ */
+size_t temp_alarm_update(temp_alarm_t *alarm, int64_t now_ms, int32_t centi,
+                         int32_t rate_centi_per_min, temp_alarm_event_t *events);
+
+/**
+ * @brief Whether an alarm is currently active
+ */
+static inline bool temp_alarm_is_active(const temp_alarm_t *alarm, temp_alarm_id_t id)
+{
+    return alarm->triggers[id].active;
+}
+
+/**
+ * @brief Short alarm name for logs and the LCD
+ */
+const char *temp_alarm_name(temp_alarm_id_t id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEMP_ALARM_H */
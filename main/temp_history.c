@@ -0,0 +1,171 @@
+/**
+ * @file temp_history.c
+ * @brief Fixed-memory tiered temperature history implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <string.h>
+#include "temp_history.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+static const uint16_t tier_capacity[TEMP_HISTORY_TIER_COUNT] = {
+    TEMP_HISTORY_FULL_POINTS,
+    TEMP_HISTORY_SECOND_POINTS,
+    TEMP_HISTORY_MINUTE_POINTS,
+};
+
+/* ==================== IMPLEMENTATION ==================== */
+
+/**
+ * @brief Rounded mean that also rounds negative sums to nearest
+ */
+static int16_t rounded_mean(int32_t sum, uint16_t count)
+{
+    int32_t half = count / 2;
+    return (int16_t)(sum >= 0 ? (sum + half) / count : (sum - half) / count);
+}
+
+/**
+ * @brief Claim the next slot of a tier and return its index
+ */
+static uint16_t ring_advance(temp_history_ring_t *ring, uint16_t capacity)
+{
+    uint16_t slot = ring->head;
+    ring->head = (uint16_t)((ring->head + 1) % capacity);
+    if (ring->count < capacity) {
+        ring->count++;
+    }
+    return slot;
+}
+
+static void reset_minute_bucket(temp_history_t *history)
+{
+    history->minute_sum = 0;
+    history->minute_valid = 0;
+    history->minute_samples = 0;
+    history->minute_min = INT16_MAX;
+    history->minute_max = INT16_MIN;
+}
+
+void temp_history_init(temp_history_t *history)
+{
+    memset(history, 0, sizeof(*history));
+    reset_minute_bucket(history);
+}
+
+void temp_history_push(temp_history_t *history, int32_t centi)
+{
+    int16_t value;
+
+    // Clamp into int16; INT16_MIN itself is reserved for gaps
+    if (centi == TEMP_HISTORY_GAP) {
+        value = TEMP_HISTORY_GAP;
+    } else if (centi > INT16_MAX) {
+        value = INT16_MAX;
+    } else if (centi <= INT16_MIN) {
+        value = INT16_MIN + 1;
+    } else {
+        value = (int16_t)centi;
+    }
+
+    uint16_t slot = ring_advance(&history->rings[TEMP_HISTORY_TIER_FULL], TEMP_HISTORY_FULL_POINTS);
+    history->full[slot] = value;
+    history->total_samples++;
+
+    if (value != TEMP_HISTORY_GAP) {
+        history->second_sum += value;
+        history->second_valid++;
+        history->minute_sum += value;
+        history->minute_valid++;
+        if (value < history->minute_min) {
+            history->minute_min = value;
+        }
+        if (value > history->minute_max) {
+            history->minute_max = value;
+        }
+    }
+
+    // Close the 1 s bucket
+    if (++history->second_samples == TEMP_HISTORY_SAMPLES_PER_SECOND) {
+        slot = ring_advance(&history->rings[TEMP_HISTORY_TIER_SECONDS], TEMP_HISTORY_SECOND_POINTS);
+        history->seconds[slot] = history->second_valid > 0
+                                 ? rounded_mean(history->second_sum, history->second_valid)
+                                 : TEMP_HISTORY_GAP;
+        history->second_sum = 0;
+        history->second_valid = 0;
+        history->second_samples = 0;
+    }
+
+    // Close the 1 min bucket; min/max come from the raw samples, not the 1 s averages
+    if (++history->minute_samples == TEMP_HISTORY_SAMPLES_PER_MINUTE) {
+        slot = ring_advance(&history->rings[TEMP_HISTORY_TIER_MINUTES], TEMP_HISTORY_MINUTE_POINTS);
+        temp_history_point_t *point = &history->minutes[slot];
+        if (history->minute_valid > 0) {
+            point->min = history->minute_min;
+            point->avg = rounded_mean(history->minute_sum, history->minute_valid);
+            point->max = history->minute_max;
+        } else {
+            point->min = point->avg = point->max = TEMP_HISTORY_GAP;
+        }
+        reset_minute_bucket(history);
+    }
+}
+
+size_t temp_history_count(const temp_history_t *history, temp_history_tier_t tier)
+{
+    if (tier >= TEMP_HISTORY_TIER_COUNT) {
+        return 0;
+    }
+    return history->rings[tier].count;
+}
+
+uint32_t temp_history_period_ms(temp_history_tier_t tier)
+{
+    switch (tier) {
+        case TEMP_HISTORY_TIER_FULL:    return 1000 / TEMP_HISTORY_SAMPLE_HZ;
+        case TEMP_HISTORY_TIER_SECONDS: return 1000;
+        case TEMP_HISTORY_TIER_MINUTES: return 60000;
+        default:                        return 0;
+    }
+}
+
+size_t temp_history_read(const temp_history_t *history, temp_history_tier_t tier,
+                         size_t skip_newest, size_t max_points, temp_history_point_t *out)
+{
+    if (tier >= TEMP_HISTORY_TIER_COUNT || out == NULL) {
+        return 0;
+    }
+
+    const temp_history_ring_t *ring = &history->rings[tier];
+    const uint16_t capacity = tier_capacity[tier];
+    if (skip_newest >= ring->count) {
+        return 0;
+    }
+
+    size_t available = ring->count - skip_newest;
+    size_t n = available < max_points ? available : max_points;
+
+    // Oldest requested point: n + skip_newest slots behind head
+    size_t index = (ring->head + capacity - ((n + skip_newest) % capacity)) % capacity;
+
+    for (size_t i = 0; i < n; i++) {
+        switch (tier) {
+            case TEMP_HISTORY_TIER_FULL:
+                out[i].min = out[i].avg = out[i].max = history->full[index];
+                break;
+            case TEMP_HISTORY_TIER_SECONDS:
+                out[i].min = out[i].avg = out[i].max = history->seconds[index];
+                break;
+            default:
+                out[i] = history->minutes[index];
+                break;
+        }
+        if (++index == capacity) {
+            index = 0;
+        }
+    }
+
+    return n;
+}
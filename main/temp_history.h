@@ -0,0 +1,148 @@
+/**
+ * @file temp_history.h
+ * @brief Fixed-memory tiered temperature history
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * One history per zone, fed at TEMP_HISTORY_SAMPLE_HZ, keeps three rings:
+ * - FULL:    every sample for the last minute
+ * - SECONDS: 1 s averages for the last hour
+ * - MINUTES: 1 min min/avg/max for the last day
+ *
+ * Downsampling is incremental: each push adds the sample to running 1 s and
+ * 1 min accumulators and closes a bucket when it fills, so a push is O(1)
+ * and never rescans older data. Reads index the rings directly (O(1) per
+ * returned point). All storage is inside temp_history_t; its size is a
+ * compile-time constant. Samples are centi-degrees C; TEMP_HISTORY_GAP marks
+ * periods without a reading and is ignored by the aggregates.
+ *
+ * The module does no locking; the caller serialises push and read.
+ */
+
+#ifndef TEMP_HISTORY_H
+#define TEMP_HISTORY_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stddef.h>
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TEMP_HISTORY_SAMPLE_HZ          10      // Push rate the tiers are sized for
+
+#define TEMP_HISTORY_FULL_POINTS        (60 * TEMP_HISTORY_SAMPLE_HZ)   // 1 minute
+#define TEMP_HISTORY_SECOND_POINTS      3600                            // 1 hour
+#define TEMP_HISTORY_MINUTE_POINTS      1440                            // 1 day
+
+#define TEMP_HISTORY_SAMPLES_PER_SECOND TEMP_HISTORY_SAMPLE_HZ
+#define TEMP_HISTORY_SAMPLES_PER_MINUTE (60 * TEMP_HISTORY_SAMPLE_HZ)
+
+/** @brief Sample or bucket without any reading */
+#define TEMP_HISTORY_GAP                INT16_MIN
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief History tiers
+ */
+typedef enum {
+    TEMP_HISTORY_TIER_FULL = 0,
+    TEMP_HISTORY_TIER_SECONDS,
+    TEMP_HISTORY_TIER_MINUTES,
+    TEMP_HISTORY_TIER_COUNT
+} temp_history_tier_t;
+
+/**
+ * @brief One returned point; min == avg == max below the minute tier
+ */
+typedef struct {
+    int16_t min;
+    int16_t avg;
+    int16_t max;
+} temp_history_point_t;
+
+/**
+ * @brief Ring position of one tier
+ */
+typedef struct {
+    uint16_t head;      /**< Next slot to write */
+    uint16_t count;     /**< Valid points */
+} temp_history_ring_t;
+
+/**
+ * @brief Tiered history of one zone
+ */
+typedef struct {
+    int16_t full[TEMP_HISTORY_FULL_POINTS];
+    int16_t seconds[TEMP_HISTORY_SECOND_POINTS];
+    temp_history_point_t minutes[TEMP_HISTORY_MINUTE_POINTS];
+    temp_history_ring_t rings[TEMP_HISTORY_TIER_COUNT];
+
+    // Open 1 s bucket
+    int32_t second_sum;
+    uint16_t second_valid;
+    uint16_t second_samples;
+
+    // Open 1 min bucket
+    int32_t minute_sum;
+    uint16_t minute_valid;
+    uint16_t minute_samples;
+    int16_t minute_min;
+    int16_t minute_max;
+
+    uint32_t total_samples;     /**< Samples pushed since init */
+} temp_history_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Clear a history
+ *
+ * @param history History to initialise
+ */
+void temp_history_init(temp_history_t *history);
+
+/**
+ * @brief Append one sample and update the downsampled tiers
+ *
+ * @param history History
+ * @param centi Temperature in centi-degrees C, or TEMP_HISTORY_GAP
+ */
+void temp_history_push(temp_history_t *history, int32_t centi);
+
+/**
+ * @brief Number of points currently stored in a tier
+ */
+size_t temp_history_count(const temp_history_t *history, temp_history_tier_t tier);
+
+/**
+ * @brief Time covered by one point of a tier, in milliseconds
+ */
+uint32_t temp_history_period_ms(temp_history_tier_t tier);
+
+/**
+ * @brief Read the most recent points of a tier in chronological order
+ *
+ * Returns up to max_points points ending skip_newest points before the newest
+ * one, e.g. skip_newest = 0 and max_points = 60 on the SECONDS tier is the
+ * last minute of 1 s averages.
+ *
+ * @param history History
+ * @param tier Tier to read
+ * @param skip_newest Number of newest points to skip
+ * @param max_points Capacity of out
+ * @param out Destination, oldest point first
+ * @return Number of points written
+ */
+size_t temp_history_read(const temp_history_t *history, temp_history_tier_t tier,
+                         size_t skip_newest, size_t max_points, temp_history_point_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEMP_HISTORY_H */
@@ -0,0 +1,102 @@
+/**
+ * @file temp_lut.c
+ * @brief Raw ADC code to fixed-point temperature lookup table implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include "temp_lut.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+esp_err_t temp_lut_linear_voltage(void *ctx, int raw, int *voltage_mv)
+{
+    (void)ctx;
+    *voltage_mv = (raw * TEMP_LUT_DEFAULT_FULL_SCALE_MV) / (int)(TEMP_LUT_SIZE - 1);
+    return ESP_OK;
+}
+
+esp_err_t temp_lut_build(temp_lut_t *lut, temp_lut_voltage_fn_t to_mv, void *ctx)
+{
+    if (lut == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (to_mv == NULL) {
+        to_mv = temp_lut_linear_voltage;
+    }
+
+    for (int raw = 0; raw < (int)TEMP_LUT_SIZE; raw++) {
+        int mv;
+        esp_err_t ret = to_mv(ctx, raw, &mv);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+
+        float centi = temp_lut_reference_celsius((float)mv) * 100.0f;
+        if (centi > INT16_MAX) {
+            centi = INT16_MAX;
+        } else if (centi < INT16_MIN) {
+            centi = INT16_MIN;
+        }
+        lut->centi[raw] = (int16_t)lroundf(centi);
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t temp_lut_check_accuracy(const temp_lut_t *lut, temp_lut_voltage_fn_t to_mv, void *ctx,
+                                  uint8_t extra_bits, temp_lut_accuracy_t *report)
+{
+    if (lut == NULL || report == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (to_mv == NULL) {
+        to_mv = temp_lut_linear_voltage;
+    }
+
+    const uint32_t steps = 1UL << extra_bits;
+    double sq_sum = 0.0;
+    int mv_low;
+    int mv_high;
+    esp_err_t ret;
+
+    report->codes_checked = 0;
+    report->max_error_c = 0.0f;
+    report->worst_code = 0;
+
+    ret = to_mv(ctx, 0, &mv_high);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    for (int raw = 0; raw < (int)TEMP_LUT_SIZE; raw++) {
+        // Each voltage is converted once and reused as the next lower bound
+        mv_low = mv_high;
+        if (raw < (int)TEMP_LUT_SIZE - 1) {
+            ret = to_mv(ctx, raw + 1, &mv_high);
+            if (ret != ESP_OK) {
+                return ret;
+            }
+        }
+
+        for (uint32_t frac = 0; frac < steps; frac++) {
+            uint32_t code = ((uint32_t)raw << extra_bits) | frac;
+            float mv = mv_low + (mv_high - mv_low) * ((float)frac / (float)steps);
+            float reference = temp_lut_reference_celsius(mv);
+            float table = temp_lut_oversampled_to_centi(lut, code, extra_bits) / 100.0f;
+            float error = fabsf(table - reference);
+
+            sq_sum += (double)error * error;
+            if (error > report->max_error_c) {
+                report->max_error_c = error;
+                report->worst_code = code;
+            }
+            report->codes_checked++;
+        }
+    }
+
+    report->rms_error_c = (float)sqrt(sq_sum / report->codes_checked);
+    return ESP_OK;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file temp_lut.h
+ * @brief Raw ADC code to fixed-point temperature lookup table
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The table is built once at init by running every 12-bit code through the
+ * ADC calibration curve and the sensor equation T = (V + 0.40) / 0.046.
+ * After that a conversion is one load (12-bit codes) or two loads and a
+ * multiply (oversampled codes), with no calibration call and no float math.
+ * Temperatures are in centi-degrees Celsius (2534 = 25.34 C).
+ *
+ * The module has no driver dependencies: voltages come from a callback with
+ * the same shape as adc_cali_raw_to_voltage(), so the host tools can build
+ * and check the table against a model of the calibration curve.
+ */
+
+#ifndef TEMP_LUT_H
+#define TEMP_LUT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define TEMP_LUT_RAW_BITS           12
+#define TEMP_LUT_SIZE               (1U << TEMP_LUT_RAW_BITS)   // One entry per raw code
+
+/** @brief Sensor equation V = 0.046 * T - 0.40 */
+#define TEMP_SENSOR_OFFSET_MV       400.0f
+#define TEMP_SENSOR_SLOPE_MV_PER_C  46.0f
+
+/** @brief Full-scale voltage used when no calibration is available */
+#define TEMP_LUT_DEFAULT_FULL_SCALE_MV  3300
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Raw code to millivolt conversion (adc_cali_raw_to_voltage shape)
+ *
+ * @param ctx User context
+ * @param raw 12-bit raw code
+ * @param voltage_mv Receives the voltage in millivolts
+ * @return ESP_OK on success
+ */
+typedef esp_err_t (*temp_lut_voltage_fn_t)(void *ctx, int raw, int *voltage_mv);
+
+/**
+ * @brief Lookup table, one centi-degree entry per 12-bit code
+ */
+typedef struct {
+    int16_t centi[TEMP_LUT_SIZE];
+} temp_lut_t;
+
+/**
+ * @brief Accuracy of the fixed-point path against the float path
+ */
+typedef struct {
+    uint32_t codes_checked;     /**< Oversampled codes compared */
+    float max_error_c;          /**< Largest absolute error in degrees C */
+    float rms_error_c;          /**< RMS error in degrees C */
+    uint32_t worst_code;        /**< Oversampled code with the largest error */
+} temp_lut_accuracy_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Fill the table from a voltage conversion and the sensor equation
+ *
+ * @param lut Table to fill
+ * @param to_mv Raw code to millivolts; NULL selects temp_lut_linear_voltage()
+ * @param ctx Context passed to to_mv
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG if lut is NULL
+ * @return Error returned by to_mv
+ */
+esp_err_t temp_lut_build(temp_lut_t *lut, temp_lut_voltage_fn_t to_mv, void *ctx);
+
+/**
+ * @brief Uncalibrated conversion: 12-bit code scaled to 3.3 V full scale
+ */
+esp_err_t temp_lut_linear_voltage(void *ctx, int raw, int *voltage_mv);
+
+/**
+ * @brief Float reference path: millivolts to degrees C via the sensor equation
+ */
+static inline float temp_lut_reference_celsius(float voltage_mv)
+{
+    return (voltage_mv + TEMP_SENSOR_OFFSET_MV) / TEMP_SENSOR_SLOPE_MV_PER_C;
+}
+
+/**
+ * @brief Convert a 12-bit raw code
+ *
+ * @param lut Built table
+ * @param raw Raw code (0-4095)
+ * @return Temperature in centi-degrees C
+ */
+static inline int16_t temp_lut_raw_to_centi(const temp_lut_t *lut, uint16_t raw)
+{
+    return lut->centi[raw & (TEMP_LUT_SIZE - 1)];
+}
+
+/**
+ * @brief Convert an oversampled code, interpolating between table entries
+ *
+ * @param lut Built table
+ * @param code Oversampled code, 12 + extra_bits wide
+ * @param extra_bits Fraction bits below the 12-bit code
+ * @return Temperature in centi-degrees C
+ */
+static inline int16_t temp_lut_oversampled_to_centi(const temp_lut_t *lut, uint32_t code,
+                                                    uint8_t extra_bits)
+{
+    uint32_t index = code >> extra_bits;
+    if (index >= TEMP_LUT_SIZE - 1) {
+        return lut->centi[TEMP_LUT_SIZE - 1];
+    }
+
+    int32_t frac = (int32_t)(code & ((1UL << extra_bits) - 1));
+    int32_t low = lut->centi[index];
+    int32_t step = lut->centi[index + 1] - low;
+    int32_t half = extra_bits > 0 ? (1L << (extra_bits - 1)) : 0;
+
+    return (int16_t)(low + ((step * frac + half) >> extra_bits));
+}
+
+/**
+ * @brief Compare the table with the float path over every oversampled code
+ *
+ * The float path is the one the firmware used before the table: interpolate
+ * the calibrated voltage between neighbouring codes, then apply the sensor
+ * equation in float.
+ *
+ * @param lut Built table
+ * @param to_mv Conversion the table was built with (NULL = linear)
+ * @param ctx Context passed to to_mv
+ * @param extra_bits Oversampling bits of the codes to check
+ * @param report Receives the accuracy figures
+ * @return ESP_OK on success
+ * @return ESP_ERR_INVALID_ARG on NULL pointers
+ * @return Error returned by to_mv
+ */
+esp_err_t temp_lut_check_accuracy(const temp_lut_t *lut, temp_lut_voltage_fn_t to_mv, void *ctx,
+                                  uint8_t extra_bits, temp_lut_accuracy_t *report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEMP_LUT_H */
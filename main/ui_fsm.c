@@ -0,0 +1,142 @@
+/**
+ * @file ui_fsm.c
+ * @brief Table-driven UI state machine implementation
+ * @author Mechatronics Engineer
+ * @date October 2026
+ */
+
+#include <stddef.h>
+#include "ui_fsm.h"
+
+/* ==================== IMPLEMENTATION ==================== */
+
+static void trace_push(ui_fsm_t *fsm, int64_t now_ms, uint8_t from, uint8_t event, uint8_t to,
+                       int32_t arg)
+{
+    fsm->trace[fsm->trace_head] = (ui_fsm_trace_entry_t){
+        .time_ms = (uint32_t)now_ms,
+        .arg = arg,
+        .from = from,
+        .event = event,
+        .to = to,
+    };
+    fsm->trace_head = (uint8_t)((fsm->trace_head + 1) % UI_FSM_TRACE_LEN);
+    if (fsm->trace_count < UI_FSM_TRACE_LEN) {
+        fsm->trace_count++;
+    }
+}
+
+/**
+ * @brief Run entry of the current state and arm its timer
+ */
+static void enter_state(ui_fsm_t *fsm, int64_t now_ms)
+{
+    const ui_fsm_state_t *state = &fsm->states[fsm->state];
+
+    fsm->entered_ms = now_ms;
+    if (state->timeout_ms > 0 && fsm->timer.start(state->timeout_ms) != ESP_OK) {
+        // Without a timer the screen would never end; expire it at once
+        fsm->entered_ms = now_ms - state->timeout_ms;
+    }
+    if (state->entry != NULL) {
+        state->entry();
+    }
+    if (state->timeout_ms > 0 && now_ms - fsm->entered_ms >= state->timeout_ms) {
+        ui_fsm_dispatch(fsm, fsm->timeout_event, 0, now_ms);
+    }
+}
+
+esp_err_t ui_fsm_init(ui_fsm_t *fsm, const ui_fsm_state_t *states, uint8_t state_count,
+                      const ui_fsm_transition_t *transitions, size_t transition_count,
+                      const ui_fsm_timer_t *timer, uint8_t timeout_event, uint8_t initial,
+                      int64_t now_ms)
+{
+    if (fsm == NULL || states == NULL || state_count == 0 || state_count >= UI_FSM_ANY_STATE ||
+        initial >= state_count || (transitions == NULL && transition_count > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    bool timed = false;
+    for (uint8_t i = 0; i < state_count; i++) {
+        timed |= states[i].timeout_ms > 0;
+    }
+    if (timed && (timer == NULL || timer->start == NULL || timer->stop == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    for (size_t i = 0; i < transition_count; i++) {
+        if ((transitions[i].from >= state_count && transitions[i].from != UI_FSM_ANY_STATE) ||
+            transitions[i].to >= state_count) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+
+    *fsm = (ui_fsm_t){
+        .states = states,
+        .state_count = state_count,
+        .transitions = transitions,
+        .transition_count = transition_count,
+        .timeout_event = timeout_event,
+        .state = initial,
+    };
+    if (timer != NULL) {
+        fsm->timer = *timer;
+    }
+    enter_state(fsm, now_ms);
+    return ESP_OK;
+}
+
+bool ui_fsm_dispatch(ui_fsm_t *fsm, uint8_t event, int32_t arg, int64_t now_ms)
+{
+    const uint8_t from = fsm->state;
+    const ui_fsm_state_t *state = &fsm->states[from];
+
+    // A timeout belongs to the current visit of a timed state; drop stale ones
+    if (event == fsm->timeout_event &&
+        (state->timeout_ms == 0 || now_ms - fsm->entered_ms < state->timeout_ms)) {
+        fsm->ignored++;
+        trace_push(fsm, now_ms, from, event, UI_FSM_NO_STATE, arg);
+        return false;
+    }
+
+    for (size_t i = 0; i < fsm->transition_count; i++) {
+        const ui_fsm_transition_t *t = &fsm->transitions[i];
+        if ((t->from != from && t->from != UI_FSM_ANY_STATE) || t->event != event) {
+            continue;
+        }
+        if (t->guard != NULL && !t->guard(arg)) {
+            continue;
+        }
+
+        trace_push(fsm, now_ms, from, event, t->to, arg);
+        fsm->taken++;
+        if (state->timeout_ms > 0) {
+            fsm->timer.stop();
+        }
+        if (state->exit != NULL) {
+            state->exit();
+        }
+        if (t->action != NULL) {
+            t->action(arg);
+        }
+        fsm->state = t->to;
+        enter_state(fsm, now_ms);
+        return true;
+    }
+
+    fsm->ignored++;
+    trace_push(fsm, now_ms, from, event, UI_FSM_NO_STATE, arg);
+    return false;
+}
+
+size_t ui_fsm_trace_read(const ui_fsm_t *fsm, ui_fsm_trace_entry_t *out, size_t max)
+{
+    size_t n = fsm->trace_count < max ? fsm->trace_count : max;
+    size_t start = (fsm->trace_head + UI_FSM_TRACE_LEN - fsm->trace_count) % UI_FSM_TRACE_LEN;
+
+    // Oldest first; when max is short, keep the newest n
+    start = (start + (fsm->trace_count - n)) % UI_FSM_TRACE_LEN;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = fsm->trace[(start + i) % UI_FSM_TRACE_LEN];
+    }
+    return n;
+}
@@ -0,0 +1,178 @@
+/**
+ * @file ui_fsm.h
+ * @brief Table-driven state machine for the keypad/LCD user interface
+ * @author Mechatronics Engineer
+ * @date October 2026
+ *
+ * The application describes its screens in two constant tables:
+ *
+ * - states: name, entry and exit actions, and an optional timeout after
+ *   which the timeout event is dispatched (timed screens)
+ * - transitions: (from, event, guard) -> (action, to), searched in order;
+ *   UI_FSM_ANY_STATE matches every state
+ *
+ * A transition runs exit(from), action, entry(to), also when from == to,
+ * so entry actions can own the screen drawing. Leaving a timed state stops
+ * its timer; entering one starts it through the application's timer hooks
+ * (a one-shot esp_timer on the target). A timeout that arrives after its
+ * state was left, or before its time, is ignored rather than acted on.
+ *
+ * Every dispatched event, taken or not, goes into a ring of the last
+ * UI_FSM_TRACE_LEN entries for debugging.
+ *
+ * The engine uses no RTOS or driver calls and is driven from one task.
+ */
+
+#ifndef UI_FSM_H
+#define UI_FSM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==================== INCLUDES ==================== */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+/* ==================== CONFIGURATION CONSTANTS ==================== */
+
+#define UI_FSM_TRACE_LEN            32      // Dispatched events kept for debugging
+#define UI_FSM_ANY_STATE            0xFE    // Transition source matching every state
+#define UI_FSM_NO_STATE             0xFF    // Trace: event did not match a transition
+
+/* ==================== DATA TYPES ==================== */
+
+/**
+ * @brief Guard: return true to allow the transition
+ */
+typedef bool (*ui_fsm_guard_fn_t)(int32_t arg);
+
+/**
+ * @brief Transition action (arg is the event's argument)
+ */
+typedef void (*ui_fsm_action_fn_t)(int32_t arg);
+
+/**
+ * @brief Entry or exit action
+ */
+typedef void (*ui_fsm_state_fn_t)(void);
+
+/**
+ * @brief One state
+ */
+typedef struct {
+    const char *name;
+    ui_fsm_state_fn_t entry;    /**< May be NULL */
+    ui_fsm_state_fn_t exit;     /**< May be NULL */
+    uint32_t timeout_ms;        /**< 0 = no timeout */
+} ui_fsm_state_t;
+
+/**
+ * @brief One transition
+ */
+typedef struct {
+    uint8_t from;               /**< State index or UI_FSM_ANY_STATE */
+    uint8_t event;
+    uint8_t to;
+    ui_fsm_guard_fn_t guard;    /**< May be NULL */
+    ui_fsm_action_fn_t action;  /**< May be NULL */
+} ui_fsm_transition_t;
+
+/**
+ * @brief Timer hooks for timed states
+ */
+typedef struct {
+    esp_err_t (*start)(uint32_t timeout_ms);
+    void (*stop)(void);
+} ui_fsm_timer_t;
+
+/**
+ * @brief Trace entry
+ */
+typedef struct {
+    uint32_t time_ms;
+    int32_t arg;
+    uint8_t from;
+    uint8_t event;
+    uint8_t to;                 /**< UI_FSM_NO_STATE if nothing matched */
+    uint8_t reserved;
+} ui_fsm_trace_entry_t;
+
+/**
+ * @brief Machine
+ */
+typedef struct {
+    const ui_fsm_state_t *states;
+    uint8_t state_count;
+    const ui_fsm_transition_t *transitions;
+    size_t transition_count;
+    ui_fsm_timer_t timer;
+    uint8_t timeout_event;      /**< Event id dispatched when a timed state expires */
+
+    uint8_t state;
+    int64_t entered_ms;         /**< Entry time of the current state */
+    uint32_t taken;             /**< Transitions taken */
+    uint32_t ignored;           /**< Events that matched nothing (or stale timeouts) */
+
+    ui_fsm_trace_entry_t trace[UI_FSM_TRACE_LEN];
+    uint8_t trace_head;         /**< Next slot to write */
+    uint8_t trace_count;
+} ui_fsm_t;
+
+/* ==================== FUNCTION PROTOTYPES ==================== */
+
+/**
+ * @brief Set up a machine and enter the initial state (runs its entry action)
+ *
+ * @param fsm Machine
+ * @param states State table (kept by reference)
+ * @param state_count Entries in the state table (below UI_FSM_ANY_STATE)
+ * @param transitions Transition table (kept by reference)
+ * @param transition_count Entries in the transition table
+ * @param timer Timer hooks (required if any state has a timeout)
+ * @param timeout_event Event id the application dispatches when the timer fires
+ * @param initial Initial state
+ * @param now_ms Current time
+ * @return ESP_OK, or ESP_ERR_INVALID_ARG for an inconsistent table
+ */
+esp_err_t ui_fsm_init(ui_fsm_t *fsm, const ui_fsm_state_t *states, uint8_t state_count,
+                      const ui_fsm_transition_t *transitions, size_t transition_count,
+                      const ui_fsm_timer_t *timer, uint8_t timeout_event, uint8_t initial,
+                      int64_t now_ms);
+
+/**
+ * @brief Dispatch one event
+ *
+ * @param fsm Machine
+ * @param event Event id
+ * @param arg Event argument passed to the guard and action
+ * @param now_ms Current time
+ * @return true if a transition was taken
+ */
+bool ui_fsm_dispatch(ui_fsm_t *fsm, uint8_t event, int32_t arg, int64_t now_ms);
+
+/**
+ * @brief Name of a state ("-" if out of range)
+ */
+static inline const char *ui_fsm_state_name(const ui_fsm_t *fsm, uint8_t state)
+{
+    return state < fsm->state_count ? fsm->states[state].name : "-";
+}
+
+/**
+ * @brief Copy the trace, oldest entry first
+ *
+ * @param fsm Machine
+ * @param out Destination
+ * @param max Capacity of out
+ * @return Entries copied
+ */
+size_t ui_fsm_trace_read(const ui_fsm_t *fsm, ui_fsm_trace_entry_t *out, size_t max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UI_FSM_H */